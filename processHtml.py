@@ -2,11 +2,14 @@
 #!/usr/bin/python
 ###
 # Use this script for creating PROGMEM header files from html files.
-# needs pip install requests
+# HTML is minified and gzip-compressed offline (no external service needed); the header contains
+# the compressed data and an ETag (hash of the content), so the webserver can answer with 304.
 ##
 # html file base names
-import requests
 import argparse
+import gzip
+import hashlib
+import re
 
 def str2bool(v):
     if isinstance(v, bool):
@@ -23,52 +26,57 @@ HTML_FILES = ["management_DE","management_EN", "accesspoint_DE", "accesspoint_EN
 class htmlHeaderProcessor(object):
 
     """
-    Returns a minified HTML string, uses html-minifier.com api.
+    Returns a minified HTML string. Only safe transformations: comments, indentation
+    and empty lines are removed; line-breaks are kept (JavaScript relies on them).
     """
-    def minifyHTML(self, filename):
-        with open('html/' + filename + '.html', 'r') as r:
-            data = r.read()
-            return requests.post('https://html-minifier.com/raw', data=dict(input=data)).text.encode('utf8')
+    def minify_html(self, data):
+        data = re.sub(r'<!--.*?-->', '', data, flags=re.DOTALL)
+        lines = []
+        inScript = False
+        for line in data.split('\n'):
+            line = line.strip()
+            if re.search(r'<script[^>]*>', line) and not re.search(r'src=', line):
+                inScript = True
+            if '</script>' in line:
+                inScript = False
+            if not line:
+                continue
+            if inScript and line.startswith('//'):
+                continue
+            lines.append(line)
+        return '\n'.join(lines)
 
-    def escape_html(self, data):
-        data = data.replace('\n', '\\\n')
-        data = data.replace('\"', '\\"')
-        data = data.replace('\\d', '\\\d')
-        data = data.replace('\\.', '\\\.')
-        data = data.replace('\\^', '\\\\^')
-        data = data.replace('%;', '%%;')
-        return data
+    def compress(self, data):
+        return gzip.compress(data.encode('utf8'), compresslevel=9, mtime=0)
 
-    def html_to_c_header(self, filename):
-        content = ""
-        with open('html/' + filename + '.html', 'r') as r:
+    def html_to_c_header(self, filename, minify=True):
+        with open('html/' + filename + '.html', 'r', encoding='utf8') as r:
             data = r.read()
-            content += self.escape_html(data)
-        return content
-
+        if minify:
+            data = self.minify_html(data)
+        return self.compress(data)
 
     def write_header_file(self, filename, content):
+        varname = filename.split('_')[0]
+        etag = hashlib.sha256(content).hexdigest()[:16]
         with open('src/HTML' + filename + '.h', 'w') as w:
-            varname = filename.split('_')[0]
-            w.write("static const char " + varname + "_HTML[] PROGMEM = \"")
-            w.write(content)
-            w.write("\";")
+            w.write("// Generated by processHtml.py from html/" + filename + ".html (gzip-compressed); don't edit\n")
+            w.write("static const char " + varname + "_HTML_ETAG[] PROGMEM = \"\\\"" + etag + "\\\"\";\n")
+            w.write("static const uint8_t " + varname + "_HTML_GZ[] PROGMEM = {\n")
+            for i in range(0, len(content), 16):
+                w.write("    " + ", ".join("0x%02x" % b for b in content[i:i + 16]) + ",\n")
+            w.write("};\n")
 
     def main(self):
         parser = argparse.ArgumentParser(description='Create c code PROGMEM header files from HTML files.')
         parser.add_argument("--minify", type=str2bool, nargs='?',
-                            const=True, default=False,
+                            const=True, default=True,
                             help="Minify HTML Code")
-        args = parser.parse_args()
+        args, unknown = parser.parse_known_args()
 
         for file in HTML_FILES:
-            if args.minify:
-
-                self.header_file_content = self.minifyHTML(file)
-                self.header_file_content = self.escape_html(self.header_file_content)
-            else:
-                self.header_file_content = self.html_to_c_header(file)
+            self.header_file_content = self.html_to_c_header(file, args.minify)
             self.write_header_file(file, self.header_file_content)
 
 if __name__ == '__main__':
-    htmlHeaderProcessor().main()
\ No newline at end of file
+    htmlHeaderProcessor().main()
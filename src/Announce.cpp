@@ -0,0 +1,300 @@
+#include <Arduino.h>
+#include <driver/i2s.h>
+#include "settings.h"
+#include "Announce.h"
+#include "AudioDsp.h"
+#include "AudioPlayer.h"
+#include "AudioStats.h"
+#include "ChannelRouter.h"
+#include "Log.h"
+#include "Resampler.h"
+#include "SdCard.h"
+#include "WavFile.h"
+#include "Wlan.h"
+
+/* Offline announcements: pre-recorded clips (16 bit PCM WAV) are loaded from announceDirectory into PSRAM
+   once and concatenated (crossfaded) to sentences like "ipaddress 1 9 2 point 1 6 8 ...".
+   Numbers are spoken by a clip of their own (e.g. "15.wav") if available, digit by digit otherwise. */
+
+#ifdef ANNOUNCE_ENABLE
+    #define ANNOUNCE_MAX_CLIPS          48u     // Number of different clips that are kept in PSRAM
+    #define ANNOUNCE_MAX_SEQUENCE       32u     // Max. number of clips per announcement
+    #define ANNOUNCE_MAX_TEXT           96u
+    #define ANNOUNCE_NAME_LENGTH        12u
+    #define ANNOUNCE_OUTPUT_FRAMES      128u
+
+    typedef struct {
+        char name[ANNOUNCE_NAME_LENGTH];
+        int16_t *data;                          // Mono; NULL if clip doesn't exist or is invalid
+        uint32_t frames;
+    } announceClip;
+
+    typedef struct {
+        char text[ANNOUNCE_MAX_TEXT];           // Space-separated clip-names; "#<n>" is a number
+    } announceRequest;
+
+    static QueueHandle_t Announce_Queue = NULL;
+    static announceClip Announce_Clips[ANNOUNCE_MAX_CLIPS];
+    static uint8_t Announce_ClipCount = 0;
+    static uint32_t Announce_SampleRate = 0;    // All clips have to use the sample rate of the first one that was loaded
+    static uint32_t Announce_OutputBuffer[ANNOUNCE_OUTPUT_FRAMES];
+    static uint8_t Announce_OutputFrames = 0;
+
+    static bool Announce_Enqueue(const char *_text);
+    static uint8_t Announce_Resolve(char *_text, const announceClip **_sequence);
+    static const announceClip *Announce_GetClip(const char *_name);
+    static bool Announce_LoadClip(announceClip *_clip);
+    static void Announce_TrimSilence(announceClip *_clip);
+    static void Announce_Output(const int16_t _sample);
+    static void Announce_Flush(void);
+#endif
+
+void Announce_Init(void) {
+    #ifdef ANNOUNCE_ENABLE
+        if (!psramFound()) {
+            return;
+        }
+        Announce_Queue = xQueueCreate(2, sizeof(announceRequest));
+        if (Announce_Queue == NULL) {
+            Log_Println((char *) FPSTR(unableToCreateAnnounceQ), LOGLEVEL_ERROR);
+        }
+    #endif
+}
+
+// Returns false if offline-announcements are not available (no PSRAM or no clips on SD); caller may fall back to TTS then
+bool Announce_IpAddress(void) {
+    #ifdef ANNOUNCE_ENABLE
+        const String ipAddress = Wlan_GetIpAddress();
+        if (ipAddress == "0.0.0.0") {
+            return false;
+        }
+        char text[ANNOUNCE_MAX_TEXT] = "ipaddress";
+        for (const char *c = ipAddress.c_str(); *c; c++) {
+            const char digit[2] = {*c, '\0'};
+            const size_t length = strlen(text);
+            snprintf(text + length, sizeof(text) - length, " %s", (digit[0] == '.') ? "point" : digit);
+        }
+        return Announce_Enqueue(text);
+    #else
+        return false;
+    #endif
+}
+
+bool Announce_BatteryLevel(const uint8_t _percent) {
+    #ifdef ANNOUNCE_ENABLE
+        char text[ANNOUNCE_MAX_TEXT];
+        snprintf(text, sizeof(text), "battery #%u percent", _percent);
+        return Announce_Enqueue(text);
+    #else
+        return false;
+    #endif
+}
+
+// 0 minutes => sleep-timer was disabled
+bool Announce_SleepTimer(const uint8_t _minutes) {
+    #ifdef ANNOUNCE_ENABLE
+        char text[ANNOUNCE_MAX_TEXT];
+        if (_minutes) {
+            snprintf(text, sizeof(text), "sleeptimer #%u minutes", _minutes);
+        } else {
+            snprintf(text, sizeof(text), "sleeptimer off");
+        }
+        return Announce_Enqueue(text);
+    #else
+        return false;
+    #endif
+}
+
+bool Announce_IsPending(void) {
+    #ifdef ANNOUNCE_ENABLE
+        return Announce_Queue != NULL && uxQueueMessagesWaiting(Announce_Queue);
+    #else
+        return false;
+    #endif
+}
+
+// Called by AudioPlayer_Task (while audio-lib is paused or idle). Blocks until announcement was played.
+// Afterwards I2S is set back to the sample rate of the current track.
+void Announce_Play(const uint32_t _trackSampleRate) {
+    #ifdef ANNOUNCE_ENABLE
+        announceRequest request;
+        if (xQueueReceive(Announce_Queue, &request, 0) != pdPASS) {
+            return;
+        }
+        const announceClip *sequence[ANNOUNCE_MAX_SEQUENCE];
+        const uint8_t count = Announce_Resolve(request.text, sequence);
+        if (!count) {
+            return;
+        }
+
+        gPlayProperties.currentSpeechActive = true;
+        Resampler_TrackStarted();
+        i2s_set_sample_rates(I2S_NUM_0, Resampler_GetOutputRate(Announce_SampleRate));
+        AudioDsp_Update(Announce_SampleRate);
+        AudioDsp_FadeTo(true, 0);
+
+        // End of every clip is crossfaded with the beginning of the next one; so there are neither gaps nor clicks
+        const uint32_t crossfadeFrames = Announce_SampleRate * announceCrossfadeTime / 1000u;
+        uint32_t start = 0;
+        for (uint8_t i = 0; i < count; i++) {
+            const announceClip *clip = sequence[i];
+            const announceClip *next = (i + 1 < count) ? sequence[i + 1] : NULL;
+            const uint32_t overlap = next ? std::min(crossfadeFrames, std::min(clip->frames - start, next->frames)) : 0;
+
+            for (uint32_t pos = start; pos < clip->frames - overlap; pos++) {
+                Announce_Output(clip->data[pos]);
+            }
+            for (uint32_t pos = 0; pos < overlap; pos++) {
+                const int32_t fadeOut = clip->data[clip->frames - overlap + pos] * (int32_t) (overlap - pos);
+                const int32_t fadeIn = next->data[pos] * (int32_t) pos;
+                Announce_Output((fadeOut + fadeIn) / (int32_t) overlap);
+            }
+            start = overlap;
+        }
+
+        // Fill DMA-buffer with silence; otherwise I2S would repeat its content until audio-lib writes again
+        AudioDsp_FadeTo(false, 0);
+        for (uint32_t i = 0; i < AudioStats_GetDmaBufferFrames(); i++) {
+            Announce_Output(0);
+        }
+        Announce_Flush();
+
+        Resampler_TrackStarted();
+        if (_trackSampleRate) {
+            i2s_set_sample_rates(I2S_NUM_0, Resampler_GetOutputRate(_trackSampleRate));
+        }
+        gPlayProperties.currentSpeechActive = false;
+    #endif
+}
+
+#ifdef ANNOUNCE_ENABLE
+bool Announce_Enqueue(const char *_text) {
+    if (Announce_Queue == NULL || !gFSystem.exists((char *) FPSTR(announceDirectory))) {
+        return false;
+    }
+    announceRequest request;
+    strncpy(request.text, _text, sizeof(request.text) - 1);
+    request.text[sizeof(request.text) - 1] = '\0';
+    return xQueueSend(Announce_Queue, &request, 0) == pdPASS;
+}
+
+// Translates text into a sequence of clips (loads them if necessary). Missing clips are skipped.
+uint8_t Announce_Resolve(char *_text, const announceClip **_sequence) {
+    uint8_t count = 0;
+    char *savePtr;
+    for (char *token = strtok_r(_text, " ", &savePtr); token != NULL && count < ANNOUNCE_MAX_SEQUENCE; token = strtok_r(NULL, " ", &savePtr)) {
+        if (token[0] != '#') {
+            const announceClip *clip = Announce_GetClip(token);
+            if (clip != NULL) {
+                _sequence[count++] = clip;
+            }
+            continue;
+        }
+
+        const announceClip *clip = Announce_GetClip(token + 1);
+        if (clip != NULL) {
+            _sequence[count++] = clip;
+            continue;
+        }
+        for (const char *digit = token + 1; *digit && count < ANNOUNCE_MAX_SEQUENCE; digit++) {
+            const char name[2] = {*digit, '\0'};
+            clip = Announce_GetClip(name);
+            if (clip != NULL) {
+                _sequence[count++] = clip;
+            }
+        }
+    }
+    return count;
+}
+
+// Returns clip from cache; loads it from SD if it wasn't requested before. Missing clips are remembered as well.
+const announceClip *Announce_GetClip(const char *_name) {
+    for (uint8_t i = 0; i < Announce_ClipCount; i++) {
+        if (!strcmp(Announce_Clips[i].name, _name)) {
+            return Announce_Clips[i].data ? &Announce_Clips[i] : NULL;
+        }
+    }
+    if (Announce_ClipCount >= ANNOUNCE_MAX_CLIPS || strlen(_name) >= ANNOUNCE_NAME_LENGTH) {
+        return NULL;
+    }
+
+    announceClip *clip = &Announce_Clips[Announce_ClipCount++];
+    strcpy(clip->name, _name);
+    clip->data = NULL;
+    clip->frames = 0;
+    return Announce_LoadClip(clip) ? clip : NULL;
+}
+
+// Loads clip (16 bit PCM WAV, mono or stereo) as mono into PSRAM
+bool Announce_LoadClip(announceClip *_clip) {
+    char path[48];
+    snprintf(path, sizeof(path) / sizeof(path[0]), "%s/%s.wav", (char *) FPSTR(announceDirectory), _clip->name);
+    if (!gFSystem.exists(path)) {
+        snprintf(Log_Buffer, Log_BufferLength, "%s: %s", (char *) FPSTR(announceClipMissing), path);
+        Log_Println(Log_Buffer, LOGLEVEL_NOTICE);
+        return false;
+    }
+
+    uint32_t frames;
+    uint32_t sampleRate;
+    int16_t *data = WavFile_LoadMono(path, UINT32_MAX, &frames, &sampleRate);
+    if (data == NULL || (Announce_SampleRate && sampleRate != Announce_SampleRate)) {
+        free(data);
+        snprintf(Log_Buffer, Log_BufferLength, "%s: %s", (char *) FPSTR(announceClipInvalid), path);
+        Log_Println(Log_Buffer, LOGLEVEL_ERROR);
+        return false;
+    }
+
+    Announce_SampleRate = sampleRate;
+    _clip->data = data;
+    _clip->frames = frames;
+    Announce_TrimSilence(_clip);
+    return true;
+}
+
+// Removes silence at beginning and end (keeps 5 ms); otherwise concatenated clips would sound choppy
+void Announce_TrimSilence(announceClip *_clip) {
+    uint32_t first = 0;
+    uint32_t last = _clip->frames;
+    while (first < last && abs(_clip->data[first]) < announceSilenceThreshold) {
+        first++;
+    }
+    while (last > first && abs(_clip->data[last - 1]) < announceSilenceThreshold) {
+        last--;
+    }
+    if (first == last) {    // Silence only
+        return;
+    }
+
+    const uint32_t margin = Announce_SampleRate / 200u;
+    first = (first > margin) ? first - margin : 0;
+    last = std::min(last + margin, _clip->frames);
+    memmove(_clip->data, _clip->data + first, (last - first) * sizeof(int16_t));
+    _clip->frames = last - first;
+}
+
+// Passes frame through DSP (volume, EQ) and resampler like the frames of the audio-lib
+void Announce_Output(const int16_t _sample) {
+    uint32_t frame = ((uint32_t) (uint16_t) _sample << 16) | (uint16_t) _sample;
+    bool continueI2S;
+    ChannelRouter_Process(&frame, Announce_SampleRate);
+    AudioDsp_Process(&frame);
+    Resampler_Process(&frame, &continueI2S, Announce_SampleRate);
+    if (!continueI2S) {     // Already written by resampler
+        return;
+    }
+    Announce_OutputBuffer[Announce_OutputFrames++] = frame;
+    if (Announce_OutputFrames == ANNOUNCE_OUTPUT_FRAMES) {
+        Announce_Flush();
+    }
+}
+
+void Announce_Flush(void) {
+    if (!Announce_OutputFrames) {
+        return;
+    }
+    size_t bytesWritten;
+    i2s_write(I2S_NUM_0, Announce_OutputBuffer, Announce_OutputFrames * sizeof(Announce_OutputBuffer[0]), &bytesWritten, portMAX_DELAY);
+    Announce_OutputFrames = 0;
+}
+#endif
@@ -0,0 +1,8 @@
+#pragma once
+
+void Announce_Init(void);
+bool Announce_IpAddress(void);
+bool Announce_BatteryLevel(const uint8_t _percent);
+bool Announce_SleepTimer(const uint8_t _minutes);
+bool Announce_IsPending(void);
+void Announce_Play(const uint32_t _trackSampleRate);
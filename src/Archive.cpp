@@ -0,0 +1,559 @@
+#include <Arduino.h>
+#include "settings.h"
+#include "Archive.h"
+#include "Common.h"
+#include "Log.h"
+#include "MemX.h"
+#include "SdCard.h"
+#include "Web.h"
+#include "rom/miniz.h"
+
+/* Extracts a tar-archive (optionally gzip-compressed) while it's being uploaded: there's no temporary copy on SD.
+   gzip is inflated by the decompressor in ROM; its output-buffer is the 32 KB dictionary (used circularly).
+   Data of each file is collected and written in blocks of uploadWriteBatch (aligned within the file).
+   Playlist-caches of affected directories are deleted once at the end. */
+
+#define ARCHIVE_BLOCK_SIZE              512u    // tar consists of blocks of 512 bytes
+#define ARCHIVE_MAX_DIRS                32u     // Directories remembered for deleting their playlist-cache at the end
+#define ARCHIVE_PROGRESS_INTERVAL       500u    // Interval of progress-messages via websocket (in ms)
+
+#define ARCHIVE_TAR_HEADER              0u
+#define ARCHIVE_TAR_FILE                1u      // Content of a regular file
+#define ARCHIVE_TAR_LONGNAME            2u      // Content of GNU-longname-entry ('L')
+#define ARCHIVE_TAR_SKIP                3u      // Content of unsupported entries (links, pax-headers, ...)
+#define ARCHIVE_TAR_PADDING             4u      // Content is padded to blocks of 512 bytes
+#define ARCHIVE_TAR_END                 5u
+
+#define ARCHIVE_GZIP_FIXED              0u
+#define ARCHIVE_GZIP_EXTRA_LENGTH       1u
+#define ARCHIVE_GZIP_EXTRA              2u
+#define ARCHIVE_GZIP_NAME               3u
+#define ARCHIVE_GZIP_COMMENT            4u
+#define ARCHIVE_GZIP_HEADER_CRC         5u
+#define ARCHIVE_GZIP_DEFLATE            6u
+#define ARCHIVE_GZIP_DONE               7u      // Trailer (crc + size) is ignored
+
+#define ARCHIVE_GZIP_FLAG_HCRC          0x02
+#define ARCHIVE_GZIP_FLAG_EXTRA         0x04
+#define ARCHIVE_GZIP_FLAG_NAME          0x08
+#define ARCHIVE_GZIP_FLAG_COMMENT       0x10
+
+static archiveStats Archive_Stats = {false, false, 0, 0};
+static char Archive_Destination[MAX_FILEPATH_LENTGH];
+static uint32_t Archive_LastProgress = 0;
+
+// tar
+static uint8_t Archive_TarState;
+static uint8_t *Archive_Header = NULL;          // Header-block (or GNU-longname) being collected
+static uint32_t Archive_HeaderFill;
+static uint32_t Archive_EntryRemaining;         // Bytes of content left
+static uint32_t Archive_PaddingRemaining;
+static char *Archive_LongName = NULL;
+static char *Archive_FilePath = NULL;
+static File Archive_File;
+static bool Archive_FileError;
+
+// Write-batching
+static uint8_t *Archive_Batch = NULL;
+static uint32_t Archive_BatchSize;
+static uint32_t Archive_BatchFill;
+
+// Directories touched
+static char *Archive_Dirs = NULL;
+static uint8_t Archive_DirCount;
+
+// gzip
+static bool Archive_Gzip;
+static uint8_t Archive_GzipState;
+static uint8_t Archive_GzipFlags;
+static uint32_t Archive_GzipCount;              // Bytes of current header-part
+static uint32_t Archive_GzipExtraLength;
+static tinfl_decompressor *Archive_Inflator = NULL;
+static uint8_t *Archive_Dictionary = NULL;
+static uint32_t Archive_DictionaryPos;
+
+static bool Archive_Inflate(const uint8_t *_data, size_t _length);
+static bool Archive_Tar(const uint8_t *_data, size_t _length);
+static bool Archive_HandleHeader(void);
+static bool Archive_BuildPath(const char *_name, const bool _isDir);
+static bool Archive_MakeDirs(const char *_path, const bool _isDir);
+static void Archive_AddDir(const char *_path);
+static void Archive_WriteFileData(const uint8_t *_data, size_t _length);
+static void Archive_FlushBatch(void);
+static void Archive_CloseFile(void);
+static uint32_t Archive_ParseOctal(const uint8_t *_field, const uint8_t _length);
+static void Archive_Free(void);
+
+// Checks by extension if file is an archive that can be extracted
+bool Archive_IsArchive(const char *_filename, bool *_gzip) {
+    char filename[MAX_FILEPATH_LENTGH];
+    snprintf(filename, sizeof(filename), "%s", _filename);
+    for (char *c = filename; *c; c++) {
+        *c = tolower(*c);
+    }
+
+    if (endsWith(filename, ".tar")) {
+        *_gzip = false;
+        return true;
+    }
+    if (endsWith(filename, ".tar.gz") || endsWith(filename, ".tgz")) {
+        *_gzip = true;
+        return true;
+    }
+    return false;
+}
+
+// Starts extraction into directory _destination (ASCII-path)
+bool Archive_Begin(const char *_destination, const bool _gzip) {
+    Archive_Free();
+
+    Archive_BatchSize = psramFound() ? uploadWriteBatch : uploadBufferSizeNoPsram / 2;
+    if (Archive_BatchSize > uploadWriteBatch) {
+        Archive_BatchSize = uploadWriteBatch;
+    }
+    Archive_Header = (uint8_t *) x_malloc(ARCHIVE_BLOCK_SIZE);
+    Archive_LongName = x_malloc(MAX_FILEPATH_LENTGH);
+    Archive_FilePath = x_malloc(MAX_FILEPATH_LENTGH);
+    Archive_Batch = (uint8_t *) x_malloc(Archive_BatchSize);
+    Archive_Dirs = x_malloc(ARCHIVE_MAX_DIRS * MAX_FILEPATH_LENTGH);
+    if (_gzip) {
+        Archive_Inflator = (tinfl_decompressor *) x_malloc(sizeof(tinfl_decompressor));
+        Archive_Dictionary = (uint8_t *) x_malloc(TINFL_LZ_DICT_SIZE);
+    }
+    if (!Archive_Header || !Archive_LongName || !Archive_FilePath || !Archive_Batch || !Archive_Dirs || (_gzip && (!Archive_Inflator || !Archive_Dictionary))) {
+        Archive_Free();
+        Log_Println((char *) FPSTR(archiveInitFailed), LOGLEVEL_ERROR);
+        return false;
+    }
+
+    strncpy(Archive_Destination, _destination, sizeof(Archive_Destination) - 1);
+    Archive_Destination[sizeof(Archive_Destination) - 1] = '\0';
+    size_t length = strlen(Archive_Destination);
+    while (length && Archive_Destination[length - 1] == '/') {      // "/" => ""
+        Archive_Destination[--length] = '\0';
+    }
+
+    Archive_TarState = ARCHIVE_TAR_HEADER;
+    Archive_HeaderFill = 0;
+    Archive_LongName[0] = '\0';
+    Archive_BatchFill = 0;
+    Archive_DirCount = 0;
+    Archive_Gzip = _gzip;
+    Archive_GzipState = ARCHIVE_GZIP_FIXED;
+    Archive_GzipCount = 0;
+    if (_gzip) {
+        tinfl_init(Archive_Inflator);
+        Archive_DictionaryPos = 0;
+    }
+
+    Archive_Stats.active = true;
+    Archive_Stats.error = false;
+    Archive_Stats.files = 0;
+    Archive_Stats.bytes = 0;
+    Archive_LastProgress = millis();
+
+    snprintf(Log_Buffer, Log_BufferLength, "%s: %s", (char *) FPSTR(archiveExtracting), _destination);
+    Log_Println(Log_Buffer, LOGLEVEL_INFO);
+    return true;
+}
+
+// Passes the next piece of the archive. Returns false once the archive turned out to be broken (rest is ignored).
+bool Archive_Write(const uint8_t *_data, size_t _length) {
+    if (!Archive_Stats.active || Archive_Stats.error) {
+        return false;
+    }
+
+    const bool ok = Archive_Gzip ? Archive_Inflate(_data, _length) : Archive_Tar(_data, _length);
+    if (!ok) {
+        Archive_Stats.error = true;
+    }
+
+    if (millis() - Archive_LastProgress >= ARCHIVE_PROGRESS_INTERVAL) {
+        Archive_LastProgress = millis();
+        Web_SendWebsocketData(0, 63);
+    }
+    return ok;
+}
+
+// Finishes extraction. Returns true if the archive was complete and all files were written.
+bool Archive_End(void) {
+    if (!Archive_Stats.active) {
+        return false;
+    }
+
+    if (Archive_File) {             // Archive ended within a file => partial file is removed
+        Archive_File.close();
+        gFSystem.remove(Archive_FilePath);
+        Archive_Stats.error = true;
+    }
+    if (Archive_TarState != ARCHIVE_TAR_END && Archive_TarState != ARCHIVE_TAR_HEADER) {
+        Archive_Stats.error = true;
+    }
+
+    // Playlists need to be rebuilt for all directories that got new files
+    for (uint8_t i = 0; i < Archive_DirCount; i++) {
+        Web_DeleteCachefile(Archive_Dirs + i * MAX_FILEPATH_LENTGH);
+    }
+
+    snprintf(Log_Buffer, Log_BufferLength, "%s: %u files, %u bytes", (char *) FPSTR(archiveExtracted), Archive_Stats.files, Archive_Stats.bytes);
+    Log_Println(Log_Buffer, Archive_Stats.error ? LOGLEVEL_ERROR : LOGLEVEL_INFO);
+
+    Archive_Stats.active = false;
+    Web_SendWebsocketData(0, 63);
+    Archive_Free();
+    return !Archive_Stats.error;
+}
+
+const archiveStats *Archive_GetStats(void) {
+    return &Archive_Stats;
+}
+
+// Parses gzip-header and inflates deflate-stream; output is passed to the tar-parser
+bool Archive_Inflate(const uint8_t *_data, size_t _length) {
+    while (_length && Archive_GzipState < ARCHIVE_GZIP_DEFLATE) {
+        const uint8_t c = *_data++;
+        _length--;
+        switch (Archive_GzipState) {
+            case ARCHIVE_GZIP_FIXED:        // Magic (2), method (1), flags (1), mtime (4), xfl (1), os (1)
+                if ((Archive_GzipCount == 0 && c != 0x1f) || (Archive_GzipCount == 1 && c != 0x8b) || (Archive_GzipCount == 2 && c != 8)) {
+                    Log_Println((char *) FPSTR(archiveInvalid), LOGLEVEL_ERROR);
+                    return false;
+                }
+                if (Archive_GzipCount == 3) {
+                    Archive_GzipFlags = c;
+                }
+                if (++Archive_GzipCount == 10) {
+                    Archive_GzipCount = 0;
+                    Archive_GzipExtraLength = 0;
+                    Archive_GzipState = ARCHIVE_GZIP_EXTRA_LENGTH;
+                }
+                break;
+            case ARCHIVE_GZIP_EXTRA_LENGTH:
+                Archive_GzipExtraLength |= c << (8 * Archive_GzipCount);
+                if (++Archive_GzipCount == 2) {
+                    Archive_GzipCount = 0;
+                    Archive_GzipState = ARCHIVE_GZIP_EXTRA;
+                }
+                break;
+            case ARCHIVE_GZIP_EXTRA:
+                Archive_GzipCount++;
+                break;
+            case ARCHIVE_GZIP_NAME:
+            case ARCHIVE_GZIP_COMMENT:
+                if (!c) {
+                    Archive_GzipCount = 0;
+                    Archive_GzipState++;
+                }
+                break;
+            case ARCHIVE_GZIP_HEADER_CRC:
+                Archive_GzipCount++;
+                break;
+        }
+
+        // Skip optional parts of header that are not present (or finished)
+        for (;;) {
+            if (Archive_GzipState == ARCHIVE_GZIP_EXTRA_LENGTH && !(Archive_GzipFlags & ARCHIVE_GZIP_FLAG_EXTRA)) {
+                Archive_GzipState = ARCHIVE_GZIP_NAME;
+            } else if (Archive_GzipState == ARCHIVE_GZIP_EXTRA && Archive_GzipCount == Archive_GzipExtraLength) {
+                Archive_GzipState = ARCHIVE_GZIP_NAME;
+            } else if (Archive_GzipState == ARCHIVE_GZIP_NAME && !(Archive_GzipFlags & ARCHIVE_GZIP_FLAG_NAME)) {
+                Archive_GzipState = ARCHIVE_GZIP_COMMENT;
+            } else if (Archive_GzipState == ARCHIVE_GZIP_COMMENT && !(Archive_GzipFlags & ARCHIVE_GZIP_FLAG_COMMENT)) {
+                Archive_GzipCount = 0;
+                Archive_GzipState = ARCHIVE_GZIP_HEADER_CRC;
+            } else if (Archive_GzipState == ARCHIVE_GZIP_HEADER_CRC && (!(Archive_GzipFlags & ARCHIVE_GZIP_FLAG_HCRC) || Archive_GzipCount == 2)) {
+                Archive_GzipState = ARCHIVE_GZIP_DEFLATE;
+            } else {
+                break;
+            }
+        }
+    }
+
+    while (Archive_GzipState == ARCHIVE_GZIP_DEFLATE) {
+        size_t inBytes = _length;
+        size_t outBytes = TINFL_LZ_DICT_SIZE - Archive_DictionaryPos;
+        const tinfl_status status = tinfl_decompress(Archive_Inflator, _data, &inBytes, Archive_Dictionary, Archive_Dictionary + Archive_DictionaryPos, &outBytes, TINFL_FLAG_HAS_MORE_INPUT);
+        _data += inBytes;
+        _length -= inBytes;
+
+        if (outBytes && !Archive_Tar(Archive_Dictionary + Archive_DictionaryPos, outBytes)) {
+            return false;
+        }
+        Archive_DictionaryPos = (Archive_DictionaryPos + outBytes) & (TINFL_LZ_DICT_SIZE - 1);
+
+        if (status < TINFL_STATUS_DONE) {
+            Log_Println((char *) FPSTR(archiveInvalid), LOGLEVEL_ERROR);
+            return false;
+        }
+        if (status == TINFL_STATUS_DONE) {
+            Archive_GzipState = ARCHIVE_GZIP_DONE;
+        } else if (status != TINFL_STATUS_HAS_MORE_OUTPUT && !_length) {
+            break;      // Needs more input
+        }
+    }
+    return true;
+}
+
+bool Archive_Tar(const uint8_t *_data, size_t _length) {
+    while (_length) {
+        size_t bytes;
+        switch (Archive_TarState) {
+            case ARCHIVE_TAR_HEADER:
+                bytes = ARCHIVE_BLOCK_SIZE - Archive_HeaderFill;
+                if (bytes > _length) {
+                    bytes = _length;
+                }
+                memcpy(Archive_Header + Archive_HeaderFill, _data, bytes);
+                Archive_HeaderFill += bytes;
+                if (Archive_HeaderFill == ARCHIVE_BLOCK_SIZE) {
+                    Archive_HeaderFill = 0;
+                    if (!Archive_HandleHeader()) {
+                        return false;
+                    }
+                }
+                break;
+
+            case ARCHIVE_TAR_FILE:
+            case ARCHIVE_TAR_LONGNAME:
+            case ARCHIVE_TAR_SKIP:
+                bytes = (Archive_EntryRemaining < _length) ? Archive_EntryRemaining : _length;
+                if (Archive_TarState == ARCHIVE_TAR_FILE) {
+                    Archive_WriteFileData(_data, bytes);
+                } else if (Archive_TarState == ARCHIVE_TAR_LONGNAME) {
+                    for (size_t i = 0; i < bytes; i++) {
+                        if (Archive_HeaderFill < MAX_FILEPATH_LENTGH - 1) {
+                            Archive_LongName[Archive_HeaderFill++] = _data[i];
+                        }
+                    }
+                    Archive_LongName[Archive_HeaderFill] = '\0';
+                }
+                Archive_EntryRemaining -= bytes;
+                if (!Archive_EntryRemaining) {
+                    if (Archive_TarState == ARCHIVE_TAR_FILE) {
+                        Archive_CloseFile();
+                    }
+                    Archive_HeaderFill = 0;
+                    Archive_TarState = Archive_PaddingRemaining ? ARCHIVE_TAR_PADDING : ARCHIVE_TAR_HEADER;
+                }
+                break;
+
+            case ARCHIVE_TAR_PADDING:
+                bytes = (Archive_PaddingRemaining < _length) ? Archive_PaddingRemaining : _length;
+                Archive_PaddingRemaining -= bytes;
+                if (!Archive_PaddingRemaining) {
+                    Archive_TarState = ARCHIVE_TAR_HEADER;
+                }
+                break;
+
+            default:        // End-marker was found; rest is ignored
+                return true;
+        }
+        _data += bytes;
+        _length -= bytes;
+    }
+    return true;
+}
+
+bool Archive_HandleHeader(void) {
+    // Empty block marks end of archive
+    bool empty = true;
+    for (uint32_t i = 0; i < ARCHIVE_BLOCK_SIZE && empty; i++) {
+        empty = !Archive_Header[i];
+    }
+    if (empty) {
+        Archive_TarState = ARCHIVE_TAR_END;
+        return true;
+    }
+
+    // Checksum is calculated with its own field treated as spaces
+    uint32_t checksum = 0;
+    for (uint32_t i = 0; i < ARCHIVE_BLOCK_SIZE; i++) {
+        checksum += (i >= 148 && i < 156) ? ' ' : Archive_Header[i];
+    }
+    if (checksum != Archive_ParseOctal(Archive_Header + 148, 8)) {
+        Log_Println((char *) FPSTR(archiveInvalid), LOGLEVEL_ERROR);
+        return false;
+    }
+
+    const uint32_t size = Archive_ParseOctal(Archive_Header + 124, 12);
+    const char type = Archive_Header[156];
+    Archive_EntryRemaining = size;
+    Archive_PaddingRemaining = (ARCHIVE_BLOCK_SIZE - (size % ARCHIVE_BLOCK_SIZE)) % ARCHIVE_BLOCK_SIZE;
+
+    if (type == 'L') {              // GNU: name of next entry is stored as content
+        Archive_TarState = ARCHIVE_TAR_LONGNAME;
+    } else if (type == '0' || type == '\0' || type == '7' || type == '5') {
+        char name[MAX_FILEPATH_LENTGH];
+        if (Archive_LongName[0]) {
+            snprintf(name, sizeof(name), "%s", Archive_LongName);
+            Archive_LongName[0] = '\0';
+        } else if (!memcmp(Archive_Header + 257, "ustar", 5) && Archive_Header[345]) {     // ustar: prefix + name
+            snprintf(name, sizeof(name), "%.155s/%.100s", (const char *) Archive_Header + 345, (const char *) Archive_Header);
+        } else {
+            snprintf(name, sizeof(name), "%.100s", (const char *) Archive_Header);
+        }
+
+        const bool isDir = (type == '5');
+        if (!Archive_BuildPath(name, isDir)) {
+            snprintf(Log_Buffer, Log_BufferLength, "%s: %s", (char *) FPSTR(archiveEntrySkipped), name);
+            Log_Println(Log_Buffer, LOGLEVEL_ERROR);
+            Archive_TarState = ARCHIVE_TAR_SKIP;
+        } else if (isDir) {
+            Archive_MakeDirs(Archive_FilePath, true);
+            Archive_TarState = ARCHIVE_TAR_SKIP;
+        } else {
+            Archive_MakeDirs(Archive_FilePath, false);
+            Archive_AddDir(Archive_FilePath);
+            Archive_File = gFSystem.open(Archive_FilePath, FILE_WRITE);
+            Archive_FileError = !Archive_File;
+            if (Archive_FileError) {
+                snprintf(Log_Buffer, Log_BufferLength, "%s: %s", (char *) FPSTR(failedOpenFileForWrite), Archive_FilePath);
+                Log_Println(Log_Buffer, LOGLEVEL_ERROR);
+                Archive_Stats.error = true;
+            }
+            Archive_BatchFill = 0;
+            Archive_TarState = ARCHIVE_TAR_FILE;
+        }
+    } else {                        // Links, pax-headers, ...
+        Archive_TarState = ARCHIVE_TAR_SKIP;
+    }
+
+    if (!Archive_EntryRemaining) {
+        if (Archive_TarState == ARCHIVE_TAR_FILE) {
+            Archive_CloseFile();
+        }
+        Archive_TarState = ARCHIVE_TAR_HEADER;
+    }
+    return true;
+}
+
+// Builds ASCII-path of entry within destination. Absolute paths and ".." are refused.
+bool Archive_BuildPath(const char *_name, const bool _isDir) {
+    while (_name[0] == '.' && _name[1] == '/') {
+        _name += 2;
+    }
+    if (_name[0] == '/' || !_name[0]) {
+        return false;
+    }
+    for (const char *c = _name; *c; c++) {
+        if ((c == _name || c[-1] == '/') && c[0] == '.' && c[1] == '.' && (c[2] == '/' || !c[2])) {
+            return false;
+        }
+    }
+
+    char utf8Path[MAX_FILEPATH_LENTGH];
+    snprintf(utf8Path, sizeof(utf8Path), "%s/%s", Archive_Destination, _name);
+    convertUtf8ToAscii(utf8Path, Archive_FilePath);
+    size_t length = strlen(Archive_FilePath);
+    while (_isDir && length > 1 && Archive_FilePath[length - 1] == '/') {
+        Archive_FilePath[--length] = '\0';
+    }
+    return true;
+}
+
+// Creates all directories of _path (the last element only if it's a directory itself)
+bool Archive_MakeDirs(const char *_path, const bool _isDir) {
+    char dir[MAX_FILEPATH_LENTGH];
+    snprintf(dir, sizeof(dir), "%s", _path);
+    for (char *c = dir + 1; ; c++) {
+        if (*c == '/' || (!*c && _isDir)) {
+            const char end = *c;
+            *c = '\0';
+            if (!gFSystem.exists(dir) && !gFSystem.mkdir(dir)) {
+                return false;
+            }
+            *c = end;
+        }
+        if (!*c) {
+            return true;
+        }
+    }
+}
+
+// Remembers directory of a file for deleting its playlist-cache at the end
+void Archive_AddDir(const char *_path) {
+    const char *last = strrchr(_path, '/');
+    const size_t length = last - _path + 1;     // Including '/'
+    for (uint8_t i = 0; i < Archive_DirCount; i++) {
+        const char *dir = Archive_Dirs + i * MAX_FILEPATH_LENTGH;
+        if (strlen(dir) == length && !strncmp(dir, _path, length)) {
+            return;
+        }
+    }
+    if (Archive_DirCount == ARCHIVE_MAX_DIRS) {     // No space left => delete cache right now
+        Web_DeleteCachefile(_path);
+        return;
+    }
+    snprintf(Archive_Dirs + Archive_DirCount * MAX_FILEPATH_LENTGH, length + 1, "%s", _path);
+    Archive_DirCount++;
+}
+
+void Archive_WriteFileData(const uint8_t *_data, size_t _length) {
+    while (_length) {
+        size_t bytes = Archive_BatchSize - Archive_BatchFill;
+        if (bytes > _length) {
+            bytes = _length;
+        }
+        memcpy(Archive_Batch + Archive_BatchFill, _data, bytes);
+        Archive_BatchFill += bytes;
+        _data += bytes;
+        _length -= bytes;
+        if (Archive_BatchFill == Archive_BatchSize) {
+            Archive_FlushBatch();
+        }
+    }
+}
+
+void Archive_FlushBatch(void) {
+    if (Archive_BatchFill && !Archive_FileError) {
+        if (Archive_File.write(Archive_Batch, Archive_BatchFill) == Archive_BatchFill) {
+            Archive_Stats.bytes += Archive_BatchFill;
+        } else {
+            snprintf(Log_Buffer, Log_BufferLength, "%s: %s", (char *) FPSTR(writeFailed), Archive_FilePath);
+            Log_Println(Log_Buffer, LOGLEVEL_ERROR);
+            Archive_FileError = true;
+            Archive_Stats.error = true;
+        }
+    }
+    Archive_BatchFill = 0;
+}
+
+void Archive_CloseFile(void) {
+    Archive_FlushBatch();
+    if (Archive_File) {
+        Archive_File.close();
+        if (!Archive_FileError) {
+            Archive_Stats.files++;
+        }
+    }
+}
+
+uint32_t Archive_ParseOctal(const uint8_t *_field, const uint8_t _length) {
+    uint32_t value = 0;
+    for (uint8_t i = 0; i < _length && _field[i]; i++) {
+        if (_field[i] >= '0' && _field[i] <= '7') {
+            value = (value << 3) | (_field[i] - '0');
+        }
+    }
+    return value;
+}
+
+void Archive_Free(void) {
+    if (Archive_File) {
+        Archive_File.close();
+    }
+    free(Archive_Header);
+    free(Archive_LongName);
+    free(Archive_FilePath);
+    free(Archive_Batch);
+    free(Archive_Dirs);
+    free(Archive_Inflator);
+    free(Archive_Dictionary);
+    Archive_Header = NULL;
+    Archive_LongName = NULL;
+    Archive_FilePath = NULL;
+    Archive_Batch = NULL;
+    Archive_Dirs = NULL;
+    Archive_Inflator = NULL;
+    Archive_Dictionary = NULL;
+}
@@ -0,0 +1,14 @@
+#pragma once
+
+typedef struct {
+    bool active;                                // Extraction is running
+    bool error;                                 // Archive is broken or SD couldn't be written
+    uint32_t files;                             // Files extracted
+    uint32_t bytes;                             // Bytes extracted (uncompressed)
+} archiveStats;
+
+bool Archive_IsArchive(const char *_filename, bool *_gzip);
+bool Archive_Begin(const char *_destination, const bool _gzip);
+bool Archive_Write(const uint8_t *_data, size_t _length);
+bool Archive_End(void);
+const archiveStats *Archive_GetStats(void);
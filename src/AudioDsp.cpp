@@ -0,0 +1,363 @@
+#include <Arduino.h>
+#include "settings.h"
+#include "AudioDsp.h"
+#include "Biquad.h"
+#include "Log.h"
+
+#define AUDIODSP_MAX_BIQUADS            6u
+#define AUDIODSP_SAMPLE_SHIFT           8       // 16 bit-samples are processed as 24 bit-values (headroom + less rounding-noise)
+
+// Linear gain-ramp (Q2.30). New targets are requested by other tasks and taken over by AudioDsp_Process().
+typedef struct {
+    int32_t current;
+    int32_t target;
+    int32_t step;
+    volatile bool requested;
+    volatile int32_t requestedTarget;
+    volatile uint32_t requestedDurationMs;
+} gainRamp;
+
+#define AUDIODSP_GAIN_UNITY             (1 << 30)
+
+#define AUDIODSP_VOLUME_STEPS           256u    // Fine volume 0..255
+
+// Perceptual volume-curve (Q0.16); calculated once as volume is applied here (audio-lib's volume is fixed to max)
+static uint16_t AudioDsp_VolumeCurve[AUDIODSP_VOLUME_STEPS];
+static bool AudioDsp_VolumeCurveReady = false;
+
+static volatile uint8_t AudioDsp_RequestedOutput = AUDIODSP_OUTPUT_SPEAKER;
+static uint32_t AudioDsp_SampleRate = 0;
+
+static gainRamp AudioDsp_VolumeRamp = {0, 0, 0, false, 0, 0};                                   // Volume
+static gainRamp AudioDsp_FadeRamp = {AUDIODSP_GAIN_UNITY, AUDIODSP_GAIN_UNITY, 0, false, 0, 0};   // Pause/resume, stop, track-change
+static gainRamp AudioDsp_SleepRamp = {AUDIODSP_GAIN_UNITY, AUDIODSP_GAIN_UNITY, 0, false, 0, 0};  // Sleep-timer
+static int32_t AudioDsp_OutputGain = 0;                                                         // Product of all ramps
+
+static void AudioDsp_RequestRamp(gainRamp *_ramp, const int32_t _target, const uint32_t _durationMs);
+static void AudioDsp_CalculateVolumeCurve(void);
+
+#ifdef EQUALIZER_ENABLE
+    static_assert(sizeof(eqSpeakerFilters) / sizeof(eqSpeakerFilters[0]) <= AUDIODSP_MAX_BIQUADS, "Too many filters configured for eqSpeakerFilters");
+    static_assert(sizeof(eqHeadphoneFilters) / sizeof(eqHeadphoneFilters[0]) <= AUDIODSP_MAX_BIQUADS, "Too many filters configured for eqHeadphoneFilters");
+
+    static biquadCoefficients AudioDsp_Coefficients[AUDIODSP_MAX_BIQUADS];
+    static biquadState AudioDsp_State[2][AUDIODSP_MAX_BIQUADS];     // Left + right channel
+    static uint8_t AudioDsp_BiquadCount = 0;
+    static uint8_t AudioDsp_CurrentOutput = 0xFF;
+#endif
+
+#ifdef REPLAYGAIN_ENABLE
+    #define AUDIODSP_GAIN_SHIFT             12      // Replay-gain is Q12
+    #define AUDIODSP_LIMITER_SHIFT          15      // Limiter-gain is Q15
+    #define AUDIODSP_LIMITER_THRESHOLD      ((int32_t) (0.891 * (1 << 23)))     // -1 dBFS (24 bit)
+    #define AUDIODSP_LIMITER_RELEASE_SHIFT  14      // Release: ~0.4 s
+    #define AUDIODSP_LOUDNESS_BINS          140u    // Histogram of block-loudness from -70 to 0 LUFS (0.5 LU per bin)
+
+    static int32_t AudioDsp_ReplayGain = 1 << AUDIODSP_GAIN_SHIFT;
+    static bool AudioDsp_LimiterEnabled = false;
+    static int32_t AudioDsp_LimiterGain = 1 << AUDIODSP_LIMITER_SHIFT;
+
+    static bool AudioDsp_MeasureEnabled = false;
+    static biquadCoefficients AudioDsp_KWeightingCoefficients[2];
+    static biquadState AudioDsp_KWeightingState[2];
+    static uint64_t AudioDsp_BlockEnergy = 0;
+    static uint32_t AudioDsp_BlockFrames = 0;
+    static uint32_t AudioDsp_FramesPerBlock = 0;
+    static uint16_t AudioDsp_LoudnessHistogram[AUDIODSP_LOUDNESS_BINS];
+    static uint32_t AudioDsp_LoudnessBlocks = 0;
+
+    static void AudioDsp_FinishLoudnessBlock(void);
+#endif
+
+// Selects filter-set that is used for the next samples (speaker or headphone)
+void AudioDsp_SetOutput(const uint8_t _output) {
+    AudioDsp_RequestedOutput = _output;
+}
+
+// Sets volume (fine scale 0..255); changes are ramped within volumeRampTime in order to avoid clicks
+void AudioDsp_SetVolume(const uint8_t _volume) {
+    if (!AudioDsp_VolumeCurveReady) {
+        AudioDsp_CalculateVolumeCurve();
+    }
+    const int32_t gain = (_volume == AUDIODSP_VOLUME_STEPS - 1) ? AUDIODSP_GAIN_UNITY : (int32_t) AudioDsp_VolumeCurve[_volume] << 14;
+    AudioDsp_RequestRamp(&AudioDsp_VolumeRamp, gain, volumeRampTime);
+}
+
+// Volume 0 is muted; 1..255 are spread evenly (in dB) from -volumeCurveRange to 0 dB.
+// So every step changes perceived loudness by the same amount, which is important at low volumes.
+void AudioDsp_CalculateVolumeCurve(void) {
+    AudioDsp_VolumeCurve[0] = 0;
+    for (uint16_t i = 1; i < AUDIODSP_VOLUME_STEPS; i++) {
+        const float db = -volumeCurveRange * (AUDIODSP_VOLUME_STEPS - 1 - i) / (AUDIODSP_VOLUME_STEPS - 2);
+        AudioDsp_VolumeCurve[i] = (uint16_t) std::min(65535.0f, roundf(powf(10.0f, db / 20.0f) * 65536.0f));
+    }
+    AudioDsp_VolumeCurveReady = true;
+}
+
+// Fades audio out (e.g. before pause/stop) or in (e.g. after resume)
+void AudioDsp_FadeTo(const bool _on, const uint32_t _durationMs) {
+    AudioDsp_RequestRamp(&AudioDsp_FadeRamp, _on ? AUDIODSP_GAIN_UNITY : 0, _durationMs);
+}
+
+// Separate envelope for sleep-timer so that track-changes during fade-out don't bring volume back
+void AudioDsp_SleepFadeTo(const bool _on, const uint32_t _durationMs) {
+    AudioDsp_RequestRamp(&AudioDsp_SleepRamp, _on ? AUDIODSP_GAIN_UNITY : 0, _durationMs);
+}
+
+// Returns true as long as pause/stop/track-change-fade is in progress
+bool AudioDsp_IsFading(void) {
+    return AudioDsp_FadeRamp.requested || AudioDsp_FadeRamp.current != AudioDsp_FadeRamp.target;
+}
+
+// Returns true if AudioDsp_Process() wouldn't change any sample (max. volume, no fade, no EQ, no replay-gain/measurement).
+// Allows for bypassing the chain; has to be called by AudioPlayer_Task.
+bool AudioDsp_IsTransparent(void) {
+    #ifdef REPLAYGAIN_ENABLE
+        if (AudioDsp_MeasureEnabled || AudioDsp_LimiterEnabled || AudioDsp_ReplayGain != (1 << AUDIODSP_GAIN_SHIFT)) {
+            return false;
+        }
+    #endif
+    #ifdef EQUALIZER_ENABLE
+        if (AudioDsp_BiquadCount) {
+            return false;
+        }
+    #endif
+    const gainRamp *ramps[] = {&AudioDsp_VolumeRamp, &AudioDsp_FadeRamp, &AudioDsp_SleepRamp};
+    for (const gainRamp *ramp : ramps) {
+        if (ramp->requested || ramp->current != AUDIODSP_GAIN_UNITY || ramp->target != AUDIODSP_GAIN_UNITY) {
+            return false;
+        }
+    }
+    return true;
+}
+
+void AudioDsp_RequestRamp(gainRamp *_ramp, const int32_t _target, const uint32_t _durationMs) {
+    _ramp->requestedTarget = _target;
+    _ramp->requestedDurationMs = _durationMs;
+    _ramp->requested = true;
+}
+
+// Called by AudioPlayer_Task; (re-)calculates coefficients if sample rate or output changed.
+// Runs in the same task as AudioDsp_Process(), so no locking is needed.
+void AudioDsp_Update(const uint32_t _sampleRate) {
+    if (!_sampleRate) {
+        return;
+    }
+    const bool sampleRateChanged = (_sampleRate != AudioDsp_SampleRate);
+    AudioDsp_SampleRate = _sampleRate;
+
+    #ifdef REPLAYGAIN_ENABLE
+        if (sampleRateChanged) {
+            // K-weighting of ITU-R BS.1770 (pre-filter + RLB-filter)
+            Biquad_Design(EQ_FILTER_HIGHSHELF, 1681.97f, 0.7072f, 4.0f, _sampleRate, &AudioDsp_KWeightingCoefficients[0]);
+            Biquad_Design(EQ_FILTER_HIGHPASS, 38.14f, 0.5003f, 0.0f, _sampleRate, &AudioDsp_KWeightingCoefficients[1]);
+            memset(AudioDsp_KWeightingState, 0, sizeof(AudioDsp_KWeightingState));
+            AudioDsp_FramesPerBlock = _sampleRate * 2u / 5u;    // 400 ms
+            AudioDsp_BlockEnergy = 0;
+            AudioDsp_BlockFrames = 0;
+        }
+    #endif
+
+    #ifdef EQUALIZER_ENABLE
+        const uint8_t output = AudioDsp_RequestedOutput;
+        if (!sampleRateChanged && output == AudioDsp_CurrentOutput) {
+            return;
+        }
+        AudioDsp_CurrentOutput = output;
+
+        const float (*filters)[4] = eqSpeakerFilters;
+        uint8_t numberOfFilters = sizeof(eqSpeakerFilters) / sizeof(eqSpeakerFilters[0]);
+        if (output == AUDIODSP_OUTPUT_HEADPHONE) {
+            filters = eqHeadphoneFilters;
+            numberOfFilters = sizeof(eqHeadphoneFilters) / sizeof(eqHeadphoneFilters[0]);
+        }
+
+        AudioDsp_BiquadCount = 0;
+        memset(AudioDsp_State, 0, sizeof(AudioDsp_State));
+        for (uint8_t i = 0; i < numberOfFilters; i++) {
+            const uint8_t type = (uint8_t) filters[i][0];
+            if (type == EQ_FILTER_NONE) {
+                continue;
+            }
+            if (Biquad_Design(type, filters[i][1], filters[i][2], filters[i][3], _sampleRate, &AudioDsp_Coefficients[AudioDsp_BiquadCount])) {
+                AudioDsp_BiquadCount++;
+            } else {
+                snprintf(Log_Buffer, Log_BufferLength, "%s: %u", (char *) FPSTR(eqFilterInvalid), i);
+                Log_Println(Log_Buffer, LOGLEVEL_ERROR);
+            }
+        }
+
+        snprintf(Log_Buffer, Log_BufferLength, "%s (%s, %u Hz): %u", (char *) FPSTR(eqFiltersActivated), (output == AUDIODSP_OUTPUT_HEADPHONE) ? "HP" : "SPK", _sampleRate, AudioDsp_BiquadCount);
+        Log_Println(Log_Buffer, LOGLEVEL_INFO);
+    #endif
+}
+
+#ifdef REPLAYGAIN_ENABLE
+    // Sets gain (in dB) for the current track. Optionally enables limiter and measurement of the track's loudness.
+    // Has to be called by AudioPlayer_Task.
+    void AudioDsp_SetReplayGain(const float _gainDb, const bool _limiter, const bool _measure) {
+        AudioDsp_ReplayGain = lround(pow(10.0, _gainDb / 20.0) * (1 << AUDIODSP_GAIN_SHIFT));
+        AudioDsp_LimiterEnabled = _limiter;
+        AudioDsp_LimiterGain = 1 << AUDIODSP_LIMITER_SHIFT;
+
+        AudioDsp_MeasureEnabled = _measure;
+        memset(AudioDsp_KWeightingState, 0, sizeof(AudioDsp_KWeightingState));
+        memset(AudioDsp_LoudnessHistogram, 0, sizeof(AudioDsp_LoudnessHistogram));
+        AudioDsp_LoudnessBlocks = 0;
+        AudioDsp_BlockEnergy = 0;
+        AudioDsp_BlockFrames = 0;
+    }
+
+    // Integrated loudness (LUFS) of the blocks measured so far (gated according to EBU R128)
+    bool AudioDsp_GetIntegratedLoudness(float *_loudness, uint32_t *_measuredSeconds) {
+        if (!AudioDsp_LoudnessBlocks) {
+            return false;
+        }
+
+        double energy = 0.0;
+        uint32_t numberOfBlocks = 0;
+        for (uint8_t i = 0; i < AUDIODSP_LOUDNESS_BINS; i++) {
+            if (AudioDsp_LoudnessHistogram[i]) {
+                energy += AudioDsp_LoudnessHistogram[i] * pow(10.0, (-70.0 + (i + 0.5) / 2.0 + 0.691) / 10.0);
+                numberOfBlocks += AudioDsp_LoudnessHistogram[i];
+            }
+        }
+        const double relativeGate = -0.691 + 10.0 * log10(energy / numberOfBlocks) - 10.0;
+
+        energy = 0.0;
+        numberOfBlocks = 0;
+        for (uint8_t i = 0; i < AUDIODSP_LOUDNESS_BINS; i++) {
+            const double binLoudness = -70.0 + (i + 0.5) / 2.0;
+            if (AudioDsp_LoudnessHistogram[i] && binLoudness >= relativeGate) {
+                energy += AudioDsp_LoudnessHistogram[i] * pow(10.0, (binLoudness + 0.691) / 10.0);
+                numberOfBlocks += AudioDsp_LoudnessHistogram[i];
+            }
+        }
+        if (!numberOfBlocks) {
+            return false;
+        }
+
+        *_loudness = -0.691 + 10.0 * log10(energy / numberOfBlocks);
+        *_measuredSeconds = AudioDsp_LoudnessBlocks * 2u / 5u;
+        return true;
+    }
+#endif
+
+// Converts 24 bit-value back to 16 bit (with rounding + saturation)
+static inline int16_t IRAM_ATTR AudioDsp_Saturate(int32_t _x) {
+    _x = (_x + (1 << (AUDIODSP_SAMPLE_SHIFT - 1))) >> AUDIODSP_SAMPLE_SHIFT;
+    if (_x > INT16_MAX) {
+        return INT16_MAX;
+    } else if (_x < INT16_MIN) {
+        return INT16_MIN;
+    }
+    return _x;
+}
+
+#ifdef REPLAYGAIN_ENABLE
+    // Accumulates K-weighted energy of the (unprocessed) mid-signal. Every 400 ms a block is added to the histogram.
+    static inline void IRAM_ATTR AudioDsp_MeasureLoudness(const int32_t _left, const int32_t _right) {
+        int32_t y = Biquad_Run(((_left + _right) / 2) << AUDIODSP_SAMPLE_SHIFT, AudioDsp_KWeightingCoefficients, AudioDsp_KWeightingState, 2) >> 4;    // 20 bit
+        AudioDsp_BlockEnergy += (int64_t) y * y;
+        if (++AudioDsp_BlockFrames >= AudioDsp_FramesPerBlock) {
+            AudioDsp_FinishLoudnessBlock();
+        }
+    }
+
+    void AudioDsp_FinishLoudnessBlock(void) {
+        if (AudioDsp_BlockEnergy) {
+            // Mean square relative to full scale (20 bit) of both channels (= 2 * mid for correlated channels)
+            const double meanSquare = 2.0 * AudioDsp_BlockEnergy / AudioDsp_BlockFrames / (double) (1ull << 38);
+            const double blockLoudness = -0.691 + 10.0 * log10(meanSquare);
+            if (blockLoudness >= -70.0) {   // Absolute gate
+                uint8_t bin = (blockLoudness + 70.0) * 2.0;
+                AudioDsp_LoudnessHistogram[std::min(bin, (uint8_t) (AUDIODSP_LOUDNESS_BINS - 1))]++;
+                AudioDsp_LoudnessBlocks++;
+            }
+        }
+        AudioDsp_BlockEnergy = 0;
+        AudioDsp_BlockFrames = 0;
+    }
+
+    // Applies replay-gain and (optionally) limits peaks to -1 dBFS. Attack is immediate, release is exponential.
+    static inline void IRAM_ATTR AudioDsp_ApplyReplayGain(int32_t *_left, int32_t *_right) {
+        int32_t left = ((int64_t) *_left * AudioDsp_ReplayGain) >> AUDIODSP_GAIN_SHIFT;
+        int32_t right = ((int64_t) *_right * AudioDsp_ReplayGain) >> AUDIODSP_GAIN_SHIFT;
+
+        if (AudioDsp_LimiterEnabled) {
+            const int32_t peak = std::max(abs(left), abs(right));
+            if ((((int64_t) peak * AudioDsp_LimiterGain) >> AUDIODSP_LIMITER_SHIFT) > AUDIODSP_LIMITER_THRESHOLD) {
+                AudioDsp_LimiterGain = ((int64_t) AUDIODSP_LIMITER_THRESHOLD << AUDIODSP_LIMITER_SHIFT) / peak;
+            } else if (AudioDsp_LimiterGain < (1 << AUDIODSP_LIMITER_SHIFT)) {
+                AudioDsp_LimiterGain += (((1 << AUDIODSP_LIMITER_SHIFT) - AudioDsp_LimiterGain) >> AUDIODSP_LIMITER_RELEASE_SHIFT) + 1;
+            }
+            left = ((int64_t) left * AudioDsp_LimiterGain) >> AUDIODSP_LIMITER_SHIFT;
+            right = ((int64_t) right * AudioDsp_LimiterGain) >> AUDIODSP_LIMITER_SHIFT;
+        }
+
+        *_left = left;
+        *_right = right;
+    }
+#endif
+
+// Advances ramp by one sample. Returns true if gain changed.
+static inline bool IRAM_ATTR AudioDsp_RunRamp(gainRamp *_ramp) {
+    if (_ramp->requested) {
+        const uint32_t sampleRate = AudioDsp_SampleRate ? AudioDsp_SampleRate : 44100u;
+        const uint32_t numberOfSamples = (uint64_t) _ramp->requestedDurationMs * sampleRate / 1000u;
+        _ramp->target = _ramp->requestedTarget;
+        _ramp->step = numberOfSamples ? (_ramp->target - _ramp->current) / (int32_t) numberOfSamples : 0;
+        _ramp->requested = false;
+        if (!_ramp->step) {
+            _ramp->current = _ramp->target;
+        }
+        return true;
+    }
+
+    if (_ramp->current == _ramp->target) {
+        return false;
+    }
+    _ramp->current += _ramp->step;
+    if ((_ramp->step > 0 && _ramp->current >= _ramp->target) || (_ramp->step < 0 && _ramp->current <= _ramp->target)) {
+        _ramp->current = _ramp->target;
+    }
+    return true;
+}
+
+// Called for every stereo-frame (left: lower 16 bit; right: upper 16 bit) before it's written to I2S.
+// Chain: loudness-measurement => replay-gain/limiter => equalizer => volume/fades
+void IRAM_ATTR AudioDsp_Process(uint32_t *_sample) {
+    int32_t left = (int16_t) (*_sample & 0xFFFF);
+    int32_t right = (int16_t) (*_sample >> 16);
+
+    #ifdef REPLAYGAIN_ENABLE
+        if (AudioDsp_MeasureEnabled) {
+            AudioDsp_MeasureLoudness(left, right);
+        }
+    #endif
+
+    left <<= AUDIODSP_SAMPLE_SHIFT;
+    right <<= AUDIODSP_SAMPLE_SHIFT;
+
+    #ifdef REPLAYGAIN_ENABLE
+        if (AudioDsp_ReplayGain != (1 << AUDIODSP_GAIN_SHIFT) || AudioDsp_LimiterEnabled) {
+            AudioDsp_ApplyReplayGain(&left, &right);
+        }
+    #endif
+
+    #ifdef EQUALIZER_ENABLE
+        if (AudioDsp_BiquadCount) {
+            left = Biquad_Run(left, AudioDsp_Coefficients, AudioDsp_State[0], AudioDsp_BiquadCount);
+            right = Biquad_Run(right, AudioDsp_Coefficients, AudioDsp_State[1], AudioDsp_BiquadCount);
+        }
+    #endif
+
+    // Gain-envelope is updated per sample; so volume-changes and fades are click-free
+    if (AudioDsp_RunRamp(&AudioDsp_VolumeRamp) | AudioDsp_RunRamp(&AudioDsp_FadeRamp) | AudioDsp_RunRamp(&AudioDsp_SleepRamp)) {
+        AudioDsp_OutputGain = ((((int64_t) AudioDsp_VolumeRamp.current * AudioDsp_FadeRamp.current) >> 30) * AudioDsp_SleepRamp.current) >> 30;
+    }
+    left = ((int64_t) left * AudioDsp_OutputGain) >> 30;
+    right = ((int64_t) right * AudioDsp_OutputGain) >> 30;
+
+    *_sample = ((uint32_t) (uint16_t) AudioDsp_Saturate(right) << 16) | (uint16_t) AudioDsp_Saturate(left);
+}
@@ -0,0 +1,18 @@
+#pragma once
+
+#define AUDIODSP_OUTPUT_SPEAKER         0u
+#define AUDIODSP_OUTPUT_HEADPHONE       1u
+
+void AudioDsp_SetOutput(const uint8_t _output);
+void AudioDsp_Update(const uint32_t _sampleRate);
+void AudioDsp_Process(uint32_t *_sample);
+void AudioDsp_SetVolume(const uint8_t _volume);
+void AudioDsp_FadeTo(const bool _on, const uint32_t _durationMs);
+void AudioDsp_SleepFadeTo(const bool _on, const uint32_t _durationMs);
+bool AudioDsp_IsFading(void);
+bool AudioDsp_IsTransparent(void);
+
+#ifdef REPLAYGAIN_ENABLE
+    void AudioDsp_SetReplayGain(const float _gainDb, const bool _limiter, const bool _measure);
+    bool AudioDsp_GetIntegratedLoudness(float *_loudness, uint32_t *_measuredSeconds);
+#endif
@@ -0,0 +1,43 @@
+#include <Arduino.h>
+#include <driver/i2s.h>
+#include "settings.h"
+#include "AudioStats.h"
+#include "Resampler.h"
+#include "UiSound.h"
+
+/* Hooks into the I2S-driver: all calls of i2s_set_sample_rates() and i2s_driver_install() (including the ones of audio-lib
+   and bluetooth) are linked against the __wrap_-functions below (-Wl,--wrap in platformio.ini). */
+
+#ifdef RESAMPLER_ENABLE
+    static uint32_t AudioOutput_I2sRate = 0;       // Rate I2S was configured with (0 => unknown)
+#endif
+
+// Rate is replaced by the resampler's output-rate and I2S is only reconfigured if its rate really changes;
+// so it keeps running with a fixed clock.
+extern "C" esp_err_t __real_i2s_set_sample_rates(i2s_port_t i2s_num, uint32_t rate);
+extern "C" esp_err_t __wrap_i2s_set_sample_rates(i2s_port_t i2s_num, uint32_t rate) {
+    #ifdef RESAMPLER_ENABLE
+        const uint32_t outputRate = Resampler_GetOutputRate(rate);
+        if (outputRate == AudioOutput_I2sRate) {
+            return ESP_OK;
+        }
+        const esp_err_t err = __real_i2s_set_sample_rates(i2s_num, outputRate);
+        AudioOutput_I2sRate = (err == ESP_OK) ? outputRate : 0;
+        return err;
+    #else
+        return __real_i2s_set_sample_rates(i2s_num, rate);
+    #endif
+}
+
+// (Re-)installed driver (e.g. audio-object was rebuilt or bluetooth is started) runs with the rate of _i2s_config.
+// Its DMA-queue is shortened if it's configured for feedback-sounds (refer UiSound_AdjustDmaBuffers()).
+extern "C" esp_err_t __real_i2s_driver_install(i2s_port_t i2s_num, const i2s_config_t *i2s_config, int queue_size, void *i2s_queue);
+extern "C" esp_err_t __wrap_i2s_driver_install(i2s_port_t i2s_num, const i2s_config_t *i2s_config, int queue_size, void *i2s_queue) {
+    #ifdef RESAMPLER_ENABLE
+        AudioOutput_I2sRate = 0;
+    #endif
+    i2s_config_t config = *i2s_config;
+    UiSound_AdjustDmaBuffers(&config.dma_buf_count, &config.dma_buf_len);
+    AudioStats_SetDmaBufferFrames(config.dma_buf_count * config.dma_buf_len);
+    return __real_i2s_driver_install(i2s_num, &config, queue_size, i2s_queue);
+}
@@ -2,31 +2,45 @@
 #include <freertos/task.h>
 #include <esp_task_wdt.h>
 #include "settings.h"
+#include "Announce.h"
 #include "Audio.h"
+#include "AudioDsp.h"
 #include "AudioPlayer.h"
+#include "AudioStats.h"
+#include "ChannelRouter.h"
 #include "Common.h"
 #include "Led.h"
 #include "Log.h"
+#include "Loudness.h"
 #include "MemX.h"
 #include "Mqtt.h"
+#include "PcmPlayer.h"
 #include "Port.h"
 #include "Queues.h"
+#include "Resampler.h"
 #include "Rfid.h"
 #include "RotaryEncoder.h"
 #include "SdCard.h"
+#include "SeekTable.h"
+#include "Spectrum.h"
 #include "System.h"
+#include "TimeStretch.h"
+#include "UiSound.h"
+#include "WebStream.h"
 #include "Wlan.h"
 #include "Web.h"
 
 #define AUDIOPLAYER_VOLUME_MAX 21u
+#define AUDIOPLAYER_VOLUME_FINE_MAX 255u     // Fine volume-scale; legacy scale (0..21) is a compatibility-view of it
 #define AUDIOPLAYER_VOLUME_MIN 0u
 #define AUDIOPLAYER_VOLUME_INIT 3u
 
 playProps gPlayProperties;
+static Audio *AudioPlayer_Audio = NULL;     // Needed by audio_process_i2s() to get current sample rate
 //uint32_t cnt123 = 0;
 
-// Volume
-static uint8_t AudioPlayer_CurrentVolume = AUDIOPLAYER_VOLUME_INIT;
+// Volume (min/max/init use legacy scale 0..21; current volume is kept in fine scale 0..255)
+static uint8_t AudioPlayer_CurrentVolumeFine = (AUDIOPLAYER_VOLUME_INIT * AUDIOPLAYER_VOLUME_FINE_MAX + AUDIOPLAYER_VOLUME_MAX / 2) / AUDIOPLAYER_VOLUME_MAX;
 static uint8_t AudioPlayer_MaxVolume = AUDIOPLAYER_VOLUME_MAX;
 static uint8_t AudioPlayer_MaxVolumeSpeaker = AUDIOPLAYER_VOLUME_MAX;
 static uint8_t AudioPlayer_MinVolume = AUDIOPLAYER_VOLUME_MIN;
@@ -39,6 +53,18 @@ static uint8_t AudioPlayer_InitVolume = AUDIOPLAYER_VOLUME_INIT;
 #endif
 
 static void AudioPlayer_Task(void *parameter);
+static void AudioPlayer_FadeOut(Audio *_audio, const uint16_t _durationMs);
+static bool AudioPlayer_ConnectToFS(Audio *_audio, const char *_path);
+static void AudioPlayer_StopSong(Audio *_audio);
+static void AudioPlayer_PauseResume(Audio *_audio);
+static void AudioPlayer_Loop(Audio *_audio);
+static bool AudioPlayer_IsRunning(Audio *_audio);
+static uint32_t AudioPlayer_GetSampleRate(Audio *_audio);
+static uint32_t AudioPlayer_GetFilePos(Audio *_audio);
+static uint32_t AudioPlayer_GetFileSize(Audio *_audio);
+static uint32_t AudioPlayer_GetAudioCurrentTime(Audio *_audio);
+static bool AudioPlayer_SetFilePos(Audio *_audio, const uint32_t _pos);
+static bool AudioPlayer_SetTimeOffset(Audio *_audio, const int32_t _seconds);
 static void AudioPlayer_HeadphoneVolumeManager(void);
 static char **AudioPlayer_ReturnPlaylistFromWebstream(const char *_webUrl);
 static int AudioPlayer_ArrSortHelper(const void *a, const void *b);
@@ -69,6 +95,7 @@ void AudioPlayer_Init(void) {
         gPrefsSettings.putUInt("initVolume", AudioPlayer_GetInitVolume());
         Log_Println((char *) FPSTR(wroteInitialLoudnessToNvs), LOGLEVEL_ERROR);
     }
+    AudioPlayer_SetCurrentVolume(AudioPlayer_GetInitVolume());
 
     // Get maximum volume for speaker from NVS
     uint32_t nvsMaxVolumeSpeaker = gPrefsSettings.getUInt("maxVolumeSp", 0);
@@ -103,6 +130,10 @@ void AudioPlayer_Init(void) {
     // delete cover image
     gPlayProperties.coverFileName = NULL;
     if (System_GetOperationMode() == OPMODE_NORMAL) {       // Don't start audio-task in BT-mode!
+        SeekTable_Init();
+        WebStream_Init();
+        Announce_Init();
+        UiSound_Init();
         xTaskCreatePinnedToCore(
             AudioPlayer_Task,      /* Function to implement the task */
             "mp3play",             /* Name of the task */
@@ -119,12 +150,31 @@ void AudioPlayer_Cyclic(void) {
     AudioPlayer_HeadphoneVolumeManager();
 }
 
+// Returns current volume in legacy scale (0..21); used by MQTT, webgui, bluetooth and buttons
 uint8_t AudioPlayer_GetCurrentVolume(void) {
-    return AudioPlayer_CurrentVolume;
+    return AudioPlayer_VolumeFromFine(AudioPlayer_CurrentVolumeFine);
 }
 
 void AudioPlayer_SetCurrentVolume(uint8_t value) {
-    AudioPlayer_CurrentVolume = value;
+    AudioPlayer_CurrentVolumeFine = AudioPlayer_VolumeToFine(value);
+}
+
+uint8_t AudioPlayer_GetCurrentVolumeFine(void) {
+    return AudioPlayer_CurrentVolumeFine;
+}
+
+void AudioPlayer_SetCurrentVolumeFine(uint8_t value) {
+    AudioPlayer_CurrentVolumeFine = value;
+}
+
+// Converts legacy volume (0..21) to fine volume (0..255)
+uint8_t AudioPlayer_VolumeToFine(const uint8_t _volume) {
+    return (std::min(_volume, (uint8_t) AUDIOPLAYER_VOLUME_MAX) * AUDIOPLAYER_VOLUME_FINE_MAX + AUDIOPLAYER_VOLUME_MAX / 2) / AUDIOPLAYER_VOLUME_MAX;
+}
+
+// Converts fine volume (0..255) to nearest legacy volume (0..21)
+uint8_t AudioPlayer_VolumeFromFine(const uint8_t _volumeFine) {
+    return (_volumeFine * AUDIOPLAYER_VOLUME_MAX + AUDIOPLAYER_VOLUME_FINE_MAX / 2) / AUDIOPLAYER_VOLUME_FINE_MAX;
 }
 
 uint8_t AudioPlayer_GetMaxVolume(void) {
@@ -167,6 +217,8 @@ void AudioPlayer_SetupVolume(void) {
     #else
         if (Port_Detect_Mode_HP(Port_Read(HP_DETECT))) {
             AudioPlayer_MaxVolume = AudioPlayer_MaxVolumeSpeaker; // 1 if headphone is not connected
+            AudioDsp_SetOutput(AUDIODSP_OUTPUT_SPEAKER);
+            ChannelRouter_SetOutput(AUDIODSP_OUTPUT_SPEAKER);
             #ifdef PLAY_MONO_SPEAKER
                 gPlayProperties.newPlayMono = true;
             #else
@@ -188,6 +240,8 @@ void AudioPlayer_SetupVolume(void) {
         } else {
             AudioPlayer_MaxVolume = AudioPlayer_MaxVolumeHeadphone; // 0 if headphone is connected (put to GND)
             gPlayProperties.newPlayMono = false;                     // always stereo for headphones!
+            AudioDsp_SetOutput(AUDIODSP_OUTPUT_HEADPHONE);
+            ChannelRouter_SetOutput(AUDIODSP_OUTPUT_HEADPHONE);
 
             #ifdef GPIO_PA_EN
                 Port_Write(GPIO_PA_EN, false, true);
@@ -209,6 +263,8 @@ void AudioPlayer_HeadphoneVolumeManager(void) {
         if (AudioPlayer_HeadphoneLastDetectionState != currentHeadPhoneDetectionState && (millis() - AudioPlayer_HeadphoneLastDetectionTimestamp >= headphoneLastDetectionDebounce)) {
             if (currentHeadPhoneDetectionState) {
                 AudioPlayer_MaxVolume = AudioPlayer_MaxVolumeSpeaker;
+                AudioDsp_SetOutput(AUDIODSP_OUTPUT_SPEAKER);
+                ChannelRouter_SetOutput(AUDIODSP_OUTPUT_SPEAKER);
                 #ifdef PLAY_MONO_SPEAKER
                     gPlayProperties.newPlayMono = true;
                 #else
@@ -224,7 +280,9 @@ void AudioPlayer_HeadphoneVolumeManager(void) {
             } else {
                 AudioPlayer_MaxVolume = AudioPlayer_MaxVolumeHeadphone;
                 gPlayProperties.newPlayMono = false; // Always stereo for headphones
-                if (AudioPlayer_GetCurrentVolume() > AudioPlayer_MaxVolume) {
+                AudioDsp_SetOutput(AUDIODSP_OUTPUT_HEADPHONE);
+                ChannelRouter_SetOutput(AUDIODSP_OUTPUT_HEADPHONE);
+                if (AudioPlayer_GetCurrentVolumeFine() > AudioPlayer_VolumeToFine(AudioPlayer_MaxVolume)) {
                     AudioPlayer_VolumeToQueueSender(AudioPlayer_MaxVolume, true); // Lower volume for headphone if headphone's maxvolume is exceeded by volume set in speaker-mode
                 }
 
@@ -258,18 +316,26 @@ void AudioPlayer_Task(void *parameter) {
         static Audio audioAsStatic;         // Don't use heap as it's needed for other stuff :-)
         Audio *audio = &audioAsStatic;
     #endif
+    AudioPlayer_Audio = audio;
 
     #ifdef I2S_COMM_FMT_LSB_ENABLE
         audio->setI2SCommFMT_LSB(true);
     #endif
 
     uint8_t settleCount = 0;
+    #ifdef BOARD_HAS_PSRAM
+        uint32_t inputBufferSize = AudioStats_GetInputBufferSize();
+        audio->setBufsize(-1, inputBufferSize);
+    #endif
     audio->setPinout(I2S_BCLK, I2S_LRC, I2S_DOUT);
-    audio->setVolume(AudioPlayer_GetInitVolume());
-    audio->forceMono(gPlayProperties.currentPlayMono);
-    if (gPlayProperties.currentPlayMono) {
-        audio->setTone(3, 0, 0);
-    }
+    audio->setVolume(AUDIOPLAYER_VOLUME_MAX);     // Volume is applied by DSP-chain (allows for smooth ramps)
+    AudioDsp_SetVolume(AudioPlayer_VolumeToFine(AudioPlayer_GetInitVolume()));
+    ChannelRouter_SetMono(gPlayProperties.currentPlayMono);
+    #ifndef EQUALIZER_ENABLE
+        if (gPlayProperties.currentPlayMono) {
+            audio->setTone(3, 0, 0);
+        }
+    #endif
 
     uint8_t currentVolume;
     static BaseType_t trackQStatus;
@@ -284,10 +350,11 @@ void AudioPlayer_Task(void *parameter) {
         if (xQueueReceive(gVolumeQueue, &currentVolume, 0) == pdPASS) {
             snprintf(Log_Buffer, Log_BufferLength, "%s: %d", (char *) FPSTR(newLoudnessReceivedQueue), currentVolume);
             Log_Println(Log_Buffer, LOGLEVEL_INFO);
-            audio->setVolume(currentVolume);
+            AudioDsp_SetVolume(currentVolume);
             Web_SendWebsocketData(0, 50);
             #ifdef MQTT_ENABLE
-                publishMqtt((char *) FPSTR(topicLoudnessState), currentVolume, false);
+                publishMqtt((char *) FPSTR(topicLoudnessState), AudioPlayer_VolumeFromFine(currentVolume), false);
+                publishMqtt((char *) FPSTR(topicLoudnessFineState), currentVolume, false);
             #endif
         }
 
@@ -302,7 +369,8 @@ void AudioPlayer_Task(void *parameter) {
                 if (gPlayProperties.pausePlay) {
                     gPlayProperties.pausePlay = false;
                 }
-                audio->stopSong();
+                AudioPlayer_FadeOut(audio, fadeTimeTrackChange);
+                AudioPlayer_StopSong(audio);
                 #if (LANGUAGE == DE)
                     snprintf(Log_Buffer, Log_BufferLength, "%s mit %d Titel(n)", (char *) FPSTR(newPlaylistReceived), gPlayProperties.numberOfTracks);
                 #else
@@ -320,6 +388,7 @@ void AudioPlayer_Task(void *parameter) {
             }
             if (gPlayProperties.trackFinished) {
                 gPlayProperties.trackFinished = false;
+                Loudness_TrackFinished();
                 if (gPlayProperties.playMode == NO_PLAYLIST) {
                     gPlayProperties.playlistFinished = true;
                     continue;
@@ -353,12 +422,16 @@ void AudioPlayer_Task(void *parameter) {
                (stop, start, next track, prev. track, last track, first track...) */
             switch (trackCommand) {
                 case STOP:
-                    audio->stopSong();
+                    AudioPlayer_FadeOut(audio, fadeTimePause);
+                    AudioPlayer_StopSong(audio);
+                    WebStream_Stop();
                     trackCommand = 0;
                     Log_Println((char *) FPSTR(cmndStop), LOGLEVEL_INFO);
                     gPlayProperties.pausePlay = true;
                     gPlayProperties.playlistFinished = true;
                     gPlayProperties.playMode = NO_PLAYLIST;
+                    SeekTable_Release();
+                    Loudness_TrackFinished();
                     // delete title
                     if (gPlayProperties.title) {
                         free(gPlayProperties.title);
@@ -371,13 +444,19 @@ void AudioPlayer_Task(void *parameter) {
                     continue;
 
                 case PAUSEPLAY:
-                    audio->pauseResume();
+                    if (gPlayProperties.pausePlay) {
+                        AudioPlayer_PauseResume(audio);
+                        AudioDsp_FadeTo(true, fadeTimePause);
+                    } else {
+                        AudioPlayer_FadeOut(audio, fadeTimePause);
+                        AudioPlayer_PauseResume(audio);
+                    }
                     trackCommand = 0;
                     Log_Println((char *) FPSTR(cmndPause), LOGLEVEL_INFO);
                     if (gPlayProperties.saveLastPlayPosition && !gPlayProperties.pausePlay) {
-                        snprintf(Log_Buffer, Log_BufferLength, "%s: %u", (char *) FPSTR(trackPausedAtPos), audio->getFilePos());
+                        snprintf(Log_Buffer, Log_BufferLength, "%s: %u", (char *) FPSTR(trackPausedAtPos), AudioPlayer_GetFilePos(audio));
                         Log_Println(Log_Buffer, LOGLEVEL_INFO);
-                        AudioPlayer_NvsRfidWriteWrapper(gPlayProperties.playRfidTag, *(gPlayProperties.playlist + gPlayProperties.currentTrackNumber), audio->getFilePos(), gPlayProperties.playMode, gPlayProperties.currentTrackNumber, gPlayProperties.numberOfTracks);
+                        AudioPlayer_NvsRfidWriteWrapper(gPlayProperties.playRfidTag, *(gPlayProperties.playlist + gPlayProperties.currentTrackNumber), AudioPlayer_GetFilePos(audio), gPlayProperties.playMode, gPlayProperties.currentTrackNumber, gPlayProperties.numberOfTracks);
                     }
                     gPlayProperties.pausePlay = !gPlayProperties.pausePlay;
                     Web_SendWebsocketData(0, 30);
@@ -385,7 +464,7 @@ void AudioPlayer_Task(void *parameter) {
 
                 case NEXTTRACK:
                     if (gPlayProperties.pausePlay) {
-                        audio->pauseResume();
+                        AudioPlayer_PauseResume(audio);
                         gPlayProperties.pausePlay = false;
                     }
                     if (gPlayProperties.repeatCurrentTrack) { // End loop if button was pressed
@@ -404,7 +483,8 @@ void AudioPlayer_Task(void *parameter) {
                         }
                         Log_Println((char *) FPSTR(cmndNextTrack), LOGLEVEL_INFO);
                         if (!gPlayProperties.playlistFinished) {
-                            audio->stopSong();
+                            AudioPlayer_FadeOut(audio, fadeTimeTrackChange);
+                            AudioPlayer_StopSong(audio);
                         }
                     } else {
                         Log_Println((char *) FPSTR(lastTrackAlreadyActive), LOGLEVEL_NOTICE);
@@ -417,7 +497,7 @@ void AudioPlayer_Task(void *parameter) {
 
                 case PREVIOUSTRACK:
                     if (gPlayProperties.pausePlay) {
-                        audio->pauseResume();
+                        AudioPlayer_PauseResume(audio);
                         gPlayProperties.pausePlay = false;
                     }
                     if (gPlayProperties.repeatCurrentTrack) { // End loop if button was pressed
@@ -430,7 +510,7 @@ void AudioPlayer_Task(void *parameter) {
                     }
                     if (gPlayProperties.currentTrackNumber > 0) {
                         // play previous track when current track time is small, else play current track again
-                        if (audio->getAudioCurrentTime() < 2) {
+                        if (AudioPlayer_GetAudioCurrentTime(audio) < 2) {
                             gPlayProperties.currentTrackNumber--;
                         }
                         if (gPlayProperties.saveLastPlayPosition) {
@@ -440,7 +520,8 @@ void AudioPlayer_Task(void *parameter) {
 
                         Log_Println((char *) FPSTR(cmndPrevTrack), LOGLEVEL_INFO);
                         if (!gPlayProperties.playlistFinished) {
-                            audio->stopSong();
+                            AudioPlayer_FadeOut(audio, fadeTimeTrackChange);
+                            AudioPlayer_StopSong(audio);
                         }
                     } else {
                         if (gPlayProperties.playMode == WEBSTREAM) {
@@ -452,7 +533,8 @@ void AudioPlayer_Task(void *parameter) {
                         if (gPlayProperties.saveLastPlayPosition) {
                             AudioPlayer_NvsRfidWriteWrapper(gPlayProperties.playRfidTag, *(gPlayProperties.playlist + gPlayProperties.currentTrackNumber), 0, gPlayProperties.playMode, gPlayProperties.currentTrackNumber, gPlayProperties.numberOfTracks);
                         }
-                        audio->stopSong();
+                        AudioPlayer_FadeOut(audio, fadeTimeTrackChange);
+                        AudioPlayer_StopSong(audio);
                         Led_Indicate(LedIndicatorType::Rewind);
                         // delete title
                         if (gPlayProperties.title) {
@@ -462,13 +544,19 @@ void AudioPlayer_Task(void *parameter) {
                         // delete cover image
 						gPlayProperties.coverFileName = NULL;
                         Web_SendWebsocketData(0, 40);
-                        audioReturnCode = audio->connecttoFS(gFSystem, *(gPlayProperties.playlist + gPlayProperties.currentTrackNumber));
+                        audioReturnCode = AudioPlayer_ConnectToFS(audio, *(gPlayProperties.playlist + gPlayProperties.currentTrackNumber));
                         // consider track as finished, when audio lib call was not successful
                         if (!audioReturnCode) {
                             System_IndicateError();
                             gPlayProperties.trackFinished = true;
                             continue;
                         }
+                        SeekTable_Prepare(*(gPlayProperties.playlist + gPlayProperties.currentTrackNumber), gPlayProperties.saveLastPlayPosition);
+                        AudioStats_TrackStarted();
+                        Resampler_TrackStarted();
+                        TimeStretch_TrackStarted();
+                        AudioDsp_FadeTo(true, fadeTimeTrackChange);
+                        Loudness_TrackStarted(*(gPlayProperties.playlist + gPlayProperties.currentTrackNumber), false);
                         Log_Println((char *) FPSTR(trackStart), LOGLEVEL_INFO);
                         trackCommand = 0;
                         continue;
@@ -478,7 +566,7 @@ void AudioPlayer_Task(void *parameter) {
 
                 case FIRSTTRACK:
                     if (gPlayProperties.pausePlay) {
-                        audio->pauseResume();
+                        AudioPlayer_PauseResume(audio);
                         gPlayProperties.pausePlay = false;
                     }
                     if (gPlayProperties.currentTrackNumber > 0) {
@@ -489,7 +577,8 @@ void AudioPlayer_Task(void *parameter) {
                         }
                         Log_Println((char *) FPSTR(cmndFirstTrack), LOGLEVEL_INFO);
                         if (!gPlayProperties.playlistFinished) {
-                            audio->stopSong();
+                            AudioPlayer_FadeOut(audio, fadeTimeTrackChange);
+                            AudioPlayer_StopSong(audio);
                         }
                     } else {
                         Log_Println((char *) FPSTR(firstTrackAlreadyActive), LOGLEVEL_NOTICE);
@@ -502,7 +591,7 @@ void AudioPlayer_Task(void *parameter) {
 
                 case LASTTRACK:
                     if (gPlayProperties.pausePlay) {
-                        audio->pauseResume();
+                        AudioPlayer_PauseResume(audio);
                         gPlayProperties.pausePlay = false;
                     }
                     if (gPlayProperties.currentTrackNumber + 1 < gPlayProperties.numberOfTracks) {
@@ -513,7 +602,8 @@ void AudioPlayer_Task(void *parameter) {
                         }
                         Log_Println((char *) FPSTR(cmndLastTrack), LOGLEVEL_INFO);
                         if (!gPlayProperties.playlistFinished) {
-                            audio->stopSong();
+                            AudioPlayer_FadeOut(audio, fadeTimeTrackChange);
+                            AudioPlayer_StopSong(audio);
                         }
                     } else {
                         Log_Println((char *) FPSTR(lastTrackAlreadyActive), LOGLEVEL_NOTICE);
@@ -593,6 +683,29 @@ void AudioPlayer_Task(void *parameter) {
             gPlayProperties.currentRelPos = 0;
             audioReturnCode = false;
 
+            #ifdef BOARD_HAS_PSRAM
+                // Audio-lib allocates its input-buffer only once. So audio-object needs to be rebuilt if buffer has to grow due to underruns.
+                if (inputBufferSize != AudioStats_GetInputBufferSize()) {
+                    AudioPlayer_StopSong(audio);
+                    delete audio;
+                    audio = new AudioCustom();
+                    AudioPlayer_Audio = audio;
+                    inputBufferSize = AudioStats_GetInputBufferSize();
+                    audio->setBufsize(-1, inputBufferSize);
+                    #ifdef I2S_COMM_FMT_LSB_ENABLE
+                        audio->setI2SCommFMT_LSB(true);
+                    #endif
+                    audio->setPinout(I2S_BCLK, I2S_LRC, I2S_DOUT);
+                    audio->setVolume(AUDIOPLAYER_VOLUME_MAX);
+                    ChannelRouter_SetMono(gPlayProperties.currentPlayMono);
+                    #ifndef EQUALIZER_ENABLE
+                        if (gPlayProperties.currentPlayMono) {
+                            audio->setTone(3, 0, 0);
+                        }
+                    #endif
+                }
+            #endif
+
             if (gPlayProperties.playMode == WEBSTREAM || (gPlayProperties.playMode == LOCAL_M3U && gPlayProperties.isWebstream)) { // Webstream
                 // delete title
                 if (gPlayProperties.title) {
@@ -602,7 +715,11 @@ void AudioPlayer_Task(void *parameter) {
                 // delete cover image
                 gPlayProperties.coverFileName = NULL;
                 Web_SendWebsocketData(0, 40);
-                audioReturnCode = audio->connecttohost(*(gPlayProperties.playlist + gPlayProperties.currentTrackNumber));
+                // Use local proxy (buffers in PSRAM + reconnects) if available; otherwise connect directly
+                char localUrl[32];
+                const char *url = *(gPlayProperties.playlist + gPlayProperties.currentTrackNumber);
+                PcmPlayer_Stop();
+                audioReturnCode = WebStream_Start(url, localUrl, sizeof(localUrl)) ? audio->connecttohost(localUrl) : audio->connecttohost(url);
                 gPlayProperties.playlistFinished = false;
                 Web_SendWebsocketData(0, 30);
             } else if (gPlayProperties.playMode != WEBSTREAM && !gPlayProperties.isWebstream) {
@@ -621,7 +738,8 @@ void AudioPlayer_Task(void *parameter) {
                     // delete cover image
                     gPlayProperties.coverFileName = NULL;
                     Web_SendWebsocketData(0, 40);
-                    audioReturnCode = audio->connecttoFS(gFSystem, *(gPlayProperties.playlist + gPlayProperties.currentTrackNumber));
+                    WebStream_Stop();
+                    audioReturnCode = AudioPlayer_ConnectToFS(audio, *(gPlayProperties.playlist + gPlayProperties.currentTrackNumber));
                     // consider track as finished, when audio lib call was not successful
                 }
             }
@@ -634,10 +752,20 @@ void AudioPlayer_Task(void *parameter) {
                 if (gPlayProperties.currentTrackNumber) {
                     Led_Indicate(LedIndicatorType::PlaylistProgress);
                 }
+                AudioStats_TrackStarted();
+                Resampler_TrackStarted();
+                TimeStretch_TrackStarted();
+                AudioDsp_FadeTo(true, fadeTimeTrackChange);
+                Loudness_TrackStarted(*(gPlayProperties.playlist + gPlayProperties.currentTrackNumber), gPlayProperties.isWebstream);
+                if (gPlayProperties.isWebstream) {
+                    SeekTable_Release();
+                } else {
+                    SeekTable_Prepare(*(gPlayProperties.playlist + gPlayProperties.currentTrackNumber), gPlayProperties.saveLastPlayPosition); // Audiobooks get their seek-table right from the start
+                }
                 if (gPlayProperties.startAtFilePos > 0) {
-                    audio->setFilePos(gPlayProperties.startAtFilePos);
+                    AudioPlayer_SetFilePos(audio, SeekTable_AlignToFrame(gPlayProperties.startAtFilePos));
                     gPlayProperties.startAtFilePos = 0;
-                    snprintf(Log_Buffer, Log_BufferLength, "%s %u", (char *) FPSTR(trackStartatPos), audio->getFilePos());
+                    snprintf(Log_Buffer, Log_BufferLength, "%s %u", (char *) FPSTR(trackStartatPos), AudioPlayer_GetFilePos(audio));
                     Log_Println(Log_Buffer, LOGLEVEL_NOTICE);
                 }
                 if (!gPlayProperties.isWebstream) {         // Is done via audio_showstation()
@@ -660,8 +788,9 @@ void AudioPlayer_Task(void *parameter) {
 
         // Handle seekmodes
         if (gPlayProperties.seekmode != SEEK_NORMAL) {
+            uint32_t seekPos;
             if (gPlayProperties.seekmode == SEEK_FORWARDS) {
-                if (audio->setTimeOffset(jumpOffset)) {
+                if (SeekTable_GetSeekPosition(AudioPlayer_GetFilePos(audio), jumpOffset, &seekPos) ? AudioPlayer_SetFilePos(audio, seekPos) : AudioPlayer_SetTimeOffset(audio, jumpOffset)) {
                     #if (LANGUAGE == DE)
                         snprintf(Log_Buffer, Log_BufferLength, "%d Sekunden nach vorne gesprungen", jumpOffset);
                     #else
@@ -672,7 +801,7 @@ void AudioPlayer_Task(void *parameter) {
                     System_IndicateError();
                 }
             } else if (gPlayProperties.seekmode == SEEK_BACKWARDS) {
-                if (audio->setTimeOffset(-(jumpOffset))) {
+                if (SeekTable_GetSeekPosition(AudioPlayer_GetFilePos(audio), -(jumpOffset), &seekPos) ? AudioPlayer_SetFilePos(audio, seekPos) : AudioPlayer_SetTimeOffset(audio, -(jumpOffset))) {
                     #if (LANGUAGE == DE)
                         snprintf(Log_Buffer, Log_BufferLength, "%d Sekunden zurueck gesprungen", jumpOffset);
                     #else
@@ -692,6 +821,10 @@ void AudioPlayer_Task(void *parameter) {
             char ipBuf[16];
             Wlan_GetIpAddress().toCharArray(ipBuf, sizeof(ipBuf));
             bool speechOk;
+            PcmPlayer_Stop();
+            AudioDsp_FadeTo(true, 0);
+            Resampler_TrackStarted();
+            TimeStretch_TrackStarted();
             #if (LANGUAGE == DE)
                 speechOk = audio->connecttospeech(ipBuf, "de");
             #else
@@ -702,6 +835,25 @@ void AudioPlayer_Task(void *parameter) {
             }
         }
 
+        // Handle offline-announcements (current track is paused meanwhile)
+        if (Announce_IsPending()) {
+            const bool pauseTrack = AudioPlayer_IsRunning(audio) && !gPlayProperties.pausePlay;
+            if (pauseTrack) {
+                AudioPlayer_FadeOut(audio, fadeTimePause);
+                AudioPlayer_PauseResume(audio);
+            }
+            Announce_Play(AudioPlayer_GetSampleRate(audio));
+            if (pauseTrack) {
+                AudioPlayer_PauseResume(audio);
+                AudioDsp_FadeTo(true, fadeTimePause);
+            }
+        }
+
+        // UI-sounds are mixed into playback; if there's none, they're rendered here
+        if (UiSound_IsActive() && (!AudioPlayer_IsRunning(audio) || gPlayProperties.pausePlay)) {
+            UiSound_Render(AudioPlayer_GetSampleRate(audio));
+        }
+
         // If speech is over, go back to predefined state
         if (!gPlayProperties.currentSpeechActive && gPlayProperties.lastSpeechActive) {
             gPlayProperties.lastSpeechActive = false;
@@ -713,19 +865,23 @@ void AudioPlayer_Task(void *parameter) {
         // Handle if mono/stereo should be changed (e.g. if plugging headphones)
         if (gPlayProperties.newPlayMono != gPlayProperties.currentPlayMono) {
             gPlayProperties.currentPlayMono = gPlayProperties.newPlayMono;
-            audio->forceMono(gPlayProperties.currentPlayMono);
+            ChannelRouter_SetMono(gPlayProperties.currentPlayMono);
             if (gPlayProperties.currentPlayMono) {
                 Log_Println(newPlayModeMono, LOGLEVEL_NOTICE);
-                audio->setTone(3, 0, 0);
+                #ifndef EQUALIZER_ENABLE
+                    audio->setTone(3, 0, 0);
+                #endif
             } else {
                 Log_Println(newPlayModeStereo, LOGLEVEL_NOTICE);
-                audio->setTone(0, 0, 0);
+                #ifndef EQUALIZER_ENABLE
+                    audio->setTone(0, 0, 0);
+                #endif
             }
         }
 
         // Calculate relative position in file (for neopixel) for SD-card-mode
         if (!gPlayProperties.playlistFinished && !gPlayProperties.isWebstream) {
-            double fp = (double)audio->getFilePos() / (double)audio->getFileSize();
+            double fp = (double)AudioPlayer_GetFilePos(audio) / (double)AudioPlayer_GetFileSize(audio);
             if (millis() % 100 == 0) {
                 gPlayProperties.currentRelPos = fp * 100;
             }
@@ -733,19 +889,23 @@ void AudioPlayer_Task(void *parameter) {
             gPlayProperties.currentRelPos = 0;
         }
 
-        audio->loop();
+        uint32_t decodeStartTimestamp = micros();
+        AudioDsp_Update(AudioPlayer_GetSampleRate(audio));
+        AudioPlayer_Loop(audio);
+        WebStream_HandleTitle();
+        AudioStats_Update(AudioPlayer_IsRunning(audio) && !gPlayProperties.pausePlay, Resampler_GetOutputRate(AudioPlayer_GetSampleRate(audio)), micros() - decodeStartTimestamp);
         if (gPlayProperties.playlistFinished || gPlayProperties.pausePlay) {
             vTaskDelay(portTICK_PERIOD_MS * 10); // Waste some time if playlist is not active
         } else {
             System_UpdateActivityTimer(); // Refresh if playlist is active so uC will not fall asleep due to reaching inactivity-time
         }
 
-        if (audio->isRunning()) {
+        if (AudioPlayer_IsRunning(audio)) {
             settleCount = 0;
         }
 
         // If error occured: remove playlist from ESPuino
-        if (gPlayProperties.playMode != NO_PLAYLIST && gPlayProperties.playMode != BUSY && !audio->isRunning() && !gPlayProperties.pausePlay) {
+        if (gPlayProperties.playMode != NO_PLAYLIST && gPlayProperties.playMode != BUSY && !AudioPlayer_IsRunning(audio) && !gPlayProperties.pausePlay) {
             if (settleCount++ == 50) { // Hack to give audio some time to settle down after playlist was generated
                 gPlayProperties.playlistFinished = true;
                 gPlayProperties.playMode = NO_PLAYLIST;
@@ -759,6 +919,88 @@ void AudioPlayer_Task(void *parameter) {
     vTaskDelete(NULL);
 }
 
+// Fades out current track and keeps decoding until silence is reached. So stop/pause/track-change doesn't click.
+void AudioPlayer_FadeOut(Audio *_audio, const uint16_t _durationMs) {
+    if (!AudioPlayer_IsRunning(_audio) || gPlayProperties.pausePlay) {
+        AudioDsp_FadeTo(false, 0);
+        return;
+    }
+
+    AudioDsp_FadeTo(false, _durationMs);
+    const uint32_t fadeStartTimestamp = millis();
+    while (AudioDsp_IsFading() && (millis() - fadeStartTimestamp < _durationMs + 500u)) {
+        AudioPlayer_Loop(_audio);
+        vTaskDelay(portTICK_PERIOD_MS * 1);
+    }
+}
+
+/* Files from SD are played either by PCM fast path (WAV) or by audio-lib. The following wrappers dispatch to the one
+   that is active; so the rest of AudioPlayer_Task doesn't need to care. */
+bool AudioPlayer_ConnectToFS(Audio *_audio, const char *_path) {
+    _audio->stopSong();
+    if (PcmPlayer_Start(_path)) {
+        return true;
+    }
+    return _audio->connecttoFS(gFSystem, _path);
+}
+
+void AudioPlayer_StopSong(Audio *_audio) {
+    PcmPlayer_Stop();
+    _audio->stopSong();
+}
+
+void AudioPlayer_PauseResume(Audio *_audio) {
+    if (PcmPlayer_IsActive()) {
+        PcmPlayer_PauseResume();
+    } else {
+        _audio->pauseResume();
+    }
+}
+
+void AudioPlayer_Loop(Audio *_audio) {
+    if (PcmPlayer_IsActive()) {
+        PcmPlayer_Loop();
+    } else {
+        PcmPlayer_FlushSilence();
+        _audio->loop();
+    }
+}
+
+bool AudioPlayer_IsRunning(Audio *_audio) {
+    return PcmPlayer_IsActive() ? PcmPlayer_IsRunning() : _audio->isRunning();
+}
+
+uint32_t AudioPlayer_GetSampleRate(Audio *_audio) {
+    return PcmPlayer_IsActive() ? PcmPlayer_GetSampleRate() : _audio->getSampleRate();
+}
+
+// Returns position of the frame being decoded. Audio-lib's getFilePos() is its read-ahead-position,
+// so data still waiting in its input-buffer is subtracted (otherwise seeks and resume-points are off by that amount).
+uint32_t AudioPlayer_GetFilePos(Audio *_audio) {
+    if (PcmPlayer_IsActive()) {
+        return PcmPlayer_GetFilePos();
+    }
+    const uint32_t readPos = _audio->getFilePos();
+    const uint32_t buffered = _audio->inBufferFilled();
+    return (readPos > buffered) ? readPos - buffered : 0;
+}
+
+uint32_t AudioPlayer_GetFileSize(Audio *_audio) {
+    return PcmPlayer_IsActive() ? PcmPlayer_GetFileSize() : _audio->getFileSize();
+}
+
+uint32_t AudioPlayer_GetAudioCurrentTime(Audio *_audio) {
+    return PcmPlayer_IsActive() ? PcmPlayer_GetCurrentTime() : _audio->getAudioCurrentTime();
+}
+
+bool AudioPlayer_SetFilePos(Audio *_audio, const uint32_t _pos) {
+    return PcmPlayer_IsActive() ? PcmPlayer_SetFilePos(_pos) : _audio->setFilePos(_pos);
+}
+
+bool AudioPlayer_SetTimeOffset(Audio *_audio, const int32_t _seconds) {
+    return PcmPlayer_IsActive() ? PcmPlayer_SetTimeOffset(_seconds) : _audio->setTimeOffset(_seconds);
+}
+
 // Returns current repeat-mode (mix of repeat current track and current playlist)
 uint8_t AudioPlayer_GetRepeatMode(void) {
     if (gPlayProperties.repeatPlaylist && gPlayProperties.repeatCurrentTrack) {
@@ -772,19 +1014,33 @@ uint8_t AudioPlayer_GetRepeatMode(void) {
     }
 }
 
-// Adds new volume-entry to volume-queue
+// Adds new volume-entry (legacy scale 0..21) to volume-queue
 // If volume is changed via webgui or MQTT, it's necessary to re-adjust current value of rotary-encoder.
 void AudioPlayer_VolumeToQueueSender(const int32_t _newVolume, bool reAdjustRotary) {
-    uint32_t _volume;
     if (_newVolume < AudioPlayer_GetMinVolume()) {
         Log_Println((char *) FPSTR(minLoudnessReached), LOGLEVEL_INFO);
         return;
     } else if (_newVolume > AudioPlayer_GetMaxVolume()) {
         Log_Println((char *) FPSTR(maxLoudnessReached), LOGLEVEL_INFO);
         return;
+    }
+    AudioPlayer_VolumeFineToQueueSender(AudioPlayer_VolumeToFine(_newVolume), reAdjustRotary);
+}
+
+// Adds new volume-entry (fine scale 0..255) to volume-queue
+void AudioPlayer_VolumeFineToQueueSender(const int32_t _newVolumeFine, bool reAdjustRotary) {
+    uint8_t _volume;
+    if (_newVolumeFine < AudioPlayer_VolumeToFine(AudioPlayer_GetMinVolume())) {
+        Log_Println((char *) FPSTR(minLoudnessReached), LOGLEVEL_INFO);
+        UiSound_Play(UISOUND_VOLUME_LIMIT);
+        return;
+    } else if (_newVolumeFine > AudioPlayer_VolumeToFine(AudioPlayer_GetMaxVolume())) {
+        Log_Println((char *) FPSTR(maxLoudnessReached), LOGLEVEL_INFO);
+        UiSound_Play(UISOUND_VOLUME_LIMIT);
+        return;
     } else {
-        _volume = _newVolume;
-        AudioPlayer_SetCurrentVolume(_volume);
+        _volume = _newVolumeFine;
+        AudioPlayer_SetCurrentVolumeFine(_volume);
         if (reAdjustRotary) {
             RotaryEncoder_Readjust();
         }
@@ -1025,7 +1281,7 @@ size_t AudioPlayer_NvsRfidWriteWrapper(const char *_rfidCardId, const char *_tra
         }
     }
 
-    snprintf(prefBuf, sizeof(prefBuf) / sizeof(prefBuf[0]), "%s%s%s%u%s%d%s%u", stringDelimiter, trackBuf, stringDelimiter, _playPosition, stringDelimiter, _playMode, stringDelimiter, _trackLastPlayed);
+    snprintf(prefBuf, sizeof(prefBuf) / sizeof(prefBuf[0]), "%s%s%s%u%s%d%s%u%s%u", stringDelimiter, trackBuf, stringDelimiter, _playPosition, stringDelimiter, _playMode, stringDelimiter, _trackLastPlayed, stringDelimiter, TimeStretch_GetSpeed());
     #if (LANGUAGE == DE)
         snprintf(Log_Buffer, Log_BufferLength, "Schreibe '%s' in NVS für RFID-Card-ID %s mit Abspielmodus %d und letzter Track %u\n", prefBuf, _rfidCardId, _playMode, _trackLastPlayed);
     #else
@@ -1096,6 +1352,15 @@ void audio_info(const char *info) {
     Log_Println(Log_Buffer, LOGLEVEL_INFO);
 }
 
+// Called by audio-lib for every frame before it's written to I2S
+void audio_process_i2s(uint32_t *sample, bool *continueI2S) {
+    Spectrum_Process(*sample, AudioPlayer_Audio->getSampleRate());
+    UiSound_Process(sample, AudioPlayer_Audio->getSampleRate());
+    ChannelRouter_Process(sample, AudioPlayer_Audio->getSampleRate());
+    AudioDsp_Process(sample);
+    TimeStretch_Process(sample, continueI2S, AudioPlayer_Audio->getSampleRate());   // Writes to I2S itself if stretching or resampling is needed
+}
+
 void audio_id3data(const char *info) { //id3 metadata
     snprintf(Log_Buffer, Log_BufferLength, "id3data     : %s", info);
     Log_Println(Log_Buffer, LOGLEVEL_INFO);
@@ -36,11 +36,16 @@ void AudioPlayer_Init(void);
 void AudioPlayer_Cyclic(void);
 uint8_t AudioPlayer_GetRepeatMode(void);
 void AudioPlayer_VolumeToQueueSender(const int32_t _newVolume, bool reAdjustRotary);
+void AudioPlayer_VolumeFineToQueueSender(const int32_t _newVolumeFine, bool reAdjustRotary);
 void AudioPlayer_TrackQueueDispatcher(const char *_itemToPlay, const uint32_t _lastPlayPos, const uint32_t _playMode, const uint16_t _trackLastPlayed);
 void AudioPlayer_TrackControlToQueueSender(const uint8_t trackCommand);
 
 uint8_t AudioPlayer_GetCurrentVolume(void);
 void AudioPlayer_SetCurrentVolume(uint8_t value);
+uint8_t AudioPlayer_GetCurrentVolumeFine(void);
+void AudioPlayer_SetCurrentVolumeFine(uint8_t value);
+uint8_t AudioPlayer_VolumeToFine(const uint8_t _volume);
+uint8_t AudioPlayer_VolumeFromFine(const uint8_t _volumeFine);
 uint8_t AudioPlayer_GetMaxVolume(void);
 void AudioPlayer_SetMaxVolume(uint8_t value);
 uint8_t AudioPlayer_GetMaxVolumeSpeaker(void);
@@ -0,0 +1,197 @@
+#include <Arduino.h>
+#include "settings.h"
+#include "AudioStats.h"
+#include "AudioPlayer.h"
+#include "Log.h"
+#include "Mqtt.h"
+#include "Web.h"
+#include "WebStream.h"
+
+static audioStats AudioStats_Stats = {0, 0, 0, 0, 0, 0, 0, audioStatsInputBufferDefault, false};
+
+static volatile uint32_t AudioStats_OutputFrames = 0;          // Incremented for every (stereo-)frame the audio-lib sends to I2S
+static uint32_t AudioStats_LastOutputFrames = 0;
+static uint32_t AudioStats_LastUpdateTimestampUs = 0;
+static uint32_t AudioStats_LastOutputTimestamp = 0;
+static uint32_t AudioStats_LastUnderrunTimestamp = 0;
+static uint32_t AudioStats_DmaFillFrames = 0;
+static uint32_t AudioStats_DmaBufferFrames = audioStatsDmaBufferFrames;  // Size of I2S-DMA-queue (in frames)
+static bool AudioStats_DmaPrimed = false;                      // DMA-buffer was filled at least halfway since start/last underrun
+static uint32_t AudioStats_DecodeTimeSumUs = 0;
+static uint32_t AudioStats_PlayTimeSumUs = 0;
+
+static void AudioStats_HandleUnderrun(void);
+
+// Called by audio-lib (via audio_process_i2s()) for every frame that is written to I2S
+void IRAM_ATTR AudioStats_OnOutputFrame(void) {
+    AudioStats_OutputFrames++;
+}
+
+// Same for blocks that are written to I2S without per-frame processing
+void AudioStats_OnOutputFrames(const uint32_t _frames) {
+    AudioStats_OutputFrames += _frames;
+}
+
+// Called when I2S-driver is installed (refer AudioOutput.cpp)
+void AudioStats_SetDmaBufferFrames(const uint32_t _frames) {
+    AudioStats_DmaBufferFrames = _frames;
+}
+
+uint32_t AudioStats_GetDmaBufferFrames(void) {
+    return AudioStats_DmaBufferFrames;
+}
+
+// Resets all per-track-counters
+void AudioStats_TrackStarted(void) {
+    AudioStats_Stats.underrunsTrack = 0;
+    AudioStats_Stats.decodeMaxUs = 0;
+    AudioStats_Stats.longestStallMs = 0;
+    AudioStats_DmaFillFrames = 0;
+    AudioStats_DmaPrimed = false;
+    AudioStats_LastOutputTimestamp = 0;
+}
+
+// Called by AudioPlayer_Task after every run of audio->loop()
+void AudioStats_Update(const bool _playing, const uint32_t _sampleRate, const uint32_t _decodeTimeUs) {
+    const uint32_t now = micros();
+    const uint32_t elapsedUs = now - AudioStats_LastUpdateTimestampUs;
+    const uint32_t outputFrames = AudioStats_OutputFrames;
+    const uint32_t newFrames = outputFrames - AudioStats_LastOutputFrames;
+    AudioStats_LastUpdateTimestampUs = now;
+    AudioStats_LastOutputFrames = outputFrames;
+
+    if (!_playing || !_sampleRate) {    // Pause, stop or not yet started
+        AudioStats_DmaFillFrames = 0;
+        AudioStats_DmaPrimed = false;
+        AudioStats_LastOutputTimestamp = 0;
+        AudioStats_Stats.dmaFill = 0;
+        return;
+    }
+
+    // I2S-driver doesn't expose its fill-level. So it's estimated by comparing the number of frames written
+    // with the number of frames I2S consumed meanwhile. As i2s_write() blocks if DMA is full, fill is limited to its size.
+    const uint32_t fillBefore = AudioStats_DmaFillFrames;
+    const uint32_t consumedFrames = (uint64_t) elapsedUs * _sampleRate / 1000000u;
+    uint32_t fill = fillBefore + newFrames;
+    fill = (fill > consumedFrames) ? fill - consumedFrames : 0;
+    if (fill > AudioStats_DmaBufferFrames) {
+        fill = AudioStats_DmaBufferFrames;
+    }
+    AudioStats_DmaFillFrames = fill;
+    AudioStats_Stats.dmaFill = fill * 100u / AudioStats_DmaBufferFrames;
+
+    if (fill >= AudioStats_DmaBufferFrames / 2) {
+        AudioStats_DmaPrimed = true;
+    } else if (!fill && AudioStats_DmaPrimed) {
+        AudioStats_DmaPrimed = false;
+        AudioStats_HandleUnderrun();
+    }
+
+    if (!newFrames) {
+        return;
+    }
+
+    const uint32_t currentTimestamp = millis();
+    if (AudioStats_LastOutputTimestamp && (currentTimestamp - AudioStats_LastOutputTimestamp > AudioStats_Stats.longestStallMs)) {
+        AudioStats_Stats.longestStallMs = currentTimestamp - AudioStats_LastOutputTimestamp;
+    }
+    AudioStats_LastOutputTimestamp = currentTimestamp;
+
+    // Duration of audio->loop() only reflects decoding if i2s_write() didn't have to wait for free DMA-space
+    if (fillBefore < AudioStats_DmaBufferFrames / 2) {
+        AudioStats_Stats.decodeAvgUs = (AudioStats_Stats.decodeAvgUs * 7u + _decodeTimeUs) / 8u;
+        if (_decodeTimeUs > AudioStats_Stats.decodeMaxUs) {
+            AudioStats_Stats.decodeMaxUs = _decodeTimeUs;
+        }
+        AudioStats_DecodeTimeSumUs += _decodeTimeUs;
+        AudioStats_PlayTimeSumUs += (uint64_t) newFrames * 1000000u / _sampleRate;
+        if (AudioStats_PlayTimeSumUs >= 1000000u) {
+            AudioStats_Stats.decodeLoad = (uint64_t) AudioStats_DecodeTimeSumUs * 100u / AudioStats_PlayTimeSumUs;
+            AudioStats_DecodeTimeSumUs = 0;
+            AudioStats_PlayTimeSumUs = 0;
+        }
+    }
+}
+
+// Counts underrun. If there are too many per track, input-buffer is enlarged (PSRAM only) or non-essential work is reduced.
+void AudioStats_HandleUnderrun(void) {
+    AudioStats_Stats.underrunsTrack++;
+    AudioStats_Stats.underrunsTotal++;
+    AudioStats_LastUnderrunTimestamp = millis();
+
+    snprintf(Log_Buffer, Log_BufferLength, "%s: %u", (char *) FPSTR(audioUnderrunDetected), AudioStats_Stats.underrunsTrack);
+    Log_Println(Log_Buffer, LOGLEVEL_NOTICE);
+
+    if (AudioStats_Stats.underrunsTrack != audioStatsUnderrunThreshold) {
+        return;
+    }
+
+    #ifdef BOARD_HAS_PSRAM
+        if (psramFound() && AudioStats_Stats.inputBufferSize < audioStatsInputBufferMax) {
+            AudioStats_Stats.inputBufferSize = std::min(AudioStats_Stats.inputBufferSize * 2u, audioStatsInputBufferMax);
+            snprintf(Log_Buffer, Log_BufferLength, "%s: %u", (char *) FPSTR(audioInputBufferEnlarged), AudioStats_Stats.inputBufferSize);
+            Log_Println(Log_Buffer, LOGLEVEL_NOTICE);
+            return;
+        }
+    #endif
+
+    if (!AudioStats_Stats.loadReduction) {
+        AudioStats_Stats.loadReduction = true;
+        Log_Println((char *) FPSTR(audioLoadReductionActive), LOGLEVEL_NOTICE);
+    }
+}
+
+// Ends load-reduction if there was no underrun for a while and publishes statistics periodically
+void AudioStats_Cyclic(void) {
+    static uint32_t lastPublishTimestamp = 0;
+
+    if (AudioStats_Stats.loadReduction && (millis() - AudioStats_LastUnderrunTimestamp >= audioStatsLoadReductionDuration * 60000u)) {
+        AudioStats_Stats.loadReduction = false;
+        Log_Println((char *) FPSTR(audioLoadReductionInactive), LOGLEVEL_NOTICE);
+    }
+
+    if (gPlayProperties.playMode == NO_PLAYLIST || gPlayProperties.pausePlay) {
+        return;
+    }
+
+    const uint32_t publishInterval = audioStatsPublishInterval * 1000u * (AudioStats_Stats.loadReduction ? 2u : 1u);
+    if (millis() - lastPublishTimestamp < publishInterval) {
+        return;
+    }
+    lastPublishTimestamp = millis();
+
+    Web_SendWebsocketData(0, 60);
+    #ifdef MQTT_ENABLE
+        char buf[160];
+        snprintf(buf, sizeof(buf) / sizeof(buf[0]), "{\"underruns\":%u,\"underrunsTotal\":%u,\"dmaFill\":%u,\"decodeAvg\":%u,\"decodeMax\":%u,\"load\":%u,\"stall\":%u,\"inBuf\":%u,\"reduced\":%u}",
+            AudioStats_Stats.underrunsTrack, AudioStats_Stats.underrunsTotal, AudioStats_Stats.dmaFill, AudioStats_Stats.decodeAvgUs, AudioStats_Stats.decodeMaxUs,
+            AudioStats_Stats.decodeLoad, AudioStats_Stats.longestStallMs, AudioStats_Stats.inputBufferSize, AudioStats_Stats.loadReduction);
+        publishMqtt((char *) FPSTR(topicAudioStatsState), buf, false);
+    #endif
+
+    #ifdef WEBSTREAM_BUFFER_ENABLE
+        if (gPlayProperties.isWebstream) {
+            Web_SendWebsocketData(0, 61);
+            #ifdef MQTT_ENABLE
+                const webStreamStats *wsStats = WebStream_GetStats();
+                char buf[96];
+                snprintf(buf, sizeof(buf) / sizeof(buf[0]), "{\"bufFill\":%u,\"rebuffers\":%u,\"reconnects\":%u,\"latency\":%u}",
+                    wsStats->bufferFill, wsStats->rebuffers, wsStats->reconnects, wsStats->connectLatencyMs);
+                publishMqtt((char *) FPSTR(topicWebStreamStatsState), buf, false);
+            #endif
+        }
+    #endif
+}
+
+bool AudioStats_IsLoadReductionActive(void) {
+    return AudioStats_Stats.loadReduction;
+}
+
+// Size of input-buffer the audio-lib should use for the next track
+uint32_t AudioStats_GetInputBufferSize(void) {
+    return AudioStats_Stats.inputBufferSize;
+}
+
+const audioStats *AudioStats_Get(void) {
+    return &AudioStats_Stats;
+}
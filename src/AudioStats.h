@@ -0,0 +1,24 @@
+#pragma once
+
+typedef struct {
+    uint32_t underrunsTrack;                    // Number of underruns of current track
+    uint32_t underrunsTotal;                    // Number of underruns since boot
+    uint8_t dmaFill;                            // Estimated fill-level of I2S-DMA-buffer (in %)
+    uint32_t decodeAvgUs;                       // Average time needed by audio-lib to decode one frame (in us)
+    uint32_t decodeMaxUs;                       // Max. time needed by audio-lib to decode one frame of current track (in us)
+    uint8_t decodeLoad;                         // Time needed for decoding in relation to playtime (in %)
+    uint32_t longestStallMs;                    // Longest period of current track without any output (in ms)
+    uint32_t inputBufferSize;                   // Size of audio-lib's input-buffer (in bytes)
+    bool loadReduction;                         // If non-essential work (LED-animation, web-push) is reduced
+} audioStats;
+
+void AudioStats_Cyclic(void);
+void AudioStats_TrackStarted(void);
+void AudioStats_OnOutputFrame(void);
+void AudioStats_OnOutputFrames(const uint32_t _frames);
+void AudioStats_Update(const bool _playing, const uint32_t _sampleRate, const uint32_t _decodeTimeUs);
+bool AudioStats_IsLoadReductionActive(void);
+uint32_t AudioStats_GetInputBufferSize(void);
+void AudioStats_SetDmaBufferFrames(const uint32_t _frames);
+uint32_t AudioStats_GetDmaBufferFrames(void);
+const audioStats *AudioStats_Get(void);
@@ -0,0 +1,496 @@
+#include <Arduino.h>
+#include <nvs.h>
+#include "settings.h"
+#include "Backup.h"
+#include "BackupRecord.h"
+#include "Common.h"
+#include "Led.h"
+#include "Log.h"
+#include "MemX.h"
+#include "SdCard.h"
+#include "System.h"
+#include "Web.h"
+
+#ifdef ENABLE_ESPUINO_DEBUG
+    #include <nvsDump.h>
+#endif
+
+/* Import of a backup-file with RFID-assignments (one record per line: ^<rfid-id>^<value>).
+   While the file is uploaded every record is validated; valid ones are collected in a temporary file.
+   Nothing is written to NVS if there's at least one invalid record or if NVS lacks the space.
+   Afterwards a task writes all records using one NVS-handle and commits once. Before an entry is
+   overwritten, its previous value is saved in an undo-file; if writing fails, the undo-file is
+   replayed (backwards) and NVS gets its previous content back.
+   Export enumerates the entries by NVS' iterator and collects the lines in a buffer that is written in blocks.
+   Backup-file is kept as a journal: every assignment appends its record, a removed assignment appends
+   only its key (^<rfid-id>). As import is done in order of the file, the last record of a key wins.
+   Once the journal is much larger than the assignments it describes, it's compacted by a full export. */
+
+#define BACKUP_LINE_MAX                 300u    // Max. length of a record (without line-break)
+#define BACKUP_IMPORT_BATCH             32u     // Records written between two progress-messages
+#define BACKUP_NVS_ENTRY_SIZE           32u     // Bytes of data per NVS-entry
+#define BACKUP_NVS_RESERVE              126u    // NVS-entries to keep free (one page)
+#define BACKUP_EXPORT_BUFFER            4096u   // Fits a record with the longest string NVS can store
+#define BACKUP_JOURNAL_FACTOR           2u      // Journal is compacted if it's larger than that multiple of NVS-data...
+#define BACKUP_JOURNAL_SLACK            4096u   // ...plus these bytes
+
+static_assert(stringOuterDelimiter[0] == BACKUPRECORD_DELIMITER && stringDelimiter[0] == BACKUPRECORD_VALUE_START, "Delimiters of backup-file don't match");
+
+static const char backupImportFile[] PROGMEM = "/_rfidimport";
+static const char backupUndoFile[] PROGMEM = "/_rfidundo";
+
+static backupImportStats Backup_ImportStats = {false, false, 0, 0, 0};
+static File Backup_ImportFile;                  // Open while backup-file is uploaded
+static char *Backup_Line = NULL;
+static uint32_t Backup_LineLength;
+static bool Backup_LineOverflow;
+static uint32_t Backup_EntriesNeeded;           // NVS-entries needed by all records
+
+static void Backup_ImportLine(void);
+static void Backup_ImportTask(void *parameter);
+static bool Backup_ImportRecords(nvs_handle_t _handle, File &_undoFile, uint32_t *_undoOffsets);
+static void Backup_Rollback(nvs_handle_t _handle, File &_undoFile, const uint32_t *_undoOffsets, uint32_t _count);
+static bool Backup_ReadLine(File &_file, char *_buffer, const size_t _size);
+static void Backup_ImportFinished(void);
+static bool Backup_JournalNeedsCompaction(size_t _journalSize);
+static esp_err_t Backup_ExportEntry(nvs_handle_t _handle, const char *_key, char *_buffer, size_t *_fill);
+static bool Backup_WriteBlock(File &_file, const char *_buffer, size_t *_fill);
+#ifdef ENABLE_ESPUINO_DEBUG
+    static bool Backup_ExportLegacy(const char *_namespace, const char *_destFile);
+#endif
+
+// Prepares import of a backup-file that is about to be uploaded
+bool Backup_ImportBegin(void) {
+    if (Backup_ImportStats.active) {
+        if (!Backup_ImportFile) {       // Previous import is still being written to NVS
+            return false;
+        }
+        Backup_ImportFile.close();      // Upload of previous file was aborted
+    }
+
+    if (!Backup_Line) {
+        Backup_Line = x_malloc(BACKUP_LINE_MAX + 1);
+        if (!Backup_Line) {
+            return false;
+        }
+    }
+    Backup_ImportFile = gFSystem.open((char *) FPSTR(backupImportFile), FILE_WRITE);
+    if (!Backup_ImportFile) {
+        Log_Println((char *) FPSTR(errorWritingTmpfile), LOGLEVEL_ERROR);
+        return false;
+    }
+
+    Backup_LineLength = 0;
+    Backup_LineOverflow = false;
+    Backup_EntriesNeeded = 0;
+    Backup_ImportStats.active = true;
+    Backup_ImportStats.error = false;
+    Backup_ImportStats.records = 0;
+    Backup_ImportStats.invalid = 0;
+    Backup_ImportStats.written = 0;
+    Web_SendWebsocketData(0, 64);
+    return true;
+}
+
+// Passes the next piece of the backup-file. Returns false once an invalid record was found.
+bool Backup_ImportWrite(const uint8_t *_data, size_t _length) {
+    if (!Backup_ImportStats.active || !Backup_ImportFile) {
+        return false;
+    }
+
+    for (size_t i = 0; i < _length; i++) {
+        const char c = _data[i];
+        if (c == '\n') {
+            Backup_ImportLine();
+        } else if (c != '\r') {
+            if (Backup_LineLength < BACKUP_LINE_MAX) {
+                Backup_Line[Backup_LineLength++] = c;
+            } else {
+                Backup_LineOverflow = true;
+            }
+        }
+    }
+    return !Backup_ImportStats.invalid && !Backup_ImportStats.error;
+}
+
+// Upload is complete: records are written into NVS (by a task) if all of them are valid and fit into NVS
+bool Backup_ImportEnd(void) {
+    if (!Backup_ImportStats.active || !Backup_ImportFile) {
+        return false;
+    }
+
+    if (Backup_LineLength || Backup_LineOverflow) {     // Last line without line-break
+        Backup_ImportLine();
+    }
+    Backup_ImportFile.close();
+
+    if (Backup_ImportStats.invalid) {
+        snprintf(Log_Buffer, Log_BufferLength, "%s: %u", (char *) FPSTR(importCountNokNvs), Backup_ImportStats.invalid);
+        Log_Println(Log_Buffer, LOGLEVEL_ERROR);
+        Log_Println((char *) FPSTR(backupImportInvalid), LOGLEVEL_ERROR);
+        Backup_ImportStats.error = true;
+    } else if (Backup_ImportStats.error) {
+        Log_Println((char *) FPSTR(errorWritingTmpfile), LOGLEVEL_ERROR);
+    } else {
+        nvs_stats_t nvsStats;
+        if (nvs_get_stats(NULL, &nvsStats) != ESP_OK || nvsStats.free_entries < Backup_EntriesNeeded + BACKUP_NVS_RESERVE) {
+            Log_Println((char *) FPSTR(backupImportNoSpace), LOGLEVEL_ERROR);
+            Backup_ImportStats.error = true;
+        }
+    }
+
+    if (!Backup_ImportStats.error) {
+        if (xTaskCreatePinnedToCore(
+                Backup_ImportTask,      /* Function to implement the task */
+                "rfidImportTask",       /* Name of the task */
+                4096,                   /* Stack size in words */
+                NULL,                   /* Task input parameter */
+                1 | portPRIVILEGE_BIT,  /* Priority of the task */
+                NULL,                   /* Task handle. */
+                1                       /* Core where the task should run */
+            ) == pdPASS) {
+            return true;
+        }
+        Backup_ImportStats.error = true;
+    }
+
+    Backup_ImportFinished();
+    return false;
+}
+
+const backupImportStats *Backup_GetImportStats(void) {
+    return &Backup_ImportStats;
+}
+
+// Validates collected line; valid records are appended to temporary file (empty lines are ignored)
+void Backup_ImportLine(void) {
+    Backup_Line[Backup_LineLength] = '\0';
+    const bool overflow = Backup_LineOverflow;
+    const uint32_t length = Backup_LineLength;
+    Backup_LineLength = 0;
+    Backup_LineOverflow = false;
+    if (!length && !overflow) {
+        return;
+    }
+
+    char *key, *value;
+    if (overflow || !BackupRecord_Parse(Backup_Line, &key, &value)) {
+        Backup_ImportStats.invalid++;
+        return;
+    }
+    if (value) {
+        value[-1] = stringOuterDelimiter[0];
+    }
+    if (Backup_ImportFile.write((const uint8_t *) Backup_Line, length) != length || Backup_ImportFile.write('\n') != 1) {
+        Backup_ImportStats.error = true;
+        return;
+    }
+    Backup_ImportStats.records++;
+    if (value) {
+        Backup_EntriesNeeded += 1 + (strlen(value) + BACKUP_NVS_ENTRY_SIZE) / BACKUP_NVS_ENTRY_SIZE;  // Header + data (incl. '\0')
+    }
+}
+
+// Writes validated records into NVS
+void Backup_ImportTask(void *parameter) {
+    Led_SetPause(true);         // Workaround to prevent exceptions due to Neopixel-signalisation while NVS-write
+    File undoFile = gFSystem.open((char *) FPSTR(backupUndoFile), FILE_WRITE);
+    uint32_t *undoOffsets = (uint32_t *) x_malloc((Backup_ImportStats.records + 1) * sizeof(uint32_t));
+    nvs_handle_t handle;
+    bool ok = false;
+
+    if (undoFile && undoOffsets && nvs_open((char *) FPSTR(prefsRfidNamespace), NVS_READWRITE, &handle) == ESP_OK) {
+        ok = Backup_ImportRecords(handle, undoFile, undoOffsets);
+        nvs_close(handle);
+    }
+    undoFile.close();
+    free(undoOffsets);
+    Led_SetPause(false);
+
+    if (ok) {
+        snprintf(Log_Buffer, Log_BufferLength, "%s: %u", (char *) FPSTR(backupImportFinished), Backup_ImportStats.written);
+        Log_Println(Log_Buffer, LOGLEVEL_NOTICE);
+        Backup_Export((const char *) FPSTR(prefsRfidNamespace), (const char *) FPSTR(backupFile));     // Journal gets imported assignments
+    } else {
+        Log_Println((char *) FPSTR(backupImportFailed), LOGLEVEL_ERROR);
+        Backup_ImportStats.error = true;
+    }
+    Backup_ImportFinished();
+    vTaskDelete(NULL);
+}
+
+// Writes all records of temporary file with a single commit. Returns false if NVS had to be restored.
+bool Backup_ImportRecords(nvs_handle_t _handle, File &_undoFile, uint32_t *_undoOffsets) {
+    File importFile = gFSystem.open((char *) FPSTR(backupImportFile));
+    char *previous = x_malloc(BACKUP_LINE_MAX + 1);
+    char undoLine[BACKUP_LINE_MAX + BACKUPRECORD_KEY_MAX + 4];
+    uint32_t undoCount = 0;
+    esp_err_t err = (importFile && previous) ? ESP_OK : ESP_FAIL;
+
+    while (err == ESP_OK && Backup_ReadLine(importFile, Backup_Line, BACKUP_LINE_MAX + 1)) {
+        char *key, *value;
+        if (!BackupRecord_Parse(Backup_Line, &key, &value)) {
+            continue;
+        }
+
+        size_t previousLength = BACKUP_LINE_MAX + 1;
+        err = nvs_get_str(_handle, key, previous, &previousLength);
+        if ((err == ESP_OK && value && !strcmp(previous, value)) || (err == ESP_ERR_NVS_NOT_FOUND && !value)) {
+            Backup_ImportStats.written++;       // Unchanged
+            err = ESP_OK;
+            continue;
+        }
+        if (err != ESP_OK && err != ESP_ERR_NVS_NOT_FOUND) {
+            break;
+        }
+
+        // Undo-record: previous value or only key if entry didn't exist before
+        const size_t undoLength = BackupRecord_Format(undoLine, sizeof(undoLine), key, (err == ESP_OK) ? previous : NULL);
+        const uint32_t undoOffset = _undoFile.position();
+        if (_undoFile.write((const uint8_t *) undoLine, undoLength) != undoLength) {
+            err = ESP_FAIL;
+            break;
+        }
+        _undoOffsets[undoCount++] = undoOffset;
+
+        err = value ? nvs_set_str(_handle, key, value) : nvs_erase_key(_handle, key);
+        if (err == ESP_OK && (++Backup_ImportStats.written % BACKUP_IMPORT_BATCH) == 0) {
+            Web_SendWebsocketData(0, 64);
+            vTaskDelay(portTICK_PERIOD_MS * 1);
+        }
+    }
+    importFile.close();
+    free(previous);
+
+    if (err == ESP_OK) {
+        err = nvs_commit(_handle);
+    }
+    if (err != ESP_OK) {
+        snprintf(Log_Buffer, Log_BufferLength, "%s: %s", (char *) FPSTR(backupImportFailed), esp_err_to_name(err));
+        Log_Println(Log_Buffer, LOGLEVEL_ERROR);
+        Backup_Rollback(_handle, _undoFile, _undoOffsets, undoCount);
+        return false;
+    }
+    return true;
+}
+
+// Restores previous values of all entries written so far. Done backwards, so a key that was imported
+// more than once gets the value it had before the import.
+void Backup_Rollback(nvs_handle_t _handle, File &_undoFile, const uint32_t *_undoOffsets, uint32_t _count) {
+    _undoFile.close();
+    File undoFile = gFSystem.open((char *) FPSTR(backupUndoFile));
+    if (!undoFile) {
+        Log_Println((char *) FPSTR(errorReadingTmpfile), LOGLEVEL_ERROR);
+        return;
+    }
+
+    while (_count--) {
+        if (!undoFile.seek(_undoOffsets[_count]) || !Backup_ReadLine(undoFile, Backup_Line, BACKUP_LINE_MAX + 1)) {
+            continue;
+        }
+        char *key = Backup_Line + 1;
+        char *value = strchr(key, stringOuterDelimiter[0]);
+        if (value) {
+            *value++ = '\0';
+            nvs_set_str(_handle, key, value);
+        } else {
+            nvs_erase_key(_handle, key);
+        }
+    }
+    nvs_commit(_handle);
+    undoFile.close();
+}
+
+// Reads one line (without line-break). Returns false at end of file.
+bool Backup_ReadLine(File &_file, char *_buffer, const size_t _size) {
+    if (!_file.available()) {
+        return false;
+    }
+    const size_t length = _file.readBytesUntil('\n', _buffer, _size - 1);
+    _buffer[length] = '\0';
+    return true;
+}
+
+// Removes temporary files and publishes final state
+void Backup_ImportFinished(void) {
+    gFSystem.remove((char *) FPSTR(backupImportFile));
+    gFSystem.remove((char *) FPSTR(backupUndoFile));
+    Backup_ImportStats.active = false;
+    Web_SendWebsocketData(0, 64);
+}
+
+// Appends an RFID-assignment (or its removal if _value is NULL) to backup-file. If there's no backup-file yet
+// or the journal grew too large, a full export is done instead (not while an import is running: its task exports
+// once it's finished).
+bool Backup_JournalAppend(const char *_key, const char *_value) {
+    const char *journalFile = (const char *) FPSTR(backupFile);
+    File file = gFSystem.open(journalFile, FILE_APPEND);
+    if (!file) {
+        return false;
+    }
+    const size_t journalSize = file.size();
+    if (!Backup_ImportStats.active && (!journalSize || Backup_JournalNeedsCompaction(journalSize))) {
+        file.close();
+        return Backup_Export((const char *) FPSTR(prefsRfidNamespace), journalFile);
+    }
+
+    char line[BACKUP_LINE_MAX + 2];
+    const size_t length = BackupRecord_Format(line, sizeof(line), _key, _value);
+    const bool ok = (length < sizeof(line) && file.write((const uint8_t *) line, length) == length);
+    file.close();
+    return ok;
+}
+
+// Compares size of journal with the size a full export would have (estimated by used NVS-entries)
+bool Backup_JournalNeedsCompaction(size_t _journalSize) {
+    nvs_handle_t handle;
+    size_t usedEntries = 0;
+    if (nvs_open((const char *) FPSTR(prefsRfidNamespace), NVS_READONLY, &handle) == ESP_OK) {
+        nvs_get_used_entry_count(handle, &usedEntries);
+        nvs_close(handle);
+    }
+    return _journalSize > BACKUP_JOURNAL_FACTOR * usedEntries * BACKUP_NVS_ENTRY_SIZE + BACKUP_JOURNAL_SLACK;
+}
+
+// Exports RFID-assignments (keys consisting of digits) of _namespace into _destFile (one record per line: ^<rfid-id>^<value>)
+bool Backup_Export(const char *_namespace, const char *_destFile) {
+    nvs_handle_t handle;
+    if (nvs_open(_namespace, NVS_READONLY, &handle) != ESP_OK) {
+        return false;
+    }
+    char *buffer = x_malloc(BACKUP_EXPORT_BUFFER);
+    File file = gFSystem.open(_destFile, FILE_WRITE);
+    bool ok = buffer && file;
+    size_t fill = 0;
+
+    Led_SetPause(true);         // Workaround to prevent exceptions due to Neopixel-signalisation while NVS-access
+    nvs_iterator_t it = ok ? nvs_entry_find(NVS_DEFAULT_PART_NAME, _namespace, NVS_TYPE_STR) : NULL;
+    while (it && ok) {
+        nvs_entry_info_t info;
+        nvs_entry_info(it, &info);
+        it = nvs_entry_next(it);
+        if (!isNumber(info.key)) {
+            continue;
+        }
+
+        esp_err_t err = Backup_ExportEntry(handle, info.key, buffer, &fill);
+        if (err == ESP_ERR_NVS_INVALID_LENGTH && fill) {    // Buffer is full: write it and try again
+            ok = Backup_WriteBlock(file, buffer, &fill);
+            err = Backup_ExportEntry(handle, info.key, buffer, &fill);
+        }
+    }
+    if (it) {
+        nvs_release_iterator(it);
+    }
+    if (ok && fill) {
+        ok = Backup_WriteBlock(file, buffer, &fill);
+    }
+    Led_SetPause(false);
+
+    file.close();
+    free(buffer);
+    nvs_close(handle);
+    return ok;
+}
+
+// Appends "^key^value\n" to buffer. If it doesn't fit, buffer is unchanged and ESP_ERR_NVS_INVALID_LENGTH is returned.
+esp_err_t Backup_ExportEntry(nvs_handle_t _handle, const char *_key, char *_buffer, size_t *_fill) {
+    const size_t keyLength = strlen(_key);
+    if (*_fill + keyLength + 4 > BACKUP_EXPORT_BUFFER) {
+        return ESP_ERR_NVS_INVALID_LENGTH;
+    }
+
+    char *line = _buffer + *_fill;
+    line[0] = stringOuterDelimiter[0];
+    memcpy(line + 1, _key, keyLength);
+    line[keyLength + 1] = stringOuterDelimiter[0];
+    size_t length = BACKUP_EXPORT_BUFFER - *_fill - keyLength - 2;     // Value incl. '\0' (is replaced by line-break)
+    const esp_err_t err = nvs_get_str(_handle, _key, line + keyLength + 2, &length);
+    if (err == ESP_OK) {
+        line[keyLength + 1 + length] = '\n';
+        *_fill += keyLength + 2 + length;
+    }
+    return err;
+}
+
+bool Backup_WriteBlock(File &_file, const char *_buffer, size_t *_fill) {
+    const bool ok = (_file.write((const uint8_t *) _buffer, *_fill) == *_fill);
+    *_fill = 0;
+    return ok;
+}
+
+#ifdef ENABLE_ESPUINO_DEBUG
+    // Exports RFID-assignments with both exporters and prints their durations and sizes of their files
+    void Backup_PrintExportStats(void) {
+        const char *legacyFile = "/_exportlegacy";
+        const char *iteratorFile = "/_exportiterator";
+        const char *nvsNamespace = (const char *) FPSTR(prefsRfidNamespace);
+
+        uint32_t start = micros();
+        const bool legacyOk = Backup_ExportLegacy(nvsNamespace, legacyFile);
+        const uint32_t legacyDuration = micros() - start;
+        start = micros();
+        const bool iteratorOk = Backup_Export(nvsNamespace, iteratorFile);
+        const uint32_t iteratorDuration = micros() - start;
+
+        File file = gFSystem.open(legacyFile);
+        const uint32_t legacySize = file ? file.size() : 0;
+        file.close();
+        file = gFSystem.open(iteratorFile);
+        const uint32_t iteratorSize = file ? file.size() : 0;
+        file.close();
+        gFSystem.remove(legacyFile);
+        gFSystem.remove(iteratorFile);
+
+        snprintf(Log_Buffer, Log_BufferLength, "NVS-export: page-scan %u us (%s, %u bytes), iterator %u us (%s, %u bytes)", legacyDuration, legacyOk ? "ok" : "failed", legacySize, iteratorDuration, iteratorOk ? "ok" : "failed", iteratorSize);
+        Log_Println(Log_Buffer, LOGLEVEL_NOTICE);
+    }
+
+    // Previous exporter (reads all pages of nvs-partition); only kept for comparison by Backup_PrintExportStats()
+    bool Backup_ExportLegacy(const char *_namespace, const char *_destFile) {
+        const char *partname = "nvs";
+        esp_partition_iterator_t pi = esp_partition_find(ESP_PARTITION_TYPE_DATA, ESP_PARTITION_SUBTYPE_ANY, partname);
+        if (!pi) {
+            snprintf(Log_Buffer, Log_BufferLength, "Partition %s not found!", partname);
+            Log_Println(Log_Buffer, LOGLEVEL_ERROR);
+            return false;
+        }
+        const esp_partition_t *nvs = esp_partition_get(pi);
+        esp_partition_iterator_release(pi);
+
+        File backupFile = gFSystem.open(_destFile, FILE_WRITE);
+        if (!backupFile) {
+            return false;
+        }
+        Led_SetPause(true);         // Workaround to prevent exceptions due to Neopixel-signalisation while NVS-access
+        const uint8_t namespace_ID = FindNsID(nvs, _namespace);     // 0xFF => all namespaces
+        bool ok = true;
+        for (uint32_t offset = 0; ok && offset < nvs->size; offset += sizeof(nvs_page)) {
+            if (esp_partition_read(nvs, offset, &buf, sizeof(nvs_page)) != ESP_OK) {
+                Log_Println("Error reading NVS!", LOGLEVEL_ERROR);
+                ok = false;
+                break;
+            }
+
+            uint8_t i = 0;          // Index of entry (0..125)
+            while (ok && i < 126) {
+                const uint8_t bm = (buf.Bitmap[i / 4] >> ((i % 4) * 2)) & 0x03;     // State of entry (2 => written)
+                if (bm != 2) {
+                    i++;
+                    continue;
+                }
+                if ((namespace_ID == 0xFF || buf.Entry[i].Ns == namespace_ID) && isNumber(buf.Entry[i].Key)) {
+                    const String value = gPrefsRfid.getString((const char *) buf.Entry[i].Key);
+                    if (value.length()) {   // Empty if allocation failed
+                        ok = (backupFile.printf("%s%s%s%s\n", stringOuterDelimiter, buf.Entry[i].Key, stringOuterDelimiter, value.c_str()) > 0);
+                    }
+                }
+                i += std::max<uint8_t>(buf.Entry[i].Span, 1);       // Next entry (span of a corrupted entry might be 0)
+            }
+        }
+        Led_SetPause(false);
+
+        backupFile.close();
+        return ok;
+    }
+#endif
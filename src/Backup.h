@@ -0,0 +1,20 @@
+#pragma once
+
+typedef struct {
+    bool active;                                // Import is running (upload or NVS-write)
+    bool error;                                 // Import was aborted; NVS is unchanged
+    uint32_t records;                           // Valid records of backup-file
+    uint32_t invalid;                           // Invalid records (import is aborted if there's at least one)
+    uint32_t written;                           // Records written to NVS
+} backupImportStats;
+
+bool Backup_ImportBegin(void);
+bool Backup_ImportWrite(const uint8_t *_data, size_t _length);
+bool Backup_ImportEnd(void);
+const backupImportStats *Backup_GetImportStats(void);
+bool Backup_Export(const char *_namespace, const char *_destFile);
+bool Backup_JournalAppend(const char *_key, const char *_value);
+
+#ifdef ENABLE_ESPUINO_DEBUG
+    void Backup_PrintExportStats(void);
+#endif
@@ -0,0 +1,35 @@
+#include <stdio.h>
+#include <string.h>
+#include "BackupRecord.h"
+
+// Splits "^key^value" (in place) into key and value. "^key" (removed assignment) gives value NULL.
+// Returns false if record is invalid.
+bool BackupRecord_Parse(char *_line, char **_key, char **_value) {
+    if (_line[0] != BACKUPRECORD_DELIMITER) {
+        return false;
+    }
+    char *key = _line + 1;
+    char *value = strchr(key, BACKUPRECORD_DELIMITER);
+    if (value) {
+        *value++ = '\0';
+    }
+
+    const size_t keyLength = strlen(key);
+    if (!keyLength || keyLength > BACKUPRECORD_KEY_MAX || strspn(key, "0123456789") != keyLength) {
+        return false;
+    }
+    if (value && (value[0] != BACKUPRECORD_VALUE_START || strlen(value) > BACKUPRECORD_VALUE_MAX || strchr(value, BACKUPRECORD_DELIMITER))) {
+        return false;
+    }
+    *_key = key;
+    *_value = value;
+    return true;
+}
+
+// Writes record incl. line-break (_value NULL => removed assignment). Returns its length; like snprintf() it's >= _size if truncated.
+size_t BackupRecord_Format(char *_buffer, const size_t _size, const char *_key, const char *_value) {
+    if (_value) {
+        return snprintf(_buffer, _size, "%c%s%c%s\n", BACKUPRECORD_DELIMITER, _key, BACKUPRECORD_DELIMITER, _value);
+    }
+    return snprintf(_buffer, _size, "%c%s\n", BACKUPRECORD_DELIMITER, _key);
+}
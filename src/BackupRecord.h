@@ -0,0 +1,13 @@
+#pragma once
+#include <stddef.h>
+
+/* Records of the backup-file (one per line): "^<rfid-id>^<value>" assigns value, "^<rfid-id>" removes the assignment.
+   Doesn't depend on Arduino; so it's covered by the native unit-tests. */
+
+#define BACKUPRECORD_DELIMITER          '^'     // stringOuterDelimiter
+#define BACKUPRECORD_VALUE_START        '#'     // stringDelimiter; every value of an RFID-assignment starts with it
+#define BACKUPRECORD_KEY_MAX            15u     // Max. length of NVS-key
+#define BACKUPRECORD_VALUE_MAX          275u    // Max. length of a value (refer processJsonRequest())
+
+bool BackupRecord_Parse(char *_line, char **_key, char **_value);
+size_t BackupRecord_Format(char *_buffer, const size_t _size, const char *_key, const char *_value);
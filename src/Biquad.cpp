@@ -0,0 +1,83 @@
+#include <math.h>
+#include "values.h"
+#include "Biquad.h"
+
+// Calculates coefficients according to "Cookbook formulae for audio EQ biquad filter coefficients" (R. Bristow-Johnson)
+bool Biquad_Design(const uint8_t _type, const float _frequency, const float _q, const float _gainDb, const uint32_t _sampleRate, biquadCoefficients *_coefficients) {
+    if (_frequency <= 0.0f || _frequency >= _sampleRate / 2.0f || _q <= 0.0f) {
+        return false;
+    }
+
+    const double w0 = 2.0 * M_PI * _frequency / _sampleRate;
+    const double cosW0 = cos(w0);
+    const double alpha = sin(w0) / (2.0 * _q);
+    const double a = pow(10.0, _gainDb / 40.0);
+    const double sq = 2.0 * sqrt(a) * alpha;
+    double b0, b1, b2, a0, a1, a2;
+
+    switch (_type) {
+        case EQ_FILTER_HIGHPASS:
+            b0 = (1.0 + cosW0) / 2.0;
+            b1 = -(1.0 + cosW0);
+            b2 = b0;
+            a0 = 1.0 + alpha;
+            a1 = -2.0 * cosW0;
+            a2 = 1.0 - alpha;
+            break;
+
+        case EQ_FILTER_LOWPASS:
+            b0 = (1.0 - cosW0) / 2.0;
+            b1 = 1.0 - cosW0;
+            b2 = b0;
+            a0 = 1.0 + alpha;
+            a1 = -2.0 * cosW0;
+            a2 = 1.0 - alpha;
+            break;
+
+        case EQ_FILTER_PEAK:
+            b0 = 1.0 + alpha * a;
+            b1 = -2.0 * cosW0;
+            b2 = 1.0 - alpha * a;
+            a0 = 1.0 + alpha / a;
+            a1 = -2.0 * cosW0;
+            a2 = 1.0 - alpha / a;
+            break;
+
+        case EQ_FILTER_LOWSHELF:
+            b0 = a * ((a + 1.0) - (a - 1.0) * cosW0 + sq);
+            b1 = 2.0 * a * ((a - 1.0) - (a + 1.0) * cosW0);
+            b2 = a * ((a + 1.0) - (a - 1.0) * cosW0 - sq);
+            a0 = (a + 1.0) + (a - 1.0) * cosW0 + sq;
+            a1 = -2.0 * ((a - 1.0) + (a + 1.0) * cosW0);
+            a2 = (a + 1.0) + (a - 1.0) * cosW0 - sq;
+            break;
+
+        case EQ_FILTER_HIGHSHELF:
+            b0 = a * ((a + 1.0) + (a - 1.0) * cosW0 + sq);
+            b1 = -2.0 * a * ((a - 1.0) + (a + 1.0) * cosW0);
+            b2 = a * ((a + 1.0) + (a - 1.0) * cosW0 - sq);
+            a0 = (a + 1.0) - (a - 1.0) * cosW0 + sq;
+            a1 = 2.0 * ((a - 1.0) - (a + 1.0) * cosW0);
+            a2 = (a + 1.0) - (a - 1.0) * cosW0 - sq;
+            break;
+
+        default:
+            return false;
+    }
+
+    const double coefficients[5] = {b0 / a0, b1 / a0, b2 / a0, a1 / a0, a2 / a0};
+    int32_t quantized[5];
+    for (uint8_t i = 0; i < 5; i++) {
+        if (fabs(coefficients[i]) >= 8.0) {     // Doesn't fit into Q4.28
+            return false;
+        }
+        quantized[i] = (int32_t) lround(coefficients[i] * (1 << BIQUAD_COEF_SHIFT));
+    }
+
+    _coefficients->b0 = quantized[0];
+    _coefficients->b1 = quantized[1];
+    _coefficients->b2 = quantized[2];
+    _coefficients->a1 = quantized[3];
+    _coefficients->a2 = quantized[4];
+    return true;
+}
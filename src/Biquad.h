@@ -0,0 +1,46 @@
+#pragma once
+#include <stdint.h>
+
+/* Biquad-filters (direct form I) in fixed-point. Doesn't depend on Arduino; so it's covered by the native unit-tests. */
+
+#ifndef IRAM_ATTR               // Host-build (unit-tests)
+    #define IRAM_ATTR
+#endif
+
+#define BIQUAD_COEF_SHIFT               28      // Coefficients are stored as Q4.28 (biquad-coefficients can exceed 2, e.g. shelving-filters)
+
+typedef struct {
+    int32_t b0;
+    int32_t b1;
+    int32_t b2;
+    int32_t a1;
+    int32_t a2;
+} biquadCoefficients;
+
+typedef struct {
+    int32_t x1;
+    int32_t x2;
+    int32_t y1;
+    int32_t y2;
+    int32_t error;                              // Rounding-error of last output (fed back; avoids DC-offset of low-frequency filters)
+} biquadState;
+
+bool Biquad_Design(const uint8_t _type, const float _frequency, const float _q, const float _gainDb, const uint32_t _sampleRate, biquadCoefficients *_coefficients);
+
+// Runs a 24 bit-sample through a cascade of biquads. Coefficients are Q4.28; products are accumulated in 64 bit.
+// Rounding-error is fed back to the next sample. Otherwise it's amplified by poles close to DC (e.g. highpass of K-weighting).
+static inline int32_t IRAM_ATTR Biquad_Run(int32_t _x, const biquadCoefficients *_coefficients, biquadState *_state, const uint8_t _count) {
+    for (uint8_t i = 0; i < _count; i++) {
+        const biquadCoefficients *c = &_coefficients[i];
+        biquadState *s = &_state[i];
+        int64_t acc = (int64_t) c->b0 * _x + (int64_t) c->b1 * s->x1 + (int64_t) c->b2 * s->x2 - (int64_t) c->a1 * s->y1 - (int64_t) c->a2 * s->y2 + s->error;
+        int32_t y = (int32_t) ((acc + (1 << (BIQUAD_COEF_SHIFT - 1))) >> BIQUAD_COEF_SHIFT);
+        s->error = (int32_t) (acc - ((int64_t) y << BIQUAD_COEF_SHIFT));
+        s->x2 = s->x1;
+        s->x1 = _x;
+        s->y2 = s->y1;
+        s->y1 = y;
+        _x = y;
+    }
+    return _x;
+}
@@ -0,0 +1,39 @@
+#include <math.h>
+#include "ChannelMatrix.h"
+
+// Calculates matrix for the given configuration and starts crossfade to it (_rampFrames = 0 => applied immediately)
+void ChannelMatrix_SetTarget(channelMatrixState *_state, const bool _mono, const bool _swap, const int8_t _balance, const float _trimLeft, const float _trimRight, const uint32_t _rampFrames) {
+    float weight[4] = {1.0f, 0.0f, 0.0f, 1.0f};
+    if (_mono) {
+        weight[CHANNELMATRIX_LL] = weight[CHANNELMATRIX_LR] = weight[CHANNELMATRIX_RL] = weight[CHANNELMATRIX_RR] = 0.5f;
+    }
+    if (_swap) {
+        float tmp = weight[CHANNELMATRIX_LL];
+        weight[CHANNELMATRIX_LL] = weight[CHANNELMATRIX_RL];
+        weight[CHANNELMATRIX_RL] = tmp;
+        tmp = weight[CHANNELMATRIX_LR];
+        weight[CHANNELMATRIX_LR] = weight[CHANNELMATRIX_RR];
+        weight[CHANNELMATRIX_RR] = tmp;
+    }
+
+    // Balance attenuates the opposite channel linearly; trims are limited to 0 dB
+    const int8_t balance = (_balance < -100) ? -100 : ((_balance > 100) ? 100 : _balance);
+    const float gainLeft = ((balance > 0) ? (100 - balance) / 100.0f : 1.0f) * powf(10.0f, fminf(0.0f, _trimLeft) / 20.0f);
+    const float gainRight = ((balance < 0) ? (100 + balance) / 100.0f : 1.0f) * powf(10.0f, fminf(0.0f, _trimRight) / 20.0f);
+    weight[CHANNELMATRIX_LL] *= gainLeft;
+    weight[CHANNELMATRIX_LR] *= gainLeft;
+    weight[CHANNELMATRIX_RL] *= gainRight;
+    weight[CHANNELMATRIX_RR] *= gainRight;
+
+    for (uint8_t i = 0; i < 4; i++) {
+        _state->target[i] = lroundf(weight[i] * CHANNELMATRIX_UNITY);
+        if (_rampFrames) {
+            _state->current[i] = (int32_t) _state->weight[i] << CHANNELMATRIX_RAMP_SHIFT;
+            _state->step[i] = (((int32_t) _state->target[i] << CHANNELMATRIX_RAMP_SHIFT) - _state->current[i]) / (int32_t) _rampFrames;
+        } else {
+            _state->weight[i] = _state->target[i];
+        }
+    }
+    _state->rampFrames = _rampFrames;
+    _state->identity = !_rampFrames && ChannelMatrix_IsIdentity(_state->weight);
+}
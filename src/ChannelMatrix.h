@@ -0,0 +1,67 @@
+#pragma once
+#include <stdint.h>
+#include <string.h>
+
+/* 2x2-matrix of the channel-routing (refer ChannelRouter.cpp). Doesn't depend on Arduino; so it's covered by the native unit-tests. */
+
+#ifndef IRAM_ATTR               // Host-build (unit-tests)
+    #define IRAM_ATTR
+#endif
+
+#define CHANNELMATRIX_SHIFT             14u
+#define CHANNELMATRIX_UNITY             (1 << CHANNELMATRIX_SHIFT)
+#define CHANNELMATRIX_RAMP_SHIFT        16u     // Weights are ramped with 16 bit more resolution
+
+#define CHANNELMATRIX_LL                0u
+#define CHANNELMATRIX_LR                1u
+#define CHANNELMATRIX_RL                2u
+#define CHANNELMATRIX_RR                3u
+
+typedef struct {
+    int16_t weight[4];                  // Applied to current frame (Q2.14)
+    int16_t target[4];
+    int32_t current[4];                 // Weights while ramping (Q2.14 << CHANNELMATRIX_RAMP_SHIFT)
+    int32_t step[4];
+    uint32_t rampFrames;                // Remaining frames of crossfade
+    bool identity;                      // Frames are passed through
+} channelMatrixState;
+
+void ChannelMatrix_SetTarget(channelMatrixState *_state, const bool _mono, const bool _swap, const int8_t _balance, const float _trimLeft, const float _trimRight, const uint32_t _rampFrames);
+
+static inline bool ChannelMatrix_IsIdentity(const int16_t *_weight) {
+    return _weight[CHANNELMATRIX_LL] == CHANNELMATRIX_UNITY && !_weight[CHANNELMATRIX_LR] && !_weight[CHANNELMATRIX_RL] && _weight[CHANNELMATRIX_RR] == CHANNELMATRIX_UNITY;
+}
+
+// Frames of a crossfade are processed one by one; afterwards weights are kept in registers for the rest of the block
+static inline void IRAM_ATTR ChannelMatrix_Run(channelMatrixState *_state, uint32_t *_frames, const uint32_t _numberOfFrames) {
+    uint32_t i = 0;
+    for (; i < _numberOfFrames && _state->rampFrames; i++) {
+        if (--_state->rampFrames) {
+            for (uint8_t w = 0; w < 4; w++) {
+                _state->current[w] += _state->step[w];
+                _state->weight[w] = _state->current[w] >> CHANNELMATRIX_RAMP_SHIFT;
+            }
+        } else {
+            memcpy(_state->weight, _state->target, sizeof(_state->weight));
+            _state->identity = ChannelMatrix_IsIdentity(_state->weight);
+        }
+        const int32_t left = (int16_t) _frames[i];
+        const int32_t right = (int32_t) _frames[i] >> 16;
+        const int32_t outLeft = (_state->weight[CHANNELMATRIX_LL] * left + _state->weight[CHANNELMATRIX_LR] * right + (1 << (CHANNELMATRIX_SHIFT - 1))) >> CHANNELMATRIX_SHIFT;
+        const int32_t outRight = (_state->weight[CHANNELMATRIX_RL] * left + _state->weight[CHANNELMATRIX_RR] * right + (1 << (CHANNELMATRIX_SHIFT - 1))) >> CHANNELMATRIX_SHIFT;
+        _frames[i] = ((uint32_t) outRight << 16) | (uint16_t) outLeft;
+    }
+
+    const int16_t ll = _state->weight[CHANNELMATRIX_LL];
+    const int16_t lr = _state->weight[CHANNELMATRIX_LR];
+    const int16_t rl = _state->weight[CHANNELMATRIX_RL];
+    const int16_t rr = _state->weight[CHANNELMATRIX_RR];
+    for (; i < _numberOfFrames; i++) {
+        const uint32_t frame = _frames[i];
+        const int32_t left = (int16_t) frame;
+        const int32_t right = (int32_t) frame >> 16;
+        const int32_t outLeft = (ll * left + lr * right + (1 << (CHANNELMATRIX_SHIFT - 1))) >> CHANNELMATRIX_SHIFT;
+        const int32_t outRight = (rl * left + rr * right + (1 << (CHANNELMATRIX_SHIFT - 1))) >> CHANNELMATRIX_SHIFT;
+        _frames[i] = ((uint32_t) outRight << 16) | (uint16_t) outLeft;
+    }
+}
@@ -0,0 +1,71 @@
+#include <Arduino.h>
+#include "settings.h"
+#include "ChannelRouter.h"
+#include "AudioDsp.h"
+#include "ChannelMatrix.h"
+
+/* Channel-routing: both output-channels are a weighted sum of both input-channels (2x2-matrix, weights Q2.14):
+       left  = LL * left + LR * right
+       right = RL * left + RR * right
+   Mono-downmix, swap, balance and per-channel trim are just different matrices; so runtime-cost doesn't depend on the
+   configuration and identity is skipped completely. Weights of a row never sum up to more than 1; so there's no clipping.
+   Frames stay packed (right << 16 | left); every product is a 16x16 bit-multiplication (single-cycle MUL16S on ESP32).
+   Requests (mono, output) are taken over by the audio-task, which crossfades all weights to the new matrix within
+   channelRoutingRampTime; so plugging headphones or switching between mono and stereo doesn't click. */
+
+typedef struct {
+    channelMatrixState matrix;
+    bool configured;
+    bool mono;                          // Configuration that was taken over
+    uint8_t output;
+} channelRouterState;
+
+static channelRouterState ChannelRouter_State = {{{CHANNELMATRIX_UNITY, 0, 0, CHANNELMATRIX_UNITY}, {CHANNELMATRIX_UNITY, 0, 0, CHANNELMATRIX_UNITY}, {0, 0, 0, 0}, {0, 0, 0, 0}, 0, true}, false, false, AUDIODSP_OUTPUT_SPEAKER};
+static volatile bool ChannelRouter_Mono = false;
+static volatile uint8_t ChannelRouter_Output = AUDIODSP_OUTPUT_SPEAKER;
+
+static void ChannelRouter_Configure(channelRouterState *_state, const bool _mono, const uint8_t _output, const uint32_t _sampleRate);
+
+// Downmix to mono (e.g. single speaker); changes are crossfaded
+void ChannelRouter_SetMono(const bool _mono) {
+    ChannelRouter_Mono = _mono;
+}
+
+// Selects swap/balance of speaker or headphone (AUDIODSP_OUTPUT_SPEAKER/AUDIODSP_OUTPUT_HEADPHONE)
+void ChannelRouter_SetOutput(const uint8_t _output) {
+    ChannelRouter_Output = _output;
+}
+
+// true if frames are passed through (a pending request is taken over by the next call of ChannelRouter_Process())
+bool ChannelRouter_IsTransparent(void) {
+    const channelRouterState *state = &ChannelRouter_State;
+    return state->configured && state->matrix.identity && state->mono == ChannelRouter_Mono && state->output == ChannelRouter_Output;
+}
+
+// Called for every stereo-frame (left: lower 16 bit; right: upper 16 bit)
+void IRAM_ATTR ChannelRouter_Process(uint32_t *_sample, const uint32_t _sampleRate) {
+    ChannelRouter_ProcessBlock(_sample, 1, _sampleRate);
+}
+
+void IRAM_ATTR ChannelRouter_ProcessBlock(uint32_t *_frames, const uint32_t _numberOfFrames, const uint32_t _sampleRate) {
+    channelRouterState *state = &ChannelRouter_State;
+    const bool mono = ChannelRouter_Mono;
+    const uint8_t output = ChannelRouter_Output;
+    if (!state->configured || state->mono != mono || state->output != output) {
+        ChannelRouter_Configure(state, mono, output, _sampleRate);
+    }
+    if (!state->matrix.identity) {
+        ChannelMatrix_Run(&state->matrix, _frames, _numberOfFrames);
+    }
+}
+
+// Takes over configuration; crossfade to its matrix (first configuration is applied immediately)
+void ChannelRouter_Configure(channelRouterState *_state, const bool _mono, const uint8_t _output, const uint32_t _sampleRate) {
+    const bool headphone = (_output == AUDIODSP_OUTPUT_HEADPHONE);
+    const uint32_t rampFrames = _state->configured ? (uint32_t) channelRoutingRampTime * (_sampleRate ? _sampleRate : 44100u) / 1000u : 0;
+    ChannelMatrix_SetTarget(&_state->matrix, _mono, headphone ? channelSwapHeadphone : channelSwapSpeaker, headphone ? channelBalanceHeadphone : channelBalanceSpeaker,
+        channelTrimLeft, channelTrimRight, rampFrames);
+    _state->mono = _mono;
+    _state->output = _output;
+    _state->configured = true;
+}
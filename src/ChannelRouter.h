@@ -0,0 +1,7 @@
+#pragma once
+
+void ChannelRouter_SetMono(const bool _mono);
+void ChannelRouter_SetOutput(const uint8_t _output);
+bool ChannelRouter_IsTransparent(void);
+void ChannelRouter_Process(uint32_t *_sample, const uint32_t _sampleRate);
+void ChannelRouter_ProcessBlock(uint32_t *_frames, const uint32_t _numberOfFrames, const uint32_t _sampleRate);
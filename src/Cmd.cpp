@@ -1,14 +1,20 @@
 #include <Arduino.h>
 #include "settings.h"
 #include "Cmd.h"
+#include "Announce.h"
 #include "AudioPlayer.h"
+#include "Backup.h"
 #include "Battery.h"
 #include "Bluetooth.h"
 #include "Ftp.h"
 #include "Led.h"
 #include "Log.h"
 #include "Mqtt.h"
+#include "Spectrum.h"
 #include "System.h"
+#include "TimeStretch.h"
+#include "UiSound.h"
+#include "Web.h"
 #include "Wlan.h"
 
 // Only enable measurements if valid GPIO is used
@@ -18,7 +24,18 @@
     #endif
 #endif
 
+static void Cmd_Execute(const uint16_t mod);
+
+// One feedback-sound per action: click is only played if the action didn't indicate ok/error (or volume-limit) itself
 void Cmd_Action(const uint16_t mod) {
+    const uint32_t uiSoundRequests = UiSound_GetRequestCount();
+    Cmd_Execute(mod);
+    if (UiSound_GetRequestCount() == uiSoundRequests) {
+        UiSound_Play(UISOUND_CLICK);
+    }
+}
+
+void Cmd_Execute(const uint16_t mod) {
     switch (mod) {
         case CMD_LOCK_BUTTONS_MOD: { // Locks/unlocks all buttons
             System_ToggleLockControls();
@@ -236,6 +253,16 @@ void Cmd_Action(const uint16_t mod) {
             break;
         }
 
+        case CMD_TOGGLE_LED_SPECTRUM: {
+            #if defined(NEOPIXEL_ENABLE) && defined(SPECTRUM_ENABLE)
+                Led_ToggleSpectrum();
+                System_IndicateOk();
+            #else
+                System_IndicateError();
+            #endif
+            break;
+        }
+
         case CMD_TOGGLE_WIFI_STATUS: {
             Wlan_ToggleEnable();
             System_IndicateOk();
@@ -265,7 +292,9 @@ void Cmd_Action(const uint16_t mod) {
         #endif
 
         case CMD_TELL_IP_ADDRESS: {
-            if (Wlan_IsConnected()) {
+            if (Announce_IpAddress()) {     // Offline via pre-recorded clips (works in access-point-mode as well)
+                System_IndicateOk();
+            } else if (Wlan_IsConnected()) {
                 if (!gPlayProperties.pausePlay) {
                     AudioPlayer_TrackControlToQueueSender(PAUSEPLAY);
                 }
@@ -346,6 +375,7 @@ void Cmd_Action(const uint16_t mod) {
                     snprintf(Log_Buffer, Log_BufferLength, "%s: %.2f V", (char *) FPSTR(currentVoltageMsg), voltage);
                     Log_Println(Log_Buffer, LOGLEVEL_INFO);
                     Led_Indicate(LedIndicatorType::Voltage);
+                    Announce_BatteryLevel(constrain((voltage - voltageIndicatorLow) * 100.0f / (voltageIndicatorHigh - voltageIndicatorLow), 0.0f, 100.0f));
                 #ifdef MQTT_ENABLE
                         char vstr[6];
                         snprintf(vstr, 6, "%.2f", voltage);
@@ -370,11 +400,45 @@ void Cmd_Action(const uint16_t mod) {
             break;
         }
 
+        case CMD_PLAYBACK_SPEED_DOWN: {
+            #ifdef TIMESTRETCH_ENABLE
+                TimeStretch_SetSpeed(TimeStretch_GetSpeed() - timeStretchSpeedStep);
+            #endif
+            break;
+        }
+
+        case CMD_PLAYBACK_SPEED_UP: {
+            #ifdef TIMESTRETCH_ENABLE
+                TimeStretch_SetSpeed(TimeStretch_GetSpeed() + timeStretchSpeedStep);
+            #endif
+            break;
+        }
+
+        case CMD_PLAYBACK_SPEED_NORMAL: {
+            TimeStretch_SetSpeed(TIMESTRETCH_SPEED_NORMAL);
+            break;
+        }
+
         #ifdef ENABLE_ESPUINO_DEBUG
             case PRINT_TASK_STATS: {
                 System_esp_print_tasks();
                 break;
             }
+
+            case PRINT_SPECTRUM_STATS: {
+                Spectrum_PrintStats();
+                break;
+            }
+
+            case PRINT_WEBSOCKET_STATS: {
+                Web_PrintPushStats();
+                break;
+            }
+
+            case PRINT_NVS_EXPORT_STATS: {
+                Backup_PrintExportStats();
+                break;
+            }
         #endif
 
         default: {
@@ -138,6 +138,50 @@ inline void convertAsciiToUtf8(String asciiString, char *utf8String) {
     utf8String[k] = 0;
 }
 
+// Compares strings like humans do: case-insensitive and numbers by value ("track2" < "Track10")
+// Returns <0, 0 or >0 (like strcmp); strings that only differ in case or leading zeros are ordered by strcmp()
+inline int naturalCompare(const char *a, const char *b) {
+    const char *aStart = a;
+    const char *bStart = b;
+    while (*a && *b) {
+        if (isdigit(*a) && isdigit(*b)) {
+            while (*a == '0') {
+                a++;
+            }
+            while (*b == '0') {
+                b++;
+            }
+            const char *aEnd = a;
+            const char *bEnd = b;
+            while (isdigit(*aEnd)) {
+                aEnd++;
+            }
+            while (isdigit(*bEnd)) {
+                bEnd++;
+            }
+            if (aEnd - a != bEnd - b) {     // More digits => bigger number
+                return (aEnd - a) - (bEnd - b);
+            }
+            for (; a < aEnd; a++, b++) {
+                if (*a != *b) {
+                    return *a - *b;
+                }
+            }
+            continue;
+        }
+        const int diff = tolower((unsigned char) *a) - tolower((unsigned char) *b);
+        if (diff) {
+            return diff;
+        }
+        a++;
+        b++;
+    }
+    if (*a || *b) {
+        return *a ? 1 : -1;
+    }
+    return strcmp(aStart, bStart);
+}
+
 // Release previously allocated memory
 inline void freeMultiCharArray(char **arr, const uint32_t cnt) {
     for (uint32_t i = 0; i <= cnt; i++) {
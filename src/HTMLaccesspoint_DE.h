@@ -1,64 +1,42 @@
-static const char accesspoint_HTML[] PROGMEM = "<!DOCTYPE html>\
-<html>\
-    <head>\
-        <title>WLAN-Einrichtung</title>\
-        <style>\
-            input {\
-                width: 90%%;\
-                height: 44px;\
-                border-radius: 4px;\
-                margin: 10px auto;\
-                font-size: 15px;\
-                background: #f1f1f1;\
-                border: 0;\
-                padding: 0 15px\
-            }\
-            input {\
-\
-            }\
-            body {\
-                background: #007bff;\
-                font-family: sans-serif;\
-                font-size: 14px;\
-                color: #777\
-            }\
-            .box {\
-                background: #fff;\
-                max-width: 258px;\
-                margin: 75px auto;\
-                padding: 30px;\
-                border-radius: 5px;\
-                text-align: center\
-            }\
-            .btn {\
-                background: #3498db;\
-                color: #fff;\
-                cursor: pointer;\
-                width: 90%%;\
-                height: 44px;\
-                border-radius: 4px;\
-                margin: 10px auto;\
-                font-size: 15px;\
-            }\
-            .rebootmsg {\
-                display: none;\
-            }\
-        </style>\
-    </head>\
-    <body>\
-        <form id=\"settings\" action=\"/init\" class=\"box\" method=\"POST\">\
-            <h1>WLAN-Einrichtung</h1>\
-            <label for=\"ssid\">SSID:</label><br>\
-            <input type=\"text\" id=\"ssid\" name=\"ssid\" placeholder=\"SSID\" required><br>\
-            <label for=\"pwd\">Passwort:</label><br>\
-            <input type=\"password\" id=\"pwd\" name=\"pwd\" autocomplete=\"off\" required><br>\
-            <label for=\"hostname\">ESPuino-Name (Hostname):</label><br>\
-            <input type=\"text\" id=\"hostname\" name=\"hostname\" placeholder=\"espuino\" required><br><br>\
-            <input class=\"btn\" type=\"submit\" id=\"save-button\" value=\"Save\">\
-        </form>\
-        <form action=\"/restart\" class=\"box\">\
-            <h1>Fertig?</h1>\
-            <input class=\"btn\" type=\"submit\" id=\"restart-button\" value=\"Reboot\">\
-        </form>\
-    </body>\
-</html>";
\ No newline at end of file
+// Generated by processHtml.py from html/accesspoint_DE.html (gzip-compressed); don't edit
+static const char accesspoint_HTML_ETAG[] PROGMEM = "\"20a6ce7f710166e9\"";
+static const uint8_t accesspoint_HTML_GZ[] PROGMEM = {
+    0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xb5, 0x54, 0x51, 0x6f, 0xd3, 0x30,
+    0x10, 0x7e, 0xcf, 0xaf, 0x30, 0x9e, 0x90, 0xe0, 0x21, 0x24, 0x65, 0xab, 0xba, 0xa5, 0x69, 0x11,
+    0x62, 0x45, 0x20, 0xa1, 0xad, 0xa2, 0x93, 0x10, 0x8f, 0x4e, 0xec, 0x24, 0x16, 0x89, 0x1d, 0xec,
+    0xcb, 0xda, 0x82, 0xf6, 0xdf, 0x39, 0xa7, 0x4e, 0xd7, 0x56, 0xd3, 0xb4, 0x17, 0x94, 0x07, 0xdb,
+    0x67, 0xdf, 0xf7, 0x7d, 0x77, 0xf7, 0x29, 0xe9, 0xab, 0xeb, 0xdb, 0x4f, 0x77, 0x3f, 0x97, 0x0b,
+    0x52, 0x41, 0x53, 0xcf, 0x83, 0x74, 0x58, 0x04, 0xe3, 0xb8, 0x80, 0x84, 0x5a, 0xcc, 0x7f, 0x7c,
+    0xfb, 0x78, 0x13, 0x2e, 0xa4, 0x32, 0x32, 0xaf, 0xa0, 0x53, 0x65, 0x1a, 0xed, 0xe2, 0x41, 0x6a,
+    0x61, 0xeb, 0x56, 0xa9, 0xda, 0x0e, 0xc8, 0xdf, 0x60, 0x2d, 0x39, 0x54, 0x09, 0xb9, 0x8a, 0x5f,
+    0x4f, 0x83, 0x4a, 0xc8, 0xb2, 0x82, 0x84, 0x5c, 0x5c, 0xb4, 0x9b, 0x69, 0x90, 0x69, 0xc3, 0x85,
+    0x09, 0x0d, 0xe3, 0xb2, 0xb3, 0x18, 0x74, 0xb1, 0x86, 0x99, 0x52, 0xaa, 0x84, 0x8c, 0xe2, 0x76,
+    0x43, 0x58, 0x07, 0x7a, 0x1a, 0x14, 0x5a, 0x41, 0x68, 0xe5, 0x1f, 0x81, 0xd1, 0x71, 0x9f, 0xc7,
+    0xf2, 0x5f, 0xa5, 0xd1, 0x9d, 0xe2, 0x09, 0x39, 0x2b, 0x46, 0xee, 0x1b, 0xc0, 0x12, 0x12, 0x4f,
+    0x83, 0x96, 0x71, 0x2e, 0x55, 0x89, 0xfb, 0x3e, 0x21, 0x78, 0xd8, 0x6b, 0x79, 0xc0, 0x67, 0x7c,
+    0x8b, 0x9b, 0x23, 0x88, 0x38, 0x9e, 0x64, 0x45, 0xe1, 0x89, 0x0a, 0xd6, 0xc8, 0x7a, 0x9b, 0x10,
+    0xcb, 0x94, 0x0d, 0xad, 0x30, 0xb2, 0x38, 0x56, 0xd0, 0xab, 0xcc, 0x75, 0xad, 0x91, 0xeb, 0x6c,
+    0x32, 0x99, 0x20, 0xe6, 0xbb, 0x4c, 0x6f, 0x4e, 0x31, 0x0b, 0x07, 0xd8, 0xb0, 0x4d, 0xe8, 0xcb,
+    0x7f, 0x3f, 0xbe, 0x3c, 0x2c, 0x6f, 0x32, 0xde, 0x97, 0xb7, 0x57, 0x7b, 0x1e, 0x3f, 0xd1, 0x94,
+    0xbe, 0x60, 0x10, 0x1b, 0x08, 0x59, 0x2d, 0x4b, 0xcc, 0xcc, 0x85, 0x02, 0x61, 0x7a, 0x56, 0x50,
+    0xa7, 0xac, 0xe7, 0x17, 0x57, 0x97, 0x3c, 0x7b, 0xd4, 0xd7, 0xab, 0xc8, 0x3b, 0x63, 0xdd, 0xa9,
+    0xd5, 0xd2, 0xa5, 0x4e, 0xff, 0xc3, 0x44, 0x50, 0x8d, 0x11, 0x99, 0xd6, 0xd0, 0xd8, 0x12, 0x35,
+    0x71, 0x69, 0xdb, 0x9a, 0x61, 0x13, 0x95, 0x56, 0xc2, 0xdd, 0xa6, 0x91, 0x37, 0x45, 0x1a, 0x79,
+    0x13, 0xb9, 0x39, 0xe0, 0x52, 0x68, 0xd3, 0x10, 0xc9, 0x67, 0xd4, 0x0a, 0x00, 0xec, 0x82, 0xa5,
+    0x84, 0xe5, 0x20, 0xb5, 0x9a, 0xd1, 0x48, 0x2a, 0x09, 0x94, 0xe4, 0x35, 0xb3, 0x76, 0x46, 0xb1,
+    0xc5, 0x94, 0x34, 0x02, 0x2a, 0x8d, 0x8f, 0x97, 0xb7, 0xab, 0x3b, 0xea, 0x0c, 0x39, 0x7a, 0xc2,
+    0x86, 0x18, 0x0c, 0xd2, 0x9a, 0x65, 0xa2, 0x26, 0x88, 0x8e, 0xc8, 0x56, 0x72, 0x3a, 0x5f, 0xad,
+    0xbe, 0x5e, 0x27, 0x69, 0xd4, 0xc7, 0xe7, 0x69, 0x66, 0xf0, 0xcd, 0xce, 0x14, 0xb0, 0x6d, 0xc5,
+    0x8c, 0xba, 0x0e, 0xd3, 0x9d, 0x10, 0xf7, 0x9c, 0x28, 0xd6, 0x88, 0x61, 0x8f, 0xa5, 0xe4, 0xa2,
+    0xd2, 0x35, 0x76, 0x66, 0x46, 0x1d, 0x0e, 0x25, 0x46, 0xfc, 0xee, 0xa4, 0x11, 0xdc, 0x23, 0x1d,
+    0xb0, 0xb5, 0x6b, 0x24, 0x5b, 0xa2, 0xe4, 0xb5, 0x36, 0xf0, 0x0c, 0x61, 0xbb, 0x7b, 0xc2, 0x77,
+    0xa4, 0x2e, 0xcb, 0x73, 0xf6, 0x5b, 0xd7, 0xe6, 0x5c, 0x37, 0x6d, 0x2d, 0x00, 0x43, 0xba, 0x28,
+    0x9e, 0xa3, 0xac, 0xb4, 0x05, 0x97, 0x4b, 0xe7, 0x8b, 0xd5, 0xb2, 0x93, 0x4a, 0x87, 0x37, 0x78,
+    0x22, 0x6f, 0xbe, 0xf8, 0xf8, 0xdb, 0x17, 0xd5, 0xbd, 0x47, 0xf1, 0x3a, 0x1e, 0xcf, 0x47, 0xf5,
+    0x0b, 0xdb, 0x3a, 0x8a, 0x13, 0x3d, 0x87, 0xc0, 0xc3, 0xc0, 0x40, 0x51, 0x4f, 0x62, 0xbb, 0xac,
+    0x91, 0x43, 0x7b, 0xd9, 0xbd, 0x08, 0xb3, 0x0e, 0x40, 0xe3, 0xf5, 0x3d, 0xab, 0x3b, 0xbc, 0x5f,
+    0x61, 0xcc, 0x8d, 0x33, 0x72, 0x6e, 0x18, 0x4c, 0xb1, 0xb7, 0x81, 0x11, 0x16, 0x98, 0x39, 0x76,
+    0xc2, 0x6e, 0xf6, 0x9f, 0x85, 0x01, 0x59, 0x7e, 0xf0, 0x23, 0x7f, 0x09, 0xbb, 0xc7, 0x3a, 0x15,
+    0xf0, 0xbd, 0xf7, 0xee, 0xa1, 0x84, 0xc8, 0xfb, 0x33, 0xea, 0x7f, 0x7d, 0xff, 0x00, 0x34, 0x78,
+    0x6b, 0xc1, 0x11, 0x05, 0x00, 0x00,
+};
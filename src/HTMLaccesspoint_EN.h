@@ -1,64 +1,42 @@
-static const char accesspoint_HTML[] PROGMEM = "<!DOCTYPE html>\
-<html>\
-    <head>\
-        <title>WiFi-configuration</title>\
-        <style>\
-            input {\
-                width: 90%%;\
-                height: 44px;\
-                border-radius: 4px;\
-                margin: 10px auto;\
-                font-size: 15px;\
-                background: #f1f1f1;\
-                border: 0;\
-                padding: 0 15px\
-            }\
-            input {\
-\
-            }\
-            body {\
-                background: #007bff;\
-                font-family: sans-serif;\
-                font-size: 14px;\
-                color: #777\
-            }\
-            .box {\
-                background: #fff;\
-                max-width: 258px;\
-                margin: 75px auto;\
-                padding: 30px;\
-                border-radius: 5px;\
-                text-align: center\
-            }\
-            .btn {\
-                background: #3498db;\
-                color: #fff;\
-                cursor: pointer;\
-                width: 90%%;\
-                height: 44px;\
-                border-radius: 4px;\
-                margin: 10px auto;\
-                font-size: 15px;\
-            }\
-            .rebootmsg {\
-                display: none;\
-            }\
-        </style>\
-    </head>\
-    <body>\
-        <form id=\"settings\" action=\"/init\" class=\"box\" method=\"POST\">\
-            <h1>WiFi-configuration</h1>\
-            <label for=\"ssid\">SSID:</label><br>\
-            <input type=\"text\" id=\"ssid\" name=\"ssid\" placeholder=\"SSID\" required><br>\
-            <label for=\"pwd\">Password:</label><br>\
-            <input type=\"password\" id=\"pwd\" name=\"pwd\" autocomplete=\"off\" required><br>\
-            <label for=\"hostname\">ESPuino's name (hostname):</label><br>\
-            <input type=\"text\" id=\"hostname\" name=\"hostname\" placeholder=\"espuino\" required><br><br>\
-            <input class=\"btn\" type=\"submit\" id=\"save-button\" value=\"Save\">\
-        </form>\
-        <form action=\"/restart\" class=\"box\">\
-            <h1>Ready to go?</h1>\
-            <input class=\"btn\" type=\"submit\" id=\"restart-button\" value=\"Reboot\">\
-        </form>\
-    </body>\
-</html>";
\ No newline at end of file
+// Generated by processHtml.py from html/accesspoint_EN.html (gzip-compressed); don't edit
+static const char accesspoint_HTML_ETAG[] PROGMEM = "\"28cb2e0e2c820007\"";
+static const uint8_t accesspoint_HTML_GZ[] PROGMEM = {
+    0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xb5, 0x54, 0xc1, 0x6e, 0xdb, 0x30,
+    0x0c, 0xbd, 0xfb, 0x2b, 0x34, 0x15, 0xc3, 0xb6, 0x83, 0xe7, 0x64, 0x4d, 0x90, 0xd6, 0x71, 0xb2,
+    0xc3, 0xda, 0x01, 0x3b, 0x35, 0x68, 0x0a, 0x0c, 0x3b, 0xca, 0x96, 0x6c, 0x0b, 0x93, 0x25, 0x4f,
+    0xa2, 0xdb, 0xa4, 0x43, 0xff, 0x7d, 0x94, 0x23, 0xa7, 0x49, 0x50, 0x14, 0xbd, 0x0c, 0x39, 0x48,
+    0x26, 0xc5, 0xf7, 0x1e, 0xc9, 0x87, 0x64, 0xef, 0xae, 0x6e, 0xbe, 0xdd, 0xfd, 0x5a, 0x5d, 0x93,
+    0x1a, 0x1a, 0xb5, 0x8c, 0xb2, 0xe1, 0x10, 0x8c, 0xe3, 0x01, 0x12, 0x94, 0x58, 0xfe, 0x94, 0xdf,
+    0x65, 0x5c, 0x18, 0x5d, 0xca, 0xaa, 0xb3, 0x0c, 0xa4, 0xd1, 0x59, 0xb2, 0xcb, 0x44, 0x99, 0x83,
+    0xad, 0x3f, 0xa5, 0x6e, 0x3b, 0x20, 0x7f, 0xa3, 0x07, 0xc9, 0xa1, 0x4e, 0xc9, 0xe5, 0xe8, 0xfd,
+    0x3c, 0xaa, 0x85, 0xac, 0x6a, 0x48, 0xc9, 0x64, 0xd2, 0x6e, 0xe6, 0x51, 0x6e, 0x2c, 0x17, 0x36,
+    0xb6, 0x8c, 0xcb, 0xce, 0x61, 0xd0, 0xc7, 0x1a, 0x66, 0x2b, 0xa9, 0x53, 0x32, 0x1e, 0xb5, 0x1b,
+    0xc2, 0x3a, 0x30, 0xf3, 0xa8, 0x34, 0x1a, 0x62, 0x27, 0x1f, 0x05, 0x46, 0xa7, 0x7d, 0x1d, 0x2b,
+    0x7e, 0x57, 0xd6, 0x74, 0x9a, 0xa7, 0xe4, 0xac, 0x1c, 0xfb, 0xdf, 0x00, 0x96, 0x92, 0xd1, 0x3c,
+    0x6a, 0x19, 0xe7, 0x52, 0x57, 0x78, 0xef, 0x0b, 0xa2, 0xa7, 0xbd, 0x96, 0x27, 0x7c, 0xc6, 0xb7,
+    0x78, 0x39, 0x82, 0x18, 0x8d, 0x66, 0x79, 0x59, 0x06, 0xa2, 0x92, 0x35, 0x52, 0x6d, 0x53, 0xe2,
+    0x98, 0x76, 0xb1, 0x13, 0x56, 0x96, 0xc7, 0x0a, 0x7a, 0x95, 0x85, 0x51, 0x06, 0xb9, 0xce, 0x66,
+    0xb3, 0x19, 0x62, 0x7e, 0xce, 0xcd, 0xe6, 0x14, 0xb3, 0xf4, 0x80, 0x0d, 0xdb, 0xc4, 0xa1, 0xfd,
+    0x2f, 0xd3, 0x8b, 0xc3, 0xf6, 0x66, 0xd3, 0x7d, 0x7b, 0x7b, 0xb5, 0xe7, 0xa3, 0x17, 0x86, 0xd2,
+    0x37, 0x0c, 0x62, 0x03, 0x31, 0x53, 0xb2, 0xc2, 0xca, 0x42, 0x68, 0x10, 0xb6, 0x67, 0x05, 0x7d,
+    0xca, 0x7a, 0x3e, 0xb9, 0xbc, 0xe0, 0xf9, 0xb3, 0xbe, 0x5e, 0x45, 0xd1, 0x59, 0xe7, 0xbf, 0x5a,
+    0x23, 0x7d, 0xe9, 0xfc, 0x3f, 0x6c, 0x04, 0xd5, 0x58, 0x91, 0x1b, 0x03, 0x8d, 0xab, 0x50, 0x13,
+    0x97, 0xae, 0x55, 0x0c, 0x87, 0xa8, 0x8d, 0x16, 0x3e, 0x9b, 0x25, 0xc1, 0x14, 0x59, 0x12, 0x6c,
+    0xe4, 0xf7, 0x80, 0x47, 0x69, 0x6c, 0x43, 0x24, 0x5f, 0x50, 0x27, 0x00, 0x70, 0x0a, 0x8e, 0x12,
+    0x56, 0x78, 0x3b, 0x2d, 0x68, 0x22, 0xb5, 0x04, 0x4a, 0x0a, 0xc5, 0x9c, 0x5b, 0x50, 0x1c, 0x31,
+    0x25, 0x8d, 0x80, 0xda, 0xe0, 0xe3, 0xd5, 0xcd, 0xfa, 0x8e, 0x7a, 0x4b, 0x8e, 0x5f, 0x34, 0x22,
+    0x86, 0xa3, 0x4c, 0xb1, 0x5c, 0x28, 0x82, 0xf8, 0x88, 0xed, 0x24, 0xa7, 0xcb, 0xf5, 0xfa, 0xc7,
+    0x55, 0x9a, 0x25, 0x7d, 0x7c, 0x99, 0xe5, 0x16, 0xdf, 0xec, 0x6c, 0x01, 0xdb, 0x56, 0x2c, 0xa8,
+    0x9f, 0x31, 0xdd, 0x49, 0xf1, 0xcf, 0x89, 0x66, 0x8d, 0x18, 0xee, 0xd8, 0x4c, 0x21, 0x6a, 0xa3,
+    0x70, 0x36, 0x0b, 0xea, 0x71, 0x28, 0xb1, 0xe2, 0x4f, 0x27, 0xad, 0xe0, 0x01, 0xe9, 0x80, 0xad,
+    0x7d, 0x40, 0xb2, 0x15, 0x8a, 0x7e, 0xc0, 0x61, 0xbe, 0x42, 0xd8, 0x86, 0x27, 0x3b, 0x52, 0x5f,
+    0x15, 0x38, 0xfb, 0xab, 0x1f, 0x74, 0x61, 0x9a, 0x56, 0x09, 0xc0, 0x90, 0x29, 0xcb, 0xd7, 0x28,
+    0x6b, 0xe3, 0xc0, 0xd7, 0xd2, 0xe5, 0xf5, 0x7a, 0xd5, 0x49, 0x6d, 0x3e, 0xb8, 0x1e, 0x8b, 0x7c,
+    0x1c, 0x32, 0x9f, 0xde, 0xd4, 0xf9, 0x1e, 0x27, 0x28, 0x79, 0xfe, 0x3e, 0x9a, 0x80, 0x70, 0xad,
+    0x27, 0x39, 0x51, 0x74, 0x08, 0x3c, 0x2c, 0x0d, 0x34, 0x0d, 0x24, 0xae, 0xcb, 0x1b, 0x39, 0x0c,
+    0x98, 0xdd, 0x8b, 0x38, 0xef, 0x00, 0x0c, 0xa6, 0xef, 0x99, 0xea, 0x30, 0xbf, 0xc6, 0x98, 0x5f,
+    0x69, 0xe2, 0x1d, 0x31, 0x18, 0x63, 0x6f, 0x05, 0x2b, 0x1c, 0x30, 0x7b, 0xec, 0x86, 0xdd, 0xfe,
+    0x6f, 0xd1, 0x4e, 0x5b, 0x02, 0x86, 0x54, 0xe6, 0x6b, 0xd8, 0xfc, 0x5b, 0x24, 0x04, 0xc0, 0x53,
+    0x15, 0xb7, 0xbd, 0x89, 0x0f, 0x75, 0x24, 0xc1, 0xa8, 0x49, 0xff, 0x2f, 0xf8, 0x0f, 0x47, 0x61,
+    0x75, 0xe4, 0x1c, 0x05, 0x00, 0x00,
+};
@@ -1,1225 +1,739 @@
-static const char management_HTML[] PROGMEM = "<!DOCTYPE html> \
-<html lang=\"de\">\
-<head>\
-    <title>ESPuino-Konfiguration</title>\
-    <meta charset=\"utf-8\">\
-    <meta name=\"viewport\" content=\"width=device-width, initial-scale=1\">\
-    <link rel=\"shortcut icon\" type=\"image/x-icon\" href=\"https://espuino.de/espuino/favicon.ico\">\
-    <link rel=\"stylesheet\" href=\"https://espuino.de/espuino/css/bootstrap.min.css\">\
-    <link rel=\"stylesheet\" href=\"https://cdnjs.cloudflare.com/ajax/libs/jstree/3.2.1/themes/default/style.min.css\"/>\
-    <link rel=\"stylesheet\" href=\"https://cdnjs.cloudflare.com/ajax/libs/font-awesome/5.15.1/css/all.min.css\"/>\
-    <link rel=\"stylesheet\" href=\"https://cdnjs.cloudflare.com/ajax/libs/toastr.js/latest/toastr.min.css\"/>\
-    <link rel=\"stylesheet\" href=\"https://cdnjs.cloudflare.com/ajax/libs/bootstrap-slider/11.0.2/css/bootstrap-slider.min.css\" />\
-    <script src=\"https://espuino.de/espuino/js/jquery.min.js\"></script>\
-    <script src=\"https://code.jquery.com/ui/1.12.0/jquery-ui.min.js\"></script>\
-    <script src=\"https://espuino.de/espuino/js/popper.min.js\"></script>\
-    <script src=\"https://espuino.de/espuino/js/bootstrap.min.js\"></script>\
-    <script src=\"https://cdnjs.cloudflare.com/ajax/libs/jstree/3.2.1/jstree.min.js\"></script>\
-    <script src=\"https://cdnjs.cloudflare.com/ajax/libs/toastr.js/latest/toastr.min.js\"></script>\
-    <script src=\"https://cdnjs.cloudflare.com/ajax/libs/bootstrap-slider/11.0.2/bootstrap-slider.min.js\"></script>\
-    <style type=\"text/css\">\
-        .filetree {\
-            border: 1px solid black;\
-            height: 200px;\
-            margin: 0em 0em 1em 0em;\
-            overflow-y: scroll;\
-        }\
-        .slider.slider-horizontal {\
-            width: 60%%;\
-            margin-left: 1em;\
-            margin-right: 1em;\
-\
-        }\
-        .slider-handle{\
-            height: 30px;\
-            width: 30px;\
-            top: -5px;\
-        }\
-\
-        legend.scheduler-border {\
-            width:inherit; /* Or auto */\
-            padding:0 10px; /* To give a bit of padding on the left and right */\
-            border-bottom:none;\
-        }\
-\
-        .icon-pos{\
-            top: 0.3em;\
-            position: relative;\
-         }\
-        .reboot{\
-            color:white;\
-        }\
-        .reboot:hover{\
-            color: orange;\
-        }\
-\
-        .fa-sync:hover {\
-            color: #666666;\
-        }\
-\
-        .clickForRefresh {\
-            text-align: center;\
-            color: gray;\
-            cursor: pointer;\
-            margin-top: 5em;\
-        }\
-\
-        .clickForRefresh:hover {\
-            color: darkgray;\
-        }\
-\
-        .filetree-container {\
-            position: relative;\
-        }\
-\
-        .coverimage-container {\
-            width: 80%%;\
-            height:15%%;\
-            margin-left: 1em;\
-            margin-right: 1em;\
-        }\
-\
-        .indexing-progress {\
-            width: 100%%;\
-            height: 100%%;\
-            position: absolute;\
-            top: 0;\
-            left: 0;\
-            opacity: 0.7;\
-            display: none;\
-        }\
-\
-        .refreshAction{\
-            text-align: right;\
-            font-size: 0.8em;\
-        }\
-\
-        .refreshAction:hover{\
-            cursor: pointer;\
-            color: darkgray;\
-        }\
-\
-        .overlay {\
-            z-index: 9;\
-            opacity: 0.8;\
-            background: #1a1919;\
-            height: 200px;\
-            display: none;\
-            width: 100%%;\
-        }\
-\
-        #SubTabContent.tab-content {\
-            display: flex;\
-        }\
-\
-        #SubTabContent.tab-content > .tab-pane {\
-            display: block; /* undo \"display: none;\" */\
-            visibility: hidden;\
-            margin-right: -100%%;\
-            width: 100%%;\
-        }\
-\
-        #SubTabContent.tab-content > .active {\
-            visibility: visible;\
-        }\
-\
-        /* IOS display fix */\
-        select {\
-            -webkit-appearance: none;\
-            -moz-appearance: none;\
-            appearance: none;\
-            background: url('data:image/png;base64,iVBORw0KGgoAAAANSUhEUgAAABkAAAAZCAAAAADhgtq/AAAACXBIWXMAAC4jAAAuIwF4pT92AAAAR0lEQVR4nGP5z4ADsOCSGOoyC+NRabjMQqjQQrgUTCYeIrQQyEI3DSyFJIHkApAUkgSy21B0oLo6fiGSBKp/kCUGU4hSRQYAYg0Rw+gGlUQAAAAASUVORK5CYII=') no-repeat;\
-            background-position: center right;\
-        }\
-    </style>\
-</head>\
-<body>\
-<nav class=\"navbar navbar-expand-sm bg-primary navbar-dark\">\
-    <div class=\"col-md-12\">\
-    <a class=\"float-left navbar-brand\">\
-        <img src=\"https://www.espuino.de/espuino/Espuino32.png\"\
-             width=\"35\" height=\"35\" class=\"d-inline-block align-top\" alt=\"\"/>\
-        ESPuino\
-    </a>\
-    <a class=\"reboot float-right nav-link\" href=\"/restart\"><i class=\"fas fa-redo\"></i> Neustart</a>\
-    <a class=\"reboot float-right nav-link\" href=\"/shutdown\"><i class=\"fas fa-power-off\"></i> Ausschalten</a>\
-    <a class=\"reboot float-right nav-link\" href=\"/log\"><i class=\"fas fa-book\"></i> Log</a>\
-    <a class=\"reboot float-right nav-link\" href=\"/info\"><i class=\"fas fa-info\"></i> Infos</a>\
-    </div>\
-</nav>\
-<br/>\
-    <nav>\
-        <div class=\"container nav nav-tabs\" id=\"nav-tab\" role=\"tablist\">\
-            <a class=\"nav-item nav-link\" id=\"nav-control-tab\" data-toggle=\"tab\" href=\"#nav-control\" role=\"tab\" aria-controls=\"nav-control\" aria-selected=\"false\"><i class=\"fas fa-gamepad\"></i><span class=\".d-sm-none .d-md-block\"> Steuerung</span></a>\
-            <a class=\"nav-item nav-link active\" id=\"nav-rfid-tab\" data-toggle=\"tab\" href=\"#nav-rfid\" role=\"tab\" aria-controls=\"nav-rfid\" aria-selected=\"true\"><i class=\"fas fa-dot-circle\"></i> RFID</a>\
-            <a class=\"nav-item nav-link\" id=\"nav-wifi-tab\" data-toggle=\"tab\" href=\"#nav-wifi\" role=\"tab\" aria-controls=\"nav-wifi\" aria-selected=\"false\"><i class=\"fas fa-wifi\"></i><span class=\".d-sm-none .d-md-block\"> WLAN</span></a>\
-            %SHOW_MQTT_TAB%\
-            %SHOW_FTP_TAB%\
-            <a class=\"nav-item nav-link\" id=\"nav-general-tab\" data-toggle=\"tab\" href=\"#nav-general\" role=\"tab\" aria-controls=\"nav-general\" aria-selected=\"false\"><i class=\"fas fa-sliders-h\"></i> Allgemein</a>\
-            <a class=\"nav-item nav-link\" id=\"nav-tools-tab\" data-toggle=\"tab\" href=\"#nav-tools\" role=\"tab\" aria-controls=\"nav-tools\" aria-selected=\"false\"><i class=\"fas fa-wrench\"></i> Tools</a>\
-            <a class=\"nav-item nav-link\" id=\"nav-forum-tab\" data-toggle=\"tab\" href=\"#nav-forum\" role=\"tab\" aria-controls=\"nav-forum\" aria-selected=\"false\"><i class=\"fas fa-comment\"></i><span class=\".d-sm-none .d-md-block\"> Forum</span></a>\
-        </div>\
-    </nav>\
-<br>\
-<div class=\"tab-content\" id=\"nav-tabContent\">\
-    <div class=\"tab-pane fade\" id=\"nav-wifi\" role=\"tabpanel\" aria-labelledby=\"nav-wifi-tab\">\
-        <div class=\"container\" id=\"wifiConfig\">\
-            <form action=\"#wifiConfig\" method=\"POST\" onsubmit=\"wifiConfig('wifiConfig'); return false\">\
-                <div class=\"form-group col-md-12\">\
-                    <legend>WLAN-Einstellungen</legend>\
-                    <label for=\"ssid\">WLAN-Name (SSID):</label>\
-                    <input type=\"text\" class=\"form-control\" id=\"ssid\" placeholder=\"SSID\" name=\"ssid\" required>\
-                    <div class=\"invalid-feedback\">\
-                        Bitte SSID des WLANs eintragen.\
-                    </div>\
-                    <label for=\"pwd\">Passwort:</label>\
-                    <input type=\"password\" class=\"form-control\" id=\"pwd\" placeholder=\"Passwort\" name=\"pwd\" required>\
-                    <label for=\"hostname\">ESPuino-Name (Hostname):</label>\
-                    <input type=\"text\" class=\"form-control\" id=\"hostname\" placeholder=\"espuino\" name=\"hostname\"\
-                           value=\"%HOSTNAME%\" pattern=\"^[^-\\.]{2,32}\" required>\
-                </div>\
-                <br>\
-                <div class=\"text-center\">\
-                <button type=\"reset\" class=\"btn btn-secondary\">Reset</button>\
-                <button type=\"submit\" class=\"btn btn-primary\">Absenden</button>\
-                </div>\
-            </form>\
-        </div>\
-    </div>\
-    <div class=\"tab-pane fade\" id=\"nav-control\" role=\"tabpanel\" aria-labelledby=\"nav-control-tab\">\
-        <div class=\"container\" id=\"navControl\">\
-                <div class=\"form-group col-md-12\">\
-                    <legend>Steuerung</legend>\
-                    <div class=\"form-group col-md-12\">\
-                        <img src=\"/cover\" class=\"coverimage-container\" id=\"coverimg\">\
-                    </div>\
-                    <div class=\"buttons\">\
-                        <button type=\"button\" class=\"btn btn-default btn-lg\" id=\"nav-btn-first\" onclick=\"sendControl(173)\">\
-                            <span class=\"fas fa-fast-backward\"></span>\
-                        </button>\
-                        <button type=\"button\" class=\"btn btn-default btn-lg\" id=\"nav-btn-prev\" onclick=\"sendControl(171)\">\
-                            <span class=\"fas fa-backward\"></span>\
-                        </button>\
-                        <button type=\"button\" class=\"btn btn-default btn-lg\" id=\"nav-btn-play\" onclick=\"sendControl(170)\">\
-                            <i id=\"ico-play-pause\" class='fas fa-lg fa-play')></i>\
-                        </button>\
-                        <button type=\"button\" class=\"btn btn-default btn-lg\" id=\"nav-btn-next\" onclick=\"sendControl(172)\">\
-                            <span class=\"fas fa-forward\"></span>\
-                        </button>\
-                        <button type=\"button\" class=\"btn btn-default btn-lg\" id=\"nav-btn-last\" onclick=\"sendControl(174)\">\
-                            <span class=\"fas fa-fast-forward\"></span>\
-                        </button>\
-                    </div>\
-                </div>\
-                <br>\
-                <div class=\"form-group col-md-12\">\
-                    <legend>Lautst&auml;rke</legend>\
-                        <button type=\"button\" class=\"btn btn-default btn-lg\" onclick=\"sendControl(177)\">\
-                            <span class=\"fas fa-volume-down\"></span>\
-                        </button>\
-                        </i><input data-provide=\"slider\" type=\"number\" data-slider-min=\"1\" data-slider-max=\"21\" min=\"1\" max=\"21\" class=\"form-control\" id=\"setVolume\"\
-                            data-slider-value=\"%CURRENT_VOLUME%\" value=\"%CURRENT_VOLUME%\" onchange=\"sendVolume(this.value)\">\
-                        <button type=\"button\" class=\"btn btn-default btn-lg\" onclick=\"sendControl(176)\">\
-                            <span class=\"fas fa-volume-up\"></span>\
-                        </button>\
-                </div>\
-                <br/>\
-                <div class=\"form-group col-md-12\">\
-                    <legend>Aktueller Titel</legend>\
-                    <div id=\"track\"></div>\
-                </div>\
-        </div>\
-    </div>\
-    <div class=\"tab-pane fade show active\" id=\"nav-rfid\" role=\"tabpanel\" aria-labelledby=\"nav-rfid-tab\">\
-        <div class=\"container\" id=\"filetreeContainer\">\
-            <fieldset>\
-                <legend>Dateien</legend>\
-				<div class=\"filetree-container\">\
-				<div id=\"filebrowser\">\
-					<div class=\"filetree demo\" id=\"explorerTree\"></div>\
-				</div>\
-				<div>\
-					<form id=\"explorerUploadForm\" method=\"POST\" enctype=\"multipart/form-data\" action=\"/explorer\">\
-                        <div class=\"input-group\">\
-                            <span class=\"form-control\" id=\"uploaded_file_text\"></span>\
-                            <span class=\"input-group-btn\">\
-                                <span class=\"btn btn-secondary\" onclick=\"$(this).parent().find('input[type=file]').click();\">Browse</span>\
-                                <span class=\"btn btn-primary\" onclick=\"$(this).parent().find('input[type=file]').submit();\">Upload</span>\
-                                <input name=\"uploaded_file\" id =\"uploaded_file\" onchange=\"$(this).parent().parent().find('.form-control').html($(this).val().split(/[\\|/]/).pop());\" style=\"display: none;\" type=\"file\" multiple>\
-                            </span>\
-                        </div>\
-                    </form>\
-                    <br>\
-                    <div class=\"progress\">\
-                        <div id=\"explorerUploadProgress\" class=\"progress-bar\" role=\"progressbar\" ></div>\
-                    </div>\
-                </div>\
-                <br>\
-				</div>\
-            </fieldset>\
-        </div>\
-        <div class=\"container\" id=\"rfidMusicTags\">\
-            <fieldset>\
-                <legend>RFID-Zuweisungen</legend>\
-            <form action=\"#rfidMusicTags\" method=\"POST\" onsubmit=\"rfidAssign('rfidMusicTags'); return false\">\
-                <div class=\"form-group col-md-12\">\
-                    <label for=\"rfidIdMusic\">RFID-Chip-Nummer (12-stellig)</label>\
-                    <input type=\"text\" class=\"form-control\" id=\"rfidIdMusic\" maxlength=\"12\" pattern=\"[0-9]{12}\"\
-                           placeholder=\"%RFID_TAG_ID%\" name=\"rfidIdMusic\" required>\
-                    <br>\
-                    <ul class=\"nav nav-tabs\" id=\"SubTab\" role=\"tablist\">\
-                        <li class=\"nav-item\">\
-                            <a class=\"nav-link active\" id=\"rfid-music-tab\" data-toggle=\"tab\" href=\"#rfidmusic\" role=\"tab\"><i class=\"fas fa-music\"></i> Musik</a>\
-                        </li>\
-                        <li class=\"nav-item\">\
-                            <a class=\"nav-link\" id=\"rfid-mod-tab\" data-toggle=\"tab\" href=\"#rfidmod\" role=\"tab\"><i class=\"fas fa-cog\"></i> Modifikation</a>\
-                        </li>\
-                    </ul>\
-                    <div class=\"tab-content\" id=\"SubTabContent\">\
-                        <div class=\"tab-pane show active\" id=\"rfidmusic\" role=\"tabpanel\">\
-                            <br>\
-                            <label for=\"fileOrUrl\">Datei, Verzeichnis oder URL (^ und # als Zeichen nicht erlaubt)</label>\
-                            <input type=\"text\" class=\"form-control\" id=\"fileOrUrl\" maxlength=\"255\" placeholder=\"z.B. /mp3/Hoerspiele/Yakari/Yakari_und_seine_Freunde.mp3\" pattern=\"^[^\\^#]+$\" name=\"fileOrUrl\" required>\
-                            <label for=\"playMode\">Abspielmodus</label>\
-                            <select class=\"form-control\" id=\"playMode\" name=\"playMode\">\
-                                <option class=\"placeholder\" disabled selected value=\"\">Modus auswählen</option>\
-                                <option class=\"option-file\" value=\"1\">Einzelner Titel</option>\
-                                <option class=\"option-file\" value=\"2\">Einzelner Titel (Endlosschleife)</option>\
-                                <option class=\"option-file-and-folder\" value=\"3\">Hörbuch</option>\
-                                <option class=\"option-file-and-folder\" value=\"4\">Hörbuch (Endlosschleife)</option>\
-                                <option class=\"option-folder\" value=\"5\">Alle Titel eines Verzeichnis (sortiert)</option>\
-                                <option class=\"option-folder\" value=\"6\">Alle Titel eines Verzeichnis (zufällig)</option>\
-                                <option class=\"option-folder\" value=\"7\">Alle Titel eines Verzeichnis (sortiert, Endlosschleife)</option>\
-                                <option class=\"option-folder\" value=\"9\">Alle Titel eines Verzeichnis (zufällig, Endlosschleife)</option>\
-                                <option class=\"option-stream\" value=\"8\">Webradio</option>\
-                                <option class=\"option-stream\" value=\"11\">Liste (Dateien von SD und/oder Webstreams) aus lokaler .m3u-Datei</option>\
-                            </select>\
-                        </div>\
-                        <div class=\"tab-pane \" id=\"rfidmod\" role=\"tabpanel\">\
-                            <label for=\"modId\"></label>\
-                            <select class=\"form-control\" id=\"modId\" name=\"modId\">\
-                                <option class=\"placeholder\" disabled selected value=\"\">Modifikation auswählen</option>\
-                                <option value=\"100\">Tastensperre</option>\
-                                <option value=\"101\">Schlafen nach 15 Minuten</option>\
-                                <option value=\"102\">Schlafen nach 30 Minuten</option>\
-                                <option value=\"103\">Schlafen nach 1 Stunde</option>\
-                                <option value=\"104\">Schlafen nach 2 Stunden</option>\
-                                <option value=\"105\">Schlafen nach Ende des Titels</option>\
-                                <option value=\"106\">Schlafen nach Ende der Playlist</option>\
-                                <option value=\"107\">Schlafen nach fünf Titeln</option>\
-                                <option value=\"110\">Wiederhole Playlist (endlos)</option>\
-                                <option value=\"111\">Wiederhole Titel (endlos)</option>\
-                                <option value=\"120\">Dimme LEDs (Nachtmodus)</option>\
-                                <option value=\"130\">Aktiviere/deaktive WLAN</option>\
-                                <option value=\"140\">Aktiviere/deaktiviere Bluetooth</option>\
-                                <option value=\"150\">Aktiviere FTP</option>\
-                                <option value=\"0\">Lösche Zuordnung</option>\
-                            </select>\
-                        </div>\
-                    </div>\
-                </div>\
-                <br>\
-                <div class=\"text-center\">\
-                <button type=\"reset\" class=\"btn btn-secondary\">Reset</button>\
-                <button type=\"submit\" class=\"btn btn-primary\">Absenden</button>\
-                </div>\
-            </form>\
-            </fieldset>\
-        </div>\
-        <br />\
-    </div>\
-    <div class=\"tab-pane fade\" id=\"nav-mqtt\" role=\"tabpanel\" aria-labelledby=\"nav-mqtt-tab\">\
-        <div class=\"container\" id=\"mqttConfig\">\
-\
-            <form class=\"needs-validation\" action=\"#mqttConfig\" method=\"POST\"\
-                  onsubmit=\"mqttSettings('mqttConfig'); return false\">\
-                <div class=\"form-check col-md-12\">\
-                    <legend>MQTT-Einstellungen</legend>\
-                    <input class=\"form-check-input\" type=\"checkbox\" value=\"1\" id=\"mqttEnable\" name=\"mqttEnable\" %MQTT_ENABLE%>\
-                    <label class=\"form-check-label\" for=\"mqttEnable\">\
-                        MQTT aktivieren\
-                    </label>\
-                </div>\
-                <div class=\"form-group my-2 col-md-12\">\
-                    <label for=\"mqttServer\">MQTT-Server</label>\
-                    <input type=\"text\" class=\"form-control\" id=\"mqttServer\" minlength=\"7\" maxlength=\"%MQTT_SERVER_LENGTH%\"\
-                           placeholder=\"z.B. 192.168.2.89\" name=\"mqttServer\" value=\"%MQTT_SERVER%\">\
-                    <label for=\"mqttUser\">MQTT-Benutzername (optional):</label>\
-                    <input type=\"text\" class=\"form-control\" id=\"mqttUser\" maxlength=\"%MQTT_USER_LENGTH%\"\
-                           placeholder=\"Benutzername\" name=\"mqttUser\" value=\"%MQTT_USER%\">\
-                    <label for=\"mqttPwd\">MQTT-Passwort (optional):</label>\
-                    <input type=\"password\" class=\"form-control\" id=\"mqttPwd\" maxlength=\"%MQTT_PWD_LENGTH%\"\
-                           placeholder=\"Passwort\" name=\"mqttPwd\" value=\"%MQTT_PWD%\">\
-                    <label for=\"mqttPort\">MQTT-Port:</label>\
-                    <input type=\"number\" class=\"form-control\" id=\"mqttPort\" min=\"1\" max=\"65535\"\
-                            placeholder=\"Port\" name=\"mqttPort\" value=\"%MQTT_PORT%\" required>\
-                </div>\
-                <br>\
-                <div class=\"text-center\">\
-                <button type=\"reset\" class=\"btn btn-secondary\">Reset</button>\
-                <button type=\"submit\" class=\"btn btn-primary\">Absenden</button>\
-                </div>\
-            </form>\
-        </div>\
-    </div>\
-    <div class=\"tab-pane fade\" id=\"nav-ftp\" role=\"tabpanel\" aria-labelledby=\"nav-ftp-tab\">\
-        <div class=\"container\" id=\"ftpConfig\">\
-\
-            <form action=\"#ftpConfig\" method=\"POST\" onsubmit=\"ftpSettings('ftpConfig'); return false\">\
-                <div class=\"form-group col-md-12\">\
-                    <legend>FTP-Einstellungen</legend>\
-                    <label for=\"ftpUser\">FTP-Benutzername:</label>\
-                    <input type=\"text\" class=\"form-control\" id=\"ftpUser\" maxlength=\"%FTP_USER_LENGTH%\"\
-                           placeholder=\"Benutzername\" name=\"ftpUser\" value=\"%FTP_USER%\" required>\
-                    <label for=\"pwd\">FTP-Passwort:</label>\
-                    <input type=\"password\" class=\"form-control\" id=\"ftpPwd\" maxlength=\"%FTP_PWD_LENGTH%\" placeholder=\"Passwort\"\
-                           name=\"ftpPwd\" value=\"%FTP_PWD%\" required>\
-                </div>\
-                <br>\
-                <div class=\"text-center\">\
-                <button type=\"reset\" class=\"btn btn-secondary\">Reset</button>\
-                <button type=\"submit\" class=\"btn btn-primary\">Absenden</button>\
-                </div>\
-            </form>\
-        </div>\
-    </div>\
-\
-    <div class=\"tab-pane fade\" id=\"nav-general\" role=\"tabpanel\" aria-labelledby=\"nav-general-tab\">\
-        <div class=\"container\" id=\"generalConfig\">\
-\
-            <form action=\"#generalConfig\" method=\"POST\" onsubmit=\"genSettings('generalConfig'); return false\">\
-                    <div class=\"form-group col-md-12\">\
-                    <fieldset>\
-                            <legend class=\"w-auto\">Lautstärke</legend>\
-                    <label for=\"initialVolume\">Nach dem Einschalten</label>\
-                        <div class=\"text-center\">\
-                    <i class=\"fas fa-volume-down fa-2x .icon-pos\"></i> <input data-provide=\"slider\" type=\"number\" data-slider-min=\"1\" data-slider-max=\"21\" min=\"1\" max=\"21\" class=\"form-control\" id=\"initialVolume\" name=\"initialVolume\"\
-                        data-slider-value=\"%INIT_VOLUME%\"  value=\"%INIT_VOLUME%\" required>  <i class=\"fas fa-volume-up fa-2x .icon-pos\"></i></div>\
-                        <br>\
-                    <label for=\"maxVolumeSpeaker\">Maximal (Lautsprecher)</label>\
-                        <div class=\"text-center\">\
-                     <i class=\"fas fa-volume-down fa-2x .icon-pos\"></i>   <input data-provide=\"slider\" type=\"number\" data-slider-min=\"1\" data-slider-max=\"21\" min=\"1\" max=\"21\" class=\"form-control\" id=\"maxVolumeSpeaker\" name=\"maxVolumeSpeaker\"\
-                        data-slider-value=\"%MAX_VOLUME_SPEAKER%\"  value=\"%MAX_VOLUME_SPEAKER%\" required>  <i class=\"fas fa-volume-up fa-2x .icon-pos\"></i>\
-                        </div>\
-                        <br>\
-                    <label for=\"maxVolumeHeadphone\">Maximal (Kopfhörer)</label>\
-                        <div class=\"text-center\">\
-                    <i class=\"fas fa-volume-down fa-2x .icon-pos\"></i> <input data-provide=\"slider\" type=\"number\" data-slider-min=\"1\" data-slider-max=\"21\" min=\"1\" max=\"21\" class=\"form-control\" id=\"maxVolumeHeadphone\" name=\"maxVolumeHeadphone\"\
-                         data-slider-value=\"%MAX_VOLUME_HEADPHONE%\" value=\"%MAX_VOLUME_HEADPHONE%\" required>  <i class=\"fas fa-volume-up fa-2x .icon-pos\"></i>\
-                        </div>\
-                </fieldset>\
-                </div>\
-                <br>\
-                <div class=\"form-group col-md-12\">\
-                    <fieldset >\
-                        <legend class=\"w-auto\">Neopixel (Helligkeit)</legend>\
-                    <label for=\"initBrightness\">Nach dem Einschalten:</label>\
-                        <div class=\"text-center\">\
-                            <i class=\"far fa-sun fa-2x .icon-pos\"></i>\
-                        <input data-provide=\"slider\" type=\"number\" data-slider-min=\"0\" data-slider-max=\"255\" min=\"0\" max=\"255\" class=\"form-control\" id=\"initBrightness\" name=\"initBrightness\"\
-                               data-slider-value=\"%INIT_LED_BRIGHTNESS%\"  value=\"%INIT_LED_BRIGHTNESS%\" required><i class=\"fas fa-sun fa-2x .icon-pos\"></i>\
-                        </div>\
-\
-                    <label for=\"nightBrightness\">Im Nachtmodus</label>\
-                        <div class=\"text-center\">\
-                        <i class=\"far fa-sun fa-2x .icon-pos\"></i><input data-provide=\"slider\" type=\"number\" data-slider-min=\"0\" data-slider-max=\"255\" min=\"0\" max=\"255\" class=\"form-control\" id=\"nightBrightness\" name=\"nightBrightness\" data-slider-value=\"%NIGHT_LED_BRIGHTNESS%\" value=\"%NIGHT_LED_BRIGHTNESS%\" required><i class=\"fas fa-sun fa-2x .icon-pos\"></i>\
-                        </div>\
-                    </fieldset>\
-                </div>\
-<br>\
-                <div class=\"form-group col-md-12\">\
-                    <fieldset>\
-                        <legend>Deep Sleep</legend>\
-\
-                        <label for=\"inactivityTime\">Inaktivität nach (in Minuten)</label>\
-                        <div class=\"text-center\"><i class=\"fas fa-hourglass-start fa-2x .icon-pos\"></i> <input type=\"number\" data-provide=\"slider\" data-slider-min=\"0\" data-slider-max=\"30\" min=\"1\" max=\"120\" class=\"form-control\" id=\"inactivityTime\" name=\"inactivityTime\"\
-                         data-slider-value=\"%MAX_INACTIVITY%\"  value=\"%MAX_INACTIVITY%\" required><i class=\"fas fa-hourglass-end fa-2x .icon-pos\"></i></div>\
-                    </fieldset>\
-                </div>\
-<br>\
-\
-                <div class=\"form-group col-md-12\">\
-                    <fieldset>\
-                        <legend>Batterie</legend>\
-                    <div>Status über Neopixel anzeigen</div>\
-                        <br>\
-                    <label for=\"warningLowVoltage\">Unter dieser Spannung wird eine Warnung angezeigt.\
-                    </label>\
-                        <div class=\"text-center\">\
-                        <i class=\"fas fa-battery-quarter fa-2x .icon-pos\"></i> <input  data-provide=\"slider\"  data-slider-step=\"0.1\" data-slider-min=\"3.0\" data-slider-max=\"5.0\"  min=\"3.0\" max=\"5.0\" type=\"text\" class=\"form-control\" id=\"warningLowVoltage\" name=\"warningLowVoltage\"\
-                        data-slider-value=\"%WARNING_LOW_VOLTAGE%\" value=\"%WARNING_LOW_VOLTAGE%\" pattern=\"^\\d{1,2}(\\.\\d{1,3})?\" required> <i class=\"fas fa-battery-three-quarters fa-2x .icon-pos\" fa-2x .icon-pos></i>\
-                        </div>\
-<br>\
-                    <label for=\"voltageIndicatorLow\">Eine LED leuchtet bei dieser Spannung\
-                        </label>\
-                        <div class=\"text-center\">\
-                        <i class=\"fas fa-battery-quarter fa-2x .icon-pos\"></i> <input data-provide=\"slider\" min=\"2.0\" data-slider-step=\"0.1\" data-slider-min=\"2.0\" data-slider-max=\"5.0\" max=\"5.0\" type=\"text\" class=\"form-control\" id=\"voltageIndicatorLow\" name=\"voltageIndicatorLow\"\
-                          data-slider-value=\"%VOLTAGE_INDICATOR_LOW%\"  value=\"%VOLTAGE_INDICATOR_LOW%\" pattern=\"^\\d{1,2}(\\.\\d{1,3})?\" required> <i class=\"fas fa-battery-three-quarters fa-2x .icon-pos\" fa-2x .icon-pos></i>\
-                        </div>\
-                        <br>\
-                        <label for=\"voltageIndicatorHigh\">Alle LEDs leuchten bei dieser Spannung</label>\
-\
-                            <div class=\"text-center\">\
-                                <i class=\"fas fa-battery-quarter fa-2x .icon-pos\"></i><input data-provide=\"slider\" data-slider-step=\"0.1\"  data-slider-min=\"2.0\" data-slider-max=\"5.0\" min=\"2.0\" max=\"5.0\" type=\"text\" class=\"form-control\" id=\"voltageIndicatorHigh\" name=\"voltageIndicatorHigh\"\
-                           data-slider-value=\"%VOLTAGE_INDICATOR_HIGH%\"  value=\"%VOLTAGE_INDICATOR_HIGH%\" pattern=\"^\\d{1,2}(\\.\\d{1,3})?\" required> <i class=\"fas fa-battery-three-quarters fa-2x .icon-pos\" fa-2x .icon-pos></i>\
-                        </div>\
-\
-                        <br>\
-                    <label for=\"voltageCheckInterval\">Zeitabstand der Messung (in Minuten)</label>\
-                        <div class=\"text-center\"><i class=\"fas fa-hourglass-start fa-2x .icon-pos\"></i>\
-                            <input data-provide=\"slider\" data-slider-min=\"1\" data-slider-max=\"60\" type=\"number\" min=\"1\" max=\"60\" class=\"form-control\" id=\"voltageCheckInterval\"\
-                                   data-slider-value=\"%VOLTAGE_CHECK_INTERVAL%\"  name=\"voltageCheckInterval\" value=\"%VOLTAGE_CHECK_INTERVAL%\" required><i class=\"fas fa-hourglass-end fa-2x .icon-pos\"></i>\
-                    </div>\
-\
-                    </fieldset>\
-                </div>\
-<br>\
-                <div class=\"text-center\">\
-                <button type=\"reset\" class=\"btn btn-secondary\">Reset</button>\
-                <button type=\"submit\" class=\"btn btn-primary\">Absenden</button>\
-                </div>\
-            </form>\
-        </div>\
-        <br />\
-    </div>\
-    <div class=\"tab-pane fade\" id=\"nav-tools\" role=\"tabpanel\" aria-labelledby=\"nav-tools-tab\">\
-        <div class=\"container\" id=\"eraseNvs\">\
-            <legend>NVS RFID-Zuweisungen löschen</legend>\
-            <form action=\"/rfidnvserase\" enctype=\"multipart/form-data\" method=\"GET\">\
-                <div class=\"form-group\">\
-                    <p>Über den Importer werden lediglich neue Einträge importiert, jedoch keine bestehenden Einträge aktiv gelöscht. Im Falle einer doppelten Zuweisung wird ein Eintrag allenfalls überschrieben. Mit dieser Funktion können alle bestehenden NVS-RFID-Zuweisungen gelöscht werden, so dass der ESPuino im Anschluss keinerlei Karten mehr kennt. Wird im Anschluss der Importer gestartet, befinden sich im Speicher des ESPuino anschließend exakt nur solche Zuweisungen, die Teil der Backup-Datei sind. Weitere Infos gibt es <a href=\"https://forum.espuino.de/t/die-backupfunktion-des-espuino/508\" target=\"_blank\">hier</a>.</p>\
-                </div>\
-                <button type=\"submit\" class=\"btn btn-primary\">Zuweisungen löschen</button>\
-            </form>\
-        </div>\
-        <br />\
-        <br />\
-        <div class=\"container\" id=\"importNvs\">\
-            <legend>NVS RFID-Importer</legend>\
-            <form action=\"/upload\" enctype=\"multipart/form-data\" method=\"POST\">\
-                <div class=\"form-group\">\
-                    <label for=\"nvsUpload\">Hier kann eine Backup-Datei hochgeladen werden, um NVS-RFID-Zuweisungen zu importieren.</label>\
-                    <input type=\"file\" class=\"form-control-file\" id=\"nvsUpload\" name=\"nvsUpload\" accept=\".txt\">\
-                </div>\
-                <button type=\"submit\" class=\"btn btn-primary\">Absenden</button>\
-            </form>\
-        </div>\
-        <br />\
-        <br />\
-        <div class=\"container\" id=\"httpUpdate\">\
-            <legend>Firmware-Update</legend>\
-            <form action=\"/update\" enctype=\"multipart/form-data\" method=\"POST\">\
-                <div class=\"form-group\">\
-                    <label for=\"firmwareUpload\">Hier kann ein Firmware-Update durchgeführt werden.</label>\
-                    <input type=\"file\" class=\"form-control-file\" id=\"firmwareUpload\" name=\"firmwareUpload\" accept=\".bin\">\
-                </div>\
-                <button type=\"submit\" class=\"btn btn-primary\">Absenden</button>\
-            </form>\
-        </div>\
-    </div>\
-    <br />\
-    <br />\
-    <div class=\"tab-pane fade\" id=\"nav-forum\" role=\"tabpanel\" aria-labelledby=\"nav-forum-tab\">\
-        <div class=\"container\" id=\"forum\">\
-            <legend>Forum</legend>\
-            <p>Du hast Probleme mit ESPuino oder bist an einem Erfahrungsaustausch interessiert?<br />\
-                Dann schaue doch mal im <a href=\"https://forum.espuino.de\" target=\"_blank\">ESPuino-Forum</a> vorbei! Insbesondere gibt es dort auch einen<br />\
-                <a href=\"https://forum.espuino.de/c/dokumentation/anleitungen/10\" target=\"_blank\">Bereich</a>, in dem reichlich Dokumentation hinterlegt ist. Wir freuen uns auf deinen Besuch!\
-            </p>\
-        </div>\
-    </div>\
-</div>\
-<script type=\"text/javascript\">\
-    var DEBUG = false;\
-    var lastIdclicked = '';\
-    var ActiveSubTab = 'rfid-music-tab';\
-    var host = $(location).attr('hostname');\
-\
-    /* show active / selected tab */\
-    $('#SubTab.nav-tabs a').on('shown.bs.tab', function (e) {\
-        ActiveSubTab = $(e.target).attr('id');\
-        console.log ( ActiveSubTab);\
-        if (ActiveSubTab == 'rfid-music-tab') {\
-            document.getElementById(\"fileOrUrl\").required = true;\
-        } else {\
-            document.getElementById(\"fileOrUrl\").required = false;\
-        }\
-});\
-\
-    if (DEBUG) {\
-        host = \"192.168.178.114\";\
-    }\
-\
-    toastr.options = {\
-        \"closeButton\": false,\
-        \"debug\": false,\
-        \"newestOnTop\": false,\
-        \"progressBar\": false,\
-        \"positionClass\": \"toast-top-right\",\
-        \"preventDuplicates\": false,\
-        \"onclick\": null,\
-        \"showDuration\": \"300\",\
-        \"hideDuration\": \"1000\",\
-        \"timeOut\": \"5000\",\
-        \"extendedTimeOut\": \"1000\",\
-        \"showEasing\": \"swing\",\
-        \"hideEasing\": \"linear\",\
-        \"showMethod\": \"fadeIn\",\
-        \"hideMethod\": \"fadeOut\",\
-        \"preventDuplicates\": true,\
-        \"preventOpenDuplicates\": true\
-    };\
-\
-    function postRendering(event, data) {\
-        Object.keys(data.instance._model.data).forEach(function (key, index) {\
-\
-            var cur = data.instance.get_node(data.instance._model.data[key]);\
-            var lastFolder = cur['id'].split('/').filter(function (el) {\
-                return el.trim().length > 0;\
-            }).pop();\
-            if ((/\\.(mp3|MP3|ogg|wav|WAV|OGG|wma|WMA|acc|ACC|flac|FLAC|m4a|M4A)$/i).test(lastFolder)) {\
-                data.instance.set_type(data.instance._model.data[key], 'audio');\
-            } else {\
-                if (data.instance._model.data[key]['type'] == \"file\") {\
-                    data.instance.disable_node(data.instance._model.data[key]);\
-                }\
-            }\
-            data.instance.rename_node(data.instance._model.data[key], lastFolder);\
-        });\
-    }\
-\
-    /* File Explorer functions begin*/\
-    var lastSelectedNodePath = \"\";\
-\
-    $('#explorerTree').on('select_node.jstree', function (e, data) {\
-\
-        $('input[name=fileOrUrl]').val(data.node.data.path);\
-\
-        if (ActiveSubTab !== 'rfid-music-tab') {\
-            $('#SubTab.nav-tabs a[id=\"rfid-music-tab\"]').tab('show');\
-        }\
-\
-        if (data.node.type == \"folder\") {\
-            $('.option-folder').show();\
-            $('.option-file').hide();\
-            $('#playMode option').removeAttr('selected').filter('[value=3]').attr('selected', true);\
-        }\
-\
-        if (data.node.type == \"audio\") {\
-            $('.option-file').show();\
-            $('.option-folder').hide();\
-            $('#playMode option').removeAttr('selected').filter('[value=1]').attr('selected', true);\
-        }\
-\
-        if(lastSelectedNodePath != data.node.data.path) {\
-            if (data.node.data.directory) {\
-\
-                var ref = $('#explorerTree').jstree(true),\
-                    sel = ref.get_selected();\
-                if(!sel.length) { return false; }\
-                sel = sel[0];\
-                var children = $(\"#explorerTree\").jstree(\"get_children_dom\",sel);\
-                /* refresh only, when there is no child -> possible not yet updated */\
-                if(children.length < 1){\
-                    refreshNode(sel);\
-                }\
-\
-            }\
-         lastSelectedNodePath = data.node.data.path;\
-        }\
-\
-\
-    });\
-\
-	function doRest(path, callback, obj) {\
-		obj.url      = path;\
-		obj.dataType = \"json\";\
-		obj.contentType= \"application/json;charset=IBM437\",\
-        obj.scriptCharset= \"IBM437\",\
-        obj.success  = function(data, textStatus, jqXHR) {\
-			if (callback) {\
-				callback(data);\
-			}\
-		};\
-		obj.error    = function(jqXHR, textStatus, errorThrown) {\
-			console.log(\"AJAX error\");\
-			/*debugger; */\
-		};\
-		jQuery.ajax(obj);\
-	} /* doRest */\
-\
-	function getData(path, callback) {\
-		doRest(path, callback, {\
-			method   : \"GET\"\
-		});\
-	} /* getData */\
-\
-	function deleteData(path, callback, _data) {\
-		doRest(path, callback, {\
-			method   : \"DELETE\",\
-			data: _data\
-		});\
-	} /* deleteData */\
-\
-	function patchData(path, callback, _data) {\
-		doRest(path, callback, {\
-			method   : \"PATCH\",\
-			data: _data\
-		});\
-	} /* patchData */\
-\
-	function postData(path, callback, _data) {\
-		doRest(path, callback, {\
-			method   : \"POST\",\
-			data: _data\
-		});\
-	} /* postData */\
-\
-\
-	function putData(path, callback, _data) {\
-		doRest(path, callback, {\
-			method   : \"PUT\",\
-			data: _data\
-		});\
-	} /* putData */\
-\
-\
-	/* File Upload */\
-	$('#explorerUploadForm').submit(function(e){\
-		e.preventDefault();\
-		console.log(\"Upload!\");\
-		var data = new FormData(this);\
-\
-		var ref = $('#explorerTree').jstree(true),\
-			sel = ref.get_selected(),\
-			path = \"/\";\
-        if(!sel.length) { alert(\"Please select the upload location!\");return false; }\
-        if(!document.getElementById('uploaded_file').files.length > 0) { alert(\"Please select files to upload!\");return false; }\
-		sel = sel[0];\
-		selectedNode = ref.get_node(sel);\
-		if(selectedNode.data.directory){\
-			path = selectedNode.data.path\
-		} else {\
-			/* remap sel to parent folder */\
-			sel = ref.get_node(ref.get_parent(sel));\
-			path = parentNode.data.path;\
-			console.log(\"Parent path: \" + path);\
-		}\
-\
-		$.ajax({\
-			url: '/explorer?path=' + path,\
-            type: 'POST',\
-            data: data,\
-            contentType: false,\
-            processData:false,\
-			xhr: function() {\
-				var xhr = new window.XMLHttpRequest();\
-\
-				xhr.upload.addEventListener(\"progress\", function(evt) {\
-				  if (evt.lengthComputable) {\
-					var percentComplete = evt.loaded / evt.total;\
-					percentComplete = parseInt(percentComplete * 100);\
-                    console.log(percentComplete);\
-                    var percent = percentComplete + '%';\
-                    $(\"#explorerUploadProgress\").css('width', percent).text(percent);\
-				  }\
-				}, false);\
-\
-				return xhr;\
-			},\
-			success: function(data, textStatus, jqXHR) {\
-                console.log(\"Upload success!\");\
-                $(\"#explorerUploadProgress\").text(\"Upload success!\");\
-                document.getElementById('uploaded_file').value = '';\
-                document.getElementById('uploaded_file_text').innerHTML = '';\
-\
-				getData(\"/explorer?path=\" + path, function(data) {\
-					/* We now have data! */\
-					deleteChildrenNodes(sel);\
-					addFileDirectory(sel, data);\
-					ref.open_node(sel);\
-\
-\
-				});\
-\
-			}\
-        });\
-	});\
-\
-	/* File Delete */\
-	function handleDeleteData(nodeId) {\
-		var ref = $('#explorerTree').jstree(true);\
-		var node = ref.get_node(nodeId);\
-		console.log(\"call delete request: \" + node.data.path);\
-		deleteData(\"/explorer?path=\" + node.data.path);\
-	}\
-\
-	function fileNameSort( a, b ) {\
-		if ( a.dir && !b.dir ) {\
-			return -1\
-		}\
-		if ( !a.dir && b.dir ) {\
-			return 1\
-		}\
-		if ( a.name < b.name ){\
-			return -1;\
-		}\
-		if ( a.name > b.name ){\
-			return 1;\
-		}\
-		return 0;\
-	}\
-\
-	function createChild(nodeId, data) {\
-		var ref = $('#explorerTree').jstree(true);\
-		var node = ref.get_node(nodeId);\
-		var parentNodePath = node.data.path;\
-		/* In case of root node remove leading '/' to avoid '//' */\
-		if(parentNodePath == \"/\"){\
-			parentNodePath = \"\";\
-		}\
-		var child = {\
-			text: data.name,\
-			type: getType(data),\
-			data: {\
-				path: parentNodePath + \"/\" + data.name,\
-				directory: data.dir\
-			}\
-		};\
-\
-		return child;\
-\
-	}\
-\
-	function deleteChildrenNodes(nodeId) {\
-		var ref = $('#explorerTree').jstree(true);\
-		var children = $(\"#explorerTree\").jstree(\"get_children_dom\",nodeId);\
-		for(var i=0;i<children.length;i++)\
-		{\
-			ref.delete_node(children[i].id);\
-		}\
-\
-	}\
-\
-	function refreshNode(nodeId) {\
-\
-		var ref = $('#explorerTree').jstree(true);\
-\
-		var node = ref.get_node(nodeId);\
-\
-		getData(\"/explorer?path=\" + node.data.path, function(data) {\
-			/* We now have data! */\
-\
-			deleteChildrenNodes(nodeId);\
-			addFileDirectory(nodeId, data);\
-			ref.open_node(nodeId);\
-\
-		});\
-\
-\
-	}\
-\
-	function getType(data) {\
-		var type = \"\";\
-\
-		if(data.dir) {\
-			type = \"folder\";\
-		} else if ((/\\.(mp3|MP3|ogg|wav|WAV|OGG|wma|WMA|acc|ACC|m4a|M4A|flac|FLAC)$/i).test(data.name)) {\
-			type = \"audio\";\
-		} else {\
-			type = \"file\";\
-		}\
-\
-		return type;\
-	}\
-\
-\
-	function addFileDirectory(parent, data) {\
-\
-		data.sort( fileNameSort );\
-		var ref = $('#explorerTree').jstree(true);\
-\
-		for (var i=0; i<data.length; i++) {\
-			console.log(\"Create Node\");\
-			ref.create_node(parent, createChild(parent, data[i]));\
-		}\
-	} /* addFileDirectory */\
-\
-	function buildFileSystemTree(path) {\
-\
-		$('#explorerTree').jstree({\
-				\"core\" : {\
-						\"check_callback\" : true,\
-						'force_text' : true,\
-						\"themes\" : { \"stripes\" : true },\
-						'data' : {	text: '/',\
-									state: {\
-										opened: true\
-									},\
-									type: 'folder',\
-									children: [],\
-									data: {\
-										path: '/',\
-										directory: true\
-								}}\
-					},\
-					'types': {\
-						'folder': {\
-							'icon': \"fa fa-folder\"\
-						},\
-						'file': {\
-							'icon': \"fa fa-file\"\
-						},\
-						'audio': {\
-							'icon': \"fa fa-file-audio\"\
-						},\
-						'default': {\
-							'icon': \"fa fa-folder\"\
-						}\
-					},\
-				plugins: [\"contextmenu\", \"themes\", \"types\"],\
-				contextmenu: {\
-					items: function(nodeId) {\
-						var ref = $('#explorerTree').jstree(true);\
-						var node = ref.get_node(nodeId);\
-						var items = {};\
-\
-\
-						if (node.data.directory) {\
-							items.createDir = {\
-								label: \"Neuer Ordner\",\
-								action: function(x) {\
-									var childNode = ref.create_node(nodeId, {text: \"Neuer Ordner\", type: \"folder\"});\
-									if(childNode) {\
-										ref.edit(childNode, null, function(childNode, status){\
-											putData(\"/explorer?path=\" + node.data.path + \"/\" + childNode.text);\
-											refreshNode(nodeId);\
-										});\
-									}\
-								}\
-							};\
-						}\
-\
-						/* Play */\
-						items.play = {\
-							label: \"Abspielen\",\
-							action: function(x) {\
-								var playMode = 1;\
-                                if (node.data.directory) {\
-                                    playMode = 5; \
-                                } else {\
-                                    if ((/\\.(m3u|M3U)$/i).test(node.data.path)) {\
-                                        playMode = 11;\
-                                    }\
-                                }                                \
-								postData(\"/exploreraudio?path=\" + node.data.path + \"&playmode=\" + playMode);\
-							}\
-						};\
-\
-						/* Refresh */\
-						items.refresh = {\
-							label: \"Aktualisieren\",\
-							action: function(x) {\
-								refreshNode(nodeId);\
-							}\
-						};\
-\
-						/* Delete */\
-						items.delete = {\
-							label: \"Löschen\",\
-							action: function(x) {\
-								handleDeleteData(nodeId);\
-								refreshNode(ref.get_parent(nodeId));\
-							}\
-						};\
-\
-						/* Rename */\
-						items.rename = {\
-							label: \"Umbenennen\",\
-							action: function(x) {\
-								var srcPath = node.data.path;\
-								ref.edit(nodeId, null, function(node, status){\
-									node.data.path = node.data.path.substring(0,node.data.path.lastIndexOf(\"/\")+1) + node.text;\
-									patchData(\"/explorer?srcpath=\" + srcPath + \"&dstpath=\" + node.data.path);\
-									refreshNode(ref.get_parent(nodeId));\
-								});\
-							}\
-						};\
-\
-					   return items;\
-					}\
-				}\
-			});\
-\
-		if (path.length == 0) {\
-			return;\
-		}\
-		getData(\"/explorer?path=/\", function(data) {\
-			/* We now have data! */\
-			$('#explorerTree').jstree(true).settings.core.data.children = [];\
-\
-			data.sort( fileNameSort );\
-\
-\
-			for (var i=0; i<data.length; i++) {\
-				var newChild = {\
-					text: data[i].name,\
-					type: getType(data[i]),\
-					data: {\
-						path: \"/\" + data[i].name,\
-						directory: data[i].dir\
-					},\
-					children: []\
-				};\
-				$('#explorerTree').jstree(true).settings.core.data.children.push(newChild);\
-			}\
-\
-			$(\"#explorerTree\").jstree(true).refresh();\
-\
-\
-		});\
-	} /* buildFileSystemTree */\
-\
-    /* File Explorer functions end */\
-\
-    var socket = undefined;\
-    var tm;\
-    var volumeSlider = new Slider(\"#setVolume\"); \
-    document.getElementById('setVolume').remove();\
-\
-    function connect() {\
-        socket = new WebSocket(\"ws://\" + host + \"/ws\");\
-\
-        socket.onopen = function () {\
-            setInterval(ping, 15000);\
-            getTrack();\
-            getCoverimage();\
-        };\
-\
-        socket.onclose = function (e) {\
-            console.log('Socket is geschlossen. Neuer Versuch in fuenf Sekunden.', e.reason);\
-            socket = null;\
-            setTimeout(function () {\
-                connect();\
-            }, 5000);\
-        };\
-\
-        socket.onerror = function (err) {\
-            console.error('Socket-Fehler: ', err.message, 'Socket wird geschlossen');\
-        };\
-\
-        socket.onmessage = function(event) {\
-          console.log(event.data);\
-          var socketMsg = JSON.parse(event.data);\
-          if (socketMsg.rfidId != null) {\
-              document.getElementById('rfidIdMusic').value = socketMsg.rfidId;\
-              toastr.info(\"RFID Tag mit \"+ socketMsg.rfidId + \" erkannt.\" );\
-              $(\"#rfidIdMusic\").effect(\"highlight\", {color:\"#abf5af\"}, 3000);\
-          } if (\"status\" in socketMsg) {\
-              if (socketMsg.status == \"ok\") {\
-                  toastr.success(\"Aktion erfolgreich ausgeführt.\" );\
-              }\
-          } if (\"pong\" in socketMsg) {\
-              if (socketMsg.pong == 'pong') {\
-                  pong();\
-              }\
-            } if (\"volume\" in socketMsg) {\
-                volumeSlider.setValue(parseInt(socketMsg.volume));        \
-            } if (\"trackinfo\" in socketMsg) {\
-                document.getElementById('track').innerHTML = socketMsg.trackinfo.name;\
-                \
-                var btnTrackPlayPause = document.getElementById('nav-btn-play');\
-                if (socketMsg.trackinfo.pausePlay) {\
-                    btnTrackPlayPause.innerHTML = '<i id=\"ico-play-pause\" class=\"fas fa-lg fa-play\")></i>';\
-                } else {\
-                    btnTrackPlayPause.innerHTML = '<i id=\"ico-play-pause\" class=\"fas fa-lg fa-pause\")></i>';\
-                }\
-\
-                var btnTrackFirst = document.getElementById('nav-btn-first');\
-                var btnTrackPrev = document.getElementById('nav-btn-prev');\
-                if (socketMsg.trackinfo.currentTrackNumber <= 1) {\
-                    btnTrackFirst.classList.add(\"disabled\");\
-                    btnTrackPrev.classList.add(\"disabled\");\
-                } else {\
-                    btnTrackFirst.classList.remove(\"disabled\");\
-                    btnTrackPrev.classList.remove(\"disabled\");\
-                }\
-                var btnTrackLast = document.getElementById('nav-btn-last');\
-                var btnTrackNext = document.getElementById('nav-btn-next');\
-                if (socketMsg.trackinfo.currentTrackNumber >= socketMsg.trackinfo.numberOfTracks) {\
-                    btnTrackLast.classList.add(\"disabled\");\
-                    btnTrackNext.classList.add(\"disabled\");\
-                } else {\
-                    btnTrackLast.classList.remove(\"disabled\");\
-                    btnTrackNext.classList.remove(\"disabled\");\
-                }\
-            } if (\"coverimg\" in socketMsg) {\
-                document.getElementById('coverimg').src = \"/cover?\" + new Date().getTime();\
-          }  \
-      };\
-    }\
-\
-\
-    function ping() {\
-        var myObj = {\
-            \"ping\": {\
-                ping: 'ping'\
-            }\
-        };\
-        var myJSON = JSON.stringify(myObj);\
-        socket.send(myJSON);\
-        tm = setTimeout(function () {\
-            toastr.warning('Die Verbindung zum ESPuino ist unterbrochen! Bitte Seite neu laden.');\
-        }, 5000);\
-    }\
-\
-    function pong() {\
-        clearTimeout(tm);\
-    }\
-\
-    function getTrack() {\
-        var myObj = {\
-            \"trackinfo\": {\
-                trackinfo: 'trackinfo'\
-            }\
-        };\
-        var myJSON = JSON.stringify(myObj);\
-        socket.send(myJSON);\
-    }\
-\
-    function getCoverimage() {\
-        var myObj = {\
-            \"coverimg\": {\
-                coverimg: 'coverimg'\
-            }\
-        };\
-        var myJSON = JSON.stringify(myObj);\
-        socket.send(myJSON);\
-    }\
-\
-\
-    function genSettings(clickedId) {\
-        lastIdclicked = clickedId;\
-        var myObj = {\
-            \"general\": {\
-                iVol: document.getElementById('initialVolume').value,\
-                mVolSpeaker: document.getElementById('maxVolumeSpeaker').value,\
-                mVolHeadphone: document.getElementById('maxVolumeHeadphone').value,\
-                iBright: document.getElementById('initBrightness').value,\
-                nBright: document.getElementById('nightBrightness').value,\
-                iTime: document.getElementById('inactivityTime').value,\
-                vWarning: document.getElementById('warningLowVoltage').value,\
-                vIndLow: document.getElementById('voltageIndicatorLow').value,\
-                vIndHi: document.getElementById('voltageIndicatorHigh').value,\
-                vInt: document.getElementById('voltageCheckInterval').value\
-            }\
-        };\
-        var myJSON = JSON.stringify(myObj);\
-        socket.send(myJSON);\
-    }\
-\
-    function ftpSettings(clickedId) {\
-        lastIdclicked = clickedId;\
-        var myObj = {\
-            \"ftp\": {\
-                ftpUser: document.getElementById('ftpUser').value,\
-                ftpPwd: document.getElementById('ftpPwd').value\
-            }\
-        };\
-        var myJSON = JSON.stringify(myObj);\
-        socket.send(myJSON);\
-    }\
-\
-    function mqttSettings(clickedId) {\
-        lastIdclicked = clickedId;\
-        var val;\
-        if (document.getElementById('mqttEnable').checked) {\
-            val = document.getElementById('mqttEnable').value;\
-        } else {\
-            val = 0;\
-        }\
-        var myObj = {\
-            \"mqtt\": {\
-                mqttEnable: val,\
-                mqttServer: document.getElementById('mqttServer').value,\
-                mqttUser: document.getElementById('mqttUser').value,\
-                mqttPwd: document.getElementById('mqttPwd').value,\
-                mqttPort: document.getElementById('mqttPort').value\
-            }\
-        };\
-        var myJSON = JSON.stringify(myObj);\
-        socket.send(myJSON);\
-    }\
-\
-    function removeTrSlash(str) {\
-        if (str.substr(-1) === '/') {\
-            return str.substr(0, str.length - 1);\
-        }\
-        return str;\
-    }\
-\
-    function rfidAssign(clickedId) {\
-        lastIdclicked = clickedId;\
-        if (ActiveSubTab == 'rfid-music-tab') {\
-            var myObj = {\
-                \"rfidAssign\": {\
-                    rfidIdMusic: document.getElementById('rfidIdMusic').value,\
-                    fileOrUrl: removeTrSlash(document.getElementById('fileOrUrl').value),\
-                    playMode: document.getElementById('playMode').value\
-                }\
-            };\
-        } else {\
-            var myObj = {\
-                \"rfidMod\": {\
-                    rfidIdMod: document.getElementById('rfidIdMusic').value,\
-                    modId: document.getElementById('modId').value\
-                }\
-            };\
-        }\
-        var myJSON = JSON.stringify(myObj);\
-        socket.send(myJSON);\
-    }\
-\
-    function wifiConfig(clickedId) {\
-        lastIdclicked = clickedId;\
-        var myObj = {\
-            \"wifiConfig\": {\
-                ssid: document.getElementById('ssid').value,\
-                pwd: document.getElementById('pwd').value,\
-                hostname: document.getElementById('hostname').value\
-            }\
-        };\
-        var myJSON = JSON.stringify(myObj);\
-        socket.send(myJSON);\
-    }\
-    function sendControl(cmd) {\
-        var myObj = {\
-            \"controls\": {\
-                action: cmd\
-            }\
-        };\
-        var myJSON = JSON.stringify(myObj);\
-        socket.send(myJSON);\
-    }\
-    function sendVolume(vol) {\
-        var myObj = {\
-            \"controls\": {\
-                set_volume: vol\
-            }\
-        };\
-        var myJSON = JSON.stringify(myObj);\
-        socket.send(myJSON);\
-    }\
-\
-    $(document).ready(function () {\
-        connect();\
-		buildFileSystemTree(\"/\");\
-\
-        console.log(parseInt(document.getElementById('warningLowVoltage').value));\
-        $(function () {\
-            $('[data-toggle=\"tooltip\"]').tooltip();\
-        });\
-    });\
-</script>\
-</body>\
-</html>";
\ No newline at end of file
+// Generated by processHtml.py from html/management_DE.html (gzip-compressed); don't edit
+static const char management_HTML_ETAG[] PROGMEM = "\"bdd5b5c85870212a\"";
+static const uint8_t management_HTML_GZ[] PROGMEM = {
+    0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xe5, 0x7d, 0x5b, 0x77, 0xdb, 0x38,
+    0x92, 0xf0, 0xf3, 0xa7, 0x5f, 0x81, 0x30, 0x9d, 0x16, 0x35, 0x91, 0x28, 0xcb, 0x8e, 0xd3, 0x69,
+    0x3b, 0x76, 0x1f, 0xdf, 0x92, 0x78, 0x3a, 0x89, 0xdd, 0xbe, 0x24, 0xd3, 0x9d, 0xce, 0xe4, 0x50,
+    0x22, 0x24, 0x31, 0xa6, 0x48, 0x35, 0x2f, 0x96, 0x9d, 0xc4, 0xff, 0x64, 0xcf, 0xd9, 0x97, 0xf9,
+    0x0d, 0xf3, 0x34, 0x6f, 0xf9, 0x63, 0x5b, 0x55, 0x00, 0x48, 0xf0, 0x26, 0xcb, 0x8e, 0x7b, 0x67,
+    0xbe, 0xb3, 0xb3, 0xdb, 0xb1, 0x08, 0x16, 0x0a, 0x85, 0x42, 0xa1, 0x50, 0x55, 0x28, 0x80, 0x4f,
+    0xef, 0xed, 0x1e, 0xec, 0x9c, 0xfc, 0x7a, 0xb8, 0xc7, 0xc6, 0xf1, 0xc4, 0xdb, 0x6c, 0x3c, 0xc5,
+    0x3f, 0xcc, 0xb3, 0xfd, 0xd1, 0x86, 0xe1, 0x70, 0x03, 0x0b, 0xb8, 0xed, 0xc0, 0x9f, 0xd8, 0x8d,
+    0x3d, 0xbe, 0xb9, 0x77, 0x7c, 0x98, 0xb8, 0x7e, 0xd0, 0xf9, 0x39, 0xf0, 0x87, 0xee, 0x28, 0x09,
+    0xed, 0xd8, 0x0d, 0xfc, 0xa7, 0x5d, 0xf1, 0xb2, 0xf1, 0x74, 0xc2, 0x63, 0x9b, 0x0d, 0xc6, 0x76,
+    0x18, 0xf1, 0x78, 0xc3, 0x48, 0xe2, 0x61, 0xe7, 0x89, 0xa1, 0x8a, 0x7d, 0x7b, 0xc2, 0x37, 0x8c,
+    0x73, 0x97, 0xcf, 0xa6, 0x41, 0x18, 0x1b, 0x6c, 0x10, 0xf8, 0x31, 0xf7, 0x01, 0x6c, 0xe6, 0x3a,
+    0xf1, 0x78, 0xc3, 0xe1, 0xe7, 0xee, 0x80, 0x77, 0xe8, 0xa1, 0xcd, 0x5c, 0xdf, 0x8d, 0x5d, 0xdb,
+    0xeb, 0x44, 0x03, 0xdb, 0xe3, 0x1b, 0x3d, 0x44, 0xe2, 0xb9, 0xfe, 0x19, 0x0b, 0xb9, 0xb7, 0x61,
+    0x44, 0x63, 0x40, 0x30, 0x48, 0x62, 0xe6, 0x02, 0x0e, 0x83, 0xc5, 0x97, 0x53, 0x40, 0xec, 0x4e,
+    0xec, 0x11, 0xef, 0x5e, 0x74, 0x44, 0xd9, 0x38, 0xe4, 0xc3, 0x0d, 0x63, 0x1c, 0xc7, 0xd3, 0x68,
+    0xad, 0xdb, 0xe5, 0xd1, 0x14, 0xa9, 0xb6, 0x1c, 0xae, 0x7e, 0x76, 0x87, 0xf6, 0x39, 0x42, 0x5a,
+    0xf0, 0x4f, 0x01, 0x79, 0x7c, 0xe9, 0xf1, 0x68, 0xcc, 0x79, 0xbc, 0x00, 0x96, 0x41, 0x14, 0x75,
+    0xfb, 0x41, 0x10, 0x47, 0x71, 0x68, 0x4f, 0xad, 0x89, 0xeb, 0x5b, 0x50, 0xb2, 0x28, 0xbe, 0x81,
+    0xe3, 0x7f, 0x8c, 0xac, 0x81, 0x17, 0x24, 0xce, 0xd0, 0xb3, 0x43, 0x6e, 0x0d, 0x82, 0x49, 0xd7,
+    0xfe, 0x68, 0x5f, 0x74, 0x3d, 0xb7, 0x1f, 0x75, 0x3f, 0x02, 0x52, 0xce, 0xbb, 0x2b, 0xd6, 0xb2,
+    0xd5, 0xeb, 0xc6, 0x63, 0x3e, 0xe1, 0x51, 0xd7, 0xe1, 0x43, 0x3b, 0xf1, 0xe2, 0x2e, 0x21, 0x4d,
+    0xdb, 0xeb, 0xde, 0x4d, 0x83, 0x43, 0x18, 0x90, 0x8e, 0x3d, 0xe3, 0x51, 0x30, 0xe1, 0xdd, 0x55,
+    0xab, 0x07, 0xff, 0x4f, 0x1d, 0xb4, 0x3d, 0xef, 0xae, 0x9b, 0x8a, 0x03, 0x1b, 0x7a, 0x67, 0x7d,
+    0x8c, 0xba, 0x9e, 0x1d, 0xf3, 0x28, 0x56, 0x05, 0x77, 0xdc, 0x4c, 0x3a, 0x34, 0x9d, 0xc8, 0x73,
+    0x1d, 0x1e, 0x76, 0x7b, 0x3d, 0x6b, 0xc9, 0x5a, 0xce, 0x0f, 0x9b, 0x7c, 0x97, 0xb6, 0xcd, 0xb0,
+    0xf1, 0x68, 0x10, 0xba, 0xd3, 0x98, 0x45, 0xe1, 0x60, 0xee, 0xf8, 0x43, 0x07, 0x3e, 0xfe, 0x91,
+    0xf0, 0xf0, 0x92, 0x6a, 0x7f, 0x84, 0xa1, 0x7f, 0xda, 0x15, 0x55, 0x6b, 0x70, 0x0c, 0x02, 0x87,
+    0x5b, 0xb2, 0x0a, 0xd2, 0x9a, 0xb8, 0xdd, 0x9e, 0xd5, 0x5b, 0xb6, 0x96, 0x24, 0x9e, 0x4e, 0xe2,
+    0x2e, 0x8a, 0xaa, 0x9a, 0x9c, 0x69, 0x30, 0x9d, 0xca, 0xce, 0xdc, 0x1a, 0x47, 0x5e, 0xa2, 0x17,
+    0xe9, 0xd5, 0x0d, 0x24, 0x59, 0x3c, 0xdc, 0x11, 0xe6, 0x79, 0x72, 0xf4, 0xed, 0xd8, 0xeb, 0xc4,
+    0xa7, 0x52, 0x74, 0x8a, 0xcd, 0xa1, 0xcc, 0x4a, 0xd5, 0x14, 0xf3, 0x8b, 0xb8, 0x2b, 0x14, 0x83,
+    0x35, 0x74, 0x3d, 0x8e, 0x0c, 0x60, 0x9f, 0x1b, 0xfd, 0x20, 0x84, 0xca, 0x6b, 0xac, 0x37, 0xbd,
+    0x60, 0x51, 0x00, 0x98, 0x58, 0xdf, 0xb3, 0x07, 0x67, 0xeb, 0x8d, 0x31, 0x77, 0x47, 0xe3, 0x78,
+    0x8d, 0x2d, 0x2f, 0x2d, 0x4d, 0x2f, 0xd6, 0x1b, 0x13, 0x3b, 0x1c, 0xb9, 0xfe, 0x1a, 0x5b, 0xe2,
+    0x13, 0xfa, 0xaf, 0x27, 0xfe, 0xae, 0x37, 0x82, 0x73, 0x1e, 0x0e, 0xbd, 0x60, 0xd6, 0xb9, 0x5c,
+    0x63, 0xd0, 0x70, 0xe0, 0x79, 0xeb, 0x8d, 0xab, 0x86, 0x25, 0x89, 0x12, 0x7f, 0x3a, 0xa0, 0x2b,
+    0xdd, 0x4f, 0x30, 0xb3, 0x6d, 0x0f, 0x9a, 0x24, 0xed, 0xba, 0xc6, 0x1e, 0x2f, 0x3d, 0x50, 0x68,
+    0x3b, 0x1e, 0x1f, 0x42, 0x53, 0x3d, 0xc4, 0x27, 0x4b, 0x42, 0xd1, 0x3a, 0x15, 0xa5, 0xe8, 0x3a,
+    0x63, 0xdb, 0x77, 0x3c, 0xfe, 0x39, 0x25, 0x6e, 0x85, 0x68, 0x93, 0x08, 0xc5, 0x43, 0x1c, 0x4c,
+    0xd7, 0x58, 0x67, 0x15, 0x7f, 0x5e, 0x35, 0x3c, 0x3e, 0xe2, 0xbe, 0x63, 0x45, 0x83, 0x31, 0x77,
+    0x12, 0x0f, 0x10, 0x88, 0xee, 0xa6, 0x44, 0xb8, 0xfe, 0x98, 0x87, 0x6e, 0xbc, 0xce, 0xba, 0x7f,
+    0x61, 0x07, 0x21, 0xb3, 0x93, 0x38, 0x60, 0x7f, 0xe9, 0x36, 0xa6, 0xb6, 0xe3, 0xb8, 0xfe, 0x68,
+    0x6d, 0x89, 0xf5, 0x10, 0x27, 0xbe, 0x3d, 0x09, 0xd8, 0xc8, 0x3d, 0xe7, 0xcc, 0x66, 0x7d, 0x37,
+    0x66, 0xc1, 0x90, 0x49, 0x18, 0x16, 0xf8, 0x0c, 0xf4, 0x22, 0xc3, 0x1e, 0x30, 0xa0, 0x8e, 0x11,
+    0xe1, 0x88, 0x44, 0x34, 0x05, 0x2d, 0xc6, 0x71, 0x30, 0x59, 0xf3, 0x03, 0x9f, 0x53, 0x4f, 0x50,
+    0xe1, 0x77, 0xa6, 0x41, 0xf4, 0x59, 0x50, 0xba, 0x64, 0xad, 0x60, 0x17, 0xa1, 0xc0, 0xc5, 0x55,
+    0x6c, 0x0d, 0x95, 0x0d, 0xac, 0x67, 0xe7, 0x02, 0x38, 0xe4, 0x38, 0xcc, 0x9f, 0x1b, 0x83, 0xc0,
+    0x0b, 0xc2, 0xb5, 0xd9, 0xd8, 0x8d, 0xf5, 0xf2, 0xb5, 0x31, 0x32, 0x5f, 0xbd, 0x65, 0x41, 0x08,
+    0x0b, 0xa6, 0x78, 0x3f, 0xb4, 0x3b, 0xd1, 0xa5, 0x3f, 0x10, 0x00, 0x2c, 0x85, 0xb8, 0xff, 0x98,
+    0xfe, 0x47, 0x20, 0x03, 0xcf, 0x1d, 0x9c, 0x3d, 0x0b, 0xc2, 0x23, 0x3e, 0x0c, 0x41, 0xaf, 0x01,
+    0x10, 0x4a, 0x48, 0xc7, 0xf6, 0xdc, 0x11, 0x50, 0x31, 0x80, 0x45, 0x91, 0x87, 0xeb, 0xaa, 0xe2,
+    0x28, 0xb4, 0x2f, 0xe1, 0x21, 0x09, 0x23, 0x7c, 0x9a, 0x06, 0xae, 0x78, 0x2b, 0xc7, 0x8a, 0x3a,
+    0xb2, 0x2a, 0x47, 0xaa, 0x80, 0xb7, 0x48, 0x82, 0x63, 0x87, 0x67, 0x02, 0xdb, 0x55, 0x26, 0x87,
+    0x1d, 0x5c, 0x86, 0x6d, 0xd7, 0x27, 0xc0, 0x1a, 0x56, 0x0c, 0x10, 0x0f, 0xad, 0xaf, 0x39, 0x68,
+    0x39, 0xf6, 0x4f, 0x50, 0x98, 0xa4, 0x54, 0xf4, 0x56, 0x6f, 0x20, 0x58, 0xae, 0xef, 0xf0, 0x0b,
+    0x18, 0xc7, 0xce, 0x34, 0x0c, 0x46, 0x40, 0x70, 0x94, 0xe1, 0xec, 0x2d, 0x69, 0x48, 0xe5, 0x53,
+    0x46, 0x9c, 0xdd, 0x87, 0xe9, 0x92, 0xe0, 0x78, 0x88, 0x71, 0x5c, 0x6f, 0x88, 0xb6, 0xe0, 0x47,
+    0x30, 0xb5, 0x07, 0x6e, 0x7c, 0x89, 0x83, 0xfb, 0xc3, 0x7a, 0xc3, 0x71, 0xa3, 0xa9, 0x67, 0xc3,
+    0x53, 0x2a, 0x02, 0xa1, 0x60, 0xcd, 0xd6, 0x00, 0x31, 0xe5, 0xf9, 0x4e, 0xd4, 0xad, 0x37, 0x68,
+    0x15, 0x8c, 0xdc, 0x4f, 0x1c, 0x71, 0x3c, 0x91, 0xa4, 0xe6, 0xaa, 0xa5, 0x63, 0x5f, 0x1c, 0x93,
+    0x2a, 0x3e, 0x23, 0x28, 0x90, 0x00, 0x5d, 0xfb, 0xd4, 0xa1, 0x0e, 0xaf, 0xb1, 0x1f, 0x73, 0x64,
+    0x3e, 0x59, 0x6f, 0xf4, 0x61, 0xd6, 0x8f, 0xc2, 0x20, 0xf1, 0x1d, 0x90, 0x93, 0x9e, 0xdd, 0xfb,
+    0xb1, 0xf7, 0x63, 0x49, 0x09, 0x14, 0xba, 0x92, 0xe3, 0xd3, 0x55, 0xe3, 0xfe, 0x71, 0xd2, 0x3f,
+    0xb1, 0xfb, 0x3b, 0xc2, 0xa4, 0xb2, 0x62, 0xbb, 0xdf, 0x91, 0xe6, 0x15, 0x34, 0x9c, 0x56, 0x1d,
+    0x7a, 0xfc, 0xe2, 0x1a, 0xe8, 0x4d, 0x46, 0x8f, 0x53, 0xdb, 0xe7, 0x7a, 0xcd, 0xbe, 0x17, 0x80,
+    0x62, 0xc2, 0xc9, 0x08, 0x44, 0x06, 0xcc, 0xc8, 0x53, 0x63, 0xe0, 0x9c, 0x3b, 0x77, 0x23, 0xb7,
+    0xef, 0x7a, 0xd4, 0xab, 0xb1, 0xeb, 0x38, 0xdc, 0x2f, 0x8e, 0x7b, 0x47, 0x50, 0xbb, 0x38, 0xe9,
+    0x40, 0x8c, 0x3d, 0x40, 0x29, 0x04, 0x52, 0x74, 0xf4, 0xf4, 0xdb, 0xa3, 0x01, 0x05, 0x8a, 0xf6,
+    0x0f, 0x8e, 0x99, 0xa4, 0x87, 0x0d, 0xdd, 0x0b, 0xa4, 0x25, 0xe2, 0x1e, 0x1f, 0x60, 0xd7, 0x3b,
+    0x33, 0xde, 0x3f, 0x73, 0x61, 0x88, 0x61, 0x51, 0xb4, 0x61, 0x8e, 0x0e, 0xb8, 0x62, 0x60, 0x67,
+    0x12, 0x7c, 0xaa, 0x28, 0x2e, 0x97, 0xe8, 0x83, 0x93, 0x84, 0x9e, 0xd9, 0x74, 0xec, 0xd8, 0x5e,
+    0x13, 0xd6, 0xe6, 0xd4, 0x1f, 0xad, 0xf7, 0xed, 0x88, 0x3f, 0x7e, 0xd4, 0x76, 0xdf, 0x6c, 0x1f,
+    0x1c, 0xcd, 0x96, 0x7e, 0x7e, 0x3e, 0x0a, 0xb6, 0xe0, 0x7f, 0xaf, 0x8f, 0x4f, 0xc7, 0x7b, 0xa7,
+    0x23, 0xf8, 0xb5, 0x7d, 0x86, 0xcf, 0xbf, 0xed, 0xe0, 0xbf, 0x5b, 0xbb, 0xe3, 0x51, 0xfc, 0x47,
+    0x17, 0x7f, 0xed, 0xfc, 0x6d, 0x7b, 0xff, 0xed, 0xdf, 0x5e, 0xc1, 0x8f, 0x47, 0x1f, 0xe1, 0x31,
+    0xd9, 0x9f, 0x3d, 0x7b, 0x34, 0x3d, 0xf9, 0x71, 0x19, 0xdf, 0x1d, 0x2d, 0x79, 0x7b, 0xbf, 0xbc,
+    0x39, 0x7a, 0xe4, 0x3f, 0x3f, 0x5c, 0xfd, 0xf4, 0x68, 0x6b, 0x37, 0x3a, 0xd8, 0x39, 0x7e, 0x7e,
+    0x10, 0x5c, 0xee, 0x3c, 0x7c, 0x7d, 0x64, 0xf7, 0x3f, 0xbe, 0xfa, 0xe5, 0x8f, 0x8f, 0xbf, 0xfc,
+    0x12, 0x8e, 0x4e, 0x4f, 0x76, 0x7e, 0xe5, 0xfb, 0xe1, 0x2f, 0xbf, 0x5c, 0xee, 0xed, 0xaf, 0xec,
+    0x1e, 0x5f, 0x3e, 0xfb, 0xeb, 0xfe, 0x8b, 0xb3, 0xad, 0xe9, 0xd6, 0xe9, 0xd9, 0xe8, 0xf8, 0x72,
+    0xb9, 0xb7, 0xbd, 0x14, 0xbc, 0x0c, 0x1e, 0x0f, 0xdd, 0xe7, 0xc7, 0xdb, 0x3f, 0x4f, 0xbb, 0x67,
+    0x3b, 0xa7, 0xcf, 0x4f, 0x1f, 0x8d, 0x8f, 0x8f, 0x7e, 0xf9, 0x75, 0xeb, 0xd7, 0xd1, 0xd2, 0xd1,
+    0xec, 0xe1, 0xe8, 0xb9, 0x77, 0xfa, 0x0b, 0x51, 0x75, 0x7c, 0xfa, 0xe6, 0xe0, 0xe8, 0xe7, 0xd5,
+    0x9d, 0x5f, 0xf7, 0xf7, 0x37, 0x9a, 0x2d, 0xe8, 0x77, 0x27, 0xe4, 0xc0, 0x86, 0x58, 0xef, 0x7c,
+    0x27, 0x9b, 0x7e, 0x42, 0x41, 0xa9, 0xf9, 0x72, 0xd5, 0x78, 0x2a, 0xcc, 0x51, 0x58, 0xf4, 0xba,
+    0xd2, 0x57, 0xe8, 0x07, 0xce, 0x25, 0xfc, 0xf1, 0xed, 0x73, 0x36, 0xf0, 0xec, 0x28, 0xda, 0x30,
+    0xe0, 0x67, 0xdf, 0x0e, 0x99, 0xf8, 0xd3, 0xe1, 0x17, 0x20, 0x60, 0x4e, 0x27, 0x9a, 0xb0, 0x3e,
+    0xce, 0x7e, 0x60, 0x66, 0x78, 0xa9, 0xde, 0xe1, 0xec, 0x41, 0x0b, 0xda, 0x71, 0xd3, 0xca, 0x30,
+    0xaf, 0x3a, 0x13, 0xa7, 0xd3, 0x5b, 0xc6, 0x72, 0x5b, 0x95, 0xc2, 0xca, 0x67, 0xc7, 0xa4, 0x65,
+    0x54, 0xd5, 0x3e, 0x0c, 0x9c, 0x83, 0x30, 0xee, 0x64, 0x94, 0x5f, 0xe8, 0x67, 0xb3, 0x99, 0x55,
+    0x61, 0xeb, 0xec, 0x89, 0xbf, 0x2b, 0xcb, 0x16, 0x8c, 0xa4, 0x21, 0x24, 0x73, 0xc3, 0x58, 0x59,
+    0x05, 0x33, 0x93, 0x66, 0x9f, 0xf8, 0x2d, 0xdb, 0x73, 0x60, 0xfe, 0x82, 0x4d, 0xca, 0x3b, 0x34,
+    0x19, 0x18, 0x69, 0x0d, 0xd4, 0xbf, 0x06, 0xfc, 0x04, 0x48, 0xb4, 0x59, 0xa5, 0x77, 0x04, 0x8c,
+    0xb0, 0x75, 0x4a, 0xc5, 0x92, 0xc1, 0x04, 0xc1, 0x62, 0x91, 0x02, 0x8a, 0x3b, 0x68, 0xe0, 0x2a,
+    0x83, 0xb6, 0x0b, 0xea, 0x25, 0xb6, 0xc1, 0x2d, 0xda, 0x7c, 0xea, 0xa6, 0x1d, 0xb4, 0x23, 0x06,
+    0xab, 0x49, 0xc8, 0x9d, 0x00, 0x4d, 0x0b, 0x77, 0x93, 0xbd, 0xe6, 0x09, 0x41, 0xdd, 0x02, 0x7f,
+    0x34, 0x4e, 0x62, 0x27, 0x98, 0xf9, 0x15, 0x0d, 0x4c, 0x83, 0x19, 0x2c, 0x96, 0xc1, 0x70, 0x28,
+    0x5b, 0xd9, 0x4a, 0x22, 0x58, 0xb5, 0xa1, 0x53, 0xdc, 0xbf, 0x45, 0x43, 0x5e, 0x30, 0xaa, 0x68,
+    0x03, 0xea, 0x9d, 0x49, 0xf4, 0x2f, 0x83, 0xd1, 0x2d, 0xd0, 0xba, 0xfe, 0x30, 0xa8, 0xc0, 0x2b,
+    0x8b, 0x11, 0xef, 0x3e, 0xfc, 0x8c, 0x04, 0xe6, 0x2e, 0x08, 0x0f, 0xfe, 0x01, 0x2c, 0x28, 0x8d,
+    0x61, 0x57, 0x08, 0x63, 0x51, 0xaa, 0xd4, 0x52, 0x86, 0x72, 0x8a, 0x0d, 0x82, 0xee, 0x01, 0xf3,
+    0xdf, 0x75, 0x48, 0x5c, 0xf1, 0xc9, 0x60, 0x60, 0x54, 0xa1, 0x01, 0x67, 0xf7, 0x3d, 0x37, 0x8a,
+    0x73, 0xe2, 0x87, 0x20, 0x60, 0x13, 0x4c, 0x34, 0x52, 0x55, 0x4d, 0xc4, 0x0c, 0x15, 0x05, 0x06,
+    0x54, 0x17, 0x20, 0x26, 0xa3, 0x91, 0x44, 0xa4, 0x7a, 0x74, 0x5f, 0x83, 0xd4, 0xda, 0x01, 0x69,
+    0x0a, 0x5d, 0x5b, 0xbd, 0x88, 0x72, 0x08, 0xe5, 0x3b, 0xa1, 0xdd, 0xb8, 0x83, 0x4c, 0xf0, 0x22,
+    0x5e, 0xc1, 0x95, 0x11, 0xb8, 0xda, 0x60, 0x24, 0x09, 0xc6, 0x3c, 0x8d, 0x60, 0xb2, 0x29, 0x00,
+    0x0b, 0x67, 0x5d, 0x07, 0x35, 0x1b, 0x83, 0x9f, 0x30, 0xa9, 0x48, 0x98, 0x8d, 0x4d, 0x76, 0x1c,
+    0x73, 0xf0, 0x3f, 0x12, 0x1f, 0xc6, 0x06, 0xe1, 0x37, 0x0b, 0x43, 0x54, 0xea, 0x2d, 0x13, 0x9a,
+    0x39, 0xeb, 0x74, 0x38, 0x74, 0x9d, 0x05, 0x7a, 0x8c, 0x60, 0xd7, 0x75, 0x57, 0xc0, 0x14, 0xfa,
+    0x1a, 0x87, 0x49, 0x55, 0x57, 0x9d, 0x20, 0xee, 0x0c, 0xdc, 0x70, 0xe0, 0x71, 0x29, 0x06, 0x47,
+    0xcf, 0xf6, 0x77, 0xaf, 0x23, 0x3e, 0xa3, 0x7a, 0xe6, 0x0e, 0xdd, 0x05, 0xa8, 0x46, 0xb0, 0xeb,
+    0xa8, 0x16, 0x30, 0x0b, 0x8e, 0x10, 0x01, 0xdf, 0x60, 0x78, 0xde, 0xbe, 0xdc, 0x7a, 0x9d, 0x1b,
+    0x19, 0xaa, 0x25, 0x68, 0xe6, 0x93, 0x29, 0x7a, 0x3f, 0x1b, 0xc6, 0xf1, 0x8b, 0x83, 0xb7, 0x1f,
+    0x5e, 0xfd, 0x72, 0x72, 0xf2, 0xe1, 0x64, 0x6b, 0x9b, 0xbc, 0x11, 0x84, 0x9f, 0x03, 0xfb, 0xec,
+    0xe4, 0xb0, 0x00, 0xba, 0x08, 0xcf, 0xc0, 0xae, 0xe7, 0xa1, 0xbd, 0x88, 0x78, 0x4b, 0xc8, 0xeb,
+    0x38, 0x97, 0x82, 0x2d, 0xc8, 0x3c, 0xe1, 0x91, 0x44, 0x9d, 0xb1, 0x52, 0x58, 0x9e, 0x37, 0xe2,
+    0x13, 0xee, 0xfa, 0x8b, 0x8f, 0x7b, 0x1c, 0x40, 0xeb, 0x0b, 0xf4, 0x80, 0xe0, 0xae, 0xa3, 0x5f,
+    0x02, 0x2d, 0x3a, 0xf4, 0x21, 0xf7, 0x07, 0x8a, 0xf4, 0x13, 0xac, 0xba, 0x38, 0xd9, 0xc3, 0x20,
+    0x4c, 0x26, 0x0b, 0x90, 0x4d, 0x70, 0xd7, 0x91, 0x2d, 0x81, 0x16, 0x24, 0x1b, 0x5c, 0xe3, 0x09,
+    0x2c, 0xfc, 0x37, 0x11, 0xda, 0x67, 0xd8, 0x40, 0x4e, 0x6a, 0x8b, 0x8a, 0x39, 0xaf, 0x91, 0x35,
+    0xdb, 0x2f, 0xa7, 0x86, 0xa5, 0x6d, 0x68, 0x94, 0xa1, 0xc9, 0x4e, 0x1d, 0xda, 0x0e, 0xcf, 0xcf,
+    0x68, 0xad, 0xe7, 0x08, 0xa1, 0x24, 0xcb, 0xb3, 0xfb, 0xdc, 0xf3, 0xb8, 0xd3, 0xbf, 0x2c, 0x4c,
+    0xfe, 0x9a, 0x85, 0x41, 0x20, 0x45, 0xa8, 0x1d, 0x0a, 0x77, 0x22, 0x1c, 0x30, 0x6d, 0x42, 0xba,
+    0x2f, 0xf0, 0x81, 0xd7, 0xda, 0x3b, 0x36, 0xe1, 0xf1, 0x38, 0x00, 0xf8, 0xc3, 0x83, 0xe3, 0x13,
+    0x03, 0x7c, 0xd3, 0x28, 0xe9, 0x4f, 0xdc, 0x58, 0xaf, 0x6f, 0x36, 0xb3, 0xdf, 0xcd, 0xd6, 0x3a,
+    0x38, 0x59, 0x71, 0x12, 0xfa, 0x4c, 0x72, 0x3c, 0x47, 0x03, 0x36, 0xd3, 0x41, 0xcb, 0x6b, 0xca,
+    0x72, 0xd6, 0x8f, 0xf0, 0xaa, 0x37, 0x51, 0x1d, 0x74, 0xf6, 0x5c, 0x3f, 0x8a, 0xa1, 0x43, 0xa0,
+    0xb4, 0x71, 0xa5, 0x96, 0xaf, 0x00, 0x06, 0xbb, 0xc9, 0x00, 0xc3, 0x86, 0x11, 0x45, 0xa0, 0x49,
+    0x05, 0xf4, 0x6b, 0x58, 0x13, 0x98, 0x79, 0x7c, 0xbc, 0xbf, 0xdb, 0x5a, 0x03, 0x60, 0x84, 0x41,
+    0x4b, 0xc9, 0x9f, 0x26, 0xb1, 0x16, 0xa6, 0x30, 0x72, 0x04, 0xa4, 0xeb, 0x0e, 0xf2, 0x81, 0x70,
+    0x31, 0x50, 0x1f, 0x03, 0x3e, 0x0e, 0x3c, 0x98, 0x80, 0xa0, 0x44, 0x00, 0x9b, 0x21, 0x03, 0xbb,
+    0xe2, 0x75, 0xc8, 0xff, 0x48, 0x5c, 0xb0, 0x58, 0xf2, 0xbd, 0x71, 0xfd, 0x73, 0x30, 0x97, 0x9c,
+    0xce, 0x90, 0x03, 0xf3, 0x6d, 0x94, 0x8d, 0xc6, 0xb6, 0x1b, 0xc7, 0x9c, 0x21, 0x02, 0xe6, 0xf0,
+    0x88, 0xf4, 0x5b, 0xc4, 0x60, 0x0a, 0xc7, 0x21, 0x18, 0xd6, 0xbe, 0x95, 0x8a, 0x8a, 0xd6, 0x99,
+    0xe9, 0x0c, 0xfa, 0x72, 0x08, 0x08, 0x67, 0x41, 0x18, 0xd7, 0xf4, 0x61, 0x2a, 0x5e, 0x3b, 0x73,
+    0xfa, 0x81, 0x68, 0xf2, 0xdd, 0x50, 0x38, 0x55, 0x57, 0x08, 0x42, 0xeb, 0x89, 0x46, 0xc3, 0x38,
+    0x88, 0x62, 0x04, 0x32, 0xd2, 0x48, 0xb8, 0xe0, 0xeb, 0x0b, 0x59, 0x7e, 0x4b, 0xde, 0xa6, 0x68,
+    0xf3, 0x84, 0x49, 0x3b, 0x55, 0xd1, 0xa5, 0x41, 0xd9, 0xc0, 0xbd, 0x10, 0x24, 0xf0, 0xef, 0xef,
+    0xfe, 0xde, 0xf9, 0xdd, 0x7a, 0xff, 0x79, 0xb9, 0xbd, 0xb2, 0x7c, 0x95, 0x23, 0x5a, 0xf2, 0xaf,
+    0x34, 0xc7, 0xd0, 0xe3, 0x15, 0x16, 0x3c, 0xca, 0x53, 0x3f, 0x89, 0x63, 0x0c, 0xa3, 0x10, 0x91,
+    0x60, 0x83, 0xf2, 0x8c, 0xca, 0x7e, 0xec, 0x33, 0xf8, 0x0f, 0x54, 0x03, 0x90, 0x0a, 0x56, 0xf9,
+    0xa5, 0xb1, 0x79, 0x84, 0x00, 0x4f, 0xbb, 0xa2, 0x52, 0xb1, 0xb6, 0x90, 0xf7, 0x52, 0x75, 0x69,
+    0xde, 0x1b, 0x9b, 0x5b, 0xfd, 0x08, 0xe4, 0x13, 0x25, 0x35, 0xad, 0xaf, 0xd4, 0x01, 0x32, 0x44,
+    0x7b, 0x14, 0x7f, 0xae, 0x9f, 0xea, 0x65, 0xeb, 0x69, 0xde, 0x6c, 0xd7, 0xad, 0xb2, 0xb9, 0x13,
+    0x1e, 0x80, 0x77, 0x24, 0xe6, 0x1b, 0x4d, 0x4a, 0xcd, 0x84, 0x4a, 0xe7, 0xe2, 0x02, 0xb5, 0x53,
+    0x67, 0xa5, 0x4b, 0x71, 0x16, 0x23, 0xa3, 0xaa, 0x1c, 0x75, 0x11, 0x04, 0xca, 0x37, 0xa4, 0x8f,
+    0xca, 0xcc, 0x12, 0xdc, 0x8d, 0x4a, 0xa3, 0x2b, 0x1e, 0x4a, 0xe3, 0x23, 0xb7, 0x14, 0xe8, 0xb7,
+    0x37, 0xca, 0x98, 0x8b, 0xcf, 0x43, 0x37, 0x04, 0xab, 0x17, 0x74, 0x19, 0x45, 0x96, 0x60, 0x88,
+    0xa1, 0x53, 0x92, 0x35, 0x66, 0xef, 0x87, 0x95, 0x96, 0xa1, 0x8c, 0x8b, 0xfc, 0x52, 0x01, 0x7f,
+    0xe2, 0x0e, 0xce, 0xf3, 0x99, 0x1d, 0x3a, 0x9a, 0x71, 0x51, 0x23, 0x38, 0xb7, 0x20, 0x6c, 0x1a,
+    0xf2, 0xf3, 0x5a, 0xba, 0x7a, 0x75, 0x74, 0xfd, 0xb9, 0x24, 0x79, 0xf6, 0x65, 0x2d, 0x49, 0x4b,
+    0x44, 0x92, 0x4b, 0x15, 0xdc, 0x41, 0x40, 0xc0, 0x20, 0xd1, 0x09, 0xe8, 0x7d, 0xd9, 0x46, 0x53,
+    0xd2, 0xe8, 0x8d, 0xc8, 0x25, 0x83, 0xf7, 0xcd, 0x16, 0x2d, 0xb5, 0x77, 0x49, 0xa3, 0x4f, 0x5a,
+    0xa8, 0x86, 0xc6, 0xe5, 0xda, 0xe1, 0x0c, 0xc2, 0x3f, 0x8d, 0x6b, 0x00, 0x59, 0x4f, 0xd1, 0xa3,
+    0xb9, 0x02, 0x36, 0x8f, 0xac, 0xbc, 0x26, 0x29, 0xea, 0xc0, 0x6b, 0xe6, 0xf1, 0x4b, 0x3b, 0x89,
+    0xa3, 0xf8, 0x7b, 0x3b, 0x99, 0x78, 0xeb, 0xe1, 0x19, 0xd7, 0x66, 0xf3, 0x6d, 0x7a, 0x5b, 0xd3,
+    0xb7, 0x1f, 0xea, 0xfa, 0x76, 0x1e, 0x78, 0xc9, 0x84, 0x77, 0xa4, 0xaf, 0x5e, 0xd1, 0x35, 0xb0,
+    0xbe, 0xc4, 0xca, 0x42, 0x16, 0xe0, 0x34, 0x0c, 0xce, 0xc1, 0x1a, 0x06, 0xf4, 0x64, 0x14, 0xab,
+    0xdd, 0x50, 0x3f, 0x99, 0xf4, 0xf1, 0x89, 0x60, 0x64, 0x04, 0x7f, 0xe2, 0xc2, 0x82, 0xd1, 0x2b,
+    0x94, 0xd9, 0x17, 0x1b, 0xc6, 0x32, 0x14, 0xaa, 0x97, 0x69, 0x41, 0xbd, 0x1d, 0xc0, 0xe3, 0x37,
+    0x44, 0xa3, 0xd1, 0xd0, 0x31, 0xc1, 0x0a, 0x9f, 0x40, 0xc3, 0x0f, 0x76, 0x4e, 0x8f, 0x8e, 0xf6,
+    0x5e, 0x9f, 0x7c, 0x78, 0x73, 0xf0, 0xf2, 0xf4, 0xd5, 0xde, 0x03, 0x83, 0xd5, 0xbe, 0x00, 0xce,
+    0x8c, 0x31, 0x6c, 0x2e, 0x58, 0x23, 0x70, 0x9a, 0xf1, 0xd8, 0x8d, 0x2c, 0xaa, 0xd2, 0x32, 0xee,
+    0x96, 0xe3, 0x8f, 0xaf, 0xe1, 0x78, 0x32, 0x9d, 0x27, 0x4a, 0x22, 0x88, 0x70, 0x03, 0x0b, 0xcd,
+    0xe5, 0xc0, 0x95, 0x11, 0xac, 0x41, 0x23, 0x1e, 0x0d, 0xc6, 0x33, 0xd7, 0x77, 0xdc, 0xd1, 0x19,
+    0x77, 0xe3, 0x3f, 0x45, 0x9c, 0x9e, 0x2c, 0xdf, 0x4a, 0xe7, 0xe9, 0x16, 0x4a, 0xad, 0xc4, 0xac,
+    0x2e, 0x55, 0x89, 0xcc, 0x52, 0xa1, 0x14, 0x2c, 0xd1, 0x29, 0xc0, 0x4a, 0x41, 0xc2, 0x3a, 0x19,
+    0xdc, 0x3c, 0x51, 0x3a, 0x9e, 0x82, 0x4d, 0x58, 0x2d, 0x49, 0x87, 0x2f, 0xb7, 0x7e, 0xdd, 0xde,
+    0xda, 0xf9, 0xf9, 0xc3, 0xf1, 0xe1, 0xde, 0xde, 0xae, 0x26, 0x49, 0xc5, 0x17, 0x77, 0xcb, 0xca,
+    0x95, 0xff, 0x2d, 0x3d, 0x58, 0xd3, 0x3e, 0x6a, 0xbd, 0xde, 0xc5, 0xb7, 0x4b, 0xe0, 0xd6, 0x59,
+    0x9c, 0xa0, 0x01, 0x14, 0xb2, 0x13, 0xf0, 0x26, 0xbd, 0x82, 0x51, 0xe2, 0x52, 0x48, 0x85, 0x6c,
+    0xf1, 0x92, 0xb6, 0xbc, 0x59, 0x3b, 0x30, 0x82, 0x67, 0x31, 0x39, 0x7a, 0x69, 0x03, 0x03, 0x1b,
+    0x0c, 0xfe, 0x48, 0x0c, 0xf1, 0x14, 0xfc, 0x4a, 0xf2, 0x33, 0x55, 0x74, 0x75, 0x79, 0x29, 0x0b,
+    0xaf, 0x3e, 0x59, 0xc2, 0xe6, 0x05, 0x78, 0x49, 0x6d, 0x5f, 0x63, 0x07, 0xb2, 0x68, 0x1c, 0xcc,
+    0x2a, 0xc3, 0x50, 0x0b, 0x1a, 0x84, 0x69, 0xc4, 0x6a, 0xae, 0x35, 0xa8, 0x36, 0xca, 0x76, 0xd2,
+    0x62, 0xf4, 0x02, 0x5d, 0xee, 0x39, 0x20, 0xbd, 0x19, 0x17, 0x76, 0xed, 0x98, 0xbb, 0x39, 0x37,
+    0x4c, 0xe7, 0x60, 0x69, 0xb3, 0xcd, 0xd0, 0x86, 0x01, 0xdf, 0xf6, 0xc3, 0x60, 0x16, 0x65, 0xc5,
+    0x85, 0x7a, 0xe0, 0x22, 0x4d, 0x02, 0x41, 0x0e, 0xbf, 0x98, 0x7a, 0x41, 0xc8, 0xc3, 0x13, 0x28,
+    0x2e, 0x0d, 0x9d, 0xf8, 0x97, 0x5c, 0x54, 0x1d, 0xf6, 0x14, 0xfe, 0xd8, 0x0e, 0x78, 0xe3, 0x93,
+    0xa2, 0x97, 0xca, 0xfd, 0x81, 0x10, 0xd9, 0x09, 0x08, 0xa6, 0x3b, 0xb5, 0xc3, 0x98, 0x6c, 0xf1,
+    0x0e, 0x4e, 0x47, 0x23, 0x75, 0x73, 0xbb, 0x0a, 0x91, 0x51, 0x74, 0xeb, 0x40, 0x7d, 0x08, 0xc9,
+    0x28, 0x4d, 0x99, 0xd2, 0x5c, 0x4f, 0x88, 0x08, 0xee, 0x7c, 0xc0, 0x4e, 0x7d, 0x20, 0x7f, 0xa8,
+    0x10, 0xa1, 0x2a, 0x63, 0x45, 0x13, 0xa1, 0x88, 0xb9, 0xec, 0x96, 0x64, 0x13, 0xe9, 0x3b, 0x5a,
+    0x3e, 0x5a, 0x16, 0x74, 0x04, 0x3c, 0x1c, 0xb3, 0x65, 0x0d, 0x41, 0xed, 0x9a, 0x4d, 0xc2, 0xf8,
+    0x8e, 0x3a, 0x8a, 0x8d, 0xbf, 0x6f, 0xb6, 0xc4, 0x56, 0xa9, 0xd9, 0x5a, 0x37, 0x36, 0xb7, 0x89,
+    0xf3, 0x95, 0x94, 0x14, 0x5d, 0x98, 0xdb, 0x34, 0x24, 0xbc, 0x22, 0x6a, 0x49, 0x0c, 0x43, 0xda,
+    0x92, 0x50, 0xbe, 0xc2, 0xb3, 0xcb, 0x31, 0x07, 0xf9, 0xc5, 0x4a, 0x65, 0xd9, 0x6a, 0x59, 0x6a,
+    0xbc, 0x40, 0x85, 0xa5, 0x33, 0x1f, 0x48, 0xc0, 0x8c, 0x2e, 0x53, 0x55, 0x02, 0x1d, 0x0a, 0x80,
+    0xd1, 0xd4, 0x03, 0xa2, 0xba, 0xef, 0x7e, 0xff, 0xfd, 0x4b, 0xf7, 0x7d, 0x17, 0x30, 0x04, 0x53,
+    0xb3, 0x05, 0x34, 0x32, 0xda, 0xc9, 0xd9, 0x28, 0xed, 0xef, 0x09, 0x21, 0x11, 0x84, 0x08, 0x51,
+    0x11, 0xfb, 0x3d, 0x4a, 0x0f, 0x96, 0x66, 0xaa, 0x20, 0x61, 0xcc, 0xc9, 0xd7, 0x97, 0x5d, 0x2d,
+    0xbd, 0xea, 0x50, 0xb9, 0xc2, 0x4e, 0x45, 0xfd, 0xe0, 0xc2, 0xa8, 0x90, 0xdd, 0xbd, 0x0b, 0xd4,
+    0x55, 0x14, 0x01, 0x12, 0xce, 0x78, 0x19, 0x17, 0x95, 0x1b, 0xc2, 0x4b, 0xaf, 0xa9, 0xbc, 0x15,
+    0x0e, 0xc6, 0xb8, 0x9b, 0x68, 0x5a, 0xb1, 0x1d, 0xb6, 0x71, 0xa7, 0x33, 0xb4, 0x46, 0x9f, 0x5a,
+    0xcc, 0xf5, 0x19, 0x98, 0xe2, 0x23, 0x3e, 0xfb, 0xfa, 0x8f, 0x31, 0xee, 0x7a, 0xb0, 0x83, 0xd0,
+    0xc1, 0x7d, 0x01, 0x60, 0xea, 0x14, 0x34, 0x24, 0xcd, 0x6a, 0xe9, 0xd3, 0x17, 0x3c, 0xd6, 0xa2,
+    0x65, 0xa9, 0x76, 0xb2, 0xf5, 0xe9, 0x9d, 0x27, 0xe6, 0x50, 0x41, 0x14, 0xab, 0xc0, 0x4a, 0x1d,
+    0x2a, 0xc5, 0xa5, 0xca, 0xa8, 0x68, 0xb3, 0x5a, 0x2d, 0x52, 0xd3, 0x29, 0x39, 0x99, 0x3e, 0x2a,
+    0x8f, 0x45, 0x41, 0xa1, 0xa1, 0xda, 0x7b, 0x95, 0x44, 0xee, 0xe0, 0xc4, 0x1e, 0x45, 0xd5, 0xca,
+    0x0c, 0x63, 0xe8, 0x9d, 0xdf, 0x92, 0x19, 0x77, 0xa3, 0x62, 0x70, 0x29, 0x1f, 0xff, 0xca, 0xe3,
+    0xaa, 0x0d, 0x81, 0x21, 0xd8, 0x56, 0x14, 0xb9, 0x23, 0xdf, 0x6c, 0xe6, 0xaa, 0xdc, 0x36, 0x0a,
+    0x96, 0x05, 0x64, 0x10, 0xdd, 0xbe, 0x40, 0x68, 0x08, 0xba, 0x77, 0xc6, 0xee, 0xb4, 0xf3, 0x3a,
+    0x99, 0x4c, 0x60, 0x04, 0xcd, 0xde, 0x72, 0x87, 0x62, 0x64, 0xee, 0xa8, 0x75, 0xab, 0xc0, 0x8c,
+    0x8e, 0x1e, 0x2d, 0x1a, 0x8f, 0xfb, 0x23, 0x5c, 0xc5, 0x80, 0x8e, 0x2c, 0x08, 0xf3, 0x6e, 0xa9,
+    0xf3, 0xe3, 0xfb, 0xcf, 0xbd, 0xe5, 0x2b, 0xa3, 0x91, 0x0b, 0xdf, 0x3c, 0x40, 0x7a, 0x3e, 0x9c,
+    0x6c, 0x3d, 0xff, 0xb0, 0x8f, 0xe6, 0x8b, 0x98, 0xea, 0x39, 0x8c, 0x5a, 0xbc, 0x86, 0xc6, 0x33,
+    0xf1, 0xb4, 0x20, 0x70, 0x61, 0x4f, 0x4a, 0xec, 0x93, 0x57, 0x6c, 0x49, 0x79, 0x6e, 0x31, 0x72,
+    0x5c, 0xda, 0xa8, 0x2a, 0xed, 0xd8, 0xd0, 0xda, 0x37, 0x41, 0x22, 0xae, 0x89, 0x26, 0x23, 0xe0,
+    0x44, 0x12, 0x9b, 0x46, 0x93, 0xcb, 0xd1, 0x61, 0x01, 0x22, 0x62, 0xda, 0xd8, 0xb7, 0x33, 0x19,
+    0xef, 0xf5, 0xdc, 0xc5, 0x09, 0xd4, 0x29, 0x0b, 0x9c, 0x45, 0xe8, 0x0a, 0x9c, 0xf9, 0x54, 0x0d,
+    0x68, 0x2f, 0x92, 0x68, 0x0a, 0x1c, 0x77, 0xe8, 0x9e, 0xc9, 0x74, 0xd5, 0x8c, 0xb4, 0x6e, 0xe2,
+    0x5d, 0x13, 0x83, 0xce, 0xa5, 0x27, 0xd4, 0x85, 0xa0, 0x4b, 0xa6, 0x48, 0x15, 0xdb, 0x84, 0x2d,
+    0xa2, 0x86, 0x5a, 0x93, 0x61, 0xd4, 0xab, 0x07, 0xe1, 0x69, 0x08, 0x2f, 0xc9, 0x8c, 0x68, 0xb3,
+    0x37, 0x3c, 0xfc, 0xc4, 0xdd, 0xc1, 0xd8, 0x77, 0x23, 0x16, 0x60, 0xd6, 0xd4, 0xe9, 0xd1, 0x4b,
+    0x66, 0xfe, 0x1d, 0xb3, 0x2f, 0xd8, 0x7d, 0x06, 0x33, 0x85, 0xfd, 0x86, 0xaf, 0x41, 0x55, 0xf9,
+    0xf0, 0x27, 0x66, 0x98, 0x63, 0x92, 0xf4, 0xe3, 0xdb, 0xc9, 0x78, 0xd6, 0xbc, 0x2e, 0xe1, 0xcb,
+    0xab, 0xab, 0x85, 0x68, 0xe4, 0x27, 0x6b, 0xdb, 0x62, 0xdd, 0xc9, 0x74, 0xa5, 0xfb, 0x22, 0xe0,
+    0x61, 0x34, 0x05, 0xb5, 0xc1, 0xbb, 0xbf, 0xda, 0x67, 0x60, 0x5c, 0xc9, 0x3f, 0x1f, 0x80, 0xbe,
+    0x0f, 0x11, 0x07, 0x5d, 0xf3, 0xe1, 0x59, 0xc8, 0xe1, 0x81, 0x5b, 0x00, 0x9e, 0x0f, 0x57, 0xfe,
+    0xfe, 0xf7, 0xfb, 0xef, 0x1f, 0x7e, 0xa7, 0x66, 0x83, 0xd6, 0x76, 0x75, 0xc0, 0x15, 0x97, 0x21,
+    0x18, 0x3c, 0x4e, 0xf1, 0x43, 0x6c, 0x12, 0x06, 0x3d, 0x89, 0xb2, 0x7e, 0xca, 0x54, 0x8f, 0xfa,
+    0x68, 0xaf, 0xaa, 0xaf, 0x62, 0xbb, 0x29, 0xbe, 0xc6, 0xd3, 0x60, 0x8a, 0xe2, 0x90, 0x2a, 0xe2,
+    0xac, 0xaf, 0x06, 0x26, 0x94, 0xc0, 0x04, 0xe3, 0x0e, 0x53, 0x1b, 0x23, 0xca, 0xf9, 0x30, 0x36,
+    0x5f, 0x21, 0x01, 0xb8, 0x60, 0xd0, 0x72, 0x81, 0xca, 0x51, 0xe0, 0x29, 0x21, 0x14, 0x4f, 0x1d,
+    0xb1, 0x6a, 0xca, 0xea, 0x3d, 0x63, 0x73, 0xcf, 0xf5, 0x3f, 0x71, 0xcf, 0xcf, 0xec, 0xf2, 0x1b,
+    0x54, 0x5f, 0x2e, 0x55, 0x67, 0xe6, 0x9e, 0xef, 0x78, 0x01, 0xee, 0xd8, 0x7b, 0xdc, 0x1d, 0xf2,
+    0xd6, 0x22, 0xf8, 0x3a, 0x98, 0x7d, 0x31, 0x94, 0x5d, 0x95, 0xa8, 0x57, 0x8c, 0xcd, 0x17, 0x5f,
+    0xff, 0x19, 0xf6, 0x93, 0xc1, 0xf8, 0xb6, 0x28, 0x1e, 0x65, 0x28, 0x6e, 0x4e, 0x56, 0x1e, 0xd5,
+    0x2a, 0x8c, 0x37, 0xd8, 0xea, 0xb2, 0x8f, 0x28, 0x51, 0x51, 0x6e, 0x52, 0x98, 0x51, 0x10, 0xc6,
+    0x2e, 0x0f, 0xe3, 0x9b, 0x22, 0x7e, 0x7c, 0x1d, 0xe2, 0x4f, 0xc9, 0xf0, 0xeb, 0x3f, 0xe4, 0x82,
+    0x71, 0x23, 0xcc, 0x3f, 0x2c, 0x4a, 0x72, 0x9b, 0x7d, 0x1b, 0x6f, 0x7e, 0x5c, 0xb8, 0x0b, 0x37,
+    0x6e, 0x09, 0x73, 0x73, 0xed, 0x49, 0xda, 0xd2, 0x13, 0x63, 0xf3, 0x2d, 0xb8, 0x26, 0xb6, 0xe3,
+    0x06, 0x37, 0xac, 0xd9, 0x03, 0x41, 0x7f, 0x09, 0xeb, 0x13, 0x18, 0x5b, 0xd2, 0x33, 0x62, 0xe7,
+    0x50, 0xe7, 0x78, 0x17, 0x55, 0x58, 0x97, 0x54, 0x1a, 0x60, 0x16, 0x95, 0xa2, 0x16, 0xce, 0x26,
+    0xe6, 0x05, 0x67, 0x36, 0x7a, 0xab, 0xd6, 0x64, 0x25, 0xe9, 0x50, 0x25, 0xad, 0xcd, 0xae, 0x98,
+    0x87, 0xf3, 0xbd, 0x42, 0x4d, 0xf5, 0x06, 0x4e, 0x95, 0xe2, 0xd5, 0xf4, 0x0a, 0x40, 0xec, 0x93,
+    0x2b, 0xbf, 0xa8, 0x22, 0x11, 0x15, 0xa4, 0x16, 0x91, 0xb5, 0xbf, 0x41, 0x85, 0xa4, 0xab, 0xd1,
+    0x5c, 0x4d, 0xa2, 0xb8, 0xb9, 0x04, 0x7e, 0xf2, 0x89, 0x0d, 0xec, 0xf4, 0xc1, 0x9f, 0x0e, 0x43,
+    0x3e, 0x07, 0x12, 0x18, 0x7f, 0x0c, 0xc3, 0x6d, 0x0f, 0x71, 0x71, 0xb0, 0x61, 0x26, 0xf6, 0x56,
+    0xd9, 0x2b, 0xd7, 0x4f, 0xe2, 0xb9, 0xf8, 0x97, 0x8b, 0xb5, 0x56, 0x96, 0x16, 0xa8, 0xb5, 0x52,
+    0x6a, 0x8b, 0x1d, 0xc7, 0xa8, 0xf6, 0xe7, 0xd4, 0x79, 0x54, 0xac, 0xb3, 0x2c, 0xeb, 0xcc, 0x6b,
+    0x68, 0xb5, 0x58, 0x09, 0xe4, 0x9a, 0xd3, 0xc6, 0x21, 0x4d, 0x82, 0x68, 0x4e, 0xd5, 0xc7, 0x35,
+    0x55, 0x43, 0x76, 0x08, 0x4b, 0x01, 0xda, 0x50, 0x73, 0x2a, 0xff, 0x50, 0xac, 0x3c, 0xfc, 0xfa,
+    0x2f, 0x7f, 0x28, 0x1a, 0x9d, 0x43, 0x6f, 0x0f, 0x86, 0x4b, 0x04, 0x00, 0x41, 0x18, 0x78, 0xda,
+    0x10, 0x33, 0x39, 0x4d, 0xc7, 0xd6, 0x9c, 0x9a, 0xbd, 0x5c, 0x4d, 0xa9, 0xe2, 0xaf, 0xad, 0xb6,
+    0x0c, 0x0d, 0xee, 0xba, 0x60, 0xf2, 0xb2, 0x97, 0x7b, 0xbb, 0xa0, 0x01, 0x5e, 0x03, 0xad, 0x31,
+    0xad, 0x94, 0xf3, 0x2a, 0xe1, 0x1c, 0xdd, 0xdb, 0xed, 0xa8, 0x00, 0x0e, 0xb3, 0xfd, 0xae, 0x9d,
+    0xcc, 0xe1, 0xe5, 0x0a, 0xb4, 0xb2, 0x75, 0x06, 0x46, 0x0e, 0x68, 0x31, 0xde, 0x75, 0xb8, 0x7d,
+    0x46, 0xc9, 0x99, 0x22, 0x37, 0xa5, 0xae, 0xd2, 0xa3, 0xaa, 0x4a, 0xf8, 0x9b, 0x6d, 0x03, 0x40,
+    0x1c, 0x04, 0xf1, 0xb8, 0xbe, 0xf2, 0xaa, 0x5e, 0x99, 0x3d, 0x3b, 0x39, 0xac, 0x07, 0x7d, 0xb2,
+    0x6c, 0x68, 0x41, 0x57, 0x3a, 0xc1, 0x14, 0xc1, 0x5c, 0x0d, 0xe7, 0xd4, 0x58, 0xc9, 0xd5, 0x00,
+    0x25, 0xe9, 0x53, 0xbc, 0x6c, 0x4e, 0x0d, 0x10, 0xde, 0xd7, 0xa0, 0x19, 0x40, 0x4f, 0xb1, 0x39,
+    0x01, 0xde, 0x9a, 0xea, 0xd0, 0x97, 0x97, 0x5f, 0xff, 0x89, 0x09, 0xf1, 0xec, 0xb7, 0x24, 0x00,
+    0x17, 0x93, 0xb6, 0x0a, 0xeb, 0x55, 0xdc, 0xfc, 0x4d, 0x8c, 0xff, 0xe8, 0x8d, 0xdc, 0xb2, 0x3f,
+    0xda, 0x0f, 0xe9, 0x5c, 0xcd, 0xc2, 0x7b, 0xbb, 0x93, 0x3f, 0xe2, 0x78, 0xc1, 0x38, 0x1e, 0x82,
+    0x5e, 0x1f, 0xc7, 0x43, 0xa8, 0x42, 0x1a, 0x87, 0xf2, 0x3f, 0x38, 0x77, 0xa2, 0x0e, 0x65, 0x28,
+    0x90, 0x46, 0xce, 0x02, 0x5f, 0xf7, 0xb5, 0x4a, 0x79, 0xe7, 0xb6, 0x91, 0x39, 0xb7, 0x08, 0x73,
+    0xcc, 0xe3, 0xd8, 0x05, 0x81, 0x33, 0x9b, 0x59, 0x8d, 0x45, 0x7c, 0x5b, 0x0a, 0x5d, 0x54, 0x46,
+    0x55, 0x31, 0x8d, 0xab, 0x36, 0xc3, 0xe3, 0x86, 0xf1, 0x94, 0xd4, 0xf6, 0x4c, 0x19, 0xb1, 0xe7,
+    0xe3, 0xd2, 0x94, 0xae, 0x66, 0x59, 0xc9, 0x82, 0x01, 0x96, 0x5c, 0x0d, 0x24, 0x95, 0xa5, 0xd3,
+    0xda, 0x6f, 0x94, 0xa2, 0x25, 0xd5, 0x1e, 0xfd, 0xe4, 0xb2, 0xb3, 0x5c, 0xeb, 0xd6, 0x0b, 0xa6,
+    0x86, 0xb8, 0x1f, 0x2e, 0x58, 0x21, 0x1e, 0x6e, 0xe5, 0xdf, 0x68, 0xb8, 0x70, 0x77, 0x42, 0x39,
+    0x38, 0x3f, 0xe4, 0xdc, 0x9d, 0x07, 0x94, 0x37, 0x77, 0xbc, 0x77, 0xf4, 0x66, 0xef, 0xe8, 0xc3,
+    0xcb, 0xbd, 0xd7, 0xcf, 0x4f, 0x5e, 0x3c, 0x28, 0xb8, 0xf3, 0xe4, 0xff, 0xf4, 0x7e, 0x5c, 0xb6,
+    0x7a, 0x8f, 0x9f, 0x58, 0xcb, 0xd6, 0x93, 0x1f, 0x75, 0xfe, 0x29, 0x62, 0x4b, 0xbd, 0x38, 0x8d,
+    0xd2, 0x3e, 0x6c, 0x73, 0x58, 0x50, 0x3f, 0x81, 0x23, 0x44, 0x29, 0x23, 0x62, 0xe2, 0xdb, 0xde,
+    0x2d, 0x53, 0x46, 0x52, 0xdc, 0xe5, 0x5e, 0x9c, 0x1e, 0xd7, 0xf6, 0x41, 0x27, 0x41, 0x27, 0xff,
+    0x34, 0xaa, 0x24, 0xfe, 0x10, 0x53, 0x6e, 0x88, 0x76, 0x95, 0x23, 0x73, 0x3d, 0xdd, 0x0b, 0xa4,
+    0xe0, 0x28, 0xd4, 0x65, 0xd2, 0x0f, 0xdf, 0xee, 0xd6, 0x50, 0x5e, 0x4c, 0xd2, 0x49, 0xc9, 0x2b,
+    0x13, 0x8d, 0x50, 0x92, 0xea, 0xfa, 0x4c, 0x21, 0xb5, 0xdf, 0x35, 0x9f, 0x48, 0x6a, 0x30, 0xb7,
+    0x37, 0xfa, 0x78, 0x75, 0x75, 0x65, 0xb5, 0x48, 0x5b, 0x91, 0x2e, 0x7a, 0xfe, 0xbf, 0x95, 0x8c,
+    0x33, 0x8c, 0xa7, 0x0b, 0xea, 0x6b, 0x80, 0x5c, 0x60, 0xdb, 0x25, 0x9e, 0xd6, 0x25, 0xdd, 0x65,
+    0xaf, 0x6a, 0x03, 0x8e, 0x00, 0x92, 0xa9, 0xe4, 0x14, 0xfe, 0xdb, 0x72, 0xee, 0xc0, 0xfa, 0x58,
+    0x24, 0xe5, 0x0e, 0x5a, 0x13, 0x93, 0x09, 0xe1, 0xf5, 0xe9, 0x76, 0xbb, 0x69, 0xae, 0xd0, 0xe5,
+    0xa6, 0x0a, 0xe6, 0xed, 0xde, 0x70, 0x92, 0xa7, 0x78, 0x6a, 0xc2, 0x2c, 0x38, 0x93, 0x90, 0xe2,
+    0x6f, 0xcf, 0xaf, 0x83, 0x96, 0x4a, 0x73, 0x1b, 0x09, 0xd6, 0xa7, 0x76, 0x4d, 0xfe, 0x5d, 0x23,
+    0xa5, 0xf5, 0xb0, 0x90, 0x82, 0xf7, 0x7f, 0x60, 0x02, 0x95, 0x93, 0xa5, 0xe7, 0x4d, 0x22, 0x3d,
+    0x09, 0x7b, 0xee, 0x44, 0x92, 0x80, 0x75, 0x93, 0x29, 0xff, 0xba, 0x76, 0x42, 0x01, 0x58, 0x36,
+    0xa1, 0x72, 0x75, 0x6e, 0x39, 0xa9, 0x4a, 0x9b, 0x0e, 0xaa, 0xc2, 0xac, 0x83, 0x47, 0x41, 0x0d,
+    0x99, 0x85, 0xf3, 0xf5, 0x1f, 0xf9, 0x0c, 0x1c, 0x4d, 0x64, 0xe5, 0x15, 0x01, 0x32, 0x17, 0x65,
+    0x13, 0x5d, 0x1e, 0xdc, 0x27, 0x65, 0x38, 0x47, 0xd3, 0xe3, 0x2b, 0x4a, 0x86, 0xeb, 0x65, 0xc6,
+    0xad, 0xcf, 0xbf, 0xc1, 0xc7, 0xe5, 0x0b, 0x96, 0x9e, 0x1b, 0x95, 0xb1, 0xe4, 0x7f, 0x6f, 0xfa,
+    0x4d, 0xbe, 0xdb, 0x72, 0x76, 0x17, 0x0a, 0xd3, 0x89, 0xc3, 0x58, 0x5d, 0xff, 0x60, 0x3c, 0x2a,
+    0x7b, 0x97, 0x9b, 0x69, 0xfa, 0xc2, 0x6a, 0x5f, 0x08, 0xec, 0xe0, 0x2d, 0xda, 0x67, 0x64, 0xd2,
+    0xd8, 0x17, 0x30, 0x17, 0xc0, 0x3b, 0xa5, 0x91, 0x9a, 0x86, 0x1c, 0xcc, 0xc4, 0xb0, 0xf5, 0xe7,
+    0xb0, 0x9c, 0xfd, 0x9b, 0x99, 0x5e, 0xea, 0xbd, 0x5a, 0xec, 0x4b, 0xe5, 0xdf, 0xc0, 0xfa, 0xc6,
+    0xb5, 0xbc, 0x7f, 0xc1, 0x6d, 0x67, 0x3a, 0x0e, 0x7c, 0xae, 0x71, 0xff, 0xe7, 0x60, 0x3a, 0x1c,
+    0x7f, 0xfd, 0x67, 0xf8, 0xa7, 0xf1, 0xfe, 0x3f, 0x84, 0xf3, 0x59, 0xdf, 0x8b, 0xbc, 0xd7, 0xde,
+    0xdc, 0x05, 0xf7, 0x2b, 0x9d, 0xd7, 0x9b, 0x29, 0x35, 0x56, 0xab, 0xd5, 0x5e, 0xf3, 0x60, 0xea,
+    0x5e, 0x60, 0x4c, 0xe7, 0x05, 0xed, 0x4a, 0x62, 0xc0, 0xa0, 0x55, 0xaf, 0xdf, 0xb6, 0xe9, 0x34,
+    0x9c, 0x4f, 0x3b, 0xca, 0x55, 0x0a, 0x6e, 0xed, 0x86, 0x43, 0x1e, 0xd2, 0xf1, 0x99, 0xc4, 0xaf,
+    0x63, 0xc1, 0x37, 0x0c, 0x75, 0x65, 0x96, 0xd8, 0xaa, 0x4a, 0x08, 0x4b, 0xf3, 0xc1, 0x56, 0x57,
+    0xaf, 0xd1, 0x6d, 0x5a, 0x97, 0x35, 0xe5, 0xa6, 0x97, 0xa6, 0x83, 0x5c, 0x3e, 0x18, 0x54, 0xdf,
+    0xb3, 0xf2, 0x71, 0x02, 0x1f, 0x31, 0xea, 0x0c, 0xde, 0x9f, 0xb0, 0x2c, 0x6e, 0x76, 0xa7, 0x8c,
+    0xfd, 0x77, 0xf3, 0xb5, 0xd8, 0x55, 0xc9, 0xd8, 0x52, 0xf1, 0xb7, 0x70, 0xf6, 0x0e, 0xa6, 0x8d,
+    0x96, 0x4d, 0xc5, 0xf9, 0x94, 0x1d, 0x7b, 0xf0, 0x6f, 0xdd, 0xdc, 0xa0, 0xcd, 0x56, 0x37, 0xbe,
+    0x3c, 0x71, 0x71, 0xf1, 0xdf, 0xf7, 0x45, 0xfc, 0x01, 0xec, 0x85, 0x58, 0x04, 0x6a, 0x4d, 0xd7,
+    0x57, 0x01, 0xec, 0x05, 0xf4, 0x62, 0xa9, 0xbf, 0xe3, 0x20, 0x09, 0x47, 0x58, 0xd2, 0xa1, 0x03,
+    0xb7, 0xf3, 0x55, 0x63, 0xc5, 0x08, 0x96, 0x46, 0x79, 0xa1, 0x71, 0x5d, 0x59, 0x2a, 0xa8, 0x46,
+    0x0c, 0xec, 0xce, 0x9b, 0x2e, 0x39, 0x2e, 0xa4, 0xd3, 0x25, 0x5f, 0x5a, 0x3f, 0xa8, 0x59, 0x27,
+    0x51, 0x53, 0xcd, 0x35, 0x07, 0xee, 0x74, 0x74, 0xb7, 0x69, 0x3b, 0xd8, 0xe5, 0xf9, 0x64, 0xb9,
+    0xcd, 0xe3, 0xd8, 0x8e, 0x93, 0x88, 0x7d, 0xfd, 0x17, 0xb0, 0x91, 0xa5, 0x8a, 0xd2, 0xf6, 0x3f,
+    0x71, 0x97, 0xbc, 0xad, 0xea, 0xc5, 0x71, 0x66, 0x87, 0x3e, 0x98, 0xa5, 0x2f, 0x83, 0x19, 0xac,
+    0x06, 0xb1, 0x3d, 0x02, 0x69, 0x38, 0xa5, 0xf3, 0xe9, 0x8e, 0x0b, 0xf6, 0x7d, 0xc8, 0x8e, 0xc1,
+    0x8a, 0xc6, 0x48, 0x2b, 0x9b, 0xb9, 0xa1, 0x43, 0xbb, 0x65, 0xec, 0x2d, 0x54, 0xc1, 0x12, 0x4c,
+    0xa7, 0x42, 0xe4, 0xb1, 0xd5, 0xb8, 0xcd, 0xd2, 0xd9, 0xa7, 0x6e, 0x5c, 0x76, 0xfe, 0x48, 0x40,
+    0x42, 0x78, 0x38, 0x5f, 0x46, 0x6a, 0xc4, 0xa2, 0x22, 0x87, 0x76, 0xc9, 0xea, 0x55, 0x88, 0xcb,
+    0x8a, 0x55, 0x25, 0x30, 0xab, 0x58, 0xca, 0x32, 0x80, 0xac, 0x70, 0x21, 0xe7, 0xb2, 0xcc, 0x3b,
+    0x29, 0x43, 0x15, 0x2f, 0xb2, 0x3d, 0xfc, 0xdf, 0x9d, 0xcf, 0xbd, 0xf6, 0xf2, 0x95, 0xf9, 0xbb,
+    0x45, 0xbf, 0x56, 0xae, 0x5a, 0x3f, 0xe9, 0x2b, 0x6f, 0x2d, 0x9f, 0xe2, 0x31, 0xa6, 0x40, 0x4a,
+    0x6e, 0x45, 0x25, 0x76, 0x15, 0x0b, 0xe6, 0xdb, 0x44, 0xe7, 0x82, 0xae, 0x7d, 0xdf, 0x71, 0x07,
+    0x76, 0x1c, 0x84, 0x40, 0x2a, 0xed, 0x8d, 0xd3, 0x0e, 0x08, 0xf3, 0x78, 0x02, 0x8a, 0x1c, 0x16,
+    0xe2, 0x3e, 0x77, 0x8b, 0x82, 0xf0, 0xe7, 0x8f, 0x75, 0xf5, 0x50, 0xd3, 0x28, 0x2d, 0x5b, 0x95,
+    0x79, 0xd3, 0xd5, 0x63, 0xbe, 0x5c, 0x3f, 0xe6, 0x37, 0x1c, 0xe8, 0x2a, 0x6e, 0xa9, 0x0b, 0xd9,
+    0xaa, 0x5e, 0xfd, 0x87, 0x0f, 0xf6, 0x0b, 0x58, 0xb2, 0xe4, 0x26, 0x38, 0xed, 0x77, 0xc9, 0xe1,
+    0xf6, 0xab, 0x86, 0xfb, 0x4f, 0x1b, 0xed, 0xb9, 0x83, 0x5d, 0x33, 0xc4, 0x37, 0x1b, 0xe3, 0xf4,
+    0xfd, 0x37, 0x8e, 0x36, 0xb1, 0xab, 0x66, 0xb8, 0xc5, 0xbb, 0xff, 0xcc, 0xf1, 0xde, 0xc1, 0x7d,
+    0x87, 0x7d, 0x1c, 0xa4, 0x73, 0xdb, 0x33, 0x36, 0x7f, 0x03, 0x5b, 0xd9, 0xee, 0xc3, 0x7a, 0x0c,
+    0x8b, 0x15, 0xee, 0xdf, 0xbe, 0x02, 0x9b, 0x05, 0xd5, 0xf8, 0xff, 0xc6, 0x52, 0xdf, 0x58, 0x78,
+    0xb4, 0x6b, 0xfd, 0x9e, 0xc7, 0x4b, 0x45, 0x5b, 0x2f, 0x1f, 0x57, 0x5e, 0xba, 0x7e, 0x44, 0xf3,
+    0x0c, 0x61, 0xf9, 0x21, 0x2d, 0xbc, 0xfc, 0xa6, 0x65, 0xff, 0x26, 0x56, 0xdd, 0xff, 0x07, 0x31,
+    0xb8, 0x9b, 0x6e, 0x3e, 0x16, 0x4f, 0xfd, 0xcf, 0x0b, 0xc4, 0x65, 0x37, 0x09, 0xcc, 0x0d, 0xc3,
+    0xf1, 0xd0, 0x8e, 0xf8, 0xeb, 0xf3, 0x48, 0x0b, 0x28, 0xbf, 0x7e, 0x73, 0xcc, 0x8a, 0x99, 0xb6,
+    0xcc, 0x13, 0x3b, 0xc4, 0xb5, 0x29, 0xb7, 0x5d, 0x4c, 0x6f, 0xf1, 0xcf, 0x23, 0xc2, 0x77, 0x5d,
+    0x02, 0xbf, 0x8a, 0xe6, 0x3d, 0xdf, 0x3b, 0xa9, 0x0d, 0xcb, 0xe1, 0x8b, 0xe9, 0xe6, 0xd7, 0xff,
+    0x42, 0xa3, 0x0b, 0x78, 0xc9, 0xf6, 0x27, 0x78, 0x3d, 0x27, 0x3c, 0xcc, 0x78, 0x88, 0xcf, 0xd0,
+    0x55, 0x77, 0xe4, 0xb9, 0x60, 0x52, 0xfb, 0x3c, 0xe1, 0xe8, 0x7c, 0xc6, 0xe1, 0xd7, 0x7f, 0x8c,
+    0x38, 0x73, 0x09, 0x50, 0x24, 0x34, 0x7d, 0xe4, 0x4e, 0x00, 0x10, 0x67, 0x64, 0x5e, 0xf5, 0x39,
+    0x68, 0xbc, 0x31, 0x8d, 0x8c, 0x06, 0x4e, 0x06, 0x3a, 0x1b, 0x71, 0xd1, 0xc1, 0xd8, 0x82, 0x86,
+    0xd8, 0x33, 0x1b, 0x55, 0x38, 0xa7, 0x4b, 0x58, 0x1c, 0xbc, 0xb8, 0x90, 0xb2, 0xaf, 0x53, 0x76,
+    0xa4, 0x26, 0x9b, 0x40, 0x63, 0x83, 0xc5, 0x06, 0xf0, 0xfe, 0x10, 0xfe, 0x95, 0x66, 0x22, 0x60,
+    0x02, 0x3b, 0xb2, 0xcf, 0x7d, 0x0b, 0x34, 0x40, 0xac, 0x54, 0xff, 0xb3, 0xc4, 0x3f, 0xa3, 0x8d,
+    0xf7, 0xb3, 0xaf, 0xff, 0xf4, 0x7d, 0xc0, 0x48, 0xcd, 0xe8, 0x64, 0x01, 0xeb, 0x3b, 0x25, 0xd6,
+    0xa7, 0xb4, 0xc9, 0xae, 0xb7, 0x59, 0x14, 0xc0, 0x34, 0x8e, 0x22, 0xd2, 0x36, 0xf2, 0xbc, 0x37,
+    0x74, 0x9b, 0x6d, 0xa1, 0xff, 0xed, 0x25, 0xf0, 0x82, 0x3a, 0x1c, 0x7a, 0xb0, 0xea, 0xfc, 0x8c,
+    0x8a, 0xcf, 0x07, 0x8e, 0x8f, 0x43, 0x28, 0xf5, 0x7d, 0xe8, 0xe0, 0x5b, 0xa4, 0x3e, 0x07, 0x8e,
+    0x78, 0x52, 0xfe, 0x8e, 0xc4, 0x8d, 0x3f, 0x1c, 0xd8, 0xd7, 0xe7, 0x98, 0xb9, 0x0f, 0xd5, 0x23,
+    0xe4, 0x33, 0x54, 0x39, 0x9e, 0x52, 0x7a, 0x67, 0x48, 0x29, 0x2e, 0xaa, 0x65, 0x9b, 0xf0, 0xb8,
+    0xfc, 0xeb, 0x7f, 0xe3, 0xbc, 0xe5, 0x17, 0xc0, 0x51, 0xe6, 0x27, 0x21, 0xde, 0x1d, 0x28, 0x72,
+    0x0a, 0xd2, 0xae, 0xb4, 0x91, 0x13, 0xec, 0x84, 0xbb, 0x1e, 0x35, 0xb9, 0x6d, 0x0f, 0xce, 0x92,
+    0xa9, 0xc8, 0xa9, 0x82, 0x26, 0x7c, 0x07, 0x68, 0x03, 0x5d, 0x8a, 0x29, 0x15, 0x74, 0x69, 0x0e,
+    0x1b, 0xb9, 0xfd, 0x98, 0x41, 0x4b, 0x4f, 0xed, 0xc2, 0xfd, 0x9a, 0x74, 0x45, 0x84, 0x7e, 0x73,
+    0x52, 0x0c, 0x73, 0x88, 0xd3, 0xa1, 0xb2, 0x64, 0x3a, 0x94, 0x6c, 0xee, 0x00, 0x91, 0x1d, 0x75,
+    0xa5, 0xd2, 0xea, 0xd2, 0x13, 0x50, 0x73, 0x76, 0x38, 0xc2, 0x0b, 0x60, 0x3f, 0xf4, 0x3d, 0xdb,
+    0x3f, 0x33, 0x36, 0xc7, 0x2e, 0x6e, 0xdd, 0xda, 0x9b, 0xd6, 0xd3, 0xee, 0x54, 0x9b, 0x95, 0x37,
+    0x99, 0xeb, 0xd5, 0x73, 0x24, 0x9b, 0xf7, 0x95, 0x13, 0x5e, 0xfe, 0xa9, 0x9f, 0x95, 0x42, 0x86,
+    0x6b, 0xa6, 0xa5, 0x1a, 0xa9, 0xda, 0xa9, 0x28, 0x4e, 0x68, 0x2c, 0x3a, 0x09, 0x8b, 0x21, 0xf5,
+    0xb4, 0x6d, 0x73, 0xd1, 0x08, 0x7a, 0x61, 0xaf, 0x13, 0xb4, 0x80, 0x38, 0x53, 0x60, 0x6c, 0xbe,
+    0x00, 0x06, 0xb3, 0x33, 0x30, 0x78, 0x84, 0x83, 0x93, 0x1b, 0xf0, 0x31, 0xcc, 0x4c, 0x10, 0x6d,
+    0x1b, 0xe5, 0x4b, 0x09, 0x76, 0x32, 0xa9, 0x9e, 0x02, 0x9f, 0x92, 0x6c, 0x5a, 0xc3, 0xa4, 0xaa,
+    0xde, 0x03, 0x12, 0x19, 0xa9, 0x15, 0x6b, 0x55, 0x47, 0x9d, 0x5e, 0xd1, 0x69, 0x53, 0xb1, 0x86,
+    0xac, 0xc0, 0x1e, 0x0c, 0xf8, 0x14, 0x18, 0x60, 0xc5, 0x17, 0xb1, 0x71, 0x4b, 0x71, 0xa8, 0x50,
+    0xfd, 0x74, 0x72, 0x27, 0x37, 0xa8, 0xe9, 0x59, 0x0b, 0xed, 0xc4, 0xde, 0xed, 0xe4, 0x04, 0xe7,
+    0xc3, 0xe9, 0x14, 0xc6, 0x93, 0xeb, 0x1b, 0x82, 0x6e, 0x38, 0x01, 0x47, 0x89, 0x77, 0xc4, 0x9b,
+    0x39, 0x62, 0x42, 0x15, 0x6f, 0x22, 0x26, 0x0b, 0x4a, 0xc0, 0x50, 0x52, 0x50, 0x29, 0x06, 0xac,
+    0x40, 0x1f, 0x73, 0x92, 0x10, 0x25, 0x61, 0xf8, 0xf5, 0x5f, 0xe3, 0x50, 0xe9, 0xb8, 0x6f, 0x18,
+    0xe2, 0x42, 0xe3, 0x69, 0x42, 0x77, 0xbe, 0x34, 0x1d, 0xec, 0xbe, 0xeb, 0xdf, 0xe1, 0x60, 0x57,
+    0x6f, 0xb2, 0xd5, 0x0e, 0x67, 0xdd, 0x9e, 0x75, 0xe1, 0x9a, 0x9c, 0xb9, 0xbb, 0xd6, 0xe9, 0xd5,
+    0x3b, 0xf3, 0xf7, 0xad, 0x09, 0xa5, 0x26, 0x24, 0x41, 0xfe, 0x68, 0xe4, 0x74, 0x73, 0x37, 0x61,
+    0x63, 0x3b, 0x8a, 0x19, 0x48, 0x67, 0xdf, 0xe3, 0x13, 0x0e, 0x66, 0x60, 0x9c, 0xea, 0x78, 0xca,
+    0x8c, 0xed, 0x63, 0xae, 0xa0, 0x2d, 0xe6, 0xf2, 0x84, 0xed, 0x85, 0x43, 0x7b, 0x8c, 0xd7, 0x4a,
+    0x44, 0x36, 0xde, 0xfe, 0x96, 0x44, 0xb8, 0x44, 0xa0, 0xb5, 0x05, 0x92, 0x8d, 0xab, 0xef, 0x4f,
+    0xb2, 0xbf, 0xbb, 0x38, 0xee, 0x18, 0x18, 0x86, 0x55, 0x9a, 0x56, 0x63, 0xdc, 0x1e, 0x80, 0xb5,
+    0xe4, 0x5a, 0xa5, 0x5e, 0xd6, 0xd7, 0xea, 0x6e, 0x13, 0x49, 0xbc, 0xbd, 0xc9, 0xce, 0x83, 0x10,
+    0x7c, 0xab, 0x7b, 0xb0, 0x5e, 0x44, 0xb0, 0x8e, 0x82, 0xf5, 0x86, 0x8b, 0x87, 0x5a, 0x36, 0x1c,
+    0xcc, 0x0b, 0xb1, 0x31, 0xeb, 0x1b, 0x29, 0xf6, 0x15, 0xff, 0xaf, 0x5d, 0x4c, 0x06, 0x5d, 0x27,
+    0x38, 0x4b, 0xf0, 0x56, 0x21, 0xca, 0xbb, 0xea, 0xda, 0x3e, 0xac, 0xa4, 0x31, 0x69, 0xa2, 0x6e,
+    0x6f, 0xa9, 0x4c, 0xd6, 0x36, 0x34, 0xea, 0x62, 0x7a, 0xba, 0xbd, 0x89, 0x37, 0x84, 0x53, 0x30,
+    0x9c, 0x4a, 0xc8, 0x3c, 0xd9, 0xd5, 0x71, 0xb1, 0x31, 0xb1, 0x08, 0xd8, 0x1e, 0x33, 0xe0, 0x26,
+    0x2d, 0xc6, 0x6c, 0x18, 0x82, 0x05, 0xe3, 0xb3, 0xc4, 0xc7, 0xf4, 0xfd, 0x21, 0x54, 0x47, 0x6a,
+    0xd9, 0x36, 0x8f, 0x80, 0xf4, 0x7b, 0x8d, 0xdc, 0xda, 0x94, 0xff, 0xa3, 0xdf, 0x1d, 0xdc, 0x55,
+    0x77, 0x68, 0x45, 0x35, 0x37, 0x0c, 0x6b, 0x77, 0xfe, 0x7e, 0xb4, 0xcf, 0x6d, 0x51, 0x0a, 0x12,
+    0xd1, 0xfd, 0x0b, 0x3b, 0xb4, 0xd1, 0x6e, 0x8a, 0x58, 0x84, 0x44, 0x0e, 0x98, 0x39, 0xb0, 0xf1,
+    0x76, 0x5c, 0xd6, 0xbf, 0x64, 0xf2, 0xfc, 0x27, 0xac, 0x04, 0x83, 0x24, 0xc4, 0xd3, 0x7c, 0x22,
+    0x69, 0x2b, 0xc2, 0xeb, 0x6e, 0xf1, 0xbc, 0xf3, 0xce, 0xde, 0x8b, 0x83, 0x97, 0xbb, 0x7b, 0x47,
+    0xc7, 0x0f, 0x40, 0x3a, 0x39, 0x13, 0x27, 0x03, 0xd9, 0xb9, 0x6b, 0x33, 0x9d, 0x1c, 0xbc, 0xfb,
+    0xf2, 0x3b, 0xb3, 0xf9, 0x2e, 0x77, 0xd7, 0x17, 0x9e, 0x42, 0xe4, 0xd0, 0x90, 0x09, 0xeb, 0x35,
+    0xa9, 0x24, 0x66, 0xb6, 0xf0, 0xca, 0x59, 0x3c, 0x68, 0x1f, 0x80, 0xd3, 0x14, 0xbe, 0x38, 0x79,
+    0xf5, 0x92, 0x6d, 0x30, 0x39, 0x30, 0x27, 0xb2, 0xda, 0x3b, 0x02, 0x00, 0xfe, 0x6f, 0xc5, 0x71,
+    0xe8, 0xc2, 0xc4, 0xe3, 0xe2, 0xea, 0xcb, 0x14, 0x6f, 0xb3, 0xf5, 0x9e, 0x7d, 0xf9, 0xc2, 0x9a,
+    0xcd, 0xf5, 0xc6, 0x55, 0x6b, 0x1d, 0xdb, 0x25, 0x0d, 0xd2, 0x66, 0xd8, 0x75, 0x20, 0xd2, 0xae,
+    0x6e, 0x17, 0xa4, 0x80, 0x99, 0xe7, 0x76, 0xc8, 0x5c, 0x68, 0x73, 0x69, 0x1d, 0xfe, 0x3c, 0x65,
+    0xd4, 0x94, 0xad, 0xda, 0x89, 0x2c, 0x91, 0x37, 0x00, 0xef, 0x1e, 0x3e, 0xc4, 0x2a, 0x08, 0x9d,
+    0xbe, 0x85, 0x5a, 0x05, 0xf0, 0x77, 0xee, 0xfb, 0xf5, 0x86, 0x3b, 0x64, 0x66, 0x5a, 0x24, 0x2e,
+    0x10, 0x10, 0x17, 0xcc, 0x1e, 0x0c, 0xcd, 0xe6, 0x83, 0x66, 0x8b, 0x6d, 0x42, 0x6b, 0x88, 0xac,
+    0x00, 0x04, 0xe8, 0x8a, 0xd5, 0x42, 0x4e, 0xd9, 0x09, 0x66, 0xf7, 0x81, 0xf9, 0x6e, 0xab, 0xf3,
+    0x9b, 0xdd, 0xf9, 0xb4, 0xd4, 0xf9, 0xf1, 0xc3, 0xfb, 0x87, 0xad, 0x07, 0xdd, 0x51, 0x9b, 0x65,
+    0xbd, 0x99, 0xd8, 0xf1, 0x60, 0xdc, 0x26, 0xbd, 0x87, 0x88, 0xe5, 0x12, 0x6e, 0x52, 0x76, 0x17,
+    0x48, 0x67, 0x81, 0x9f, 0x2d, 0xf6, 0x53, 0x89, 0xc5, 0x08, 0xfa, 0x9e, 0xad, 0x31, 0xc2, 0x24,
+    0xd8, 0x78, 0x85, 0xff, 0x07, 0x7f, 0x41, 0x5a, 0xd4, 0x86, 0xbb, 0x3e, 0xe2, 0xc3, 0x30, 0x98,
+    0xb0, 0xae, 0x3d, 0x75, 0xbb, 0x91, 0x7c, 0x0b, 0x5c, 0xa2, 0x03, 0xb3, 0xc2, 0x51, 0x43, 0x59,
+    0x02, 0xf7, 0x4a, 0x24, 0x96, 0x83, 0x95, 0x48, 0xc4, 0xe0, 0xed, 0xac, 0xc0, 0x42, 0x55, 0xe3,
+    0x99, 0x80, 0xdc, 0x00, 0x9a, 0xe5, 0x4e, 0xfe, 0x1a, 0xfc, 0x74, 0xdf, 0x04, 0xf0, 0xb7, 0x99,
+    0xdb, 0x49, 0x6e, 0xb6, 0xd9, 0x04, 0x7e, 0xc9, 0xcd, 0x4d, 0x78, 0x5b, 0xdc, 0xef, 0x94, 0x00,
+    0xe9, 0x0e, 0x9c, 0x0e, 0x92, 0x16, 0x02, 0x90, 0xbb, 0x2d, 0xef, 0x80, 0x6d, 0xe6, 0x37, 0x73,
+    0x9a, 0xed, 0x86, 0x9f, 0xbe, 0x2a, 0x6c, 0x47, 0x60, 0x35, 0x8c, 0x60, 0x53, 0x25, 0x3d, 0xa4,
+    0x0d, 0x2f, 0xce, 0xdf, 0x8a, 0x00, 0x25, 0xbc, 0x2b, 0x85, 0x2a, 0xf1, 0xf5, 0xbe, 0xef, 0x40,
+    0x01, 0xbc, 0xad, 0x88, 0x6e, 0x41, 0x9b, 0xf8, 0xfe, 0x85, 0x5b, 0xf1, 0x1a, 0xa3, 0x21, 0xa2,
+    0x7e, 0x9c, 0xbd, 0xcd, 0x39, 0xd6, 0xcd, 0xc6, 0x55, 0xbb, 0x81, 0x39, 0x5e, 0xc0, 0x33, 0x96,
+    0x25, 0xfe, 0x61, 0xc7, 0xd3, 0x07, 0xe4, 0x8a, 0xcc, 0xa9, 0x93, 0xe5, 0xf8, 0x53, 0x96, 0x1e,
+    0xce, 0x1c, 0x59, 0x08, 0xbf, 0x54, 0x19, 0x26, 0xdc, 0xc8, 0x42, 0xf8, 0xd9, 0x64, 0xd0, 0xc6,
+    0x30, 0x9e, 0x62, 0x13, 0x32, 0x6f, 0x07, 0xde, 0xca, 0x5f, 0x50, 0x45, 0xe4, 0xc7, 0x88, 0x22,
+    0x44, 0x82, 0xe0, 0xd9, 0xcd, 0x62, 0x58, 0x4b, 0xdd, 0x14, 0x05, 0x30, 0xea, 0x27, 0x40, 0x35,
+    0xae, 0xd6, 0x1b, 0xa9, 0xf8, 0xa2, 0x40, 0xa5, 0x29, 0x1d, 0x28, 0xbf, 0xdf, 0xe1, 0x64, 0xff,
+    0xeb, 0xf1, 0xc1, 0x6b, 0xb3, 0x99, 0x13, 0xb0, 0xa6, 0x2e, 0xf3, 0xaa, 0x50, 0x54, 0xa0, 0xe9,
+    0x9d, 0x17, 0xab, 0x3c, 0x30, 0xfd, 0x80, 0x22, 0x7a, 0xa5, 0xd5, 0x19, 0x96, 0x60, 0x91, 0x44,
+    0x18, 0x70, 0x47, 0xcd, 0x77, 0x82, 0x00, 0x19, 0x05, 0xb5, 0x72, 0xbf, 0xc9, 0x1e, 0xe2, 0x1b,
+    0x31, 0xc9, 0xe9, 0x05, 0xcd, 0x7e, 0xa9, 0x8f, 0x64, 0x34, 0x06, 0xa6, 0xf8, 0xc6, 0x06, 0x6b,
+    0x8a, 0x88, 0x4b, 0x93, 0x34, 0x0d, 0x41, 0x8a, 0x02, 0xb3, 0x89, 0xd7, 0x96, 0xe0, 0xf4, 0x86,
+    0xee, 0xbc, 0xa6, 0xf8, 0x4b, 0x4a, 0xf8, 0x3b, 0x49, 0xe7, 0x7b, 0x31, 0x1f, 0x5b, 0x38, 0x0b,
+    0x19, 0x07, 0x43, 0x3c, 0xc5, 0x81, 0x87, 0xa6, 0xeb, 0xa0, 0xd7, 0xe5, 0x84, 0x95, 0x3a, 0xf0,
+    0x7e, 0x96, 0x1a, 0x0b, 0xfa, 0x0f, 0x68, 0x9b, 0x9a, 0x4d, 0xca, 0x9f, 0xe5, 0x38, 0xd8, 0x0a,
+    0x89, 0x85, 0x50, 0x56, 0x06, 0x8a, 0xa4, 0xf7, 0x5a, 0x4a, 0x03, 0x7c, 0x67, 0xea, 0x83, 0x03,
+    0x45, 0x8b, 0x2f, 0x32, 0xc8, 0xba, 0xdd, 0xbd, 0xed, 0xd3, 0xe7, 0xc0, 0x3a, 0x72, 0x26, 0xd6,
+    0xa9, 0x08, 0xaf, 0xd9, 0xd9, 0x77, 0xe8, 0xf0, 0x3a, 0x47, 0xae, 0xa2, 0xd2, 0xc6, 0xf2, 0x2d,
+    0x3a, 0xb2, 0x28, 0x8e, 0x38, 0x62, 0x71, 0xfe, 0x58, 0xa8, 0x04, 0x42, 0x09, 0xa2, 0x91, 0xf0,
+    0x82, 0x01, 0x2d, 0xae, 0x2d, 0xc9, 0xfe, 0x54, 0xb4, 0x84, 0xbe, 0xd2, 0x0e, 0x41, 0xb2, 0x6e,
+    0x76, 0xea, 0x05, 0x10, 0xc9, 0x75, 0x49, 0x5e, 0xf5, 0x6c, 0xa9, 0x73, 0xad, 0x0c, 0x97, 0x88,
+    0xc0, 0x87, 0xb1, 0x81, 0x9a, 0xbe, 0xd5, 0x8f, 0xf0, 0xf6, 0xe7, 0x9c, 0xb8, 0x91, 0x62, 0x2d,
+    0x10, 0xf9, 0x9d, 0xc9, 0x2d, 0x61, 0x19, 0x28, 0x3a, 0x5c, 0x07, 0x29, 0x00, 0x43, 0x0c, 0x3c,
+    0x61, 0x6e, 0x79, 0xc1, 0x88, 0x99, 0xb9, 0x9e, 0x49, 0xc9, 0xc9, 0xe3, 0x29, 0xf7, 0x16, 0xdb,
+    0x02, 0xc3, 0x89, 0x8c, 0x08, 0x9c, 0x0b, 0x7b, 0x68, 0x9d, 0xf9, 0xf1, 0xf6, 0xe5, 0xbe, 0x63,
+    0x6a, 0x07, 0x15, 0x5b, 0x96, 0x0a, 0xad, 0xe1, 0x52, 0x14, 0x26, 0x5c, 0x13, 0x97, 0x9b, 0x56,
+    0x97, 0x43, 0x24, 0x24, 0x08, 0x69, 0xa4, 0xb1, 0x43, 0x42, 0x24, 0xd3, 0x0d, 0x95, 0x6f, 0xdc,
+    0xfb, 0x01, 0xfe, 0xeb, 0x3d, 0x32, 0x10, 0x58, 0x7e, 0xe4, 0x40, 0x24, 0xe2, 0x0a, 0x45, 0x6e,
+    0x0c, 0xbc, 0x20, 0xe2, 0xdb, 0xe2, 0xe2, 0x91, 0x35, 0x81, 0xb7, 0xdd, 0x30, 0x1c, 0xde, 0x4f,
+    0x46, 0xda, 0xb3, 0xcf, 0x67, 0x3c, 0x8a, 0x0f, 0xfc, 0x93, 0x60, 0xaa, 0x95, 0xaa, 0xe3, 0xe6,
+    0xdb, 0x76, 0xa8, 0x97, 0xca, 0x0b, 0x9f, 0x77, 0xd0, 0xce, 0x85, 0x72, 0x83, 0x9a, 0xc5, 0x1b,
+    0x8f, 0xc5, 0x1d, 0xbd, 0x06, 0xd5, 0xe4, 0xe7, 0xd0, 0xc7, 0x5d, 0xf0, 0x84, 0x51, 0x81, 0xf2,
+    0x48, 0xab, 0x2f, 0x2f, 0x4b, 0x80, 0x12, 0x3f, 0xf1, 0x3c, 0x28, 0xc0, 0x51, 0xde, 0x95, 0x9f,
+    0x8c, 0x41, 0x7c, 0x2b, 0x4b, 0x4b, 0x88, 0x63, 0x0c, 0xf3, 0x53, 0x2f, 0xee, 0x2d, 0x89, 0xf2,
+    0x18, 0x54, 0xfd, 0x41, 0x12, 0x63, 0xd1, 0xaa, 0x2c, 0x02, 0x71, 0x47, 0x47, 0xc0, 0x39, 0xc9,
+    0x5e, 0x29, 0x68, 0x44, 0xbe, 0x67, 0x47, 0x30, 0x61, 0xb0, 0x34, 0x9a, 0xe1, 0x0f, 0x89, 0x3c,
+    0x2b, 0xc6, 0xeb, 0x9b, 0xa1, 0x8f, 0x12, 0xfc, 0x15, 0x79, 0x5c, 0x58, 0x8e, 0x5e, 0xc1, 0xbe,
+    0xaf, 0xe0, 0xf3, 0xe5, 0xd8, 0x4e, 0x4d, 0x4f, 0x71, 0xf0, 0xb3, 0x57, 0x07, 0x53, 0xee, 0x97,
+    0x5e, 0xe7, 0x54, 0x2e, 0x70, 0x34, 0x3e, 0xc2, 0x0e, 0x84, 0x40, 0x8f, 0x49, 0x95, 0xda, 0x14,
+    0x27, 0xc6, 0x01, 0x3f, 0xe8, 0x7f, 0x84, 0xf9, 0x62, 0x9d, 0xf1, 0xcb, 0xc8, 0xc4, 0x32, 0x0b,
+    0x53, 0x4d, 0xf1, 0x22, 0x72, 0xeb, 0xc3, 0x04, 0xbc, 0x02, 0xcf, 0x22, 0x40, 0xbc, 0xdb, 0x61,
+    0x2f, 0x6f, 0x54, 0x41, 0x0d, 0xb4, 0x86, 0xc1, 0xd4, 0x51, 0xba, 0x13, 0x4c, 0x48, 0x10, 0x8a,
+    0x3c, 0x12, 0x10, 0xc8, 0x0f, 0x3e, 0xe0, 0xa9, 0xc7, 0xfd, 0x0e, 0x10, 0xa1, 0x3a, 0x53, 0xfa,
+    0xe2, 0x19, 0x65, 0x67, 0x02, 0x22, 0x40, 0xf7, 0x0e, 0xe7, 0xd8, 0x7b, 0x79, 0x6d, 0x44, 0xb3,
+    0xdb, 0xc4, 0xab, 0x26, 0x3c, 0x58, 0x10, 0x35, 0x32, 0xb8, 0xa7, 0x19, 0x41, 0x80, 0x12, 0x6c,
+    0xaa, 0x89, 0xd9, 0x92, 0xa6, 0x1c, 0xdb, 0xc4, 0xcb, 0xf9, 0xaf, 0xe4, 0x45, 0x13, 0x42, 0xd4,
+    0xcd, 0xee, 0xef, 0x96, 0x39, 0x99, 0xae, 0x7c, 0x79, 0x75, 0xb8, 0xf2, 0x25, 0x18, 0x8d, 0xbe,
+    0xcc, 0xec, 0xf3, 0x2f, 0x6f, 0xb7, 0xde, 0x7c, 0x39, 0x78, 0xfe, 0xfc, 0xcb, 0x6c, 0x62, 0x7f,
+    0x79, 0xfb, 0x6a, 0xeb, 0x0b, 0xb8, 0x8f, 0x5f, 0xb6, 0x76, 0x76, 0xbe, 0x0c, 0xc1, 0x22, 0xfb,
+    0xf2, 0x0c, 0xec, 0xe0, 0x2f, 0x93, 0x47, 0xf6, 0x97, 0x57, 0x8f, 0xb6, 0x5a, 0xdf, 0x75, 0xdd,
+    0x96, 0x85, 0xdf, 0xfc, 0x30, 0x33, 0x62, 0x5b, 0x34, 0x85, 0x73, 0x1d, 0x04, 0x8d, 0xfb, 0x01,
+    0x95, 0xe5, 0x35, 0xfd, 0x6e, 0xb3, 0xa6, 0x9d, 0x38, 0x6e, 0xd0, 0xd4, 0x95, 0x3f, 0x52, 0x39,
+    0xbf, 0xda, 0xbb, 0x26, 0xe2, 0x6e, 0xbe, 0x47, 0x75, 0x22, 0x9c, 0xe6, 0x32, 0x05, 0xf2, 0x1c,
+    0xe0, 0x82, 0xdc, 0x47, 0xfb, 0x2f, 0x0f, 0x04, 0xde, 0x00, 0xe8, 0xd8, 0x45, 0xaa, 0xb7, 0xb5,
+    0x71, 0x4b, 0x17, 0x13, 0x50, 0xcc, 0xcf, 0x80, 0x30, 0xb6, 0x27, 0xaf, 0xa1, 0x48, 0xb5, 0x2b,
+    0xd8, 0x8a, 0x7c, 0xe4, 0xfa, 0xd2, 0x38, 0xc4, 0x9a, 0xc7, 0x52, 0x65, 0xbf, 0x06, 0xb4, 0x87,
+    0x36, 0x8c, 0x1a, 0x74, 0xca, 0x10, 0xab, 0x9a, 0x7e, 0xed, 0x8c, 0x52, 0xda, 0x04, 0x4d, 0x74,
+    0x59, 0xe2, 0xa3, 0x2e, 0x79, 0xd5, 0x9d, 0x89, 0xb6, 0x72, 0x0d, 0x68, 0xc5, 0xdc, 0x48, 0x55,
+    0x21, 0x3a, 0x26, 0xb8, 0xb2, 0x52, 0xa7, 0x08, 0x0d, 0xfd, 0x9a, 0x42, 0xcb, 0x55, 0x1a, 0xfb,
+    0x5e, 0x8d, 0xca, 0xae, 0x5c, 0x58, 0xde, 0x55, 0x5c, 0x72, 0x80, 0xed, 0xc1, 0x5f, 0xb1, 0xdc,
+    0xd0, 0x40, 0x67, 0x23, 0x4c, 0xcd, 0xe3, 0x58, 0x8a, 0x91, 0x14, 0x47, 0x38, 0x25, 0x76, 0x2b,
+    0x77, 0x0c, 0x17, 0xef, 0x74, 0x81, 0xfa, 0xa6, 0x58, 0xee, 0x2d, 0xed, 0x48, 0x34, 0x5e, 0xb5,
+    0x02, 0xea, 0x43, 0xbe, 0xb9, 0xaf, 0x4e, 0x9a, 0x33, 0x01, 0xd2, 0x44, 0xc5, 0x3f, 0x09, 0xce,
+    0xf9, 0x16, 0xad, 0x59, 0x6a, 0x79, 0xcc, 0xa6, 0x52, 0xf3, 0x9d, 0x38, 0xa7, 0xb3, 0x82, 0x74,
+    0xda, 0x79, 0xa0, 0x36, 0x29, 0x93, 0x79, 0x24, 0x93, 0xf4, 0x96, 0x28, 0x16, 0x54, 0x55, 0xd1,
+    0xab, 0xfa, 0x72, 0x17, 0x14, 0xf7, 0xae, 0xa3, 0xd8, 0xac, 0x94, 0xae, 0x7b, 0x52, 0x47, 0x15,
+    0x86, 0x5e, 0x9f, 0x78, 0xd9, 0x2b, 0x07, 0x56, 0xcc, 0x01, 0x58, 0xe8, 0x97, 0x4a, 0xc9, 0x85,
+    0x7c, 0x28, 0xcd, 0xc3, 0x82, 0x6c, 0x0a, 0x59, 0x34, 0xa9, 0xf9, 0x36, 0x7e, 0x0a, 0x02, 0xc0,
+    0x00, 0x98, 0x34, 0xa0, 0x22, 0x4f, 0xe8, 0x20, 0xf3, 0x1e, 0x3c, 0x4b, 0x0d, 0x05, 0x68, 0x73,
+    0x41, 0xd8, 0x75, 0x30, 0x97, 0x45, 0x5d, 0xf8, 0xf7, 0xdd, 0xd2, 0x7b, 0xa1, 0x17, 0x07, 0x63,
+    0xd7, 0x73, 0x60, 0x42, 0x52, 0xcb, 0x46, 0xae, 0x65, 0x23, 0x6d, 0xd9, 0xc0, 0x96, 0x14, 0xe4,
+    0x07, 0x27, 0x98, 0x18, 0x6d, 0xc0, 0x21, 0x6c, 0x24, 0xf9, 0x21, 0x11, 0x16, 0xf8, 0x1e, 0x68,
+    0xed, 0x19, 0xde, 0xe0, 0x10, 0x8f, 0x31, 0x96, 0xe2, 0x46, 0xcc, 0x0f, 0x04, 0x7e, 0xd6, 0xd9,
+    0xc4, 0xa5, 0x82, 0xbe, 0x71, 0x01, 0x85, 0x31, 0xbb, 0xe4, 0x31, 0x13, 0x41, 0x44, 0x07, 0x2d,
+    0x29, 0x20, 0x5c, 0x61, 0x57, 0xea, 0xf5, 0x29, 0x58, 0x8f, 0xa8, 0x7c, 0x09, 0x39, 0x32, 0xd8,
+    0x14, 0x2d, 0xa2, 0x36, 0xa9, 0x99, 0xd9, 0x15, 0xac, 0x57, 0x86, 0x48, 0x3a, 0x89, 0x9d, 0xe0,
+    0x08, 0x15, 0x2c, 0xbe, 0x6b, 0xb3, 0x81, 0xed, 0x79, 0x18, 0xf8, 0x6f, 0xb3, 0xa0, 0xff, 0x11,
+    0x47, 0x01, 0xfe, 0x58, 0x49, 0xe8, 0x31, 0xfa, 0xdf, 0x06, 0x13, 0x18, 0xb0, 0x10, 0x11, 0x9e,
+    0x90, 0x60, 0x32, 0xe3, 0x63, 0x04, 0xab, 0xba, 0x28, 0x96, 0xd7, 0x6a, 0xe0, 0x1b, 0x14, 0xd8,
+    0xa9, 0x58, 0x2a, 0x31, 0xf0, 0x83, 0x40, 0xeb, 0xea, 0xb3, 0x71, 0xfb, 0xdb, 0xaf, 0x1e, 0xad,
+    0xfc, 0x00, 0x6b, 0x2e, 0xd6, 0x11, 0x86, 0xed, 0x8e, 0x7c, 0xc5, 0x8c, 0xfc, 0xcb, 0x64, 0x30,
+    0xc0, 0xcf, 0xc6, 0xa0, 0x21, 0x25, 0x49, 0x26, 0xb1, 0x11, 0x21, 0x08, 0x91, 0x4e, 0xd4, 0x66,
+    0x1f, 0xff, 0xf8, 0xdb, 0x8b, 0x23, 0x25, 0x55, 0xaa, 0x13, 0xf8, 0xac, 0x7e, 0x53, 0x1d, 0xc1,
+    0x2c, 0x41, 0x28, 0x0f, 0xc3, 0x20, 0x14, 0x9d, 0x4a, 0xf1, 0x12, 0x96, 0x3c, 0x62, 0x02, 0x3b,
+    0x19, 0x87, 0x60, 0xbb, 0x12, 0xba, 0xcc, 0xfe, 0x34, 0x8d, 0xad, 0xbf, 0x6e, 0xfd, 0x4d, 0x00,
+    0x18, 0x34, 0xf0, 0x64, 0x88, 0x8d, 0x78, 0xb8, 0x8e, 0x03, 0x08, 0xcd, 0x7c, 0xfc, 0x85, 0x3e,
+    0x01, 0x86, 0xdf, 0x9a, 0x32, 0x91, 0x9d, 0xb8, 0xea, 0x80, 0x78, 0x08, 0x86, 0x23, 0x4c, 0x3a,
+    0x06, 0x20, 0x4c, 0xbb, 0x40, 0x5f, 0x61, 0x10, 0x84, 0xad, 0x5a, 0x39, 0x3a, 0x9f, 0x1b, 0x22,
+    0x94, 0x0c, 0xf4, 0x83, 0x09, 0x83, 0x5b, 0x7f, 0x62, 0x25, 0x40, 0xfc, 0x12, 0x59, 0xae, 0x01,
+    0x58, 0x42, 0x78, 0xcc, 0x2b, 0xda, 0x68, 0xb3, 0x0f, 0x4a, 0x83, 0x2f, 0xd4, 0xd4, 0xee, 0xde,
+    0xcb, 0xbd, 0x93, 0x3d, 0x18, 0x1b, 0xfa, 0x42, 0x8a, 0xa8, 0x9c, 0x35, 0x9d, 0x35, 0x93, 0x6b,
+    0x7d, 0x8a, 0xa1, 0x8f, 0x3b, 0x68, 0xfc, 0x70, 0xeb, 0x64, 0xe7, 0x45, 0x5d, 0xdb, 0x69, 0x23,
+    0xf9, 0xa6, 0xc1, 0x1c, 0xbb, 0x8b, 0x96, 0x31, 0x60, 0x5f, 0xd7, 0xb0, 0x6c, 0x22, 0xdf, 0x6e,
+    0x72, 0x27, 0xcd, 0x9e, 0xd6, 0xb7, 0x9a, 0xa4, 0x8d, 0xc2, 0x13, 0x6e, 0xf4, 0x88, 0x2d, 0x91,
+    0x35, 0x26, 0x36, 0xee, 0x68, 0x5d, 0x40, 0x8d, 0xa3, 0xae, 0x18, 0xa3, 0x40, 0x22, 0xc9, 0x77,
+    0xfa, 0x29, 0xa6, 0x60, 0x28, 0x77, 0x82, 0x28, 0x5e, 0x49, 0x01, 0x49, 0x80, 0x99, 0xf1, 0x7e,
+    0x14, 0x80, 0x0f, 0x99, 0x17, 0x51, 0x6d, 0x27, 0x2b, 0xf5, 0xde, 0x3d, 0x8e, 0x8e, 0x49, 0x9d,
+    0x3f, 0xd4, 0x4c, 0xb7, 0x83, 0xc4, 0x6a, 0xc2, 0x23, 0xb1, 0xe0, 0xdf, 0xa3, 0xdf, 0x99, 0x4a,
+    0x6e, 0xe0, 0x8d, 0x10, 0xb1, 0x69, 0x88, 0xdb, 0xc2, 0xcb, 0x7b, 0x5b, 0xd9, 0xdd, 0x09, 0xf7,
+    0x70, 0x9e, 0xe5, 0x14, 0x38, 0xcc, 0x67, 0x22, 0x25, 0x08, 0x27, 0xc4, 0x8d, 0x0d, 0x06, 0xde,
+    0x0f, 0xde, 0x49, 0x4f, 0x8f, 0xb8, 0x02, 0xa8, 0x57, 0x16, 0x7e, 0xf5, 0xc7, 0xcf, 0x51, 0xd5,
+    0x16, 0x5d, 0x00, 0xc5, 0x9f, 0xfd, 0xb2, 0x28, 0xd2, 0x87, 0x4b, 0xa5, 0x71, 0xbf, 0xbc, 0xc7,
+    0x84, 0xc6, 0xe8, 0x05, 0x90, 0xfa, 0x12, 0xaf, 0x26, 0xc4, 0x3d, 0x37, 0xcb, 0xb2, 0x90, 0xa6,
+    0xef, 0xc4, 0x24, 0xff, 0xdc, 0x00, 0x55, 0xb9, 0xc6, 0x9a, 0x72, 0xd3, 0xb0, 0xd9, 0x6e, 0xe0,
+    0xd2, 0x0d, 0x05, 0x28, 0x3e, 0x4d, 0x35, 0x90, 0x8a, 0xa2, 0x76, 0x03, 0x06, 0x02, 0x75, 0xdb,
+    0xae, 0x28, 0x16, 0x2e, 0x95, 0xa6, 0x40, 0x65, 0x59, 0xc1, 0xc6, 0x13, 0xc4, 0x2b, 0x6f, 0xbb,
+    0x7c, 0xfd, 0x5f, 0x76, 0x1f, 0x5d, 0xaa, 0xd7, 0x38, 0xac, 0x1b, 0xdc, 0x52, 0xde, 0x8d, 0xb8,
+    0xa1, 0xd2, 0xcc, 0x7b, 0xd3, 0xa6, 0x21, 0x30, 0x10, 0x8b, 0x91, 0xa5, 0x4e, 0x05, 0x3b, 0xe9,
+    0x76, 0xb9, 0xf5, 0xbb, 0x58, 0x99, 0xa1, 0xef, 0xd2, 0xf6, 0xec, 0x1a, 0x55, 0xab, 0xb4, 0x14,
+    0x89, 0x43, 0x8f, 0xdb, 0x60, 0xa5, 0xcb, 0x6b, 0x3b, 0xf0, 0x3b, 0x70, 0x82, 0xb3, 0x4c, 0x45,
+    0x29, 0x90, 0xdc, 0xe2, 0x8a, 0x8e, 0xd8, 0x6a, 0x65, 0x32, 0x77, 0xe1, 0x9e, 0x92, 0x4b, 0xcd,
+    0x81, 0xa9, 0x6d, 0x5c, 0x48, 0x7b, 0x1c, 0x48, 0x0a, 0xaa, 0x1a, 0xce, 0x9b, 0x12, 0x91, 0xb6,
+    0x1c, 0x6b, 0x3c, 0xf0, 0xb3, 0x85, 0x1b, 0x08, 0xd5, 0x81, 0x8a, 0x36, 0xd0, 0x67, 0xc5, 0xa3,
+    0x32, 0x10, 0xbe, 0xc8, 0x5c, 0x18, 0x32, 0x39, 0x26, 0xf6, 0x14, 0x01, 0x91, 0x42, 0x71, 0x55,
+    0x20, 0x13, 0xe6, 0x9f, 0xfc, 0x54, 0x56, 0x91, 0x02, 0xf5, 0x20, 0xaf, 0x15, 0x44, 0x82, 0x80,
+    0x22, 0xd9, 0xa0, 0x28, 0x7c, 0x5d, 0xb0, 0x1b, 0x72, 0xd2, 0x72, 0x28, 0xda, 0xc0, 0x37, 0xa0,
+    0xa7, 0xd8, 0x43, 0x26, 0x2d, 0xfa, 0xab, 0xd2, 0x5c, 0x50, 0xf2, 0xf1, 0x13, 0x42, 0x6c, 0x34,
+    0x25, 0x28, 0xfc, 0x31, 0xcb, 0xf2, 0x2b, 0x6f, 0xf1, 0x83, 0x71, 0x71, 0x23, 0xb3, 0xb9, 0xa6,
+    0x62, 0x6a, 0x18, 0x56, 0x6f, 0x7e, 0xcf, 0xc5, 0xcb, 0x8d, 0x5e, 0x13, 0x54, 0x63, 0xb3, 0xd9,
+    0xaa, 0x9e, 0x5d, 0x64, 0x1b, 0x54, 0xcc, 0xa2, 0xfc, 0x6c, 0x93, 0x45, 0x17, 0xe3, 0x70, 0x2d,
+    0x5b, 0xfe, 0x95, 0x62, 0x83, 0x52, 0x29, 0xf9, 0x78, 0xe1, 0x43, 0x30, 0xb3, 0xfe, 0xf6, 0xea,
+    0xe5, 0x8b, 0x38, 0x9e, 0x1e, 0xf1, 0x3f, 0x12, 0xd4, 0xd9, 0xd0, 0x4d, 0x00, 0xb1, 0x84, 0x20,
+    0x58, 0xb6, 0xe3, 0xec, 0xe1, 0xbc, 0xa2, 0x9b, 0x70, 0x7c, 0xb0, 0x98, 0xb3, 0x0b, 0x02, 0x33,
+    0x57, 0xc9, 0xe4, 0xe7, 0xb1, 0x32, 0x4f, 0xe0, 0xa7, 0x14, 0xb8, 0x9d, 0x60, 0x02, 0x6a, 0x1c,
+    0x1d, 0x47, 0xd5, 0xf4, 0x94, 0x87, 0x98, 0x65, 0x85, 0x2f, 0x70, 0x25, 0xc5, 0x1d, 0x1b, 0x84,
+    0x16, 0x0a, 0xbc, 0x4b, 0x0f, 0x71, 0x10, 0xdb, 0x1e, 0x0c, 0x55, 0x09, 0x72, 0x8a, 0xf6, 0xd3,
+    0x3e, 0x0c, 0x66, 0xf1, 0xd5, 0x5f, 0xf0, 0x3b, 0x6c, 0x85, 0xe9, 0x5e, 0x80, 0x91, 0xb3, 0x5a,
+    0x96, 0x22, 0xb2, 0x02, 0x8e, 0x87, 0xac, 0xf9, 0xa0, 0x29, 0xd4, 0x62, 0xcd, 0x5d, 0x87, 0x2d,
+    0xfc, 0xb0, 0x2a, 0x7e, 0xfd, 0xc2, 0x89, 0x31, 0xbc, 0x2e, 0x11, 0x48, 0x8d, 0xa9, 0x9e, 0xc8,
+    0x00, 0x6b, 0x8b, 0x11, 0xc9, 0x74, 0x39, 0x70, 0x73, 0x1d, 0x43, 0xee, 0xd2, 0xd6, 0x5b, 0x5b,
+    0xc8, 0xd2, 0xab, 0x50, 0x5e, 0x4c, 0x22, 0x20, 0x25, 0x36, 0x97, 0x54, 0xa1, 0xc6, 0x2b, 0x6a,
+    0x2d, 0xac, 0x38, 0xd4, 0xc6, 0x12, 0x46, 0x59, 0x17, 0xab, 0x44, 0xf7, 0xa1, 0xa2, 0x68, 0xfb,
+    0x7e, 0xba, 0x1f, 0x87, 0xb5, 0x95, 0xf1, 0x67, 0x14, 0xa6, 0x8a, 0x9a, 0x55, 0xed, 0x3c, 0x3b,
+    0x5a, 0x62, 0xc6, 0xbf, 0x45, 0xb7, 0x61, 0xc6, 0xc6, 0xf6, 0x39, 0x27, 0x99, 0xbf, 0x87, 0x13,
+    0x5d, 0xd8, 0x5f, 0x3b, 0xd2, 0x71, 0xc0, 0x09, 0x1c, 0x49, 0x5d, 0x03, 0x52, 0x8a, 0xab, 0xc7,
+    0xae, 0xd2, 0x2e, 0x58, 0x2c, 0x9d, 0x77, 0x1c, 0x86, 0x21, 0xf8, 0x8c, 0xe0, 0xc7, 0x68, 0xca,
+    0xe9, 0x2a, 0x17, 0xf4, 0x56, 0x8b, 0xcf, 0x2e, 0x17, 0x12, 0xa5, 0x19, 0x06, 0xe2, 0x9b, 0xa1,
+    0xbb, 0x99, 0x81, 0x89, 0x48, 0xf6, 0x9d, 0x1b, 0xb9, 0x70, 0x42, 0xfa, 0xfc, 0x0a, 0x4d, 0x29,
+    0x91, 0x15, 0xb4, 0x0f, 0xda, 0x4b, 0xd2, 0xd8, 0xa4, 0x1c, 0x48, 0x98, 0x95, 0x42, 0x0b, 0x95,
+    0x22, 0x0c, 0x9a, 0xe1, 0x5b, 0xc5, 0xdf, 0x12, 0xfc, 0x55, 0xd6, 0x31, 0x1c, 0x33, 0xfc, 0xf0,
+    0xc7, 0x31, 0x18, 0x01, 0x26, 0x03, 0x31, 0xec, 0x33, 0x35, 0x85, 0x19, 0xe9, 0x69, 0xf6, 0xfd,
+    0xf7, 0xec, 0x5e, 0x9f, 0x7e, 0x69, 0x61, 0xb1, 0x4e, 0x4f, 0x3a, 0xf0, 0xec, 0x5e, 0x0a, 0x55,
+    0x02, 0x4a, 0x61, 0x6c, 0x32, 0x38, 0xc0, 0xb7, 0xeb, 0x8b, 0x1f, 0x2d, 0x0d, 0xcf, 0x7a, 0x01,
+    0x68, 0xb3, 0x0c, 0x44, 0x30, 0xf2, 0xf7, 0x52, 0x8e, 0xfa, 0x41, 0xc8, 0x6d, 0x29, 0x0a, 0x92,
+    0x89, 0x59, 0xac, 0xe6, 0x2e, 0xc7, 0x85, 0xd4, 0x46, 0xba, 0x5e, 0x48, 0xbf, 0xb3, 0xe8, 0x72,
+    0xe2, 0x17, 0x1c, 0x81, 0x24, 0x5c, 0x4e, 0xc1, 0xe6, 0x0c, 0xf1, 0x43, 0x70, 0x84, 0x54, 0x84,
+    0x1e, 0x18, 0x2c, 0xb4, 0xf4, 0xad, 0xd7, 0x66, 0xb7, 0x89, 0xeb, 0x97, 0x7d, 0x1e, 0xb8, 0x0e,
+    0x3c, 0xc0, 0x93, 0xf0, 0x84, 0x8b, 0xf8, 0xc9, 0x6c, 0xa0, 0xf5, 0xb1, 0xd0, 0xae, 0x61, 0x28,
+    0x8b, 0x50, 0x38, 0xd9, 0x1b, 0xf2, 0xb3, 0xab, 0x6b, 0xd2, 0x13, 0xc6, 0xfd, 0x27, 0xb9, 0x6a,
+    0x40, 0x4f, 0x4e, 0x54, 0xc8, 0xb0, 0xa5, 0x16, 0x0f, 0xb1, 0xe4, 0xae, 0x15, 0x3b, 0xf4, 0x10,
+    0xdb, 0x83, 0x7f, 0x35, 0x24, 0xe9, 0x32, 0x2d, 0x51, 0xc3, 0xb3, 0xf0, 0x2d, 0xe5, 0x60, 0x50,
+    0xfb, 0xb9, 0x01, 0xa9, 0x9a, 0x9b, 0xb7, 0x9e, 0x2a, 0xb7, 0x8d, 0x51, 0xa4, 0xc3, 0x06, 0x46,
+    0xa8, 0xd8, 0xa0, 0xdf, 0x58, 0x5a, 0x77, 0x9f, 0x16, 0x42, 0x0d, 0xeb, 0xb8, 0x27, 0xdf, 0xa0,
+    0x58, 0x83, 0x25, 0xc8, 0x16, 0x83, 0xae, 0xc0, 0xde, 0xb9, 0xef, 0x2d, 0xda, 0xab, 0xbb, 0xd2,
+    0x3b, 0xa8, 0x47, 0x26, 0xfe, 0x1c, 0x1d, 0x30, 0x4f, 0x53, 0xe6, 0x45, 0xee, 0x1b, 0x75, 0x66,
+    0xda, 0x62, 0x49, 0x6d, 0xe6, 0xa6, 0x52, 0x51, 0x73, 0xa6, 0xd5, 0xae, 0xf2, 0x9a, 0x24, 0x27,
+    0x6b, 0x92, 0x27, 0xb1, 0x8c, 0x9d, 0x08, 0xf3, 0x57, 0xc9, 0x10, 0x25, 0x6d, 0xc8, 0x37, 0x32,
+    0x40, 0x99, 0xc6, 0xaa, 0x6f, 0x1c, 0x4f, 0x97, 0x51, 0xf4, 0x2c, 0xae, 0xae, 0xc5, 0xd3, 0x53,
+    0x51, 0x6e, 0xe9, 0x4d, 0x8a, 0x00, 0xa3, 0x16, 0x1d, 0x4f, 0x69, 0xc1, 0xb0, 0xb7, 0xa6, 0x6b,
+    0xb0, 0x3c, 0xd7, 0xc5, 0x12, 0xa3, 0xc4, 0x14, 0xca, 0x74, 0x0e, 0x35, 0x18, 0x91, 0x2a, 0xd5,
+    0x15, 0x2b, 0xbb, 0x89, 0x3f, 0xb1, 0xae, 0x25, 0x96, 0x6c, 0x60, 0x5a, 0xc9, 0x53, 0xc2, 0x5a,
+    0xc8, 0x24, 0xc9, 0xad, 0x14, 0x3b, 0xa4, 0x06, 0x19, 0x0e, 0xab, 0x21, 0xc7, 0x4b, 0x68, 0x46,
+    0x31, 0x62, 0x8a, 0x4a, 0x5d, 0x5b, 0xea, 0x94, 0x83, 0xa4, 0xb7, 0x84, 0x9c, 0xa3, 0xcf, 0x5d,
+    0xec, 0x64, 0x6e, 0x1d, 0xec, 0x27, 0x50, 0x19, 0x5f, 0x1f, 0x5f, 0x82, 0x21, 0x38, 0x41, 0xf2,
+    0x4d, 0x15, 0xeb, 0xac, 0xef, 0x17, 0xee, 0xea, 0x41, 0xa9, 0xc1, 0xd6, 0x68, 0x83, 0x0f, 0x0d,
+    0xde, 0x0f, 0x2a, 0x1a, 0x80, 0x85, 0x62, 0xfb, 0xa9, 0x09, 0xfd, 0x1e, 0x48, 0x03, 0x22, 0x2d,
+    0x34, 0xc0, 0x1f, 0x9a, 0xf0, 0x88, 0xaa, 0x32, 0x03, 0xd0, 0xb9, 0x53, 0xf1, 0x84, 0xaf, 0x31,
+    0x5d, 0x80, 0xb6, 0xce, 0x11, 0xfe, 0xf3, 0xff, 0x13, 0x4a, 0x10, 0xf4, 0x2b, 0x18, 0x59, 0x60,
+    0x48, 0x71, 0x6c, 0x0d, 0xe5, 0x96, 0x3b, 0x6a, 0x0b, 0x2b, 0xb5, 0xa6, 0x65, 0xd4, 0x18, 0x6c,
+    0x68, 0x39, 0x25, 0xd6, 0xd8, 0xbb, 0xf7, 0x45, 0x05, 0x49, 0x98, 0x34, 0x1d, 0x28, 0x70, 0xa0,
+    0x6d, 0xd7, 0xa0, 0xdd, 0x92, 0xa8, 0x89, 0xb0, 0x0a, 0x17, 0xfd, 0xc6, 0xc3, 0x07, 0x4d, 0xda,
+    0x6f, 0x13, 0xdf, 0x59, 0x20, 0xe1, 0xa6, 0x0a, 0x64, 0x51, 0x55, 0xc1, 0xa0, 0xd0, 0x11, 0x84,
+    0xd8, 0xb6, 0xa9, 0x01, 0xe9, 0x08, 0xa9, 0x25, 0x40, 0xf9, 0xf9, 0x85, 0xb9, 0x2d, 0x22, 0xe0,
+    0xd4, 0x4b, 0x46, 0xae, 0x0f, 0x96, 0xe6, 0x3b, 0xca, 0xed, 0x03, 0xee, 0x80, 0xd1, 0x96, 0x80,
+    0xc1, 0xae, 0x98, 0x8a, 0xbf, 0xb0, 0x1f, 0xc6, 0x7b, 0xe9, 0x4c, 0x08, 0x08, 0x4a, 0xa2, 0x81,
+    0xd1, 0xd5, 0x6d, 0xd4, 0x3f, 0x47, 0xd7, 0x91, 0x90, 0x63, 0x4b, 0xb8, 0x88, 0x5d, 0x89, 0xc8,
+    0x49, 0x4d, 0xa4, 0x9c, 0xc0, 0xa4, 0x58, 0x83, 0x6c, 0xd2, 0xaa, 0x47, 0x99, 0x8d, 0xd0, 0xf7,
+    0xd7, 0xf8, 0xb9, 0x2a, 0x79, 0xd7, 0xb9, 0xd1, 0x6e, 0x88, 0x7c, 0x55, 0x8d, 0xf8, 0x6c, 0x3f,
+    0x11, 0x47, 0x5b, 0xf3, 0x55, 0xf5, 0x59, 0xa2, 0x94, 0xde, 0x67, 0x21, 0x46, 0x05, 0xa4, 0x4c,
+    0x08, 0x8e, 0xd2, 0x57, 0x62, 0x97, 0xdb, 0x4c, 0xf1, 0x09, 0xab, 0x67, 0x68, 0x71, 0xc7, 0x8d,
+    0xb3, 0xd2, 0xb6, 0xd8, 0x30, 0xce, 0x08, 0xd1, 0xde, 0x44, 0x64, 0xea, 0xe3, 0xfa, 0x9e, 0x2c,
+    0xaa, 0xef, 0xd3, 0x25, 0x3a, 0x45, 0x43, 0x26, 0xbe, 0x98, 0xf1, 0xc5, 0x55, 0x49, 0x4b, 0xc2,
+    0x92, 0x81, 0x15, 0xbc, 0xbc, 0x91, 0x6c, 0x0d, 0xe2, 0x24, 0x7d, 0x65, 0x5a, 0x67, 0xa2, 0xbc,
+    0x95, 0x98, 0xfb, 0x73, 0x39, 0x98, 0xee, 0xac, 0x6c, 0xa0, 0x59, 0x36, 0x67, 0xbc, 0x34, 0xc0,
+    0xd5, 0xc2, 0x4e, 0xa4, 0xd0, 0xef, 0x2b, 0xc9, 0x97, 0x57, 0x2b, 0xa7, 0x9a, 0xb6, 0x2e, 0x98,
+    0xa9, 0x05, 0x24, 0xbd, 0x9e, 0xe8, 0x4d, 0x1a, 0xeb, 0xcc, 0xf8, 0x45, 0x53, 0x63, 0x1e, 0xd3,
+    0xbe, 0x47, 0x3c, 0xb8, 0xc5, 0x28, 0xdc, 0x0d, 0x89, 0x54, 0x05, 0xca, 0x29, 0x5c, 0x57, 0xd3,
+    0x0b, 0x60, 0xdb, 0x6e, 0x30, 0xf3, 0x55, 0x30, 0x4a, 0xb0, 0xce, 0x51, 0x25, 0x3a, 0xfb, 0x5e,
+    0xe0, 0x07, 0xd3, 0x30, 0x51, 0x13, 0xd3, 0xd3, 0x6b, 0x59, 0x28, 0x7d, 0x6d, 0x15, 0xd9, 0xb1,
+    0xc6, 0x62, 0x26, 0x65, 0x7d, 0x51, 0xb8, 0x7f, 0x52, 0x3f, 0x36, 0x7a, 0xdf, 0xa7, 0x3d, 0xe3,
+    0xfe, 0x00, 0xc8, 0x3c, 0x3d, 0xda, 0x47, 0x8f, 0x35, 0xf0, 0x31, 0xa6, 0x51, 0x61, 0xdb, 0x5f,
+    0x29, 0x93, 0xba, 0x6e, 0x5f, 0x0d, 0x65, 0x21, 0xe4, 0xe7, 0x2e, 0xf8, 0xfe, 0x78, 0xe2, 0x4c,
+    0x65, 0x6c, 0x6a, 0xb2, 0x21, 0xdf, 0xea, 0xfd, 0x7b, 0x13, 0x84, 0x94, 0x92, 0x7b, 0x5d, 0xd7,
+    0x50, 0xe1, 0x9a, 0x15, 0xfd, 0xb9, 0x41, 0x27, 0x40, 0x2d, 0xc9, 0x44, 0xd9, 0xac, 0x3f, 0x40,
+    0xf3, 0x91, 0xdc, 0x71, 0x4a, 0xc9, 0x54, 0x5b, 0x50, 0x39, 0x29, 0x3e, 0x8b, 0x13, 0xdb, 0x73,
+    0x23, 0x4a, 0xfb, 0xaf, 0xa5, 0xb5, 0x7a, 0xbe, 0x60, 0x4b, 0x38, 0xe0, 0xa9, 0xfb, 0x27, 0x87,
+    0x9b, 0xcb, 0xd8, 0x43, 0xd6, 0x8a, 0xbc, 0xfd, 0xb2, 0xbe, 0x81, 0x3a, 0x7f, 0x31, 0x3f, 0x55,
+    0x0b, 0xf1, 0x29, 0x09, 0xa3, 0x91, 0x72, 0xc4, 0x55, 0xda, 0xa3, 0xea, 0x31, 0x3d, 0xeb, 0xa4,
+    0x9c, 0x4e, 0xfa, 0xb0, 0xc2, 0xe1, 0xe1, 0xa0, 0xb9, 0xf3, 0x36, 0x0a, 0x07, 0x35, 0x6e, 0x4b,
+    0xaa, 0xb6, 0x94, 0x02, 0x2c, 0xe8, 0x2c, 0x3f, 0xaf, 0xae, 0x0a, 0xb3, 0xab, 0x88, 0x0f, 0xc3,
+    0xb2, 0xb8, 0x4a, 0xfb, 0x23, 0x73, 0xa9, 0x5d, 0x78, 0x45, 0xb9, 0x5b, 0x32, 0x93, 0x15, 0x7d,
+    0x9b, 0x87, 0xbd, 0x96, 0x9a, 0xae, 0xa8, 0xc7, 0x28, 0x32, 0x27, 0xb7, 0x50, 0x34, 0x65, 0x08,
+    0x94, 0xa7, 0xb2, 0xa3, 0x7a, 0x81, 0x73, 0xda, 0x89, 0xe2, 0x7a, 0x0f, 0x77, 0x31, 0x2e, 0x2b,
+    0x4e, 0x4b, 0x7b, 0x8f, 0x78, 0x9c, 0x25, 0xae, 0xe2, 0x14, 0x12, 0x74, 0x8b, 0xc0, 0xe9, 0x86,
+    0xcc, 0xbb, 0x15, 0xd0, 0x08, 0x57, 0x67, 0xaa, 0x77, 0x8d, 0x1b, 0x98, 0xe6, 0xd7, 0xac, 0xa2,
+    0x56, 0x9a, 0x69, 0x87, 0x26, 0x94, 0xe8, 0xa4, 0xe6, 0x18, 0xbd, 0x7b, 0xbf, 0x3e, 0xcf, 0xea,
+    0x5c, 0xc4, 0x94, 0xa4, 0x55, 0x9a, 0xcf, 0x76, 0x2a, 0x9c, 0x49, 0xf4, 0x81, 0xea, 0xfc, 0x49,
+    0xb4, 0x1a, 0x8b, 0x16, 0x53, 0xe6, 0x41, 0x66, 0x35, 0x0b, 0x4e, 0x24, 0xbe, 0x20, 0x3f, 0x32,
+    0x6f, 0x7b, 0xe1, 0x30, 0x7c, 0x03, 0x27, 0xac, 0x69, 0x12, 0x8d, 0x4d, 0xd5, 0x0b, 0x99, 0x7b,
+    0x58, 0xe7, 0x32, 0x0a, 0x6c, 0x52, 0x44, 0x4c, 0x25, 0x08, 0x68, 0xfb, 0x56, 0x98, 0xb7, 0x72,
+    0xef, 0xa9, 0x2e, 0xf3, 0x04, 0x0f, 0xb0, 0xa9, 0xac, 0x64, 0xb1, 0x9f, 0xb4, 0x81, 0x17, 0x83,
+    0xe3, 0x31, 0x38, 0xee, 0x08, 0x03, 0x27, 0x9e, 0xc8, 0xbf, 0xf8, 0x91, 0x2a, 0xfc, 0xcc, 0xbb,
+    0x30, 0x76, 0x68, 0xb3, 0xb9, 0xdb, 0x65, 0x2f, 0xf1, 0x08, 0xc5, 0x99, 0x8f, 0xd7, 0x16, 0x91,
+    0xd5, 0x8a, 0xc1, 0x03, 0x02, 0x65, 0x66, 0xb6, 0x49, 0x85, 0xc7, 0x46, 0x22, 0xda, 0x6b, 0x67,
+    0xe2, 0xe3, 0x39, 0x8e, 0x4a, 0x45, 0x25, 0xd4, 0xe2, 0x46, 0xa0, 0x63, 0x4a, 0x10, 0x95, 0x51,
+    0x5d, 0xf1, 0x00, 0x3c, 0xc8, 0xbe, 0x72, 0x27, 0x0d, 0xae, 0x08, 0x3f, 0x54, 0x56, 0x0b, 0x2b,
+    0x3e, 0x63, 0x06, 0xa0, 0x1a, 0x18, 0x66, 0xc9, 0x88, 0x23, 0xc2, 0xc7, 0x71, 0x30, 0x35, 0xda,
+    0x44, 0x0e, 0x01, 0xce, 0x0b, 0x26, 0xa6, 0x0d, 0xa7, 0xe9, 0x17, 0xa6, 0xbe, 0x25, 0x0f, 0x06,
+    0xa7, 0x0f, 0x82, 0x41, 0x01, 0xe9, 0x94, 0x75, 0x48, 0xcd, 0x5b, 0xde, 0x3f, 0xa6, 0x67, 0xd3,
+    0x98, 0xe1, 0x69, 0x0b, 0x14, 0x29, 0x4a, 0x22, 0x44, 0xf3, 0x67, 0x16, 0x11, 0x6d, 0xf4, 0x1e,
+    0x4f, 0xe2, 0xd8, 0xe1, 0xa5, 0xda, 0xa0, 0xb7, 0xc3, 0xd0, 0xbe, 0xec, 0x27, 0xc3, 0x21, 0xf9,
+    0x93, 0x12, 0x24, 0xf0, 0x71, 0x41, 0xd2, 0xf6, 0xbf, 0x45, 0xee, 0x3e, 0xd0, 0xa6, 0xf2, 0xa0,
+    0xcd, 0x29, 0xc8, 0x54, 0x9b, 0xf5, 0x30, 0x35, 0x4f, 0xb8, 0xdf, 0x27, 0xc8, 0x7d, 0x53, 0xfc,
+    0xde, 0x49, 0xbf, 0x5d, 0x4a, 0x82, 0xa2, 0xe1, 0xa5, 0x3c, 0xc5, 0x1c, 0x62, 0x5e, 0x74, 0xcc,
+    0x9a, 0xa2, 0x1f, 0xb8, 0xf1, 0x48, 0x57, 0x2b, 0xe3, 0x05, 0xf6, 0x78, 0xc2, 0x53, 0x98, 0x96,
+    0x6f, 0x78, 0x88, 0xe7, 0x35, 0x30, 0xc3, 0x7e, 0x98, 0x70, 0x7f, 0xc8, 0x8e, 0xf9, 0x19, 0x5d,
+    0x1f, 0x6e, 0x35, 0xdb, 0x0c, 0xb3, 0xa5, 0xec, 0x28, 0xf0, 0xd3, 0xce, 0x22, 0x73, 0x40, 0x31,
+    0xe3, 0x96, 0x4b, 0x8c, 0x59, 0x83, 0x41, 0x12, 0x17, 0xce, 0x23, 0xa4, 0x0c, 0xc5, 0x30, 0x33,
+    0x93, 0xdd, 0xd1, 0x29, 0x16, 0xd9, 0x00, 0x39, 0x8a, 0xc3, 0x50, 0xa7, 0x99, 0x00, 0x14, 0xd5,
+    0x9d, 0x67, 0x7c, 0xec, 0x51, 0xbe, 0x36, 0x25, 0x08, 0x58, 0xe0, 0x30, 0x44, 0xc0, 0x86, 0x36,
+    0x53, 0xbd, 0xa2, 0x33, 0xad, 0x5a, 0xbf, 0x9a, 0x85, 0xe6, 0x64, 0x05, 0x3d, 0xf7, 0x80, 0xf6,
+    0xe6, 0xb2, 0x2d, 0x02, 0x94, 0x1a, 0xda, 0x82, 0x53, 0x89, 0x60, 0x20, 0xfa, 0x5b, 0x38, 0x8a,
+    0xdb, 0x34, 0x8a, 0x52, 0x6b, 0x6e, 0xd3, 0x28, 0xb3, 0x61, 0x48, 0x69, 0xe0, 0xf4, 0x51, 0x2a,
+    0xe1, 0xb7, 0x5a, 0x96, 0xf5, 0x5e, 0x4d, 0x3e, 0x7a, 0x2b, 0x05, 0xe8, 0xd4, 0xf5, 0xe3, 0x27,
+    0x84, 0x47, 0x6b, 0x43, 0x25, 0x5d, 0x23, 0xdc, 0xbb, 0xa5, 0xf7, 0x22, 0x4f, 0x19, 0x5d, 0xf6,
+    0xd0, 0x9e, 0x1d, 0xcb, 0x4f, 0xbb, 0x99, 0x54, 0xc9, 0xc2, 0xa3, 0x09, 0x02, 0x10, 0x57, 0x33,
+    0x12, 0x2b, 0xb3, 0xd7, 0x12, 0xeb, 0x72, 0xa6, 0xfc, 0xf5, 0x81, 0xce, 0x35, 0x93, 0xe9, 0x82,
+    0x57, 0xd1, 0x08, 0x48, 0xc2, 0x4c, 0x74, 0x8b, 0xf6, 0x2d, 0xca, 0xe4, 0xa4, 0x70, 0x96, 0xf8,
+    0x9a, 0x0e, 0xa6, 0x12, 0xe1, 0x30, 0xcf, 0xcb, 0xe0, 0x6d, 0x6a, 0x1f, 0xde, 0xd1, 0x62, 0xf4,
+    0x45, 0x54, 0xeb, 0x2a, 0xbb, 0x16, 0x55, 0x8e, 0x69, 0xe0, 0x09, 0x49, 0x76, 0x62, 0x8f, 0xe8,
+    0x90, 0x96, 0xf1, 0xb0, 0x04, 0x8e, 0xb3, 0x0b, 0xc6, 0x19, 0xcf, 0xdc, 0xc5, 0x96, 0xc1, 0xe4,
+    0xde, 0x82, 0xfe, 0x8d, 0x9f, 0x96, 0xc5, 0x61, 0x54, 0x40, 0xc0, 0x8c, 0xb1, 0x3b, 0x1a, 0x7b,
+    0x22, 0x73, 0x96, 0x7d, 0x1e, 0x04, 0xa0, 0x13, 0xd7, 0x8c, 0xfb, 0x76, 0x7f, 0xb8, 0x6a, 0x0f,
+    0x0d, 0x10, 0xbd, 0x15, 0x29, 0x7a, 0x14, 0xcc, 0x31, 0x84, 0xe5, 0x60, 0xa0, 0x98, 0xa7, 0x6d,
+    0x2a, 0x11, 0xc8, 0x88, 0x10, 0x50, 0x64, 0xa8, 0x06, 0x67, 0x64, 0xa5, 0x4a, 0xea, 0xe5, 0xbe,
+    0x85, 0x89, 0x96, 0x1d, 0xca, 0x2c, 0x0f, 0xc1, 0x05, 0x1b, 0xd1, 0x61, 0x29, 0xf1, 0xad, 0x2b,
+    0x71, 0x0a, 0x50, 0x90, 0x7c, 0xa5, 0x1a, 0x05, 0xc3, 0x72, 0x74, 0x5d, 0x93, 0x08, 0x43, 0xd9,
+    0xd3, 0xf8, 0x83, 0x12, 0xf0, 0xf0, 0x87, 0xa9, 0xa3, 0x21, 0x1d, 0x58, 0xc6, 0xa3, 0xab, 0x46,
+    0x95, 0x8d, 0x6f, 0xa6, 0x3b, 0x53, 0x5a, 0xa7, 0x48, 0x45, 0x6a, 0xac, 0x48, 0x3f, 0x21, 0x58,
+    0xc4, 0x98, 0x93, 0xc2, 0x1c, 0x02, 0x2a, 0xca, 0x50, 0xd0, 0x80, 0xd0, 0x96, 0x7d, 0x19, 0x09,
+    0xad, 0xf3, 0xf4, 0xee, 0x04, 0x56, 0xf0, 0xb2, 0x48, 0xd0, 0x2b, 0x6b, 0x16, 0x62, 0x0a, 0x82,
+    0x4f, 0xe3, 0xdd, 0xa5, 0xfd, 0x84, 0x4a, 0x30, 0x58, 0xb4, 0x83, 0xd0, 0x89, 0x2a, 0xc5, 0x54,
+    0x40, 0x88, 0x04, 0x79, 0x11, 0xf9, 0x99, 0x97, 0x47, 0xb0, 0x9f, 0x9e, 0xc3, 0x15, 0xdb, 0x17,
+    0x19, 0x89, 0xad, 0x5c, 0xd8, 0xaf, 0xb2, 0x11, 0xf9, 0xc1, 0xf5, 0xeb, 0x5b, 0xc1, 0x65, 0x41,
+    0x8a, 0x8c, 0x50, 0x63, 0xf3, 0xd0, 0x51, 0xe7, 0x13, 0x7f, 0xf4, 0xf5, 0x5f, 0x5e, 0xec, 0x8e,
+    0xb4, 0xbb, 0x00, 0xda, 0x78, 0x0a, 0x70, 0x96, 0x84, 0xe0, 0x72, 0xd2, 0xf7, 0x88, 0x22, 0xed,
+    0x72, 0x00, 0xda, 0x3a, 0xbb, 0x8e, 0x5e, 0x6a, 0xfb, 0x16, 0xd4, 0x4a, 0x2e, 0xb1, 0x21, 0x28,
+    0x5d, 0xa1, 0x53, 0x6d, 0x3a, 0xfe, 0x5e, 0x3a, 0xd8, 0x8c, 0xa7, 0xde, 0x81, 0x74, 0x58, 0x95,
+    0xbe, 0xfe, 0x03, 0x13, 0xb0, 0x73, 0x64, 0xdd, 0xa0, 0xd9, 0x74, 0x5e, 0x95, 0x5a, 0xc8, 0x7a,
+    0x5c, 0x35, 0x5e, 0x4a, 0x10, 0x6d, 0xf1, 0x09, 0xba, 0x6a, 0x29, 0x94, 0x2f, 0x4b, 0x62, 0x28,
+    0xcb, 0x45, 0x42, 0x82, 0x26, 0x81, 0x66, 0x19, 0xa4, 0x7f, 0x19, 0x03, 0x48, 0x97, 0xf5, 0x96,
+    0x1e, 0x3d, 0x59, 0xfd, 0xe1, 0x31, 0xf4, 0x20, 0x78, 0xe6, 0x5e, 0x70, 0xc7, 0x24, 0xa7, 0xc1,
+    0x60, 0xaf, 0xb6, 0x8d, 0xa2, 0x6c, 0xaa, 0xaa, 0x79, 0xc1, 0xbc, 0x66, 0x7b, 0x74, 0x4f, 0x7e,
+    0x1a, 0x4f, 0xf4, 0x55, 0x23, 0xbc, 0x6e, 0xb0, 0x55, 0x2b, 0xe9, 0x48, 0xe7, 0xc7, 0x51, 0x7c,
+    0x9a, 0x8f, 0x9d, 0xc1, 0x62, 0x1c, 0x4b, 0x21, 0x42, 0xf3, 0xcc, 0xc3, 0x1b, 0x60, 0xf1, 0xc3,
+    0x0a, 0xea, 0x5b, 0x7c, 0xea, 0xdc, 0x72, 0x7e, 0xf8, 0x4a, 0x4a, 0x4f, 0x60, 0x53, 0x75, 0x2a,
+    0x89, 0x54, 0x23, 0x72, 0x2e, 0xef, 0x4c, 0x2d, 0x0d, 0x88, 0x66, 0x1c, 0xce, 0x55, 0x57, 0x02,
+    0x50, 0xd3, 0x57, 0xa9, 0xc5, 0x5a, 0x46, 0x2a, 0x93, 0xfc, 0x6d, 0xf1, 0x2d, 0xbc, 0x14, 0xb0,
+    0xad, 0x0d, 0x76, 0x5a, 0x38, 0xcf, 0x48, 0x24, 0xa0, 0xc2, 0x7e, 0x71, 0x5a, 0x91, 0x3c, 0x08,
+    0xb1, 0xa0, 0xf6, 0x63, 0x9f, 0xcc, 0x32, 0x0c, 0x62, 0x1d, 0xe2, 0xe7, 0xc6, 0xe7, 0xe6, 0x64,
+    0x69, 0x5f, 0x32, 0x6f, 0xca, 0x95, 0x36, 0x43, 0x4a, 0x5f, 0x2b, 0x47, 0x3c, 0xd8, 0x8f, 0x12,
+    0xde, 0xfc, 0xce, 0xf5, 0xdc, 0x2f, 0x9d, 0x1b, 0xa5, 0x2f, 0x9d, 0x1b, 0xe2, 0x4b, 0xe7, 0x4d,
+    0x6d, 0x44, 0xef, 0xb0, 0x01, 0x7a, 0x95, 0xb5, 0x90, 0xe3, 0xcb, 0x33, 0xfc, 0xc0, 0xfd, 0x22,
+    0x3c, 0x19, 0x22, 0x60, 0xb3, 0x55, 0xe0, 0x6a, 0xc8, 0xcf, 0x17, 0x62, 0x28, 0xc0, 0x95, 0x19,
+    0x2a, 0x0f, 0xfa, 0x12, 0x26, 0x71, 0x22, 0x8d, 0x3d, 0x95, 0xd6, 0x55, 0x8e, 0x3c, 0x8b, 0x7a,
+    0x85, 0x29, 0x24, 0x98, 0x4f, 0x62, 0x1a, 0xea, 0xbb, 0x42, 0x38, 0x03, 0x74, 0x4a, 0xe6, 0xc1,
+    0x95, 0xf8, 0x5a, 0xc4, 0x2c, 0x3d, 0x8d, 0x45, 0x90, 0x57, 0x81, 0xe6, 0xb9, 0x4a, 0xbe, 0xd9,
+    0x02, 0x7c, 0xc1, 0xc8, 0x46, 0x91, 0xa7, 0xaf, 0x85, 0xf2, 0xbb, 0xb6, 0xae, 0x4f, 0x09, 0x13,
+    0x0b, 0xf0, 0x74, 0x33, 0x37, 0x33, 0xa8, 0xec, 0x60, 0x48, 0x00, 0x91, 0xce, 0x6a, 0xa4, 0x79,
+    0x11, 0x4e, 0x23, 0x7d, 0x37, 0xe2, 0x74, 0x01, 0xf1, 0x3c, 0x46, 0x17, 0x70, 0x57, 0x33, 0x5a,
+    0x2a, 0x99, 0x81, 0xf0, 0xb0, 0x2a, 0xcc, 0xb5, 0x5a, 0xd6, 0xa9, 0x2a, 0x98, 0x05, 0x18, 0x0e,
+    0x28, 0x7e, 0x4a, 0x45, 0x3f, 0x51, 0x2c, 0x08, 0x3c, 0x00, 0xcc, 0xa9, 0x34, 0x5b, 0x58, 0x0f,
+    0x5d, 0x25, 0x33, 0x0b, 0x23, 0x66, 0xa9, 0xab, 0x18, 0xa1, 0x52, 0xcb, 0xd5, 0xe4, 0x12, 0xd4,
+    0x99, 0x38, 0x7d, 0x36, 0x15, 0x07, 0xac, 0xc0, 0x16, 0x14, 0x87, 0x72, 0xf1, 0x4f, 0x53, 0xd4,
+    0x16, 0x90, 0x68, 0xcd, 0x2b, 0xa3, 0x5e, 0x04, 0xba, 0xdc, 0xe1, 0xa5, 0x49, 0x18, 0x32, 0xc7,
+    0x14, 0xfd, 0x63, 0x53, 0xc0, 0xe2, 0x8a, 0x3b, 0xa1, 0xfc, 0xb6, 0x1a, 0xb7, 0x4d, 0xaa, 0x7c,
+    0x79, 0xfa, 0xd7, 0x6c, 0xee, 0xba, 0x1c, 0x5d, 0x43, 0xf0, 0x6d, 0x1d, 0xbc, 0x39, 0xe8, 0x53,
+    0x32, 0xc9, 0x6e, 0xec, 0x01, 0x69, 0xa4, 0x20, 0x73, 0x3f, 0x0c, 0x30, 0xfc, 0x78, 0x8f, 0x89,
+    0x74, 0xd2, 0x63, 0xbc, 0x03, 0x07, 0x6f, 0x35, 0x62, 0x14, 0x7d, 0xb6, 0x9a, 0x79, 0x17, 0x50,
+    0x4f, 0x14, 0x96, 0xbd, 0x1e, 0x78, 0xdc, 0x0e, 0x15, 0x3d, 0xf1, 0xa4, 0xbc, 0x93, 0x2b, 0x5c,
+    0xe0, 0x32, 0x7f, 0xb2, 0x25, 0x01, 0x99, 0x94, 0x3e, 0x01, 0xa7, 0xd2, 0xdf, 0xdf, 0xca, 0xae,
+    0x3c, 0x25, 0xba, 0x03, 0x5e, 0x26, 0x27, 0x15, 0x9e, 0x35, 0x72, 0x63, 0xc5, 0x03, 0x10, 0x93,
+    0x4a, 0xc8, 0x5d, 0xd2, 0x92, 0x5d, 0x1c, 0x2f, 0xcf, 0x9f, 0x8a, 0x0d, 0xb1, 0xe2, 0x91, 0xd4,
+    0xf4, 0xe5, 0x7a, 0x91, 0x5a, 0x75, 0x31, 0x7e, 0x76, 0x4a, 0xbd, 0x56, 0xc4, 0xf3, 0xa7, 0xd7,
+    0xa5, 0x97, 0xd7, 0x6e, 0xe4, 0x0e, 0xb1, 0xd7, 0x56, 0x2e, 0x1d, 0x6e, 0xcf, 0xd5, 0xd7, 0xce,
+    0xb8, 0x5f, 0x8f, 0x21, 0x3b, 0xfb, 0x9e, 0xe2, 0x48, 0x8f, 0xc0, 0xcf, 0x25, 0x5e, 0x3b, 0xfe,
+    0x9e, 0xd6, 0xf4, 0xaf, 0xad, 0x59, 0x3c, 0x39, 0x9f, 0x35, 0x2a, 0x0e, 0xd0, 0xcf, 0x69, 0x32,
+    0x77, 0xb0, 0x3e, 0xad, 0x97, 0x9d, 0xaf, 0xaf, 0xad, 0x5a, 0x3e, 0x77, 0x9f, 0xd5, 0x56, 0xc7,
+    0xef, 0x6b, 0x2b, 0x57, 0x1d, 0xcb, 0xcf, 0x55, 0xc7, 0xd3, 0xf9, 0x0b, 0xd7, 0xa6, 0x53, 0xfb,
+    0x7a, 0xf5, 0xf8, 0xfa, 0xca, 0xf9, 0x43, 0xfd, 0xb2, 0xf2, 0xdd, 0x89, 0xbd, 0xfe, 0x01, 0x92,
+    0x5b, 0x8a, 0x3d, 0x7e, 0x50, 0x05, 0x45, 0x3e, 0xbd, 0x01, 0xa0, 0xb6, 0x4b, 0xea, 0x66, 0x80,
+    0x94, 0x05, 0xea, 0x82, 0x80, 0x79, 0x35, 0xf0, 0xe2, 0x80, 0x3b, 0xef, 0x76, 0xee, 0x5b, 0x58,
+    0x37, 0xe9, 0xf7, 0x39, 0xe6, 0xad, 0xd2, 0xb1, 0xaf, 0xda, 0xb9, 0xa5, 0x9f, 0xab, 0x97, 0xd9,
+    0xbf, 0x42, 0xb5, 0x79, 0xf3, 0xec, 0x85, 0x5c, 0x35, 0xea, 0xad, 0xb6, 0x46, 0x8b, 0xba, 0x4b,
+    0xca, 0x7e, 0xd1, 0x98, 0x4f, 0x9f, 0x1f, 0x43, 0xee, 0x67, 0xf5, 0xd7, 0x90, 0x48, 0x71, 0xf7,
+    0x83, 0xba, 0xf3, 0x61, 0x6e, 0xab, 0xf2, 0x2e, 0x88, 0x4c, 0x89, 0xa4, 0x57, 0x42, 0xcc, 0xad,
+    0x96, 0x1f, 0xc9, 0xf4, 0xc6, 0x88, 0xb9, 0x75, 0xb4, 0xb1, 0x94, 0x55, 0xe8, 0xb4, 0xc7, 0xfc,
+    0x3a, 0x78, 0xd1, 0xc4, 0x9d, 0x0b, 0x80, 0xb0, 0x59, 0x4e, 0xc2, 0x63, 0x18, 0xef, 0xb1, 0x09,
+    0xf5, 0xd3, 0x00, 0x12, 0xf9, 0x67, 0xb8, 0xc9, 0x65, 0x76, 0x7a, 0x78, 0x55, 0xc3, 0x06, 0x26,
+    0x8a, 0x68, 0x69, 0x8f, 0x1a, 0xc0, 0x52, 0x9b, 0x9e, 0xe4, 0x06, 0x52, 0x47, 0xdc, 0x8c, 0xa0,
+    0xc1, 0xe5, 0x5b, 0xcc, 0xbe, 0x2d, 0xbe, 0xa8, 0xc0, 0x2d, 0x7a, 0x19, 0x40, 0x41, 0x26, 0xb2,
+    0x96, 0x48, 0x32, 0xb4, 0x20, 0xdf, 0x1c, 0x56, 0x57, 0x44, 0x1d, 0x61, 0x7e, 0xaa, 0x23, 0xb0,
+    0x6b, 0x05, 0x86, 0xd5, 0x4f, 0x58, 0x55, 0x43, 0x21, 0xc1, 0x63, 0x12, 0x72, 0x47, 0x7e, 0x4e,
+    0xeb, 0x0a, 0x24, 0x3f, 0xd0, 0x9a, 0xfc, 0x97, 0x3a, 0xf8, 0x8a, 0x4e, 0xbe, 0xa7, 0xbd, 0x0b,
+    0x9c, 0x9b, 0xf6, 0x8d, 0x3e, 0x8d, 0x3a, 0x4f, 0xf6, 0xf0, 0x7d, 0x81, 0x9e, 0x3b, 0x11, 0xbd,
+    0xec, 0x06, 0x94, 0xdb, 0x6a, 0xdc, 0x0c, 0x03, 0xb1, 0x00, 0x86, 0x7a, 0x5e, 0x47, 0xf0, 0x75,
+    0xd6, 0xed, 0xe9, 0xdc, 0x49, 0x3a, 0xd5, 0x27, 0x68, 0x76, 0x39, 0x4b, 0x2d, 0x7c, 0x76, 0xb3,
+    0xc6, 0x5d, 0x4f, 0x50, 0x7c, 0xb1, 0x23, 0xee, 0x72, 0x33, 0x07, 0x13, 0xa7, 0xd2, 0x38, 0xa4,
+    0xb7, 0x11, 0xf1, 0x40, 0x6d, 0x8d, 0x03, 0xe8, 0xdd, 0xd1, 0x90, 0x0b, 0xdb, 0x7a, 0xfc, 0x1c,
+    0xa4, 0x31, 0x4d, 0x35, 0xb2, 0xfd, 0x73, 0x7b, 0xee, 0xc9, 0x31, 0x15, 0xdc, 0x55, 0x8e, 0xe3,
+    0x20, 0xbe, 0xc0, 0x41, 0xa5, 0x7a, 0x16, 0x59, 0xbe, 0x94, 0x91, 0x65, 0x36, 0x97, 0x9d, 0xd4,
+    0xb7, 0xb4, 0xc3, 0xb7, 0x78, 0xf4, 0x20, 0x83, 0xa3, 0x93, 0x08, 0xac, 0xcb, 0x44, 0xe3, 0x6a,
+    0x6b, 0xb7, 0x01, 0xb8, 0x2c, 0xb2, 0xf1, 0x8f, 0x30, 0x60, 0x0f, 0x6a, 0x68, 0xa9, 0x9d, 0xab,
+    0x91, 0x3e, 0x8d, 0x39, 0xda, 0x5a, 0xb9, 0x9d, 0xe2, 0xec, 0x36, 0xab, 0x3c, 0x52, 0x7d, 0xbf,
+    0x18, 0x08, 0x79, 0x41, 0x35, 0x01, 0x58, 0x40, 0xbd, 0x73, 0xdf, 0xb3, 0xbf, 0xe4, 0xb1, 0x02,
+    0x59, 0xcb, 0xab, 0xab, 0x82, 0x18, 0x98, 0xf6, 0xde, 0x71, 0x7c, 0xe9, 0xd1, 0x69, 0x82, 0x71,
+    0xe4, 0x99, 0x78, 0x46, 0xc6, 0x74, 0xa1, 0xca, 0x4a, 0x6f, 0xb5, 0x48, 0x3f, 0x46, 0xf8, 0x9a,
+    0x6d, 0xf6, 0x64, 0xe9, 0x01, 0x3a, 0x31, 0x0f, 0x5a, 0xcd, 0x0c, 0x07, 0xf5, 0x07, 0xab, 0xa5,
+    0xac, 0x78, 0xc8, 0x96, 0x0b, 0xbd, 0x01, 0x45, 0x9b, 0xd2, 0xd7, 0xce, 0x00, 0x3b, 0xec, 0x51,
+    0x3b, 0x7b, 0x51, 0x4c, 0xec, 0x4d, 0xb7, 0x34, 0x4d, 0x11, 0xb5, 0xbf, 0x46, 0x9c, 0xf0, 0x36,
+    0x06, 0x02, 0x5c, 0x13, 0xfb, 0xa9, 0x77, 0x2b, 0xd7, 0xc2, 0xf6, 0x36, 0xc1, 0xc2, 0x5b, 0x84,
+    0x0e, 0x11, 0xb7, 0x5b, 0xc3, 0x30, 0xe3, 0x37, 0x93, 0xf1, 0x5d, 0xaa, 0xb9, 0x71, 0xd3, 0xd6,
+    0x76, 0x2e, 0xeb, 0x37, 0x19, 0xab, 0x72, 0x41, 0x31, 0xad, 0xa3, 0x70, 0x06, 0x47, 0xc5, 0x19,
+    0x6f, 0x6e, 0x7f, 0xb7, 0x68, 0x13, 0x2a, 0xdf, 0x7e, 0x76, 0x29, 0x5c, 0x30, 0x1a, 0xd1, 0x65,
+    0x87, 0x41, 0x80, 0x77, 0x50, 0x8a, 0x3b, 0x11, 0xc4, 0xef, 0x74, 0x4b, 0x3f, 0x7f, 0xe1, 0x50,
+    0xb7, 0x1f, 0x38, 0x97, 0xf8, 0x77, 0x1c, 0x4f, 0xbc, 0xcd, 0xff, 0x01, 0xc6, 0xe9, 0x88, 0xa8,
+    0x2f, 0xac, 0x00, 0x00,
+};
@@ -1,1158 +1,678 @@
-static const char management_HTML[] PROGMEM = "<!DOCTYPE html>\
-<html lang=\"de\">\
-<head>\
-    <title>ESPuino-Settings</title>\
-    <meta charset=\"utf-8\">\
-    <meta name=\"viewport\" content=\"width=device-width, initial-scale=1\">\
-    <link rel=\"shortcut icon\" type=\"image/x-icon\" href=\"https://espuino.de/espuino/favicon.ico\">\
-    <link rel=\"stylesheet\" href=\"https://espuino.de/espuino/css/bootstrap.min.css\">\
-    <link rel=\"stylesheet\" href=\"https://cdnjs.cloudflare.com/ajax/libs/jstree/3.2.1/themes/default/style.min.css\"/>\
-    <link rel=\"stylesheet\" href=\"https://cdnjs.cloudflare.com/ajax/libs/font-awesome/5.15.1/css/all.min.css\"/>\
-    <link rel=\"stylesheet\" href=\"https://cdnjs.cloudflare.com/ajax/libs/toastr.js/latest/toastr.min.css\"/>\
-    <link rel=\"stylesheet\" href=\"https://cdnjs.cloudflare.com/ajax/libs/bootstrap-slider/11.0.2/css/bootstrap-slider.min.css\" />\
-    <script src=\"https://espuino.de/espuino/js/jquery.min.js\"></script>\
-    <script src=\"https://code.jquery.com/ui/1.12.0/jquery-ui.min.js\"></script>\
-    <script src=\"https://espuino.de/espuino/js/popper.min.js\"></script>\
-    <script src=\"https://espuino.de/espuino/js/bootstrap.min.js\"></script>\
-    <script src=\"https://cdnjs.cloudflare.com/ajax/libs/jstree/3.2.1/jstree.min.js\"></script>\
-    <script src=\"https://cdnjs.cloudflare.com/ajax/libs/toastr.js/latest/toastr.min.js\"></script>\
-    <script src=\"https://cdnjs.cloudflare.com/ajax/libs/bootstrap-slider/11.0.2/bootstrap-slider.min.js\"></script>\
-    <style type=\"text/css\">\
-        .filetree {\
-            border: 1px solid black;\
-            height: 200px;\
-            margin: 0em 0em 1em 0em;\
-            overflow-y: scroll;\
-        }\
-        .slider.slider-horizontal {\
-            width: 60%%;\
-            margin-left: 1em;\
-            margin-right: 1em;\
-\
-        }\
-        .slider-handle{\
-            height: 30px;\
-            width: 30px;\
-            top: -5px;\
-        }\
-\
-        legend.scheduler-border {\
-            width:inherit; /* Or auto */\
-            padding:0 10px; /* To give a bit of padding on the left and right */\
-            border-bottom:none;\
-        }\
-\
-        .icon-pos{\
-            top: 0.3em;\
-            position: relative;\
-         }\
-        .reboot{\
-            color:white;\
-        }\
-        .reboot:hover{\
-            color: orange;\
-        }\
-\
-        .fa-sync:hover {\
-            color: #666666;\
-        }\
-\
-        .clickForRefresh {\
-            text-align: center;\
-            color: gray;\
-            cursor: pointer;\
-            margin-top: 5em;\
-        }\
-\
-        .clickForRefresh:hover {\
-            color: darkgray;\
-        }\
-\
-        .filetree-container {\
-            position: relative;\
-        }\
-\
-        .indexing-progress {\
-            width: 100%%;\
-            height: 100%%;\
-            position: absolute;\
-            top: 0;\
-            left: 0;\
-            opacity: 0.7;\
-            display: none;\
-        }\
-\
-        .refreshAction{\
-            text-align: right;\
-            font-size: 0.8em;\
-        }\
-\
-        .refreshAction:hover{\
-            cursor: pointer;\
-            color: darkgray;\
-        }\
-\
-        .overlay {\
-            z-index: 9;\
-            opacity: 0.8;\
-            background: #1a1919;\
-            height: 200px;\
-            display: none;\
-            width: 100%%;\
-        }\
-\
-        #SubTabContent.tab-content {\
-            display: flex;\
-        }\
-\
-        #SubTabContent.tab-content > .tab-pane {\
-            display: block; /* undo \"display: none;\" */\
-            visibility: hidden;\
-            margin-right: -100%%;\
-            width: 100%%;\
-        }\
-\
-        #SubTabContent.tab-content > .active {\
-            visibility: visible;\
-        }\
-\
-        /* IOS display fix */\
-        select {\
-            -webkit-appearance: none;\
-            -moz-appearance: none;\
-            appearance: none;\
-            background: url('data:image/png;base64,iVBORw0KGgoAAAANSUhEUgAAABkAAAAZCAAAAADhgtq/AAAACXBIWXMAAC4jAAAuIwF4pT92AAAAR0lEQVR4nGP5z4ADsOCSGOoyC+NRabjMQqjQQrgUTCYeIrQQyEI3DSyFJIHkApAUkgSy21B0oLo6fiGSBKp/kCUGU4hSRQYAYg0Rw+gGlUQAAAAASUVORK5CYII=') no-repeat;\
-            background-position: center right;\
-        }\
-    </style>\
-</head>\
-<body>\
-<nav class=\"navbar navbar-expand-sm bg-primary navbar-dark\">\
-    <div class=\"col-md-12\">\
-    <a class=\"float-left navbar-brand\">\
-        <img src=\"https://www.espuino.de/espuino/Espuino32.png\"\
-             width=\"35\" height=\"35\" class=\"d-inline-block align-top\" alt=\"\"/>\
-        ESPuino\
-    </a>\
-    <a class=\"reboot float-right nav-link\" href=\"/restart\"><i class=\"fas fa-redo\"></i> Restart</a>\
-    <a class=\"reboot float-right nav-link\" href=\"/shutdown\"><i class=\"fas fa-power-off\"></i> Shutdown</a>\
-    <a class=\"reboot float-right nav-link\" href=\"/log\"><i class=\"fas fa-book\"></i> Log</a>\
-    <a class=\"reboot float-right nav-link\" href=\"/info\"><i class=\"fas fa-info\"></i> Infos</a>\
-    </div>\
-</nav>\
-<br/>\
-    <nav>\
-        <div class=\"container nav nav-tabs\" id=\"nav-tab\" role=\"tablist\">\
-            <a class=\"nav-item nav-link\" id=\"nav-control-tab\" data-toggle=\"tab\" href=\"#nav-control\" role=\"tab\" aria-controls=\"nav-control\" aria-selected=\"false\"><i class=\"fas fa-gamepad\"></i><span class=\".d-sm-none .d-md-block\"> Control</span></a>\
-            <a class=\"nav-item nav-link active\" id=\"nav-rfid-tab\" data-toggle=\"tab\" href=\"#nav-rfid\" role=\"tab\" aria-controls=\"nav-rfid\" aria-selected=\"true\"><i class=\"fas fa-dot-circle\"></i> RFID</a>\
-            <a class=\"nav-item nav-link\" id=\"nav-wifi-tab\" data-toggle=\"tab\" href=\"#nav-wifi\" role=\"tab\" aria-controls=\"nav-wifi\" aria-selected=\"false\"><i class=\"fas fa-wifi\"></i><span class=\".d-sm-none .d-md-block\"> WiFi</span></a>\
-            %SHOW_MQTT_TAB%\
-            %SHOW_FTP_TAB%\
-            <a class=\"nav-item nav-link\" id=\"nav-general-tab\" data-toggle=\"tab\" href=\"#nav-general\" role=\"tab\" aria-controls=\"nav-general\" aria-selected=\"false\"><i class=\"fas fa-sliders-h\"></i> General</a>\
-            <a class=\"nav-item nav-link\" id=\"nav-tools-tab\" data-toggle=\"tab\" href=\"#nav-tools\" role=\"tab\" aria-controls=\"nav-tools\" aria-selected=\"false\"><i class=\"fas fa-wrench\"></i> Tools</a>\
-            <a class=\"nav-item nav-link\" id=\"nav-forum-tab\" data-toggle=\"tab\" href=\"#nav-forum\" role=\"tab\" aria-controls=\"nav-forum\" aria-selected=\"false\"><i class=\"fas fa-comment\"></i><span class=\".d-sm-none .d-md-block\"> Forum</span></a>\
-        </div>\
-    </nav>\
-<br>\
-<div class=\"tab-content\" id=\"nav-tabContent\">\
-    <div class=\"tab-pane fade\" id=\"nav-wifi\" role=\"tabpanel\" aria-labelledby=\"nav-wifi-tab\">\
-        <div class=\"container\" id=\"wifiConfig\">\
-            <form action=\"#wifiConfig\" method=\"POST\" onsubmit=\"wifiConfig('wifiConfig'); return false\">\
-                <div class=\"form-group col-md-12\">\
-                    <legend>WiFi-settings</legend>\
-                    <label for=\"ssid\">WiFi-name (SSID):</label>\
-                    <input type=\"text\" class=\"form-control\" id=\"ssid\" placeholder=\"SSID\" name=\"ssid\" required>\
-                    <div class=\"invalid-feedback\">\
-                        Enter WiFi's SSID.\
-                    </div>\
-                    <label for=\"pwd\">Password:</label>\
-                    <input type=\"password\" class=\"form-control\" id=\"pwd\" placeholder=\"Passwort\" name=\"pwd\" required>\
-                    <label for=\"hostname\">ESPuino-Name (Hostname):</label>\
-                    <input type=\"text\" class=\"form-control\" id=\"hostname\" placeholder=\"espuino\" name=\"hostname\"\
-                           value=\"%HOSTNAME%\" pattern=\"^[^-\\.]{2,32}\" required>\
-                </div>\
-                <br>\
-                <div class=\"text-center\">\
-                <button type=\"reset\" class=\"btn btn-secondary\">Reset</button>\
-                <button type=\"submit\" class=\"btn btn-primary\">Submit</button>\
-                </div>\
-            </form>\
-        </div>\
-    </div>\
-    <div class=\"tab-pane fade\" id=\"nav-control\" role=\"tabpanel\" aria-labelledby=\"nav-control-tab\">\
-        <div class=\"container\" id=\"navControl\">\
-                <div class=\"form-group col-md-12\">\
-                    <legend>Control</legend>\
-                    <div class=\"buttons\">\
-                        <button type=\"button\" class=\"btn btn-default btn-lg\" onclick=\"sendControl(173)\">\
-                            <span class=\"fas fa-fast-backward\"></span>\
-                        </button>\
-                        <button type=\"button\" class=\"btn btn-default btn-lg\" onclick=\"sendControl(171)\">\
-                            <span class=\"fas fa-backward\"></span>\
-                        </button>\
-                        <button type=\"button\" class=\"btn btn-default btn-lg\" onclick=\"sendControl(170)\">\
-                            <i class=\"fas fa-pause\"></i>\
-                        </button>\
-                        <button type=\"button\" class=\"btn btn-default btn-lg\" onclick=\"sendControl(172)\">\
-                            <span class=\"fas fa-forward\"></span>\
-                        </button>\
-                        <button type=\"button\" class=\"btn btn-default btn-lg\" onclick=\"sendControl(174)\">\
-                            <span class=\"fas fa-fast-forward\"></span>\
-                        </button>\
-                    </div>\
-                </div>\
-                <br>\
-                <div class=\"form-group col-md-12\">\
-                    <legend>Volume</legend>\
-                        <i class=\"fas fa-volume-down fa-2x .icon-pos\"></i> <input data-provide=\"slider\" type=\"number\" data-slider-min=\"1\" data-slider-max=\"21\" min=\"1\" max=\"21\" class=\"form-control\" id=\"setVolume\"\
-                            data-slider-value=\"%CURRENT_VOLUME%\" value=\"%CURRENT_VOLUME%\" onchange=\"sendVolume(this.value)\">  <i class=\"fas fa-volume-up fa-2x .icon-pos\"></i>\
-                </div>\
-                <br/>\
-                <div class=\"form-group col-md-12\">\
-                    <legend>Current track</legend>\
-                    <div id=\"track\"></div>\
-                </div>\
-        </div>\
-    </div>\
-    <div class=\"tab-pane fade show active\" id=\"nav-rfid\" role=\"tabpanel\" aria-labelledby=\"nav-rfid-tab\">\
-        <div class=\"container\" id=\"filetreeContainer\">\
-            <fieldset>\
-                <legend>Files</legend>\
-				<div class=\"filetree-container\">\
-				<div id=\"filebrowser\">\
-					<div class=\"filetree demo\" id=\"explorerTree\"></div>\
-				</div>\
-				<div>\
-					<form id=\"explorerUploadForm\" method=\"POST\" enctype=\"multipart/form-data\" action=\"/explorer\">\
-                        <div class=\"input-group\">\
-                            <span class=\"form-control\" id=\"uploaded_file_text\"></span>\
-                            <span class=\"input-group-btn\">\
-                                <span class=\"btn btn-secondary\" onclick=\"$(this).parent().find('input[type=file]').click();\">Browse</span>\
-                                <span class=\"btn btn-primary\" onclick=\"$(this).parent().find('input[type=file]').submit();\">Upload</span>\
-                                <input name=\"uploaded_file\" id =\"uploaded_file\" onchange=\"$(this).parent().parent().find('.form-control').html($(this).val().split(/[\\|/]/).pop());\" style=\"display: none;\" type=\"file\" multiple>\
-                            </span>\
-                        </div>\
-                    </form>\
-                    <br>\
-                    <div class=\"progress\">\
-                        <div id=\"explorerUploadProgress\" class=\"progress-bar\" role=\"progressbar\" ></div>\
-                    </div>\
-                </div>\
-                <br>\
-				</div>\
-            </fieldset>\
-        </div>\
-        <div class=\"container\" id=\"rfidMusicTags\">\
-            <fieldset>\
-                <legend>RFID-Assignments</legend>\
-            <form action=\"#rfidMusicTags\" method=\"POST\" onsubmit=\"rfidAssign('rfidMusicTags'); return false\">\
-                <div class=\"form-group col-md-12\">\
-                    <label for=\"rfidIdMusic\">RFID-number (12 digits)</label>\
-                    <input type=\"text\" class=\"form-control\" id=\"rfidIdMusic\" maxlength=\"12\" pattern=\"[0-9]{12}\"\
-                           placeholder=\"%RFID_TAG_ID%\" name=\"rfidIdMusic\" required>\
-                    <br>\
-                    <ul class=\"nav nav-tabs\" id=\"SubTab\" role=\"tablist\">\
-                        <li class=\"nav-item\">\
-                            <a class=\"nav-link active\" id=\"rfid-music-tab\" data-toggle=\"tab\" href=\"#rfidmusic\" role=\"tab\"><i class=\"fas fa-music\"></i> Musik</a>\
-                        </li>\
-                        <li class=\"nav-item\">\
-                            <a class=\"nav-link\" id=\"rfid-mod-tab\" data-toggle=\"tab\" href=\"#rfidmod\" role=\"tab\"><i class=\"fas fa-cog\"></i> Modifikation</a>\
-                        </li>\
-                    </ul>\
-                    <div class=\"tab-content\" id=\"SubTabContent\">\
-                        <div class=\"tab-pane show active\" id=\"rfidmusic\" role=\"tabpanel\">\
-                            <br>\
-                            <label for=\"fileOrUrl\">File, directory or URL (^ and # aren't allowed as chars)</label>\
-                            <input type=\"text\" class=\"form-control\" id=\"fileOrUrl\" maxlength=\"255\" placeholder=\"z.B. /mp3/Hoerspiele/Yakari/Yakari_und_seine_Freunde.mp3\" pattern=\"^[^\\^#]+$\" name=\"fileOrUrl\" required>\
-                            <label for=\"playMode\">Playmode</label>\
-                            <select class=\"form-control\" id=\"playMode\" name=\"playMode\">\
-                                <option class=\"placeholder\" disabled selected value=\"\">Select mode</option>\
-                                <option class=\"option-file\" value=\"1\">Single track</option>\
-                                <option class=\"option-file\" value=\"2\">Single track (loop)</option>\
-                                <option class=\"option-file-and-folder\" value=\"3\">Audiobook</option>\
-                                <option class=\"option-file-and-folder\" value=\"4\">Audiobook (loop)</option>\
-                                <option class=\"option-folder\" value=\"5\">All tracks of a directory (sorted alph.)</option>\
-                                <option class=\"option-folder\" value=\"6\">All tracks of a directory (random)</option>\
-                                <option class=\"option-folder\" value=\"7\">All tracks of a directory (sorted alph., loop)</option>\
-                                <option class=\"option-folder\" value=\"9\">All tracks of a directory (random, loop)</option>\
-                                <option class=\"option-stream\" value=\"8\">Webradio</option>\
-                                <option class=\"option-stream\" value=\"11\">List (files from SD and/or webstreams) from local .m3u-File</option>\
-                            </select>\
-                        </div>\
-                        <div class=\"tab-pane \" id=\"rfidmod\" role=\"tabpanel\">\
-                            <label for=\"modId\"></label>\
-                            <select class=\"form-control\" id=\"modId\" name=\"modId\">\
-                                <option class=\"placeholder\" disabled selected value=\"\">Select modification</option>\
-                                <option value=\"100\">Keylock</option>\
-                                <option value=\"101\">Sleep after 15 minutes</option>\
-                                <option value=\"102\">Sleep after 30 minutes</option>\
-                                <option value=\"103\">Sleep after 1 hour</option>\
-                                <option value=\"104\">Sleep after 2 hours</option>\
-                                <option value=\"105\">Sleep after end of track</option>\
-                                <option value=\"106\">Sleep after end of playlist</option>\
-                                <option value=\"107\">Sleep after end of five tracks</option>\
-                                <option value=\"110\">Loop playlist</option>\
-                                <option value=\"111\">Loop track</option>\
-                                <option value=\"120\">Dimm LEDs (nightmode)</option>\
-                                <option value=\"130\">Toggle WiFi</option>\
-                                <option value=\"140\">Toggle Bluetooth</option>\
-                                <option value=\"150\">Enable FTP</option>\
-                                <option value=\"0\">Remove assignment</option>\
-                            </select>\
-                        </div>\
-                    </div>\
-                </div>\
-                <br>\
-                <div class=\"text-center\">\
-                <button type=\"reset\" class=\"btn btn-secondary\">Reset</button>\
-                <button type=\"submit\" class=\"btn btn-primary\">Submit</button>\
-                </div>\
-            </form>\
-            </fieldset>\
-        </div>\
-        <br />\
-    </div>\
-    <div class=\"tab-pane fade\" id=\"nav-mqtt\" role=\"tabpanel\" aria-labelledby=\"nav-mqtt-tab\">\
-        <div class=\"container\" id=\"mqttConfig\">\
-\
-            <form class=\"needs-validation\" action=\"#mqttConfig\" method=\"POST\"\
-                  onsubmit=\"mqttSettings('mqttConfig'); return false\">\
-                <div class=\"form-check col-md-12\">\
-                    <legend>MQTT-settings</legend>\
-                    <input class=\"form-check-input\" type=\"checkbox\" value=\"1\" id=\"mqttEnable\" name=\"mqttEnable\" %MQTT_ENABLE%>\
-                    <label class=\"form-check-label\" for=\"mqttEnable\">\
-                        Enable MQTT\
-                    </label>\
-                </div>\
-                <div class=\"form-group my-2 col-md-12\">\
-                    <label for=\"mqttServer\">MQTT-server</label>\
-                    <input type=\"text\" class=\"form-control\" id=\"mqttServer\" minlength=\"7\" maxlength=\"%MQTT_SERVER_LENGTH%\"\
-                           placeholder=\"z.B. 192.168.2.89\" name=\"mqttServer\" value=\"%MQTT_SERVER%\">\
-                    <label for=\"mqttUser\">MQTT-username (optional):</label>\
-                    <input type=\"text\" class=\"form-control\" id=\"mqttUser\" maxlength=\"%MQTT_USER_LENGTH%\"\
-                           placeholder=\"Benutzername\" name=\"mqttUser\" value=\"%MQTT_USER%\">\
-                    <label for=\"mqttPwd\">MQTT-password (optional):</label>\
-                    <input type=\"password\" class=\"form-control\" id=\"mqttPwd\" maxlength=\"%MQTT_PWD_LENGTH%\"\
-                           placeholder=\"Passwort\" name=\"mqttPwd\" value=\"%MQTT_PWD%\">\
-                    <label for=\"mqttPort\">MQTT-port:</label>\
-                    <input type=\"number\" class=\"form-control\" id=\"mqttPort\" min=\"1\" max=\"65535\"\
-                            placeholder=\"Port\" name=\"mqttPort\" value=\"%MQTT_PORT%\" required>\
-                </div>\
-                <br>\
-                <div class=\"text-center\">\
-                <button type=\"reset\" class=\"btn btn-secondary\">Reset</button>\
-                <button type=\"submit\" class=\"btn btn-primary\">Submit</button>\
-                </div>\
-            </form>\
-        </div>\
-    </div>\
-    <div class=\"tab-pane fade\" id=\"nav-ftp\" role=\"tabpanel\" aria-labelledby=\"nav-ftp-tab\">\
-        <div class=\"container\" id=\"ftpConfig\">\
-\
-            <form action=\"#ftpConfig\" method=\"POST\" onsubmit=\"ftpSettings('ftpConfig'); return false\">\
-                <div class=\"form-group col-md-12\">\
-                    <legend>FTP-settings</legend>\
-                    <label for=\"ftpUser\">FTP-username:</label>\
-                    <input type=\"text\" class=\"form-control\" id=\"ftpUser\" maxlength=\"%FTP_USER_LENGTH%\"\
-                           placeholder=\"Benutzername\" name=\"ftpUser\" value=\"%FTP_USER%\" required>\
-                    <label for=\"pwd\">FTP-password:</label>\
-                    <input type=\"password\" class=\"form-control\" id=\"ftpPwd\" maxlength=\"%FTP_PWD_LENGTH%\" placeholder=\"Passwort\"\
-                           name=\"ftpPwd\" value=\"%FTP_PWD%\" required>\
-                </div>\
-                <br>\
-                <div class=\"text-center\">\
-                <button type=\"reset\" class=\"btn btn-secondary\">Reset</button>\
-                <button type=\"submit\" class=\"btn btn-primary\">Submit</button>\
-                </div>\
-            </form>\
-        </div>\
-    </div>\
-\
-    <div class=\"tab-pane fade\" id=\"nav-general\" role=\"tabpanel\" aria-labelledby=\"nav-general-tab\">\
-        <div class=\"container\" id=\"generalConfig\">\
-\
-            <form action=\"#generalConfig\" method=\"POST\" onsubmit=\"genSettings('generalConfig'); return false\">\
-                    <div class=\"form-group col-md-12\">\
-                    <fieldset>\
-                            <legend class=\"w-auto\">Volume</legend>\
-                    <label for=\"initialVolume\">After restart</label>\
-                        <div class=\"text-center\">\
-                    <i class=\"fas fa-volume-down fa-2x .icon-pos\"></i> <input data-provide=\"slider\" type=\"number\" data-slider-min=\"1\" data-slider-max=\"21\" min=\"1\" max=\"21\" class=\"form-control\" id=\"initialVolume\" name=\"initialVolume\"\
-                        data-slider-value=\"%INIT_VOLUME%\"  value=\"%INIT_VOLUME%\" required>  <i class=\"fas fa-volume-up fa-2x .icon-pos\"></i></div>\
-                        <br>\
-                    <label for=\"maxVolumeSpeaker\">Max. volume (speaker)</label>\
-                        <div class=\"text-center\">\
-                     <i class=\"fas fa-volume-down fa-2x .icon-pos\"></i>   <input data-provide=\"slider\" type=\"number\" data-slider-min=\"1\" data-slider-max=\"21\" min=\"1\" max=\"21\" class=\"form-control\" id=\"maxVolumeSpeaker\" name=\"maxVolumeSpeaker\"\
-                        data-slider-value=\"%MAX_VOLUME_SPEAKER%\"  value=\"%MAX_VOLUME_SPEAKER%\" required>  <i class=\"fas fa-volume-up fa-2x .icon-pos\"></i>\
-                        </div>\
-                        <br>\
-                    <label for=\"maxVolumeHeadphone\">Max. volume (headphones)</label>\
-                        <div class=\"text-center\">\
-                    <i class=\"fas fa-volume-down fa-2x .icon-pos\"></i> <input data-provide=\"slider\" type=\"number\" data-slider-min=\"1\" data-slider-max=\"21\" min=\"1\" max=\"21\" class=\"form-control\" id=\"maxVolumeHeadphone\" name=\"maxVolumeHeadphone\"\
-                         data-slider-value=\"%MAX_VOLUME_HEADPHONE%\" value=\"%MAX_VOLUME_HEADPHONE%\" required>  <i class=\"fas fa-volume-up fa-2x .icon-pos\"></i>\
-                        </div>\
-                </fieldset>\
-                </div>\
-                <br>\
-                <div class=\"form-group col-md-12\">\
-                    <fieldset >\
-                        <legend class=\"w-auto\">Neopixel (brightness)</legend>\
-                    <label for=\"initBrightness\">After restart:</label>\
-                        <div class=\"text-center\">\
-                            <i class=\"far fa-sun fa-2x .icon-pos\"></i>\
-                        <input data-provide=\"slider\" type=\"number\" data-slider-min=\"0\" data-slider-max=\"255\" min=\"0\" max=\"255\" class=\"form-control\" id=\"initBrightness\" name=\"initBrightness\"\
-                               data-slider-value=\"%INIT_LED_BRIGHTNESS%\"  value=\"%INIT_LED_BRIGHTNESS%\" required><i class=\"fas fa-sun fa-2x .icon-pos\"></i>\
-                        </div>\
-\
-                    <label for=\"nightBrightness\">For nightmode:</label>\
-                        <div class=\"text-center\">\
-                        <i class=\"far fa-sun fa-2x .icon-pos\"></i><input data-provide=\"slider\" type=\"number\" data-slider-min=\"0\" data-slider-max=\"255\" min=\"0\" max=\"255\" class=\"form-control\" id=\"nightBrightness\" name=\"nightBrightness\" data-slider-value=\"%NIGHT_LED_BRIGHTNESS%\" value=\"%NIGHT_LED_BRIGHTNESS%\" required><i class=\"fas fa-sun fa-2x .icon-pos\"></i>\
-                        </div>\
-                    </fieldset>\
-                </div>\
-<br>\
-                <div class=\"form-group col-md-12\">\
-                    <fieldset>\
-                        <legend>Deep Sleep</legend>\
-\
-                        <label for=\"inactivityTime\">After n minutes inactivity</label>\
-                        <div class=\"text-center\"><i class=\"fas fa-hourglass-start fa-2x .icon-pos\"></i> <input type=\"number\" data-provide=\"slider\" data-slider-min=\"0\" data-slider-max=\"30\" min=\"1\" max=\"120\" class=\"form-control\" id=\"inactivityTime\" name=\"inactivityTime\"\
-                         data-slider-value=\"%MAX_INACTIVITY%\"  value=\"%MAX_INACTIVITY%\" required><i class=\"fas fa-hourglass-end fa-2x .icon-pos\"></i></div>\
-                    </fieldset>\
-                </div>\
-<br>\
-\
-                <div class=\"form-group col-md-12\">\
-                    <fieldset>\
-                        <legend>Battery</legend>\
-                    <div>Show voltage-status via Neopixel</div>\
-                        <br>\
-                    <label for=\"warningLowVoltage\">Show warning below this threshold.\
-                    </label>\
-                        <div class=\"text-center\">\
-                        <i class=\"fas fa-battery-quarter fa-2x .icon-pos\"></i> <input  data-provide=\"slider\"  data-slider-step=\"0.1\" data-slider-min=\"3.0\" data-slider-max=\"5.0\"  min=\"3.0\" max=\"5.0\" type=\"text\" class=\"form-control\" id=\"warningLowVoltage\" name=\"warningLowVoltage\"\
-                        data-slider-value=\"%WARNING_LOW_VOLTAGE%\" value=\"%WARNING_LOW_VOLTAGE%\" pattern=\"^\\d{1,2}(\\.\\d{1,3})?\" required> <i class=\"fas fa-battery-three-quarters fa-2x .icon-pos\" fa-2x .icon-pos></i>\
-                        </div>\
-<br>\
-                    <label for=\"voltageIndicatorLow\">Lowest voltage, that is indicated by one LED\
-                        </label>\
-                        <div class=\"text-center\">\
-                        <i class=\"fas fa-battery-quarter fa-2x .icon-pos\"></i> <input data-provide=\"slider\" min=\"2.0\" data-slider-step=\"0.1\" data-slider-min=\"2.0\" data-slider-max=\"5.0\" max=\"5.0\" type=\"text\" class=\"form-control\" id=\"voltageIndicatorLow\" name=\"voltageIndicatorLow\"\
-                          data-slider-value=\"%VOLTAGE_INDICATOR_LOW%\"  value=\"%VOLTAGE_INDICATOR_LOW%\" pattern=\"^\\d{1,2}(\\.\\d{1,3})?\" required> <i class=\"fas fa-battery-three-quarters fa-2x .icon-pos\" fa-2x .icon-pos></i>\
-                        </div>\
-                        <br>\
-                        <label for=\"voltageIndicatorHigh\">Voltage that is indicated by all LEDs</label>\
-\
-                            <div class=\"text-center\">\
-                                <i class=\"fas fa-battery-quarter fa-2x .icon-pos\"></i><input data-provide=\"slider\" data-slider-step=\"0.1\"  data-slider-min=\"2.0\" data-slider-max=\"5.0\" min=\"2.0\" max=\"5.0\" type=\"text\" class=\"form-control\" id=\"voltageIndicatorHigh\" name=\"voltageIndicatorHigh\"\
-                           data-slider-value=\"%VOLTAGE_INDICATOR_HIGH%\"  value=\"%VOLTAGE_INDICATOR_HIGH%\" pattern=\"^\\d{1,2}(\\.\\d{1,3})?\" required> <i class=\"fas fa-battery-three-quarters fa-2x .icon-pos\" fa-2x .icon-pos></i>\
-                        </div>\
-\
-                        <br>\
-                    <label for=\"voltageCheckInterval\">Interval between measurements (in minutes)</label>\
-                        <div class=\"text-center\"><i class=\"fas fa-hourglass-start fa-2x .icon-pos\"></i>\
-                            <input data-provide=\"slider\" data-slider-min=\"1\" data-slider-max=\"60\" type=\"number\" min=\"1\" max=\"60\" class=\"form-control\" id=\"voltageCheckInterval\"\
-                                   data-slider-value=\"%VOLTAGE_CHECK_INTERVAL%\"  name=\"voltageCheckInterval\" value=\"%VOLTAGE_CHECK_INTERVAL%\" required><i class=\"fas fa-hourglass-end fa-2x .icon-pos\"></i>\
-                    </div>\
-\
-                    </fieldset>\
-                </div>\
-<br>\
-                <div class=\"text-center\">\
-                <button type=\"reset\" class=\"btn btn-secondary\">Reset</button>\
-                <button type=\"submit\" class=\"btn btn-primary\">Submit</button>\
-                </div>\
-            </form>\
-        </div>\
-        <br />\
-    </div>\
-    <div class=\"tab-pane fade\" id=\"nav-tools\" role=\"tabpanel\" aria-labelledby=\"nav-tools-tab\">\
-        <div class=\"container\" id=\"eraseNvs\">\
-            <legend>Erase NVS RFID-assignments</legend>\
-            <form action=\"/rfidnvserase\" enctype=\"multipart/form-data\" method=\"GET\">\
-                <div class=\"form-group\">\
-                    <p>Via importer new entries will only be inserted but old ones won't be erased. Only in case an old assignment to the same entry already exists, it will be overwritten. With this function all existing rfid-assignments will be erased. Further <a href=\"https://forum.espuino.de/t/die-backupfunktion-des-espuino/508\" target=\"_blank\">infos</a> in German language.</p>\
-                </div>\
-                <button type=\"submit\" class=\"btn btn-primary\">Delete assignments</button>\
-            </form>\
-        </div>\
-        <br />\
-        <br />\
-        <div class=\"container\" id=\"importNvs\">\
-            <legend>NVS RFID-Importer</legend>\
-            <form action=\"/upload\" enctype=\"multipart/form-data\" method=\"POST\">\
-                <div class=\"form-group\">\
-                    <label for=\"nvsUpload\">Backupfile can be uploaded right here in order to import NVS-RFID-assignments.</label>\
-                    <input type=\"file\" class=\"form-control-file\" id=\"nvsUpload\" name=\"nvsUpload\" accept=\".txt\">\
-                </div>\
-                <button type=\"submit\" class=\"btn btn-primary\">Submit</button>\
-            </form>\
-        </div>\
-        <br />\
-        <br />\
-        <div class=\"container\" id=\"httpUpdate\">\
-            <legend>Firmware-Update</legend>\
-            <form action=\"/update\" enctype=\"multipart/form-data\" method=\"POST\">\
-                <div class=\"form-group\">\
-                    <label for=\"firmwareUpload\">Firmware can be updated right here.</label>\
-                    <input type=\"file\" class=\"form-control-file\" id=\"firmwareUpload\" name=\"firmwareUpload\" accept=\".bin\">\
-                </div>\
-                <button type=\"submit\" class=\"btn btn-primary\">Submit</button>\
-            </form>\
-        </div>\
-    </div>\
-    <br />\
-    <br />\
-    <div class=\"tab-pane fade\" id=\"nav-forum\" role=\"tabpanel\" aria-labelledby=\"nav-forum-tab\">\
-        <div class=\"container\" id=\"forum\">\
-            <legend>Forum</legend>\
-            <p>Having problems or aim to discuss about ESPuino?<br />\
-                Join us at <a href=\"https://forum.espuino.de\" target=\"_blank\">ESPuino-Forum</a>! Especially there's a lot of (german)<br />\
-                <a href=\"https://forum.espuino.de/c/dokumentation/anleitungen/10\" target=\"_blank\">documentation</a> online!\
-            </p>\
-        </div>\
-    </div>\
-</div>\
-<script type=\"text/javascript\">\
-    var DEBUG = false;\
-    var lastIdclicked = '';\
-    var ActiveSubTab = 'rfid-music-tab';\
-    var host = $(location).attr('hostname');\
-\
-    /* show active / selected tab */\
-    $('#SubTab.nav-tabs a').on('shown.bs.tab', function (e) {\
-        ActiveSubTab = $(e.target).attr('id');\
-        console.log ( ActiveSubTab);\
-        if (ActiveSubTab == 'rfid-music-tab') {\
-            document.getElementById(\"fileOrUrl\").required = true;\
-        } else {\
-            document.getElementById(\"fileOrUrl\").required = false;\
-        }\
-});\
-\
-    if (DEBUG) {\
-        host = \"192.168.178.114\";\
-    }\
-\
-    toastr.options = {\
-        \"closeButton\": false,\
-        \"debug\": false,\
-        \"newestOnTop\": false,\
-        \"progressBar\": false,\
-        \"positionClass\": \"toast-top-right\",\
-        \"preventDuplicates\": false,\
-        \"onclick\": null,\
-        \"showDuration\": \"300\",\
-        \"hideDuration\": \"1000\",\
-        \"timeOut\": \"5000\",\
-        \"extendedTimeOut\": \"1000\",\
-        \"showEasing\": \"swing\",\
-        \"hideEasing\": \"linear\",\
-        \"showMethod\": \"fadeIn\",\
-        \"hideMethod\": \"fadeOut\",\
-        \"preventDuplicates\": true,\
-        \"preventOpenDuplicates\": true\
-    };\
-\
-    function postRendering(event, data) {\
-        Object.keys(data.instance._model.data).forEach(function (key, index) {\
-\
-            var cur = data.instance.get_node(data.instance._model.data[key]);\
-            var lastFolder = cur['id'].split('/').filter(function (el) {\
-                return el.trim().length > 0;\
-            }).pop();\
-            if ((/\\.(mp3|MP3|ogg|wav|WAV|OGG|wma|WMA|acc|ACC|flac|FLAC|m4a|M4A)$/i).test(lastFolder)) {\
-                data.instance.set_type(data.instance._model.data[key], 'audio');\
-            } else {\
-                if (data.instance._model.data[key]['type'] == \"file\") {\
-                    data.instance.disable_node(data.instance._model.data[key]);\
-                }\
-            }\
-            data.instance.rename_node(data.instance._model.data[key], lastFolder);\
-        });\
-    }\
-\
-    /* File Explorer functions begin*/\
-    var lastSelectedNodePath = \"\";\
-\
-    $('#explorerTree').on('select_node.jstree', function (e, data) {\
-\
-        $('input[name=fileOrUrl]').val(data.node.data.path);\
-\
-        if (ActiveSubTab !== 'rfid-music-tab') {\
-            $('#SubTab.nav-tabs a[id=\"rfid-music-tab\"]').tab('show');\
-        }\
-\
-        if (data.node.type == \"folder\") {\
-            $('.option-folder').show();\
-            $('.option-file').hide();\
-            $('#playMode option').removeAttr('selected').filter('[value=3]').attr('selected', true);\
-        }\
-\
-        if (data.node.type == \"audio\") {\
-            $('.option-file').show();\
-            $('.option-folder').hide();\
-            $('#playMode option').removeAttr('selected').filter('[value=1]').attr('selected', true);\
-        }\
-\
-        if(lastSelectedNodePath != data.node.data.path) {\
-            if (data.node.data.directory) {\
-\
-                var ref = $('#explorerTree').jstree(true),\
-                    sel = ref.get_selected();\
-                if(!sel.length) { return false; }\
-                sel = sel[0];\
-                var children = $(\"#explorerTree\").jstree(\"get_children_dom\",sel);\
-                /* refresh only, when there is no child -> possible not yet updated */\
-                if(children.length < 1){\
-                    refreshNode(sel);\
-                }\
-\
-            }\
-         lastSelectedNodePath = data.node.data.path;\
-        }\
-\
-\
-    });\
-\
-	function doRest(path, callback, obj) {\
-		obj.url      = path;\
-		obj.dataType = \"json\";\
-		obj.contentType= \"application/json;charset=IBM437\",\
-        obj.scriptCharset= \"IBM437\",\
-        obj.success  = function(data, textStatus, jqXHR) {\
-			if (callback) {\
-				callback(data);\
-			}\
-		};\
-		obj.error    = function(jqXHR, textStatus, errorThrown) {\
-			console.log(\"AJAX error\");\
-			/*debugger; */\
-		};\
-		jQuery.ajax(obj);\
-	} /* doRest */\
-\
-	function getData(path, callback) {\
-		doRest(path, callback, {\
-			method   : \"GET\"\
-		});\
-	} /* getData */\
-\
-	function deleteData(path, callback, _data) {\
-		doRest(path, callback, {\
-			method   : \"DELETE\",\
-			data: _data\
-		});\
-	} /* deleteData */\
-\
-	function patchData(path, callback, _data) {\
-		doRest(path, callback, {\
-			method   : \"PATCH\",\
-			data: _data\
-		});\
-	} /* patchData */\
-\
-	function postData(path, callback, _data) {\
-		doRest(path, callback, {\
-			method   : \"POST\",\
-			data: _data\
-		});\
-	} /* postData */\
-\
-\
-	function putData(path, callback, _data) {\
-		doRest(path, callback, {\
-			method   : \"PUT\",\
-			data: _data\
-		});\
-	} /* putData */\
-\
-\
-	/* File Upload */\
-	$('#explorerUploadForm').submit(function(e){\
-		e.preventDefault();\
-		console.log(\"Upload!\");\
-		var data = new FormData(this);\
-\
-		var ref = $('#explorerTree').jstree(true),\
-			sel = ref.get_selected(),\
-			path = \"/\";\
-        if(!sel.length) { alert(\"Please select the upload location!\");return false; }\
-        if(!document.getElementById('uploaded_file').files.length > 0) { alert(\"Please select files to upload!\");return false; }\
-		sel = sel[0];\
-		selectedNode = ref.get_node(sel);\
-		if(selectedNode.data.directory){\
-			path = selectedNode.data.path\
-		} else {\
-			/* remap sel to parent folder */\
-			sel = ref.get_node(ref.get_parent(sel));\
-			path = parentNode.data.path;\
-			console.log(\"Parent path: \" + path);\
-		}\
-\
-		$.ajax({\
-			url: '/explorer?path=' + path,\
-            type: 'POST',\
-            data: data,\
-            contentType: false,\
-            processData:false,\
-			xhr: function() {\
-				var xhr = new window.XMLHttpRequest();\
-\
-				xhr.upload.addEventListener(\"progress\", function(evt) {\
-				  if (evt.lengthComputable) {\
-					var percentComplete = evt.loaded / evt.total;\
-					percentComplete = parseInt(percentComplete * 100);\
-                    console.log(percentComplete);\
-                    var percent = percentComplete + '%';\
-                    $(\"#explorerUploadProgress\").css('width', percent).text(percent);\
-				  }\
-				}, false);\
-\
-				return xhr;\
-			},\
-			success: function(data, textStatus, jqXHR) {\
-                console.log(\"Upload success!\");\
-                $(\"#explorerUploadProgress\").text(\"Upload success!\");\
-                document.getElementById('uploaded_file').value = '';\
-                document.getElementById('uploaded_file_text').innerHTML = '';\
-\
-				getData(\"/explorer?path=\" + path, function(data) {\
-					/* We now have data! */\
-					deleteChildrenNodes(sel);\
-					addFileDirectory(sel, data);\
-					ref.open_node(sel);\
-\
-\
-				});\
-\
-			}\
-        });\
-	});\
-\
-	/* File Delete */\
-	function handleDeleteData(nodeId) {\
-		var ref = $('#explorerTree').jstree(true);\
-		var node = ref.get_node(nodeId);\
-		console.log(\"call delete request: \" + node.data.path);\
-		deleteData(\"/explorer?path=\" + node.data.path);\
-	}\
-\
-	function fileNameSort( a, b ) {\
-		if ( a.dir && !b.dir ) {\
-			return -1\
-		}\
-		if ( !a.dir && b.dir ) {\
-			return 1\
-		}\
-		if ( a.name < b.name ){\
-			return -1;\
-		}\
-		if ( a.name > b.name ){\
-			return 1;\
-		}\
-		return 0;\
-	}\
-\
-	function createChild(nodeId, data) {\
-		var ref = $('#explorerTree').jstree(true);\
-		var node = ref.get_node(nodeId);\
-		var parentNodePath = node.data.path;\
-		/* In case of root node remove leading '/' to avoid '//' */\
-		if(parentNodePath == \"/\"){\
-			parentNodePath = \"\";\
-		}\
-		var child = {\
-			text: data.name,\
-			type: getType(data),\
-			data: {\
-				path: parentNodePath + \"/\" + data.name,\
-				directory: data.dir\
-			}\
-		};\
-\
-		return child;\
-\
-	}\
-\
-	function deleteChildrenNodes(nodeId) {\
-		var ref = $('#explorerTree').jstree(true);\
-		var children = $(\"#explorerTree\").jstree(\"get_children_dom\",nodeId);\
-		for(var i=0;i<children.length;i++)\
-		{\
-			ref.delete_node(children[i].id);\
-		}\
-\
-	}\
-\
-	function refreshNode(nodeId) {\
-\
-		var ref = $('#explorerTree').jstree(true);\
-\
-		var node = ref.get_node(nodeId);\
-\
-		getData(\"/explorer?path=\" + node.data.path, function(data) {\
-			/* We now have data! */\
-\
-			deleteChildrenNodes(nodeId);\
-			addFileDirectory(nodeId, data);\
-			ref.open_node(nodeId);\
-\
-		});\
-\
-\
-	}\
-\
-	function getType(data) {\
-		var type = \"\";\
-\
-		if(data.dir) {\
-			type = \"folder\";\
-		} else if ((/\\.(mp3|MP3|ogg|wav|WAV|OGG|wma|WMA|acc|ACC|flac|FLAC)$/i).test(data.name)) {\
-			type = \"audio\";\
-		} else {\
-			type = \"file\";\
-		}\
-\
-		return type;\
-	}\
-\
-\
-	function addFileDirectory(parent, data) {\
-\
-		data.sort( fileNameSort );\
-		var ref = $('#explorerTree').jstree(true);\
-\
-		for (var i=0; i<data.length; i++) {\
-			console.log(\"Create Node\");\
-			ref.create_node(parent, createChild(parent, data[i]));\
-		}\
-	} /* addFileDirectory */\
-\
-	function buildFileSystemTree(path) {\
-\
-		$('#explorerTree').jstree({\
-				\"core\" : {\
-						\"check_callback\" : true,\
-						'force_text' : true,\
-						\"themes\" : { \"stripes\" : true },\
-						'data' : {	text: '/',\
-									state: {\
-										opened: true\
-									},\
-									type: 'folder',\
-									children: [],\
-									data: {\
-										path: '/',\
-										directory: true\
-								}}\
-					},\
-					'types': {\
-						'folder': {\
-							'icon': \"fa fa-folder\"\
-						},\
-						'file': {\
-							'icon': \"fa fa-file\"\
-						},\
-						'audio': {\
-							'icon': \"fa fa-file-audio\"\
-						},\
-						'default': {\
-							'icon': \"fa fa-folder\"\
-						}\
-					},\
-				plugins: [\"contextmenu\", \"themes\", \"types\"],\
-				contextmenu: {\
-					items: function(nodeId) {\
-						var ref = $('#explorerTree').jstree(true);\
-						var node = ref.get_node(nodeId);\
-						var items = {};\
-\
-\
-						if (node.data.directory) {\
-							items.createDir = {\
-								label: \"New folder\",\
-								action: function(x) {\
-									var childNode = ref.create_node(nodeId, {text: \"New folder\", type: \"folder\"});\
-									if(childNode) {\
-										ref.edit(childNode, null, function(childNode, status){\
-											putData(\"/explorer?path=\" + node.data.path + \"/\" + childNode.text);\
-											refreshNode(nodeId);\
-										});\
-									}\
-								}\
-							};\
-						}\
-\
-						/* Play */\
-						items.play = {\
-							label: \"Play\",\
-							action: function(x) {\
-								var playMode = node.data.directory?\"5\":\"1\";\
-								postData(\"/exploreraudio?path=\" + node.data.path + \"&playmode=\" + playMode);\
-							}\
-						};\
-\
-						/* Refresh */\
-						items.refresh = {\
-							label: \"Refresh\",\
-							action: function(x) {\
-								refreshNode(nodeId);\
-							}\
-						};\
-\
-						/* Delete */\
-						items.delete = {\
-							label: \"Delete\",\
-							action: function(x) {\
-								handleDeleteData(nodeId);\
-								refreshNode(ref.get_parent(nodeId));\
-							}\
-						};\
-\
-						/* Rename */\
-						items.rename = {\
-							label: \"Rename\",\
-							action: function(x) {\
-								var srcPath = node.data.path;\
-								ref.edit(nodeId, null, function(node, status){\
-									node.data.path = node.data.path.substring(0,node.data.path.lastIndexOf(\"/\")+1) + node.text;\
-									patchData(\"/explorer?srcpath=\" + srcPath + \"&dstpath=\" + node.data.path);\
-									refreshNode(ref.get_parent(nodeId));\
-								});\
-							}\
-						};\
-\
-					   return items;\
-					}\
-				}\
-			});\
-\
-		if (path.length == 0) {\
-			return;\
-		}\
-		getData(\"/explorer?path=/\", function(data) {\
-			/* We now have data! */\
-			$('#explorerTree').jstree(true).settings.core.data.children = [];\
-\
-			data.sort( fileNameSort );\
-\
-\
-			for (var i=0; i<data.length; i++) {\
-				var newChild = {\
-					text: data[i].name,\
-					type: getType(data[i]),\
-					data: {\
-						path: \"/\" + data[i].name,\
-						directory: data[i].dir\
-					},\
-					children: []\
-				};\
-				$('#explorerTree').jstree(true).settings.core.data.children.push(newChild);\
-			}\
-\
-			$(\"#explorerTree\").jstree(true).refresh();\
-\
-\
-		});\
-	} /* buildFileSystemTree */\
-\
-    /* File Explorer functions end */\
-\
-    var socket = undefined;\
-    var tm;\
-\
-    function connect() {\
-        socket = new WebSocket(\"ws://\" + host + \"/ws\");\
-\
-        socket.onopen = function () {\
-            setInterval(ping, 15000);\
-            getTrack();\
-        };\
-\
-        socket.onclose = function (e) {\
-            console.log('Socket is closed. Reconnect will be attempted in 5 seconds.', e.reason);\
-            socket = null;\
-            setTimeout(function () {\
-                connect();\
-            }, 5000);\
-        };\
-\
-        socket.onerror = function (err) {\
-            console.error('Socket encountered error: ', err.message, 'Closing socket');\
-        };\
-\
-        socket.onmessage = function(event) {\
-          console.log(event.data);\
-          var socketMsg = JSON.parse(event.data);\
-          if (socketMsg.rfidId != null) {\
-              document.getElementById('rfidIdMusic').value = socketMsg.rfidId;\
-              toastr.info(\"RFID-tag \"+ socketMsg.rfidId + \" detected.\" );\
-              $(\"#rfidIdMusic\").effect(\"highlight\", {color:\"#abf5af\"}, 3000);\
-          } if (\"status\" in socketMsg) {\
-              if (socketMsg.status == \"ok\") {\
-                  toastr.success(\"Action performed successfully.\" );\
-              }\
-          } if (\"pong\" in socketMsg) {\
-              if (socketMsg.pong == 'pong') {\
-                  pong();\
-              }\
-            } if (\"track\" in socketMsg) {\
-                document.getElementById('track').innerHTML = socketMsg.track;\
-          }\
-      };\
-    }\
-\
-    function ping() {\
-        var myObj = {\
-            \"ping\": {\
-                ping: 'ping'\
-            }\
-        };\
-        var myJSON = JSON.stringify(myObj);\
-        socket.send(myJSON);\
-        tm = setTimeout(function () {\
-            toastr.warning('Connection to ESPuino broken! Please reload website.');\
-        }, 5000);\
-    }\
-\
-    function pong() {\
-        clearTimeout(tm);\
-    }\
-\
-    function getTrack() {\
-        var myObj = {\
-            \"getTrack\": {\
-                getTrack: 'getTrack'\
-            }\
-        };\
-        var myJSON = JSON.stringify(myObj);\
-        socket.send(myJSON);\
-    }\
-\
-    function genSettings(clickedId) {\
-        lastIdclicked = clickedId;\
-        var myObj = {\
-            \"general\": {\
-                iVol: document.getElementById('initialVolume').value,\
-                mVolSpeaker: document.getElementById('maxVolumeSpeaker').value,\
-                mVolHeadphone: document.getElementById('maxVolumeHeadphone').value,\
-                iBright: document.getElementById('initBrightness').value,\
-                nBright: document.getElementById('nightBrightness').value,\
-                iTime: document.getElementById('inactivityTime').value,\
-                vWarning: document.getElementById('warningLowVoltage').value,\
-                vIndLow: document.getElementById('voltageIndicatorLow').value,\
-                vIndHi: document.getElementById('voltageIndicatorHigh').value,\
-                vInt: document.getElementById('voltageCheckInterval').value\
-            }\
-        };\
-        var myJSON = JSON.stringify(myObj);\
-        socket.send(myJSON);\
-    }\
-\
-    function ftpSettings(clickedId) {\
-        lastIdclicked = clickedId;\
-        var myObj = {\
-            \"ftp\": {\
-                ftpUser: document.getElementById('ftpUser').value,\
-                ftpPwd: document.getElementById('ftpPwd').value\
-            }\
-        };\
-        var myJSON = JSON.stringify(myObj);\
-        socket.send(myJSON);\
-    }\
-\
-    function mqttSettings(clickedId) {\
-        lastIdclicked = clickedId;\
-        var val;\
-        if (document.getElementById('mqttEnable').checked) {\
-            val = document.getElementById('mqttEnable').value;\
-        } else {\
-            val = 0;\
-        }\
-        var myObj = {\
-            \"mqtt\": {\
-                mqttEnable: val,\
-                mqttServer: document.getElementById('mqttServer').value,\
-                mqttUser: document.getElementById('mqttUser').value,\
-                mqttPwd: document.getElementById('mqttPwd').value,\
-                mqttPort: document.getElementById('mqttPort').value\
-            }\
-        };\
-        var myJSON = JSON.stringify(myObj);\
-        socket.send(myJSON);\
-    }\
-\
-    function removeTrSlash(str) {\
-        if (str.substr(-1) === '/') {\
-            return str.substr(0, str.length - 1);\
-        }\
-        return str;\
-    }\
-\
-    function rfidAssign(clickedId) {\
-        lastIdclicked = clickedId;\
-        if (ActiveSubTab == 'rfid-music-tab') {\
-            var myObj = {\
-                \"rfidAssign\": {\
-                    rfidIdMusic: document.getElementById('rfidIdMusic').value,\
-                    fileOrUrl: removeTrSlash(document.getElementById('fileOrUrl').value),\
-                    playMode: document.getElementById('playMode').value\
-                }\
-            };\
-        } else {\
-            var myObj = {\
-                \"rfidMod\": {\
-                    rfidIdMod: document.getElementById('rfidIdMusic').value,\
-                    modId: document.getElementById('modId').value\
-                }\
-            };\
-        }\
-        var myJSON = JSON.stringify(myObj);\
-        socket.send(myJSON);\
-    }\
-\
-    function wifiConfig(clickedId) {\
-        lastIdclicked = clickedId;\
-        var myObj = {\
-            \"wifiConfig\": {\
-                ssid: document.getElementById('ssid').value,\
-                pwd: document.getElementById('pwd').value,\
-                hostname: document.getElementById('hostname').value\
-            }\
-        };\
-        var myJSON = JSON.stringify(myObj);\
-        socket.send(myJSON);\
-    }\
-    function sendControl(cmd) {\
-        var myObj = {\
-            \"controls\": {\
-                action: cmd\
-            }\
-        };\
-        var myJSON = JSON.stringify(myObj);\
-        socket.send(myJSON);\
-    }\
-    function sendVolume(vol) {\
-        var myObj = {\
-            \"controls\": {\
-                set_volume: vol\
-            }\
-        };\
-        var myJSON = JSON.stringify(myObj);\
-        socket.send(myJSON);\
-    }\
-\
-    $(document).ready(function () {\
-        connect();\
-		buildFileSystemTree(\"/\");\
-\
-        console.log(parseInt(document.getElementById('warningLowVoltage').value));\
-        $(function () {\
-            $('[data-toggle=\"tooltip\"]').tooltip();\
-        });\
-\
-    });\
-</script>\
-</body>\
-</html>";
\ No newline at end of file
+// Generated by processHtml.py from html/management_EN.html (gzip-compressed); don't edit
+static const char management_HTML_ETAG[] PROGMEM = "\"7cfc5bf5ce054b47\"";
+static const uint8_t management_HTML_GZ[] PROGMEM = {
+    0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xe5, 0x3d, 0x6d, 0x7b, 0xdb, 0x36,
+    0x92, 0x9f, 0x4f, 0xbf, 0x02, 0x61, 0x9a, 0x8a, 0x6a, 0x24, 0x4a, 0xb2, 0xe3, 0x34, 0xb5, 0x63,
+    0xf7, 0xf1, 0x5b, 0x12, 0x6f, 0x93, 0xd8, 0xf1, 0x4b, 0xd2, 0x9e, 0xeb, 0xf5, 0x43, 0x89, 0x90,
+    0xc4, 0x98, 0x22, 0x55, 0x92, 0xb2, 0xec, 0x24, 0xfe, 0xef, 0x37, 0x33, 0x00, 0x48, 0xf0, 0x4d,
+    0x96, 0x1d, 0x77, 0x77, 0xef, 0xae, 0xbb, 0xb1, 0x48, 0x60, 0x30, 0x18, 0x60, 0x06, 0x83, 0xc1,
+    0x60, 0x00, 0xbe, 0x7c, 0xb4, 0xb3, 0xbf, 0x7d, 0xfc, 0xc7, 0xc1, 0x2e, 0x1b, 0xc5, 0x63, 0x6f,
+    0xa3, 0xf6, 0x12, 0x7f, 0x98, 0x67, 0xfb, 0xc3, 0x75, 0xc3, 0xe1, 0x06, 0x26, 0x70, 0xdb, 0x81,
+    0x9f, 0xd8, 0x8d, 0x3d, 0xbe, 0xb1, 0x7b, 0x74, 0x30, 0x75, 0xfd, 0xa0, 0x75, 0xc4, 0xe3, 0xd8,
+    0xf5, 0x87, 0xd1, 0xcb, 0xb6, 0x48, 0xaf, 0xbd, 0x1c, 0xf3, 0xd8, 0x66, 0xfd, 0x91, 0x1d, 0x46,
+    0x3c, 0x5e, 0x37, 0xa6, 0xf1, 0xa0, 0xf5, 0xc2, 0x50, 0xc9, 0xbe, 0x3d, 0xe6, 0xeb, 0xc6, 0xa5,
+    0xcb, 0x67, 0x93, 0x20, 0x8c, 0x0d, 0xd6, 0x0f, 0xfc, 0x98, 0xfb, 0x00, 0x36, 0x73, 0x9d, 0x78,
+    0xb4, 0xee, 0xf0, 0x4b, 0xb7, 0xcf, 0x5b, 0xf4, 0xd2, 0x64, 0xae, 0xef, 0xc6, 0xae, 0xed, 0xb5,
+    0xa2, 0xbe, 0xed, 0xf1, 0xf5, 0x2e, 0x22, 0xf1, 0x5c, 0xff, 0x82, 0x85, 0xdc, 0x5b, 0x37, 0xa2,
+    0x11, 0x20, 0xe8, 0x4f, 0x63, 0xe6, 0x02, 0x0e, 0x83, 0xc5, 0xd7, 0x13, 0x40, 0xec, 0x8e, 0xed,
+    0x21, 0x6f, 0x5f, 0xb5, 0x44, 0xda, 0x28, 0xe4, 0x83, 0x75, 0x63, 0x14, 0xc7, 0x93, 0x68, 0xb5,
+    0xdd, 0xe6, 0xd1, 0x04, 0x09, 0xb6, 0x1c, 0xae, 0x1e, 0xdb, 0x03, 0xfb, 0x12, 0x21, 0x2d, 0xf8,
+    0x93, 0x43, 0x1e, 0x5f, 0x7b, 0x3c, 0x1a, 0x71, 0x1e, 0x2f, 0x80, 0xa5, 0x1f, 0x45, 0xed, 0x5e,
+    0x10, 0xc4, 0x51, 0x1c, 0xda, 0x13, 0x6b, 0xec, 0xfa, 0x16, 0xa4, 0x2c, 0x8a, 0xaf, 0xef, 0xf8,
+    0x9f, 0x23, 0xab, 0xef, 0x05, 0x53, 0x67, 0xe0, 0xd9, 0x21, 0xb7, 0xfa, 0xc1, 0xb8, 0x6d, 0x7f,
+    0xb6, 0xaf, 0xda, 0x9e, 0xdb, 0x8b, 0xda, 0x9f, 0x01, 0x29, 0xe7, 0xed, 0x65, 0x6b, 0xc9, 0xea,
+    0xb6, 0xe3, 0x11, 0x1f, 0xf3, 0xa8, 0xed, 0xf0, 0x81, 0x3d, 0xf5, 0xe2, 0x36, 0x21, 0x4d, 0xea,
+    0x6b, 0x3f, 0x4c, 0x85, 0x03, 0x60, 0x48, 0xcb, 0x9e, 0xf1, 0x28, 0x18, 0xf3, 0xf6, 0x8a, 0xd5,
+    0x85, 0xff, 0x53, 0x03, 0x6d, 0xcf, 0x7b, 0xe8, 0xaa, 0xe2, 0xc0, 0x86, 0xd6, 0x59, 0x9f, 0xa3,
+    0xb6, 0x67, 0xc7, 0x3c, 0x8a, 0x55, 0xc2, 0x03, 0x57, 0x93, 0xb0, 0xa6, 0x15, 0x79, 0xae, 0xc3,
+    0xc3, 0x76, 0xb7, 0x6b, 0x75, 0xac, 0xa5, 0x2c, 0xdb, 0x64, 0x5e, 0x52, 0x37, 0xc3, 0xca, 0xa3,
+    0x7e, 0xe8, 0x4e, 0x62, 0x16, 0x85, 0xfd, 0xb9, 0xfc, 0x87, 0x06, 0x7c, 0xfe, 0x6b, 0xca, 0xc3,
+    0x6b, 0x2a, 0xfd, 0x19, 0x58, 0xff, 0xb2, 0x2d, 0x8a, 0x56, 0xe0, 0xe8, 0x07, 0x0e, 0xb7, 0x64,
+    0x11, 0xa4, 0x75, 0xea, 0xb6, 0xbb, 0x56, 0x77, 0xc9, 0xea, 0x48, 0x3c, 0xad, 0xa9, 0xbb, 0x28,
+    0xaa, 0x72, 0x72, 0x26, 0xc1, 0x64, 0x22, 0x1b, 0x73, 0x6f, 0x1c, 0x59, 0x89, 0x5e, 0xa4, 0x55,
+    0x77, 0x90, 0x64, 0xf1, 0xf2, 0x40, 0x98, 0xe7, 0xc9, 0xd1, 0xf7, 0x63, 0xaf, 0x12, 0x9f, 0x52,
+    0xd1, 0xc9, 0x57, 0x87, 0x32, 0x2b, 0x55, 0x53, 0xcc, 0xaf, 0xe2, 0xb6, 0x50, 0x0c, 0xd6, 0xc0,
+    0xf5, 0x38, 0x76, 0x00, 0xfb, 0x5a, 0xeb, 0x05, 0x21, 0x14, 0x5e, 0x65, 0xdd, 0xc9, 0x15, 0x8b,
+    0x02, 0xc0, 0xc4, 0x7a, 0x9e, 0xdd, 0xbf, 0x58, 0xab, 0x8d, 0xb8, 0x3b, 0x1c, 0xc5, 0xab, 0x6c,
+    0xa9, 0xd3, 0x99, 0x5c, 0xad, 0xd5, 0xc6, 0x76, 0x38, 0x74, 0xfd, 0x55, 0xd6, 0xe1, 0x63, 0xfa,
+    0xd7, 0x15, 0xbf, 0x6b, 0xb5, 0xe0, 0x92, 0x87, 0x03, 0x2f, 0x98, 0xb5, 0xae, 0x57, 0x19, 0x54,
+    0x1c, 0x78, 0xde, 0x5a, 0xed, 0xa6, 0x66, 0x49, 0xa2, 0xc4, 0x4f, 0x0b, 0x74, 0xa5, 0xfb, 0x05,
+    0x46, 0xb6, 0xed, 0x41, 0x95, 0xa4, 0x5d, 0x57, 0xd9, 0xf3, 0xce, 0x13, 0x85, 0xb6, 0xe5, 0xf1,
+    0x01, 0x54, 0xd5, 0x45, 0x7c, 0x32, 0x25, 0x14, 0xb5, 0x53, 0x52, 0x82, 0xae, 0x35, 0xb2, 0x7d,
+    0xc7, 0xe3, 0x5f, 0x13, 0xe2, 0x96, 0x89, 0x36, 0x89, 0x50, 0xbc, 0xc4, 0xc1, 0x64, 0x95, 0xb5,
+    0x56, 0xf0, 0xf1, 0xa6, 0xe6, 0xf1, 0x21, 0xf7, 0x1d, 0x2b, 0xea, 0x8f, 0xb8, 0x33, 0xf5, 0x00,
+    0x81, 0x68, 0x6e, 0x42, 0x84, 0xeb, 0x8f, 0x78, 0xe8, 0xc6, 0x6b, 0xac, 0xfd, 0x13, 0xdb, 0x0f,
+    0x99, 0x3d, 0x8d, 0x03, 0xf6, 0x53, 0xbb, 0x36, 0xb1, 0x1d, 0x07, 0xe6, 0x94, 0xd5, 0x0e, 0xeb,
+    0x22, 0x4e, 0xcc, 0x3d, 0x0e, 0xd8, 0xd0, 0xbd, 0xe4, 0xcc, 0x66, 0x3d, 0x37, 0x66, 0xc1, 0x80,
+    0x49, 0x18, 0x16, 0xf8, 0x0c, 0xf4, 0x22, 0xc3, 0x16, 0x30, 0xa0, 0x8e, 0x11, 0xe1, 0x88, 0x44,
+    0x54, 0x05, 0x35, 0xc6, 0x71, 0x30, 0x5e, 0xf5, 0x03, 0x9f, 0x53, 0x4b, 0x50, 0xe1, 0xb7, 0x26,
+    0x41, 0xf4, 0x55, 0x50, 0xda, 0xb1, 0x96, 0xb1, 0x89, 0x90, 0x00, 0x73, 0x4d, 0x00, 0x1d, 0x0c,
+    0xca, 0xc6, 0x8e, 0xa1, 0x26, 0x02, 0x0e, 0x39, 0xb2, 0xf9, 0x6b, 0xad, 0x1f, 0x78, 0x41, 0xb8,
+    0x3a, 0x1b, 0xb9, 0xb1, 0x9e, 0xbe, 0x3a, 0xc2, 0xce, 0x57, 0xb9, 0x2c, 0x08, 0x61, 0xae, 0x14,
+    0xf9, 0x03, 0xbb, 0x15, 0x5d, 0xfb, 0x7d, 0x01, 0xc0, 0x12, 0x88, 0xc7, 0xcf, 0xe9, 0x3f, 0x02,
+    0xe9, 0x7b, 0x6e, 0xff, 0xe2, 0x55, 0x10, 0x1e, 0xf2, 0x41, 0x08, 0x7a, 0x0d, 0x80, 0x50, 0x42,
+    0x5a, 0xb6, 0xe7, 0x0e, 0x81, 0x8a, 0x3e, 0x4c, 0x8a, 0x3c, 0x5c, 0x53, 0x05, 0x87, 0xa1, 0x7d,
+    0x0d, 0x2f, 0xd3, 0x30, 0xc2, 0xb7, 0x49, 0xe0, 0x8a, 0x5c, 0xc9, 0x2b, 0x6a, 0xc8, 0x8a, 0xe4,
+    0x54, 0x0e, 0x6f, 0x9e, 0x04, 0xc7, 0x0e, 0x2f, 0x04, 0xb6, 0x9b, 0x54, 0x0e, 0x5b, 0x38, 0x0d,
+    0xdb, 0xae, 0x4f, 0x80, 0x15, 0x5d, 0xe1, 0xfa, 0x0e, 0xbf, 0x82, 0x0e, 0x6f, 0x4d, 0xc2, 0x60,
+    0x08, 0x98, 0xa3, 0x54, 0x92, 0xba, 0x1d, 0x14, 0x25, 0x25, 0x13, 0xe2, 0x2d, 0xc5, 0x62, 0xf7,
+    0x40, 0xae, 0xa7, 0xd8, 0x71, 0xa2, 0xc3, 0xd7, 0x6a, 0x42, 0xda, 0xe0, 0x21, 0x98, 0xd8, 0x7d,
+    0x37, 0xbe, 0x46, 0x2e, 0xfc, 0xbc, 0x56, 0x73, 0xdc, 0x68, 0xe2, 0xd9, 0xf0, 0x96, 0xf0, 0x2a,
+    0x14, 0x6d, 0xd8, 0xec, 0x23, 0xa6, 0x6c, 0x07, 0x11, 0x9b, 0xd7, 0x6a, 0x34, 0x5d, 0x45, 0xee,
+    0x17, 0x8e, 0x38, 0x5e, 0xc8, 0x2e, 0xc8, 0x14, 0x4b, 0x98, 0x94, 0xef, 0xbc, 0xb2, 0x0e, 0x41,
+    0x50, 0x20, 0x01, 0x9a, 0xf6, 0xa5, 0x45, 0x0d, 0x5e, 0x65, 0xbf, 0x64, 0xc8, 0x7c, 0xb1, 0x56,
+    0xeb, 0xc1, 0xf0, 0x1c, 0x86, 0xc1, 0xd4, 0x77, 0x80, 0xa1, 0x5d, 0xbb, 0xfb, 0x4b, 0xf7, 0x97,
+    0xc2, 0x68, 0xcd, 0x35, 0x25, 0xd3, 0x4f, 0x37, 0xb5, 0xc7, 0x47, 0xd3, 0xde, 0xb1, 0xdd, 0xdb,
+    0x16, 0xb6, 0x8f, 0x15, 0xdb, 0xbd, 0x96, 0xb4, 0x83, 0xa0, 0xe2, 0xa4, 0xe8, 0xc0, 0xe3, 0x57,
+    0xb7, 0x40, 0x6f, 0x30, 0x7a, 0x9d, 0xd8, 0x3e, 0xd7, 0x4b, 0xf6, 0xbc, 0x00, 0x34, 0x08, 0x8e,
+    0x1a, 0x20, 0x32, 0x60, 0x46, 0x96, 0x1a, 0x03, 0x07, 0xc7, 0xa5, 0x1b, 0xb9, 0x3d, 0xd7, 0xa3,
+    0x56, 0x8d, 0x5c, 0xc7, 0xe1, 0x7e, 0x7e, 0xe4, 0xb7, 0x04, 0xb5, 0x8b, 0x93, 0x0e, 0xc4, 0xd8,
+    0x7d, 0x14, 0x17, 0x20, 0x45, 0x47, 0x4f, 0xcf, 0x1e, 0x31, 0x14, 0x28, 0xda, 0xdb, 0x3f, 0x62,
+    0x92, 0x1e, 0x36, 0x70, 0xaf, 0x90, 0x96, 0x88, 0x7b, 0xbc, 0x8f, 0x4d, 0x6f, 0xcd, 0x78, 0xef,
+    0xc2, 0x05, 0x16, 0xc3, 0xec, 0x65, 0xc3, 0x60, 0xea, 0x73, 0xd5, 0x81, 0xad, 0x71, 0xf0, 0xa5,
+    0x24, 0xb9, 0x98, 0xa2, 0x33, 0x67, 0x1a, 0x7a, 0x66, 0xdd, 0xb1, 0x63, 0x7b, 0x55, 0x98, 0x85,
+    0x13, 0x7f, 0xb8, 0xd6, 0xb3, 0x23, 0xfe, 0xfc, 0x59, 0xd3, 0xfd, 0xb8, 0xb5, 0x7f, 0x38, 0xeb,
+    0xfc, 0xf6, 0x7a, 0x18, 0x6c, 0xc2, 0x7f, 0xef, 0x8f, 0x4e, 0x46, 0xbb, 0x27, 0x43, 0x78, 0xda,
+    0xba, 0xc0, 0xf7, 0xff, 0xde, 0xc6, 0xbf, 0x9b, 0x3b, 0xa3, 0x61, 0xfc, 0x57, 0x1b, 0x9f, 0xb6,
+    0x7f, 0xdf, 0xda, 0xfb, 0xf4, 0xfb, 0x3b, 0x78, 0x78, 0xf6, 0x19, 0x5e, 0xa7, 0x7b, 0xb3, 0x57,
+    0xcf, 0x26, 0xc7, 0xbf, 0x2c, 0x61, 0xde, 0x61, 0xc7, 0xdb, 0xfd, 0xf0, 0xf1, 0xf0, 0x99, 0xff,
+    0xfa, 0x60, 0xe5, 0xcb, 0xb3, 0xcd, 0x9d, 0x68, 0x7f, 0xfb, 0xe8, 0xf5, 0x7e, 0x70, 0xbd, 0xfd,
+    0xf4, 0xfd, 0xa1, 0xdd, 0xfb, 0xfc, 0xee, 0xc3, 0x5f, 0x9f, 0x3f, 0x7c, 0x08, 0x87, 0x27, 0xc7,
+    0xdb, 0x7f, 0xf0, 0xbd, 0xf0, 0xc3, 0x87, 0xeb, 0xdd, 0xbd, 0xe5, 0x9d, 0xa3, 0xeb, 0x57, 0xff,
+    0xd8, 0x7b, 0x73, 0xb1, 0x39, 0xd9, 0x3c, 0xb9, 0x18, 0x1e, 0x5d, 0x2f, 0x75, 0xb7, 0x3a, 0xc1,
+    0xdb, 0xe0, 0xf9, 0xc0, 0x7d, 0x7d, 0xb4, 0xf5, 0xdb, 0xa4, 0x7d, 0xb1, 0x7d, 0xf2, 0xfa, 0xe4,
+    0xd9, 0xe8, 0xe8, 0xf0, 0xc3, 0x1f, 0x9b, 0x7f, 0x0c, 0x3b, 0x87, 0xb3, 0xa7, 0xc3, 0xd7, 0xde,
+    0xc9, 0x07, 0xa2, 0xea, 0xe8, 0xe4, 0xe3, 0xfe, 0xe1, 0x6f, 0x2b, 0xdb, 0x7f, 0xec, 0xed, 0xad,
+    0xd7, 0x1b, 0xd0, 0xee, 0x56, 0xc8, 0xa1, 0x1b, 0x62, 0xbd, 0xf1, 0xad, 0x74, 0xf8, 0x09, 0x4d,
+    0xa2, 0xc6, 0xcb, 0x4d, 0xed, 0xa5, 0xb0, 0x1b, 0x61, 0x76, 0x6a, 0x4b, 0x7b, 0xbe, 0x17, 0x38,
+    0xd7, 0xf0, 0xe3, 0xdb, 0x97, 0xac, 0xef, 0xd9, 0x51, 0xb4, 0x6e, 0xc0, 0x63, 0xcf, 0x0e, 0x99,
+    0xf8, 0x69, 0xf1, 0x2b, 0x10, 0x30, 0xa7, 0x15, 0x8d, 0x59, 0x0f, 0x47, 0x3f, 0x74, 0x66, 0x78,
+    0xad, 0xf2, 0x70, 0xf4, 0xa0, 0xa9, 0xeb, 0xb8, 0x49, 0x61, 0x18, 0x57, 0xad, 0xb1, 0xd3, 0xea,
+    0x2e, 0x61, 0xba, 0xad, 0x52, 0x61, 0x8a, 0xb2, 0x63, 0x9a, 0x67, 0x54, 0xd1, 0x1e, 0x30, 0xce,
+    0x41, 0x18, 0x77, 0x3c, 0xcc, 0xce, 0xc8, 0xb3, 0xd9, 0xcc, 0x2a, 0x31, 0x4a, 0x76, 0xc5, 0xef,
+    0xf2, 0x92, 0x05, 0x9c, 0x34, 0x84, 0x64, 0xae, 0x1b, 0xcb, 0x2b, 0x60, 0x0f, 0xd2, 0xe8, 0x13,
+    0xcf, 0xb2, 0x3e, 0x07, 0xc6, 0x2f, 0x18, 0x8f, 0xbc, 0x45, 0x83, 0x81, 0x91, 0xd6, 0x40, 0x45,
+    0x69, 0xc0, 0x23, 0x40, 0xa2, 0x71, 0x29, 0x57, 0x30, 0xd0, 0x11, 0xb6, 0x4e, 0xa9, 0xd0, 0xed,
+    0x4c, 0x10, 0x2c, 0x66, 0x13, 0xa0, 0xb8, 0x85, 0x96, 0xa8, 0xb2, 0x3c, 0xdb, 0xa0, 0x5e, 0x62,
+    0x1b, 0xd6, 0x2f, 0x1b, 0x2f, 0xdd, 0xa4, 0x81, 0x76, 0xc4, 0x40, 0xed, 0x87, 0xdc, 0x09, 0xd0,
+    0x06, 0x70, 0x37, 0xd8, 0xa1, 0x00, 0xba, 0x07, 0xfa, 0x68, 0x34, 0x8d, 0x9d, 0x60, 0xe6, 0x97,
+    0xe0, 0x9f, 0x04, 0x33, 0x98, 0xd4, 0x82, 0xc1, 0x40, 0x56, 0x72, 0x24, 0x41, 0xef, 0x51, 0x8b,
+    0x17, 0x0c, 0x4b, 0x2a, 0x80, 0x72, 0x17, 0x12, 0xf7, 0xdb, 0x60, 0x78, 0x0f, 0xb4, 0xae, 0x3f,
+    0x08, 0x4a, 0xf0, 0xca, 0x64, 0xc4, 0xbb, 0x07, 0x8f, 0x91, 0xc0, 0xdc, 0x06, 0xc1, 0xc1, 0x1f,
+    0xc0, 0x82, 0x92, 0x18, 0xb6, 0x85, 0x20, 0xe6, 0x25, 0x4a, 0xcd, 0x4e, 0x28, 0xa3, 0x58, 0x21,
+    0xe8, 0x1d, 0xb0, 0xd1, 0x5d, 0x87, 0x44, 0x15, 0xdf, 0x0c, 0x06, 0x96, 0x0f, 0x5a, 0x59, 0x76,
+    0xcf, 0x73, 0xa3, 0x38, 0x23, 0x7a, 0x08, 0x02, 0x13, 0xf7, 0x58, 0x23, 0x55, 0x95, 0x44, 0xcc,
+    0x50, 0x50, 0x60, 0x40, 0x55, 0x01, 0x22, 0x32, 0x1c, 0x4a, 0x44, 0xaa, 0x45, 0x8f, 0x35, 0x48,
+    0xad, 0x1e, 0x90, 0xa4, 0xd0, 0xb5, 0x55, 0x46, 0x94, 0x41, 0x28, 0xf3, 0x84, 0x66, 0xe3, 0x0e,
+    0x76, 0x82, 0x17, 0xf1, 0x92, 0x5e, 0x19, 0xc2, 0x7a, 0x18, 0x2c, 0x19, 0xd1, 0x31, 0x2f, 0x23,
+    0x18, 0x68, 0x0a, 0xc0, 0xc2, 0x11, 0xd7, 0x42, 0xad, 0xc6, 0xe0, 0x11, 0x06, 0x14, 0x09, 0xb2,
+    0xb1, 0xc1, 0xb6, 0x45, 0x15, 0x30, 0x8e, 0x01, 0x7a, 0x23, 0xc7, 0xa0, 0x42, 0x5b, 0x99, 0xd0,
+    0xc9, 0x69, 0x93, 0xc3, 0x81, 0xeb, 0x2c, 0xd0, 0x5e, 0x04, 0xbb, 0xad, 0xb1, 0x02, 0x26, 0xd7,
+    0xd2, 0x38, 0x9c, 0x96, 0x35, 0xd4, 0x09, 0xe2, 0x56, 0xdf, 0x0d, 0xfb, 0x1e, 0x57, 0xa3, 0xe3,
+    0xd5, 0xde, 0xce, 0x6d, 0xc4, 0xa7, 0x54, 0xcf, 0xdc, 0x81, 0xbb, 0x00, 0xd5, 0x08, 0x76, 0x1b,
+    0xd5, 0x02, 0x66, 0x41, 0xfe, 0x10, 0xf0, 0x1d, 0x98, 0xf3, 0xc9, 0x7d, 0xe5, 0x66, 0x38, 0x43,
+    0xa5, 0x04, 0xcd, 0x7c, 0x3c, 0xc1, 0x05, 0xca, 0xba, 0x71, 0xf4, 0x66, 0xff, 0xd3, 0xf9, 0xbb,
+    0x0f, 0xc7, 0xc7, 0xe7, 0xc7, 0x9b, 0x5b, 0xb4, 0x60, 0x40, 0xf8, 0x39, 0xb0, 0xaf, 0x8e, 0x0f,
+    0x72, 0xa0, 0x8b, 0xf4, 0x19, 0x98, 0xde, 0x3c, 0xb4, 0x17, 0x11, 0x6e, 0x09, 0x79, 0x5b, 0xcf,
+    0x25, 0x60, 0x0b, 0x76, 0x9e, 0x58, 0x34, 0x44, 0xad, 0x91, 0x64, 0xf9, 0x6b, 0x51, 0x7e, 0x71,
+    0xae, 0xc7, 0x01, 0xd4, 0xbd, 0x00, 0xfd, 0x04, 0x77, 0x1b, 0xf5, 0x12, 0x68, 0x51, 0xc6, 0x87,
+    0xdc, 0xef, 0x2b, 0xc2, 0x8f, 0xb1, 0xe8, 0xe2, 0x64, 0x0f, 0x82, 0x70, 0x3a, 0x5e, 0x80, 0x6c,
+    0x82, 0xbb, 0x8d, 0x6c, 0x09, 0xb4, 0x20, 0xd9, 0xb0, 0x76, 0x1d, 0xc3, 0x84, 0x7f, 0x17, 0x91,
+    0x7d, 0x85, 0x15, 0x64, 0x64, 0x36, 0xaf, 0x94, 0xb3, 0xda, 0x58, 0xb3, 0xf9, 0x32, 0x2a, 0x58,
+    0xda, 0x84, 0x46, 0x11, 0x9a, 0xec, 0xd3, 0x81, 0xed, 0xf0, 0xec, 0x78, 0xd6, 0x5a, 0x8e, 0x10,
+    0x4a, 0xae, 0x3c, 0xbb, 0xc7, 0x3d, 0x8f, 0x3b, 0xbd, 0xeb, 0xdc, 0xd0, 0xaf, 0x98, 0x14, 0x04,
+    0x52, 0x84, 0x02, 0x0a, 0x06, 0xee, 0x10, 0xe1, 0xa0, 0xd3, 0xc6, 0xa4, 0xf9, 0x02, 0x1f, 0xfa,
+    0x5a, 0xcb, 0x63, 0x63, 0x1e, 0x8f, 0x02, 0x80, 0x3f, 0xd8, 0x3f, 0x3a, 0x36, 0x60, 0xf1, 0x18,
+    0x4d, 0x7b, 0x63, 0x37, 0xd6, 0xcb, 0x9b, 0xf5, 0xf4, 0xb9, 0xde, 0x58, 0x83, 0x55, 0x50, 0x3c,
+    0x0d, 0x7d, 0x26, 0x7b, 0x3c, 0x43, 0x03, 0x56, 0xd3, 0x42, 0x8b, 0x6b, 0xc2, 0x32, 0x56, 0x8f,
+    0x58, 0xf6, 0x6e, 0xa0, 0x32, 0x00, 0x9e, 0x29, 0xff, 0xa8, 0x4c, 0x85, 0x6c, 0x6c, 0x21, 0x83,
+    0xc2, 0xeb, 0x46, 0x14, 0x81, 0x0a, 0x15, 0x80, 0xe8, 0x1a, 0x65, 0xe6, 0xd1, 0xd1, 0xde, 0x4e,
+    0x63, 0x15, 0x80, 0x11, 0x06, 0x8d, 0x23, 0x7f, 0x32, 0x8d, 0x35, 0x17, 0x82, 0x91, 0xa9, 0x3b,
+    0x99, 0x6e, 0xb0, 0x0b, 0x08, 0x17, 0x03, 0xbd, 0xd1, 0xe7, 0xa3, 0xc0, 0x83, 0x91, 0x07, 0xda,
+    0x03, 0xb0, 0x19, 0xd2, 0xe9, 0x2a, 0xb2, 0x43, 0xfe, 0xd7, 0xd4, 0x05, 0x23, 0x25, 0xdb, 0x10,
+    0xd7, 0xbf, 0x04, 0x0b, 0xc9, 0x69, 0x0d, 0x38, 0xf4, 0xbb, 0x8d, 0x62, 0x51, 0xdb, 0x25, 0xb3,
+    0x11, 0x29, 0xab, 0x47, 0x0c, 0xf1, 0x58, 0x89, 0x60, 0x68, 0xf4, 0x4f, 0x66, 0x40, 0xfe, 0x01,
+    0xe0, 0x98, 0xc1, 0x6a, 0xbb, 0x82, 0xec, 0x89, 0xcc, 0x9e, 0x43, 0x3a, 0xa2, 0xc9, 0x52, 0x2e,
+    0x71, 0xc6, 0x8a, 0x7a, 0x82, 0xd0, 0x88, 0xd7, 0x68, 0x18, 0x05, 0x51, 0x8c, 0x40, 0x46, 0xe2,
+    0x93, 0x7e, 0x4f, 0x5d, 0xf9, 0x46, 0xa6, 0xdf, 0xb3, 0x3b, 0x13, 0xb4, 0x59, 0xc2, 0xa4, 0x35,
+    0xaa, 0xe8, 0xd2, 0xa0, 0xec, 0x18, 0x7a, 0x0c, 0xe4, 0xed, 0x9f, 0xa7, 0xff, 0x6c, 0xfd, 0x69,
+    0x9d, 0x7d, 0x5d, 0x6a, 0x2e, 0x2f, 0xdd, 0x64, 0x88, 0x96, 0xfd, 0x57, 0x18, 0x51, 0xb8, 0xae,
+    0x15, 0x76, 0x3a, 0x4a, 0x4f, 0x6f, 0x1a, 0xc7, 0xe8, 0xd5, 0x20, 0x22, 0xc1, 0xd2, 0xe4, 0x29,
+    0x95, 0xbd, 0xd8, 0x67, 0xf0, 0x0f, 0x84, 0x0a, 0x48, 0x05, 0xdb, 0xfb, 0xda, 0xd8, 0x38, 0x44,
+    0x80, 0x97, 0x6d, 0x51, 0x28, 0x5f, 0x5a, 0x48, 0x77, 0xa1, 0xb8, 0x34, 0xe2, 0x8d, 0x8d, 0x23,
+    0xca, 0xd7, 0x4a, 0xab, 0xa1, 0x8f, 0xdd, 0xa1, 0xbd, 0x8a, 0x9f, 0xdb, 0x87, 0x75, 0xd1, 0x4a,
+    0x9a, 0x37, 0xb2, 0x75, 0xeb, 0x6b, 0xee, 0xe0, 0x06, 0x60, 0x69, 0xf5, 0xdc, 0x6d, 0x00, 0x26,
+    0xa6, 0x52, 0x32, 0xf4, 0xb4, 0xb2, 0xa2, 0xcd, 0x51, 0xa1, 0xc7, 0xc5, 0x4b, 0xa1, 0xcf, 0xa4,
+    0xd7, 0x9d, 0x9e, 0xbd, 0x21, 0xaa, 0x0e, 0xf2, 0xb4, 0x40, 0x1f, 0x03, 0x66, 0x59, 0x91, 0xd9,
+    0xfd, 0x79, 0xb9, 0x61, 0xa8, 0x99, 0x3c, 0xab, 0x99, 0xe1, 0x27, 0x6e, 0xe1, 0xd8, 0x9a, 0xd9,
+    0xa1, 0xa3, 0xcd, 0xe4, 0x15, 0x9c, 0xfb, 0x3e, 0x2a, 0xba, 0x55, 0x54, 0xfc, 0xab, 0x08, 0xe8,
+    0x10, 0x01, 0x85, 0xc5, 0x8b, 0x3d, 0x8d, 0xa4, 0xfd, 0xf7, 0x37, 0xd5, 0xbb, 0x54, 0xd9, 0xfd,
+    0x41, 0xf8, 0xaf, 0x68, 0xf7, 0xb3, 0xb9, 0xec, 0x9f, 0x47, 0x44, 0x76, 0xa8, 0xe5, 0x55, 0xc4,
+    0x2d, 0x82, 0xfe, 0x31, 0xf0, 0xa6, 0x63, 0xae, 0xc9, 0x79, 0xbe, 0xe7, 0x2f, 0x09, 0xa0, 0x85,
+    0x2b, 0x45, 0x7c, 0x5d, 0xba, 0x62, 0x89, 0x23, 0x54, 0xda, 0x38, 0x52, 0x35, 0x92, 0xc1, 0x32,
+    0x09, 0x83, 0x4b, 0x30, 0xdd, 0xa0, 0x71, 0x64, 0xc1, 0xa9, 0xdd, 0x35, 0x7f, 0x3a, 0xee, 0xe1,
+    0x1b, 0xc1, 0x48, 0x8f, 0xf0, 0xd8, 0x05, 0x8d, 0xd7, 0xcd, 0xa5, 0xd9, 0x57, 0xeb, 0xc6, 0x12,
+    0x24, 0xaa, 0xcc, 0x24, 0xa1, 0x7a, 0xee, 0xe2, 0xb1, 0x68, 0x83, 0x51, 0xd3, 0x31, 0xc1, 0xac,
+    0x34, 0x85, 0x8a, 0x9f, 0x6c, 0x9f, 0x1c, 0x1e, 0xee, 0xbe, 0x3f, 0x3e, 0xff, 0xb8, 0xff, 0xf6,
+    0xe4, 0xdd, 0xee, 0x13, 0x83, 0x55, 0x66, 0x00, 0x5f, 0x46, 0xe8, 0x86, 0x15, 0x8c, 0x11, 0x38,
+    0xcd, 0x78, 0xe4, 0x46, 0x16, 0x15, 0x01, 0xf6, 0x30, 0x56, 0xd5, 0x3b, 0xd0, 0xb9, 0xa5, 0x7d,
+    0xa3, 0x71, 0xa5, 0x7d, 0x27, 0xb6, 0x1c, 0x78, 0xf6, 0x35, 0x8e, 0x38, 0x16, 0x4d, 0x60, 0x62,
+    0xd5, 0xd8, 0xf3, 0x70, 0x12, 0xf7, 0x62, 0xe9, 0x5e, 0x43, 0x5d, 0x9f, 0x07, 0x2b, 0xd9, 0xba,
+    0xd2, 0x29, 0xe3, 0x6b, 0x27, 0x97, 0x1a, 0xc5, 0x7c, 0x02, 0xb0, 0x92, 0xdb, 0x58, 0x26, 0x85,
+    0x9b, 0xc7, 0xef, 0x23, 0xec, 0x93, 0x72, 0x76, 0x1f, 0xbc, 0xdd, 0xfc, 0x63, 0x6b, 0x73, 0xfb,
+    0xb7, 0xf3, 0xa3, 0x83, 0xdd, 0xdd, 0x1d, 0x8d, 0xdd, 0xf9, 0x8c, 0x87, 0xed, 0xca, 0xe5, 0x7f,
+    0xaf, 0xf2, 0x78, 0x81, 0xca, 0xa3, 0x7b, 0x55, 0xd4, 0x09, 0x77, 0x15, 0xbb, 0xed, 0x69, 0x18,
+    0xa2, 0x47, 0x36, 0x0e, 0x41, 0x04, 0x72, 0x93, 0x9f, 0x4b, 0x4b, 0x74, 0x32, 0xf1, 0x0a, 0x2a,
+    0xe7, 0x6e, 0xb5, 0x00, 0xff, 0xfa, 0x31, 0x2d, 0x1d, 0x92, 0x0a, 0xfa, 0x36, 0xd8, 0x91, 0x91,
+    0x60, 0xb0, 0xcc, 0x35, 0x98, 0xf2, 0xd3, 0x2d, 0x75, 0x52, 0x47, 0xdd, 0x8b, 0x0e, 0x56, 0x2f,
+    0xc0, 0x0b, 0xba, 0xef, 0x16, 0x6b, 0x83, 0x45, 0xa3, 0x60, 0x56, 0xea, 0xd6, 0x58, 0xd0, 0xec,
+    0x48, 0x3c, 0x20, 0x73, 0x6d, 0x0e, 0xb5, 0x37, 0xb2, 0x9d, 0x24, 0xe3, 0xba, 0xc2, 0xe5, 0x9e,
+    0x03, 0xb2, 0x9b, 0xf6, 0xc2, 0x2b, 0x00, 0x8b, 0xca, 0x0d, 0x8c, 0xe2, 0xee, 0x8a, 0xa1, 0x31,
+    0x01, 0x73, 0x7b, 0x61, 0x30, 0x8b, 0xd2, 0xe4, 0x5c, 0x39, 0xe6, 0xf0, 0x71, 0x20, 0x88, 0xe1,
+    0x57, 0x13, 0x2f, 0x08, 0x79, 0x78, 0x0c, 0xc9, 0x05, 0xc6, 0x89, 0xbf, 0xb4, 0xe4, 0xd1, 0x61,
+    0x4f, 0xe0, 0xc7, 0x76, 0x60, 0x75, 0x37, 0xce, 0xaf, 0x7a, 0x60, 0x65, 0x2b, 0xc4, 0x75, 0x0c,
+    0x42, 0xe9, 0x4e, 0xec, 0x30, 0x26, 0x7b, 0xaf, 0x85, 0x43, 0xd1, 0x48, 0x96, 0x4d, 0x6d, 0x85,
+    0xc8, 0xc8, 0xaf, 0x15, 0x40, 0x75, 0x08, 0xb9, 0x28, 0x0c, 0x97, 0xc2, 0x38, 0x9f, 0x12, 0x11,
+    0xdc, 0x39, 0xc7, 0x46, 0x9d, 0x93, 0xc5, 0x9d, 0xf3, 0x77, 0x14, 0xb1, 0xb6, 0x60, 0x98, 0xe4,
+    0x31, 0x17, 0x0d, 0xdf, 0x74, 0x10, 0xfd, 0x40, 0xfa, 0xbd, 0x61, 0x41, 0x43, 0x40, 0xea, 0xcd,
+    0x86, 0x35, 0x70, 0x7d, 0xc7, 0xac, 0x13, 0xc6, 0x53, 0x6a, 0x28, 0x56, 0x7e, 0x56, 0x6f, 0x88,
+    0xbd, 0x31, 0xb3, 0xb1, 0x66, 0x6c, 0x6c, 0x51, 0xcf, 0x97, 0x52, 0x92, 0x37, 0x92, 0xef, 0x53,
+    0x91, 0xb0, 0xbb, 0xa9, 0x26, 0xc1, 0x86, 0xa4, 0x26, 0xa1, 0x78, 0xc5, 0xda, 0x21, 0xd3, 0x39,
+    0xd8, 0x5f, 0xac, 0x90, 0x96, 0x4e, 0x67, 0x85, 0xca, 0x73, 0x54, 0x58, 0x7a, 0xe7, 0x03, 0x09,
+    0x18, 0xbd, 0x63, 0xaa, 0x42, 0xa0, 0x3f, 0x01, 0x30, 0x9a, 0x78, 0x40, 0x54, 0xfb, 0xf4, 0xcf,
+    0x3f, 0xbf, 0xb5, 0xcf, 0xda, 0x80, 0x21, 0x98, 0x98, 0x0d, 0xa0, 0x91, 0xd1, 0x8e, 0xc0, 0x7a,
+    0x61, 0x9f, 0x48, 0x08, 0x89, 0x20, 0x44, 0x88, 0x8a, 0xd8, 0x37, 0x50, 0x3a, 0xb0, 0x30, 0x4e,
+    0x05, 0x09, 0x23, 0x4e, 0x0b, 0x48, 0xd9, 0xd4, 0x42, 0x56, 0x8b, 0xd2, 0x15, 0x76, 0x4a, 0xea,
+    0x05, 0x57, 0x46, 0x89, 0xec, 0xee, 0x5e, 0xa1, 0xa6, 0x22, 0x8f, 0x82, 0x58, 0xee, 0x15, 0x71,
+    0x51, 0xba, 0x21, 0xd6, 0x81, 0x15, 0x85, 0xe5, 0x03, 0xe8, 0x82, 0xfe, 0x08, 0x54, 0x46, 0xc4,
+    0x4c, 0x2b, 0xb6, 0xc3, 0x26, 0x6e, 0x9d, 0x85, 0xd6, 0xf0, 0x4b, 0x83, 0xb9, 0x7e, 0x1c, 0x30,
+    0xe5, 0x5a, 0x01, 0x54, 0xb8, 0xce, 0x4b, 0x57, 0x8c, 0xb9, 0x15, 0x51, 0xde, 0x30, 0x53, 0xbb,
+    0xa1, 0xfa, 0xd0, 0xce, 0x12, 0x72, 0xa0, 0x20, 0xf2, 0x45, 0x60, 0x86, 0x0e, 0x95, 0xca, 0x52,
+    0x69, 0x94, 0xb4, 0x51, 0xae, 0x10, 0xa9, 0xea, 0x84, 0x9c, 0x54, 0x13, 0x15, 0xf9, 0x90, 0x53,
+    0x65, 0xa8, 0xf0, 0xde, 0x4d, 0x23, 0xb7, 0x7f, 0x6c, 0x0f, 0xa3, 0x72, 0x35, 0x86, 0xde, 0xd8,
+    0xd6, 0x66, 0x14, 0xb9, 0x43, 0x1f, 0xfd, 0x47, 0xba, 0x46, 0xcb, 0xfa, 0x52, 0xb2, 0xb8, 0x2a,
+    0xdd, 0x29, 0x08, 0x26, 0xd0, 0x99, 0xf5, 0x4c, 0x91, 0xfb, 0x7a, 0x54, 0xd2, 0xe5, 0x3e, 0xa2,
+    0xdb, 0x13, 0x08, 0x0d, 0x41, 0xb7, 0x30, 0x60, 0x98, 0xd9, 0x5d, 0x62, 0x8e, 0x3b, 0x74, 0xe3,
+    0xa8, 0x71, 0xaf, 0x05, 0xbf, 0x8e, 0x18, 0x6d, 0x18, 0x8f, 0xfb, 0x43, 0x9c, 0xb9, 0x80, 0x82,
+    0x74, 0x71, 0x7f, 0xda, 0x69, 0xfd, 0x72, 0xf6, 0xb5, 0x0b, 0x0b, 0xfb, 0x5a, 0xc6, 0x2d, 0xf0,
+    0x04, 0x29, 0x39, 0x3f, 0xde, 0x7c, 0x7d, 0xbe, 0x87, 0x06, 0x8b, 0x18, 0xe0, 0x19, 0x8c, 0x9a,
+    0x1f, 0x80, 0x38, 0x39, 0xf5, 0x34, 0x57, 0x62, 0x6e, 0x57, 0x43, 0xec, 0xb2, 0x96, 0x6c, 0x6a,
+    0x78, 0x6e, 0xde, 0xff, 0x58, 0xd8, 0xea, 0x28, 0x78, 0xfd, 0x69, 0xbe, 0x1b, 0x23, 0x11, 0xb7,
+    0xf8, 0x24, 0x11, 0x70, 0x2c, 0x89, 0x4d, 0x7c, 0x92, 0x45, 0x1f, 0xa3, 0x00, 0x11, 0xab, 0x06,
+    0x6c, 0xdb, 0x85, 0xf4, 0x1a, 0x7a, 0xee, 0xe2, 0x04, 0xea, 0x94, 0x05, 0xce, 0x22, 0x74, 0x05,
+    0xce, 0x7c, 0xaa, 0xfa, 0xb4, 0x9b, 0x45, 0x34, 0x05, 0x8e, 0x3b, 0x70, 0x2f, 0x6c, 0x94, 0x58,
+    0x9d, 0xb4, 0xf6, 0xd4, 0xbb, 0xc5, 0x93, 0x99, 0xd9, 0xdc, 0xae, 0x72, 0x64, 0x16, 0xcc, 0x8f,
+    0xb2, 0x6e, 0x13, 0xf6, 0x87, 0x62, 0xb5, 0x26, 0xbd, 0xa8, 0x4d, 0xf7, 0xc3, 0x93, 0x10, 0x32,
+    0xd1, 0x74, 0x68, 0x82, 0xc4, 0x86, 0xa0, 0x78, 0x82, 0xf0, 0x9a, 0x05, 0x21, 0x3b, 0x39, 0x7c,
+    0xcb, 0xcc, 0x7f, 0x52, 0x1c, 0xcb, 0x63, 0x86, 0xfa, 0xbd, 0x0e, 0x7a, 0xcb, 0xf3, 0x82, 0x19,
+    0x28, 0x26, 0x68, 0x26, 0x05, 0x55, 0xde, 0x4f, 0xb8, 0xd3, 0x7a, 0x75, 0xd1, 0x5e, 0x5a, 0x59,
+    0xc9, 0xb9, 0xb7, 0xbe, 0x58, 0x5b, 0x16, 0x6b, 0x8f, 0x27, 0xcb, 0xed, 0x37, 0x01, 0x0f, 0xa3,
+    0x09, 0x68, 0x0a, 0xde, 0xfe, 0xc3, 0xbe, 0x00, 0x4b, 0x4a, 0xfe, 0x9c, 0x4f, 0x7d, 0xe7, 0x3c,
+    0xe2, 0xa0, 0x5e, 0xce, 0x5f, 0x85, 0x1c, 0x5e, 0xb8, 0x05, 0xe0, 0x59, 0xff, 0xd7, 0x9f, 0xff,
+    0x7c, 0x7c, 0xf6, 0xf4, 0x07, 0x35, 0x0c, 0xb4, 0xba, 0xcb, 0x3d, 0x78, 0x38, 0xeb, 0x00, 0xd7,
+    0x40, 0x19, 0xe0, 0x8a, 0x09, 0x58, 0xcd, 0xd3, 0x36, 0xca, 0xe8, 0x80, 0x6a, 0xd7, 0xa1, 0x2a,
+    0xab, 0x1c, 0x85, 0x09, 0xae, 0xda, 0xcb, 0x60, 0x82, 0x32, 0x90, 0xe8, 0xdd, 0xb4, 0x9d, 0x06,
+    0xc6, 0x20, 0xc0, 0xa8, 0x82, 0x6e, 0x4d, 0x14, 0xbf, 0x5c, 0x63, 0x18, 0x1b, 0x47, 0xa2, 0x46,
+    0x41, 0x86, 0x40, 0x51, 0xc0, 0x25, 0xde, 0x5a, 0x62, 0x6e, 0x94, 0x25, 0xbb, 0x50, 0xd4, 0xf5,
+    0x87, 0x18, 0xf1, 0x25, 0x0c, 0xef, 0x3b, 0x94, 0x5d, 0xca, 0x96, 0x65, 0xa6, 0x17, 0x04, 0x93,
+    0xc6, 0x22, 0x28, 0x5a, 0xb8, 0x37, 0x3f, 0x90, 0xad, 0x92, 0xd8, 0x96, 0x8d, 0x8d, 0xcd, 0xa9,
+    0xe3, 0x06, 0xb8, 0x97, 0x7b, 0x5f, 0x1c, 0xcf, 0x34, 0x1c, 0x8b, 0x92, 0x93, 0xc5, 0xb0, 0x02,
+    0x18, 0x3c, 0x4f, 0x34, 0x28, 0xc2, 0x90, 0x2d, 0x5b, 0x13, 0x76, 0x33, 0x0a, 0x42, 0xec, 0x75,
+    0xdb, 0x9b, 0x8c, 0xac, 0xbb, 0x62, 0x7e, 0x3e, 0x17, 0x33, 0xc6, 0x15, 0x04, 0xe3, 0xbb, 0xe2,
+    0xfc, 0x79, 0x61, 0x6a, 0x9b, 0xec, 0x3e, 0xbd, 0xf1, 0xcb, 0x02, 0x34, 0x2f, 0x88, 0x19, 0x83,
+    0x27, 0xed, 0x71, 0x82, 0xf9, 0x85, 0xb1, 0xf1, 0x09, 0x96, 0x12, 0x36, 0x30, 0xeb, 0x8e, 0x25,
+    0xbb, 0x20, 0xb2, 0x6f, 0x61, 0x66, 0x61, 0x26, 0x4a, 0x01, 0xa8, 0xd1, 0x30, 0x18, 0xb3, 0xa3,
+    0x1d, 0xd4, 0x3f, 0x6d, 0xd0, 0x46, 0x33, 0xde, 0x13, 0x05, 0xa2, 0x86, 0xc8, 0xf2, 0x82, 0xbe,
+    0xed, 0x31, 0x6b, 0xbc, 0x3c, 0x6d, 0xa1, 0xf2, 0xd2, 0x6a, 0x6b, 0x8b, 0x61, 0x34, 0x7f, 0xf5,
+    0xa6, 0xa9, 0xcb, 0xc0, 0x29, 0x53, 0x96, 0x9a, 0x4a, 0x00, 0x88, 0x3d, 0x5a, 0x70, 0x2f, 0xaa,
+    0x07, 0x44, 0x01, 0xa9, 0x04, 0x64, 0xe9, 0xef, 0xd7, 0x00, 0x30, 0x91, 0xf4, 0xe5, 0x44, 0x92,
+    0xef, 0x59, 0xd5, 0x87, 0x1d, 0x58, 0xcb, 0xfe, 0xc6, 0xaf, 0x71, 0x37, 0x6d, 0x0e, 0x10, 0x2a,
+    0x07, 0x8f, 0xf3, 0x09, 0xb3, 0x07, 0xb8, 0xaf, 0xd2, 0x5d, 0x41, 0x77, 0xc9, 0x34, 0xc6, 0xb5,
+    0x63, 0x65, 0x99, 0xa5, 0x6c, 0x99, 0xe5, 0xce, 0x02, 0x65, 0x96, 0x73, 0xf5, 0xb0, 0x51, 0x30,
+    0x0d, 0xe7, 0xc0, 0x3f, 0xcb, 0xc2, 0x2f, 0x11, 0xfc, 0xbc, 0x0a, 0x56, 0xb2, 0x05, 0xc0, 0x46,
+    0x44, 0x61, 0xae, 0xd0, 0x78, 0x49, 0xa9, 0xe7, 0xa5, 0xa5, 0x50, 0x57, 0xa3, 0x65, 0x33, 0xa7,
+    0xe0, 0xcf, 0xa5, 0x05, 0x07, 0x18, 0x66, 0x26, 0x86, 0x52, 0x75, 0xd9, 0x2e, 0x30, 0xe6, 0x2d,
+    0x8c, 0xa7, 0x05, 0xaa, 0xa1, 0x81, 0x80, 0xa0, 0xb7, 0xb4, 0x63, 0x09, 0x50, 0xee, 0xb8, 0xe3,
+    0x31, 0x7b, 0xbb, 0xbb, 0x03, 0x0b, 0x09, 0x1f, 0xbd, 0x19, 0x38, 0x4f, 0x34, 0xe6, 0x14, 0x01,
+    0xd4, 0xc7, 0x64, 0xd4, 0x60, 0xa1, 0x56, 0x94, 0x78, 0x4d, 0xaa, 0x0a, 0x2c, 0x77, 0x92, 0x02,
+    0x22, 0x9a, 0xa0, 0x0a, 0xf0, 0x59, 0x0a, 0xb8, 0x05, 0x29, 0x71, 0x10, 0xc4, 0xa3, 0x6a, 0xe8,
+    0x15, 0x80, 0xde, 0xf5, 0x51, 0xe2, 0xd9, 0xab, 0xe3, 0x83, 0x6a, 0xb8, 0x17, 0x4b, 0x86, 0xe6,
+    0xb7, 0x44, 0xd3, 0x63, 0x8e, 0xf8, 0xbc, 0x58, 0xd6, 0x80, 0xd1, 0xc5, 0x3d, 0x17, 0x18, 0x64,
+    0xed, 0x3d, 0x8c, 0x5b, 0x50, 0x21, 0x93, 0x9c, 0x63, 0xb4, 0xa2, 0x48, 0x07, 0xb7, 0xb7, 0xc6,
+    0x01, 0x86, 0xfd, 0x26, 0x4b, 0x93, 0x79, 0x4a, 0x67, 0xbe, 0x0f, 0xfd, 0x3f, 0x78, 0x9b, 0xad,
+    0xb8, 0x9a, 0xeb, 0x85, 0x74, 0x04, 0x61, 0xe1, 0x9d, 0xb7, 0xf1, 0x5f, 0x71, 0xbc, 0xa0, 0xff,
+    0x0b, 0x41, 0x6f, 0xf7, 0x7f, 0x21, 0x54, 0x6e, 0x43, 0x5d, 0xd9, 0xf0, 0xc0, 0xb2, 0xa8, 0x45,
+    0x1b, 0xc6, 0xa4, 0x1a, 0x53, 0x97, 0xd1, 0x63, 0xad, 0x50, 0x76, 0x69, 0x58, 0x4b, 0x97, 0x86,
+    0x08, 0xa3, 0x0e, 0x0d, 0x99, 0xf5, 0xb4, 0xc4, 0x22, 0x2b, 0x43, 0x5a, 0xf4, 0x97, 0x7a, 0x23,
+    0x31, 0x9c, 0xa6, 0x6c, 0xaf, 0xfd, 0x8e, 0x4e, 0x88, 0xc4, 0x94, 0x4b, 0xfa, 0x40, 0x8c, 0x99,
+    0x64, 0x62, 0x49, 0x53, 0x16, 0xf4, 0x4a, 0x64, 0x4a, 0xc8, 0x01, 0x88, 0xc4, 0xd6, 0x0a, 0x2e,
+    0x86, 0xf2, 0x65, 0xf0, 0xf8, 0xba, 0xb5, 0x54, 0xb9, 0x16, 0x16, 0x7d, 0x19, 0x5e, 0xa2, 0x44,
+    0xcb, 0x1e, 0xc0, 0x97, 0x7b, 0xad, 0x10, 0x34, 0x5c, 0x38, 0xcf, 0xa8, 0x25, 0xc2, 0xcf, 0x99,
+    0x05, 0xc3, 0x13, 0x0a, 0x5b, 0x3a, 0xda, 0x3d, 0xfc, 0xb8, 0x7b, 0x78, 0xfe, 0x76, 0xf7, 0xfd,
+    0xeb, 0xe3, 0x37, 0x4f, 0x72, 0x2b, 0x61, 0x5a, 0x41, 0x74, 0x7f, 0x59, 0xb2, 0xba, 0xcf, 0x5f,
+    0x58, 0x4b, 0xd6, 0x8b, 0x5f, 0xf4, 0xbe, 0x53, 0xc4, 0x16, 0x5a, 0x71, 0x12, 0x25, 0x6d, 0x98,
+    0xc2, 0xa3, 0x08, 0x86, 0x10, 0x23, 0xdd, 0xf6, 0xee, 0xb9, 0x83, 0x9f, 0xe0, 0x2d, 0xb6, 0xe0,
+    0xe4, 0xa8, 0x92, 0xfe, 0x2d, 0x0e, 0x73, 0xec, 0x17, 0x41, 0x82, 0x4e, 0xfa, 0x49, 0x54, 0x4a,
+    0xf8, 0x01, 0x46, 0x40, 0x10, 0xdd, 0x2a, 0xce, 0xe1, 0x76, 0xba, 0x17, 0x88, 0x88, 0x50, 0xa8,
+    0x8b, 0xa4, 0x1f, 0x7c, 0xda, 0xa9, 0xa0, 0x3c, 0x1f, 0x33, 0x91, 0x90, 0x57, 0x24, 0x1a, 0xa1,
+    0x24, 0xd5, 0xf0, 0x58, 0x41, 0xa6, 0xda, 0x18, 0x9a, 0x4f, 0x24, 0x55, 0x98, 0xd9, 0xe9, 0x7b,
+    0xbe, 0xb2, 0xb2, 0xbc, 0x92, 0xa7, 0x2d, 0x4f, 0x17, 0xbd, 0xff, 0x7f, 0x8a, 0x8d, 0x18, 0xc4,
+    0x93, 0x05, 0x15, 0x34, 0x40, 0x2e, 0xb0, 0x3f, 0x11, 0x4f, 0xaa, 0xe2, 0x9d, 0xd2, 0xac, 0x4a,
+    0xff, 0x1c, 0x80, 0xa4, 0x3a, 0x38, 0x81, 0xff, 0xbe, 0x70, 0x27, 0x30, 0x2b, 0x6e, 0x89, 0x76,
+    0x82, 0x8a, 0xc4, 0x28, 0x42, 0x50, 0x35, 0xcc, 0xef, 0x37, 0xb6, 0x15, 0xaa, 0xcc, 0xf8, 0xc0,
+    0x38, 0xc9, 0x3b, 0x8e, 0xec, 0x04, 0x4f, 0x85, 0x67, 0x02, 0x87, 0x0f, 0x52, 0x3b, 0xf9, 0xee,
+    0x18, 0x27, 0xa8, 0xa9, 0x30, 0xa0, 0x91, 0x60, 0x7d, 0x3c, 0x57, 0xc4, 0x40, 0xd5, 0x12, 0x5a,
+    0x0f, 0x72, 0x61, 0x50, 0xff, 0xe7, 0x47, 0x4d, 0x31, 0x34, 0x75, 0xde, 0xc8, 0xd1, 0x43, 0x5e,
+    0xe7, 0x8e, 0x1e, 0x09, 0x58, 0x35, 0x82, 0xb2, 0xd9, 0x95, 0xa3, 0x08, 0xc0, 0xd2, 0x51, 0x94,
+    0x29, 0x73, 0xcf, 0x91, 0x54, 0x70, 0xcc, 0xab, 0x02, 0xb3, 0x16, 0x9e, 0x8d, 0x33, 0x8a, 0x81,
+    0x1e, 0x9a, 0xac, 0xca, 0xe3, 0xd2, 0x32, 0x8e, 0x62, 0x63, 0x93, 0x16, 0x4c, 0xa1, 0x3a, 0x84,
+    0xa0, 0xa4, 0xb6, 0x5a, 0x4a, 0xfe, 0xb7, 0xc5, 0x8c, 0x64, 0xdb, 0x2b, 0xc7, 0x73, 0x2e, 0x31,
+    0x19, 0x2a, 0x77, 0x8f, 0xfa, 0xc8, 0x8c, 0x2d, 0x7d, 0xfe, 0xb4, 0xaf, 0x04, 0xf6, 0xa3, 0x09,
+    0xb7, 0x2f, 0xc8, 0x6a, 0xb1, 0xaf, 0x2c, 0x26, 0xb0, 0x31, 0x33, 0x12, 0xa9, 0x8d, 0xbf, 0xa7,
+    0xc7, 0xd9, 0xbf, 0xb9, 0xcf, 0x0b, 0x8d, 0x57, 0x53, 0x7a, 0x21, 0xfd, 0x3b, 0x7a, 0xbe, 0x76,
+    0x6b, 0xd7, 0xbf, 0xe1, 0xb6, 0x33, 0x19, 0x05, 0x3e, 0xcf, 0x75, 0xfe, 0x48, 0xa5, 0x47, 0x8d,
+    0xff, 0x8b, 0x12, 0x5f, 0xd2, 0xfe, 0x7c, 0xff, 0x6b, 0x39, 0x0f, 0xc1, 0x81, 0xd2, 0x95, 0xe9,
+    0xdd, 0x74, 0x19, 0xab, 0x54, 0x66, 0xef, 0x79, 0x30, 0x71, 0xaf, 0x80, 0xb9, 0x66, 0x8f, 0xce,
+    0x12, 0x01, 0xdb, 0x88, 0x6f, 0x15, 0xba, 0x6d, 0x2b, 0x01, 0xca, 0x29, 0xb7, 0xd5, 0x3b, 0xf2,
+    0x3a, 0xa4, 0xc3, 0x09, 0x53, 0xbf, 0xaa, 0xed, 0xdf, 0xc1, 0xe3, 0xd2, 0x88, 0xa9, 0x15, 0x15,
+    0x1c, 0x95, 0xc4, 0x46, 0xad, 0xac, 0xdc, 0xa2, 0xd7, 0xb4, 0xb6, 0x6a, 0x8a, 0x4d, 0x4f, 0x4d,
+    0xb8, 0x5b, 0x3c, 0x76, 0x51, 0xdd, 0xb2, 0x62, 0x00, 0x37, 0xb9, 0xb0, 0xf4, 0x9e, 0x7d, 0x15,
+    0x84, 0x2c, 0xf1, 0x6b, 0x3d, 0x6c, 0xcf, 0xfe, 0xbb, 0x3b, 0x36, 0xdf, 0x56, 0xd9, 0xb3, 0x85,
+    0xe4, 0xef, 0xe9, 0xda, 0x07, 0x18, 0x30, 0xa9, 0x45, 0xbd, 0x83, 0x8e, 0x4f, 0x72, 0x7f, 0x56,
+    0x8d, 0x0a, 0xda, 0x87, 0x74, 0xe3, 0xeb, 0x63, 0x37, 0x9d, 0xf2, 0x7d, 0xe5, 0x26, 0x66, 0x69,
+    0xfe, 0xed, 0x7c, 0x2c, 0xb4, 0x15, 0x1d, 0xc1, 0x43, 0x4c, 0x69, 0xd1, 0x20, 0x9b, 0xaf, 0x10,
+    0x4b, 0xb8, 0x57, 0xe0, 0xf0, 0x42, 0x3c, 0x5d, 0xee, 0xe4, 0x14, 0x22, 0xfa, 0x5c, 0xe7, 0x8d,
+    0x95, 0x4c, 0x0f, 0x24, 0x63, 0x25, 0x9b, 0x5a, 0xcd, 0xd0, 0xb4, 0x91, 0xa8, 0x9f, 0xe6, 0xda,
+    0x01, 0x0f, 0xca, 0xd9, 0x2d, 0xda, 0x2c, 0xbd, 0xce, 0x06, 0x8e, 0x6d, 0x1c, 0xe1, 0xd6, 0x32,
+    0xa8, 0xe6, 0xd8, 0x1e, 0x72, 0xec, 0xf5, 0x78, 0x1a, 0xb1, 0x4b, 0xd7, 0x66, 0x4a, 0x51, 0x56,
+    0xcd, 0x8b, 0x33, 0x3b, 0xf4, 0xc1, 0x08, 0x7d, 0x1b, 0xcc, 0x3e, 0x8a, 0xc2, 0x86, 0x40, 0x25,
+    0xd3, 0x19, 0x00, 0xc2, 0x1b, 0x86, 0x02, 0xc1, 0x1f, 0x3c, 0x1a, 0x0f, 0x0b, 0x0c, 0xab, 0x76,
+    0x9f, 0x19, 0xb2, 0x27, 0xe8, 0x6e, 0xfd, 0x35, 0x05, 0x91, 0xe0, 0xe1, 0x7c, 0xa1, 0xa8, 0x90,
+    0x83, 0x92, 0xe8, 0xd1, 0x8e, 0xd5, 0x2d, 0x91, 0x8f, 0x65, 0xab, 0x4c, 0x42, 0x56, 0x30, 0x95,
+    0xa5, 0x00, 0x69, 0xe2, 0x42, 0x0b, 0xc7, 0x62, 0x5f, 0x49, 0xa1, 0x29, 0xc9, 0x48, 0xb7, 0xb4,
+    0xff, 0x74, 0xbe, 0x76, 0x9b, 0x4b, 0x37, 0xe6, 0x9f, 0x16, 0x3d, 0x2d, 0xdf, 0x34, 0x7e, 0xd5,
+    0x27, 0xd8, 0xca, 0x7e, 0xc2, 0xee, 0xe6, 0xaa, 0xb7, 0xa2, 0x42, 0x77, 0xe5, 0x13, 0xe6, 0x9b,
+    0x3f, 0x52, 0x32, 0xf6, 0x7c, 0x07, 0x37, 0xa5, 0x82, 0x10, 0x48, 0xc5, 0x6d, 0x8b, 0x19, 0xcc,
+    0x82, 0x4a, 0x6a, 0x9a, 0xc0, 0x60, 0x3b, 0x66, 0x2e, 0x8e, 0x7d, 0x82, 0xe2, 0x0e, 0xeb, 0x5d,
+    0x33, 0x3c, 0xf5, 0xf5, 0x76, 0x77, 0xe7, 0xef, 0x67, 0x79, 0x39, 0xc7, 0x89, 0x59, 0x4b, 0x56,
+    0x69, 0xe0, 0x70, 0x39, 0xeb, 0x97, 0xaa, 0x59, 0x7f, 0x47, 0x7e, 0x97, 0x75, 0x9a, 0xba, 0x86,
+    0xaa, 0x2c, 0xeb, 0x3f, 0x9c, 0xe7, 0x6f, 0x60, 0x9a, 0xa2, 0x65, 0x20, 0xa6, 0x96, 0x33, 0xdb,
+    0xf6, 0x3c, 0xda, 0x9f, 0xfa, 0xdb, 0x98, 0x3d, 0x97, 0xd7, 0x15, 0x1c, 0xbe, 0x1b, 0x8b, 0x93,
+    0xfc, 0xef, 0x64, 0x36, 0xf5, 0x56, 0x05, 0xb7, 0x45, 0xde, 0x7f, 0x26, 0xbb, 0xb7, 0x71, 0x1b,
+    0x61, 0x0f, 0x99, 0x74, 0x69, 0x7b, 0xc6, 0x86, 0x7a, 0x02, 0x45, 0x1e, 0xcf, 0x38, 0x87, 0x09,
+    0x9e, 0xdb, 0xd1, 0x34, 0xe4, 0x14, 0xaa, 0xc7, 0x4c, 0x37, 0x99, 0xf1, 0x1b, 0x7f, 0xd7, 0x3c,
+    0x5f, 0x5b, 0x98, 0xe7, 0x95, 0x4b, 0x9d, 0xe7, 0x9d, 0xbc, 0x91, 0x97, 0x75, 0x1a, 0x77, 0x6e,
+    0xe7, 0x6b, 0xb6, 0x5b, 0x58, 0x96, 0xb1, 0xb9, 0xcc, 0xef, 0x9a, 0xf3, 0xef, 0x62, 0xce, 0xfd,
+    0xc7, 0xfb, 0xda, 0xee, 0xba, 0x95, 0x98, 0x3f, 0x4d, 0x3d, 0xcf, 0xe1, 0x96, 0x9e, 0xd0, 0x9e,
+    0xeb, 0x6e, 0xe3, 0xa1, 0x1d, 0xf1, 0xf7, 0x97, 0x91, 0xe6, 0x2d, 0xde, 0xc5, 0x24, 0xf6, 0xfe,
+    0xe3, 0x11, 0xdd, 0x04, 0xd0, 0xb2, 0x6f, 0x8f, 0x3d, 0x6d, 0x63, 0xe4, 0x88, 0x7f, 0x19, 0x11,
+    0xb2, 0xdb, 0xa2, 0xd8, 0x95, 0xcb, 0xee, 0xf5, 0xee, 0x71, 0xa5, 0xef, 0x0d, 0x33, 0x26, 0x1b,
+    0x1f, 0xc1, 0xc0, 0x72, 0xc7, 0xb8, 0x0d, 0x82, 0xb6, 0x33, 0x9f, 0x01, 0xe2, 0x38, 0x74, 0xc1,
+    0x7a, 0x9e, 0xb9, 0xa0, 0x48, 0x03, 0xdf, 0xbb, 0x86, 0x61, 0x07, 0x1a, 0x16, 0xea, 0x25, 0x05,
+    0x0b, 0xa3, 0x00, 0xcc, 0x27, 0x9c, 0x52, 0x01, 0x24, 0xc0, 0x08, 0x3d, 0xc8, 0x26, 0x9a, 0x1c,
+    0x8b, 0xed, 0x23, 0x38, 0x8c, 0xc7, 0x3e, 0x36, 0xce, 0xf6, 0x09, 0x32, 0x6d, 0x1a, 0x8b, 0x03,
+    0xba, 0xac, 0x2a, 0xc2, 0xdd, 0x2d, 0xac, 0x06, 0x95, 0x75, 0x08, 0x2b, 0xf6, 0x6b, 0xc6, 0xaf,
+    0xdc, 0x28, 0x8e, 0x9a, 0xcc, 0x8d, 0x45, 0xbd, 0x80, 0x13, 0x2f, 0x23, 0x9a, 0x85, 0x2e, 0x68,
+    0x19, 0xdf, 0x62, 0x9f, 0xdc, 0x78, 0x24, 0x2c, 0xb8, 0xc1, 0xd4, 0xa7, 0x0e, 0x21, 0x3d, 0x4f,
+    0xc5, 0xd0, 0xc4, 0xa3, 0x50, 0x4a, 0xad, 0x13, 0x13, 0x2c, 0x8a, 0xb2, 0x57, 0xd3, 0x10, 0xaa,
+    0x0e, 0xd9, 0x4b, 0x3b, 0x77, 0x7d, 0x1e, 0x1d, 0x30, 0xd7, 0xef, 0x5b, 0x89, 0x41, 0x52, 0x38,
+    0x1d, 0x1f, 0x9a, 0x4e, 0xa0, 0xb2, 0x0b, 0x8a, 0x1c, 0x72, 0x38, 0x0c, 0x17, 0x79, 0x11, 0xcb,
+    0x4a, 0xe7, 0x05, 0x0c, 0x65, 0x3b, 0x1c, 0xe2, 0xfd, 0x8e, 0xe7, 0x3d, 0xcf, 0xf6, 0x2f, 0x8c,
+    0x0d, 0x57, 0x5d, 0xea, 0x81, 0xcd, 0x7f, 0xcd, 0xc3, 0x31, 0xb4, 0x1e, 0x2f, 0x8f, 0x9c, 0xc2,
+    0xd0, 0xb4, 0x5e, 0xb6, 0x27, 0x9a, 0x3c, 0xde, 0x45, 0xc6, 0x77, 0xb8, 0xc7, 0x63, 0x7d, 0xff,
+    0x3f, 0xd2, 0xe5, 0xbd, 0x54, 0xd0, 0xe5, 0x4f, 0xb5, 0x34, 0x0a, 0x6e, 0x67, 0xc5, 0x31, 0x11,
+    0xc4, 0x3d, 0x29, 0x0a, 0x95, 0x52, 0x28, 0x22, 0xf4, 0x17, 0x95, 0xbf, 0xbc, 0xcb, 0x38, 0xa9,
+    0xdb, 0x5c, 0xd4, 0x43, 0x9c, 0xdb, 0xbe, 0x83, 0x01, 0x20, 0xe2, 0xca, 0x0d, 0x58, 0x44, 0x10,
+    0x8b, 0x5c, 0x8f, 0x83, 0xbc, 0xf9, 0xc8, 0x6c, 0x75, 0x7a, 0x40, 0xde, 0x82, 0x06, 0xfc, 0x46,
+    0xc9, 0x65, 0xe2, 0xd2, 0x35, 0x10, 0x3e, 0x51, 0x3b, 0x8e, 0xba, 0x56, 0x7e, 0xd4, 0x59, 0xe5,
+    0x1b, 0x1b, 0x22, 0x4a, 0xb1, 0x44, 0x31, 0xb7, 0xd4, 0xa1, 0x05, 0x9d, 0x24, 0xb5, 0xa2, 0x4e,
+    0x13, 0xec, 0x7e, 0x9f, 0x4f, 0xa0, 0xdd, 0x56, 0x7c, 0x45, 0x11, 0xb5, 0xf7, 0x91, 0x81, 0x82,
+    0x9e, 0xa3, 0xe3, 0x1a, 0x19, 0x4e, 0x26, 0x41, 0xf6, 0xda, 0x11, 0xad, 0xfb, 0x09, 0x07, 0x0e,
+    0x8b, 0x93, 0x09, 0x30, 0x91, 0xeb, 0x5b, 0x5b, 0x6e, 0x38, 0x86, 0xf5, 0x01, 0x6f, 0x89, 0x9c,
+    0x39, 0xb2, 0x41, 0x05, 0xef, 0x22, 0x1b, 0x0b, 0xb2, 0x7d, 0x20, 0x29, 0x50, 0xbc, 0x57, 0x14,
+    0xa5, 0x9c, 0x77, 0xc8, 0xfe, 0x4b, 0x19, 0xff, 0x1d, 0x0c, 0xcd, 0x55, 0x96, 0x84, 0xf1, 0x66,
+    0x53, 0x13, 0xd6, 0xf6, 0x5c, 0xff, 0xc1, 0x58, 0x5b, 0xbe, 0x4f, 0x54, 0xc9, 0xbc, 0xaa, 0xbd,
+    0xd6, 0xdc, 0xcd, 0x1a, 0x73, 0x77, 0x5b, 0x93, 0xdb, 0x3a, 0xe6, 0xef, 0xb7, 0x12, 0x4a, 0x4d,
+    0x24, 0x82, 0xec, 0xd9, 0xb7, 0xc9, 0xc6, 0x1b, 0xfb, 0x12, 0x35, 0x31, 0x58, 0x47, 0x3d, 0x8f,
+    0x8f, 0x23, 0x8c, 0xe7, 0xb6, 0xdd, 0x31, 0x0e, 0x3b, 0xc7, 0x8d, 0xfa, 0xd3, 0x28, 0x62, 0x76,
+    0x2f, 0x00, 0x3e, 0xc8, 0x5b, 0x0a, 0x7e, 0x95, 0xcd, 0xf9, 0x47, 0x00, 0x23, 0x14, 0x16, 0xfa,
+    0x60, 0xc9, 0xdf, 0xaa, 0x9b, 0x8b, 0x6a, 0x57, 0x5d, 0x79, 0x20, 0xc9, 0xb1, 0x37, 0x1e, 0xb1,
+    0x5d, 0x8c, 0x31, 0x73, 0x61, 0x76, 0xb8, 0xc6, 0xc9, 0x26, 0xe4, 0x75, 0xc0, 0xcd, 0xbc, 0x80,
+    0x6e, 0x4d, 0x34, 0x87, 0xa4, 0x99, 0x1b, 0xaa, 0x2b, 0x6f, 0x9d, 0x0c, 0xfa, 0x6d, 0x27, 0xb8,
+    0x98, 0xa2, 0x86, 0xa0, 0x58, 0x9f, 0xb6, 0xed, 0x7b, 0xdc, 0x8d, 0xa7, 0x3e, 0xb4, 0xba, 0xdd,
+    0xed, 0x14, 0xe9, 0x71, 0x82, 0x7e, 0x0a, 0x4d, 0xd3, 0x41, 0x40, 0xf7, 0x70, 0x3d, 0xaa, 0x65,
+    0xe6, 0x80, 0xec, 0x8f, 0x7e, 0x2d, 0x67, 0x5b, 0xdd, 0x7d, 0x13, 0x55, 0x5c, 0xde, 0xa9, 0x5d,
+    0xa7, 0xf9, 0xd9, 0xbe, 0xb4, 0x45, 0x2a, 0x30, 0xa6, 0xfd, 0x13, 0x3b, 0xc0, 0x35, 0x11, 0x4c,
+    0x91, 0xe8, 0x3a, 0x71, 0xfb, 0xcc, 0xec, 0xdb, 0x78, 0xf1, 0x24, 0xae, 0x89, 0xe4, 0x49, 0x3b,
+    0xd0, 0xb9, 0x7d, 0x79, 0x38, 0x92, 0x22, 0x7d, 0x28, 0x10, 0x17, 0x4f, 0x95, 0x6e, 0xef, 0xbe,
+    0xd9, 0x7f, 0xbb, 0xb3, 0x7b, 0x78, 0xf4, 0x04, 0xc3, 0xee, 0x99, 0xd4, 0xa2, 0xe8, 0x7b, 0xd1,
+    0xc9, 0xc1, 0xdb, 0xea, 0x7e, 0x30, 0xeb, 0xa7, 0x99, 0x3b, 0x7a, 0xf0, 0xbc, 0x17, 0x87, 0x8a,
+    0xcc, 0x64, 0x62, 0x36, 0x1b, 0x78, 0x9b, 0x23, 0x9e, 0x39, 0x06, 0x76, 0xf3, 0xf0, 0xcd, 0xf1,
+    0xbb, 0xb7, 0x6c, 0x9d, 0xc9, 0x4e, 0x3d, 0x96, 0xc5, 0x4e, 0x09, 0x00, 0xfa, 0x6e, 0x33, 0x06,
+    0x73, 0x03, 0xe4, 0x9f, 0x8b, 0xcb, 0xea, 0x12, 0xbc, 0xf5, 0xc6, 0x19, 0xfb, 0xf6, 0x8d, 0xd5,
+    0xeb, 0x6b, 0xb5, 0x9b, 0xc6, 0x1a, 0xd6, 0x4b, 0xc3, 0x18, 0x56, 0xf8, 0xd0, 0x74, 0x20, 0xd2,
+    0x2e, 0xaf, 0x17, 0x38, 0xc8, 0xcc, 0x4b, 0x3b, 0x64, 0x2e, 0xd4, 0xd9, 0x59, 0x83, 0x9f, 0x97,
+    0x64, 0x37, 0x58, 0xb6, 0xaa, 0x27, 0xb2, 0xc4, 0xfe, 0x33, 0xe4, 0x3d, 0x7d, 0x8a, 0x45, 0x10,
+    0x3a, 0xc9, 0x85, 0x52, 0x39, 0xf0, 0x53, 0xf7, 0x6c, 0xad, 0xe6, 0x82, 0xec, 0x24, 0x49, 0xe2,
+    0x2c, 0xb5, 0xb8, 0x12, 0x72, 0x7f, 0x60, 0xd6, 0x9f, 0xd4, 0x1b, 0x6c, 0x03, 0x6a, 0x43, 0x64,
+    0x39, 0x20, 0x40, 0x97, 0x2f, 0x16, 0x72, 0xda, 0xe5, 0x36, 0xdb, 0x4f, 0xcc, 0xd3, 0xcd, 0xd6,
+    0x7f, 0xdb, 0xad, 0x2f, 0x9d, 0xd6, 0x2f, 0xe7, 0x67, 0x4f, 0x1b, 0x4f, 0xda, 0xc3, 0x66, 0x6a,
+    0xde, 0x98, 0x63, 0x3b, 0xee, 0x8f, 0x9a, 0xa4, 0x7c, 0x10, 0xb1, 0x9c, 0x2c, 0x4d, 0x0a, 0x0d,
+    0x82, 0x21, 0x93, 0xeb, 0xcf, 0x06, 0xfb, 0xb5, 0xd0, 0xc5, 0x08, 0x7a, 0xc6, 0x56, 0x19, 0x61,
+    0x12, 0xdd, 0x78, 0x83, 0xff, 0x83, 0x5f, 0x90, 0x16, 0xb5, 0x75, 0xab, 0x73, 0x9c, 0xc2, 0x9c,
+    0xdb, 0xf6, 0xc4, 0x6d, 0xab, 0x48, 0x06, 0xe8, 0x25, 0x3a, 0x9a, 0x28, 0x16, 0x02, 0x28, 0x4b,
+    0x60, 0xbe, 0x0b, 0xfb, 0x0b, 0x56, 0x0f, 0x44, 0x0c, 0xde, 0xa7, 0x08, 0x5d, 0xa8, 0x4a, 0xbc,
+    0x12, 0x90, 0xeb, 0x40, 0xb3, 0xdc, 0x13, 0x5e, 0x85, 0x47, 0x17, 0xd6, 0xec, 0xab, 0xac, 0x9e,
+    0xd9, 0x9f, 0xac, 0x37, 0xd9, 0x18, 0x9e, 0xe4, 0x9e, 0x19, 0xe4, 0xe6, 0xb7, 0xd1, 0x24, 0x40,
+    0xb2, 0xa9, 0xa3, 0x83, 0x24, 0x89, 0x00, 0xe4, 0x6e, 0xc9, 0x5b, 0x1b, 0xeb, 0xd9, 0x6d, 0x82,
+    0x7a, 0xb3, 0xe6, 0x27, 0x59, 0x39, 0x3f, 0x37, 0x16, 0x43, 0xf7, 0x28, 0x15, 0xd2, 0xfd, 0xa5,
+    0x90, 0x71, 0xf9, 0x49, 0x38, 0xc3, 0x20, 0xaf, 0xe0, 0x16, 0xc3, 0x6c, 0x58, 0x44, 0x43, 0x02,
+    0xe4, 0x96, 0xb8, 0x50, 0xa0, 0x4e, 0xcc, 0x7f, 0xe3, 0x96, 0x64, 0xe3, 0x9a, 0x5b, 0x94, 0x8f,
+    0xd3, 0xdc, 0xcc, 0xc2, 0xad, 0x5e, 0xbb, 0x69, 0xd6, 0x30, 0x40, 0x08, 0xfa, 0x8c, 0xa5, 0x11,
+    0x63, 0xd8, 0xf0, 0xe4, 0x05, 0x7b, 0x45, 0x06, 0x64, 0xc9, 0x74, 0x7c, 0x94, 0xa9, 0x07, 0x33,
+    0x47, 0x26, 0xc2, 0x93, 0x4a, 0xc3, 0x18, 0x27, 0x99, 0x08, 0x8f, 0x75, 0x06, 0x75, 0x0c, 0xe2,
+    0x09, 0x56, 0x21, 0xe3, 0x3f, 0x20, 0x57, 0x3e, 0x41, 0x11, 0x11, 0x67, 0x21, 0x92, 0x10, 0x09,
+    0x82, 0xa7, 0x77, 0x02, 0x61, 0x29, 0x75, 0xeb, 0x0b, 0xc0, 0xa8, 0x47, 0x80, 0xaa, 0xdd, 0xac,
+    0xd5, 0x12, 0xf1, 0x45, 0x81, 0x4a, 0x82, 0x03, 0x50, 0x7e, 0x7f, 0xc0, 0xc1, 0xfe, 0x8f, 0xa3,
+    0xfd, 0xf7, 0x66, 0x3d, 0x23, 0x60, 0x75, 0x5d, 0xe6, 0x55, 0xa2, 0x28, 0x40, 0xc3, 0x3b, 0x2b,
+    0x56, 0x59, 0x60, 0x7a, 0x80, 0x24, 0xca, 0xd2, 0xca, 0x0c, 0x0a, 0xb0, 0x48, 0x22, 0x30, 0xdc,
+    0x51, 0xe3, 0x9d, 0x20, 0x40, 0x46, 0x41, 0xad, 0x3c, 0xae, 0xb3, 0xa7, 0x98, 0x23, 0x06, 0x39,
+    0x65, 0xd0, 0xe8, 0x97, 0xfa, 0x48, 0xae, 0xf6, 0x61, 0x88, 0xaf, 0xaf, 0xb3, 0xba, 0x58, 0xd1,
+    0xd7, 0x49, 0xd3, 0x10, 0xa4, 0x48, 0x30, 0xeb, 0x78, 0x83, 0x03, 0x0e, 0x6f, 0x68, 0xce, 0x7b,
+    0x5a, 0xdf, 0x27, 0x84, 0x9f, 0x4a, 0x3a, 0xcf, 0xc4, 0x78, 0x6c, 0xe0, 0x28, 0x64, 0x1c, 0x4c,
+    0xde, 0x04, 0x07, 0x1e, 0x4f, 0xad, 0x82, 0x5e, 0x93, 0x03, 0x56, 0xea, 0xc0, 0xc7, 0x69, 0x3c,
+    0x25, 0xe8, 0x3f, 0xa0, 0x6d, 0x62, 0xd6, 0x29, 0xe8, 0x92, 0x23, 0xb3, 0x15, 0x12, 0x0b, 0xa1,
+    0xac, 0x14, 0x14, 0x49, 0xef, 0x36, 0x94, 0x06, 0xf8, 0xc1, 0xd4, 0x99, 0x03, 0x49, 0x8b, 0x4f,
+    0x32, 0xd8, 0x75, 0x3b, 0xbb, 0x5b, 0x27, 0xaf, 0xa1, 0xeb, 0xc8, 0x6c, 0x5f, 0xa3, 0x24, 0xb0,
+    0x18, 0xe2, 0x3d, 0x87, 0x8e, 0x09, 0x73, 0xec, 0x55, 0x54, 0xda, 0x98, 0xbe, 0x49, 0xc7, 0xc4,
+    0xc4, 0xb1, 0x32, 0x4c, 0xce, 0x1e, 0xc5, 0x93, 0x40, 0x28, 0x41, 0xc4, 0x09, 0x3c, 0x5e, 0x81,
+    0x4d, 0x6f, 0xc8, 0xee, 0x4f, 0x44, 0x4b, 0xe8, 0x2b, 0xed, 0xe0, 0x19, 0x6b, 0xa7, 0xa7, 0x16,
+    0x00, 0x91, 0x9c, 0x97, 0xe4, 0xe5, 0xac, 0x96, 0x3a, 0x4b, 0xc8, 0x70, 0x8a, 0x08, 0x7c, 0xe0,
+    0x0d, 0x94, 0xf4, 0xad, 0x5e, 0x84, 0xf7, 0xb5, 0x66, 0xc4, 0x8d, 0x14, 0x6b, 0x8e, 0xc8, 0x1f,
+    0x4c, 0x6e, 0x89, 0x59, 0x5d, 0xd1, 0xe1, 0x3a, 0x48, 0x01, 0xd8, 0x43, 0x11, 0xd8, 0x53, 0x96,
+    0x17, 0x0c, 0x99, 0x99, 0x69, 0x99, 0x94, 0x9c, 0x2c, 0x9e, 0x62, 0x6b, 0xb1, 0x2e, 0x65, 0x1e,
+    0xe0, 0x58, 0xd8, 0xf5, 0xc8, 0x81, 0xb5, 0x75, 0xbd, 0xe7, 0x98, 0xda, 0x19, 0xb1, 0x86, 0xa5,
+    0x5c, 0x37, 0x38, 0x15, 0x85, 0x53, 0xae, 0x89, 0xcb, 0x5d, 0x8b, 0x4b, 0x16, 0x09, 0x09, 0x42,
+    0x1a, 0x89, 0x77, 0x48, 0x88, 0xec, 0x74, 0x43, 0x05, 0xaa, 0x76, 0x7f, 0x86, 0x7f, 0xdd, 0x67,
+    0x06, 0x02, 0xcb, 0xfb, 0xc3, 0x45, 0x14, 0xa7, 0x50, 0xe4, 0x46, 0xdf, 0x0b, 0x22, 0xbe, 0x25,
+    0xae, 0x77, 0x58, 0x15, 0x78, 0x9b, 0x35, 0xc3, 0xe1, 0xbd, 0xe9, 0x50, 0x7b, 0xf7, 0x39, 0x3a,
+    0xe3, 0xf7, 0xfd, 0xe3, 0x60, 0xa2, 0xa5, 0xaa, 0xc3, 0xbd, 0x5b, 0x76, 0xa8, 0xa7, 0xca, 0x2b,
+    0x5a, 0xb7, 0xd1, 0xdc, 0x84, 0x74, 0x83, 0xaa, 0xc5, 0x3b, 0x4a, 0xc5, 0xcd, 0x9a, 0x06, 0x95,
+    0xe4, 0x97, 0xd0, 0xc6, 0x1d, 0x58, 0xd7, 0x91, 0x7f, 0x37, 0xd2, 0xca, 0xcb, 0x63, 0xe9, 0x90,
+    0xe2, 0x4f, 0x3d, 0x0f, 0x12, 0x90, 0xcb, 0x3b, 0xd3, 0x50, 0xc4, 0x64, 0x03, 0xbe, 0xe5, 0x4e,
+    0x07, 0x71, 0x8c, 0x60, 0x7c, 0xea, 0xc9, 0xdd, 0x8e, 0x48, 0x8f, 0x41, 0xd5, 0xef, 0x4f, 0x63,
+    0x4c, 0x5a, 0x91, 0x49, 0x20, 0xee, 0x60, 0xcc, 0x72, 0xe7, 0x38, 0xcd, 0x52, 0xd0, 0x88, 0x7c,
+    0xd7, 0x8e, 0x60, 0xc0, 0x60, 0x6a, 0x34, 0xc3, 0x07, 0x89, 0x3c, 0x4d, 0x46, 0x43, 0x0f, 0xda,
+    0x28, 0xc1, 0xdf, 0xd1, 0x32, 0x07, 0xd3, 0xd1, 0x38, 0xdf, 0xf3, 0x15, 0x7c, 0x36, 0x1d, 0xeb,
+    0xa9, 0x68, 0x29, 0x32, 0x3f, 0xcd, 0xda, 0x9f, 0x70, 0xbf, 0x90, 0x9d, 0x51, 0xb9, 0xd0, 0xa3,
+    0xf1, 0x21, 0x36, 0x20, 0x04, 0x7a, 0x4c, 0x2a, 0xd4, 0x24, 0x3f, 0x24, 0x32, 0x7c, 0xbf, 0xf7,
+    0x19, 0xc6, 0x8b, 0x75, 0xc1, 0xaf, 0x23, 0x13, 0xd3, 0xc0, 0x7a, 0x01, 0x33, 0xd1, 0xef, 0x73,
+    0xeb, 0x1c, 0x77, 0xba, 0x3d, 0x8b, 0x00, 0xf1, 0x14, 0xfd, 0x6e, 0xd6, 0xa8, 0x82, 0x12, 0xf8,
+    0x29, 0x0a, 0x30, 0x75, 0x94, 0xee, 0x04, 0x13, 0x12, 0x84, 0x22, 0x8b, 0x04, 0x04, 0xf2, 0xdc,
+    0x07, 0x3c, 0xd5, 0xb8, 0x4f, 0x01, 0x11, 0xaa, 0x33, 0xa5, 0x2f, 0x5e, 0x51, 0x94, 0x1f, 0x20,
+    0x02, 0x74, 0xa7, 0x38, 0xc6, 0xce, 0xe4, 0x01, 0xfd, 0x7a, 0xbb, 0x8e, 0x87, 0xfa, 0x3d, 0x98,
+    0x10, 0x35, 0x32, 0xb8, 0xa7, 0x19, 0x41, 0x80, 0x12, 0x6c, 0xaa, 0xb1, 0xd9, 0x90, 0xa6, 0x1c,
+    0xdb, 0xc0, 0xeb, 0xb4, 0x6f, 0xe4, 0x91, 0x7e, 0x21, 0xea, 0x66, 0xfb, 0x4f, 0xcb, 0x1c, 0x4f,
+    0x96, 0xbf, 0xbd, 0x3b, 0x58, 0xfe, 0x16, 0x0c, 0x87, 0xdf, 0x66, 0xf6, 0xe5, 0xb7, 0x4f, 0x9b,
+    0x1f, 0xbf, 0xed, 0xbf, 0x7e, 0xfd, 0x6d, 0x36, 0xb6, 0xbf, 0x7d, 0x7a, 0xb7, 0xf9, 0x0d, 0xd6,
+    0x70, 0xdf, 0x36, 0xb7, 0xb7, 0xbf, 0x0d, 0xc0, 0x22, 0xfb, 0xf6, 0x0a, 0xec, 0xe0, 0x6f, 0xe3,
+    0x67, 0xf6, 0xb7, 0x77, 0xcf, 0x36, 0x1b, 0x3f, 0xb4, 0xdd, 0x86, 0x85, 0xd7, 0xe9, 0x9b, 0x29,
+    0xb1, 0x0d, 0x1a, 0xc2, 0x99, 0x06, 0x82, 0xc6, 0x3d, 0x47, 0x65, 0x79, 0x4b, 0xbb, 0x9b, 0xac,
+    0x6e, 0xe3, 0x69, 0xc2, 0xba, 0xae, 0xfc, 0x91, 0xca, 0xf9, 0xc5, 0x4e, 0xeb, 0x88, 0xbb, 0x7e,
+    0x86, 0xea, 0x44, 0xac, 0x5c, 0x8b, 0x14, 0xc8, 0x73, 0x5c, 0x0b, 0xf6, 0x3e, 0xda, 0x7f, 0x59,
+    0x20, 0x58, 0x0d, 0x80, 0x8e, 0x5d, 0xa4, 0x78, 0x53, 0xe3, 0x5b, 0x32, 0x99, 0x80, 0x62, 0xc6,
+    0xb3, 0x70, 0x6c, 0x57, 0x1e, 0xfa, 0x4f, 0xb4, 0x2b, 0xd8, 0x8a, 0x7c, 0xe8, 0xfa, 0xd2, 0x38,
+    0xc4, 0x92, 0x47, 0x52, 0x65, 0xbf, 0x07, 0xb4, 0x07, 0x36, 0x70, 0x0d, 0x1a, 0x65, 0x88, 0x59,
+    0x4d, 0xbf, 0xe0, 0x43, 0x29, 0x6d, 0x82, 0x26, 0xba, 0x2c, 0xf1, 0xbd, 0x84, 0xac, 0xea, 0x4e,
+    0x45, 0x5b, 0x2d, 0x0d, 0x68, 0xc6, 0x5c, 0x4f, 0x54, 0x21, 0x2e, 0x4c, 0x70, 0x66, 0xa5, 0x46,
+    0x11, 0x1a, 0x7a, 0x9a, 0x40, 0xcd, 0x65, 0x1a, 0xfb, 0x51, 0x85, 0xca, 0x2e, 0x9d, 0x58, 0x4e,
+    0x4b, 0x0e, 0x96, 0x63, 0x7d, 0xf0, 0x2b, 0xa6, 0x1b, 0x62, 0x74, 0xca, 0x61, 0xaa, 0x1e, 0x79,
+    0x29, 0x38, 0x29, 0x8e, 0xe0, 0x49, 0xec, 0x56, 0xe6, 0xc0, 0x24, 0xde, 0x9e, 0x01, 0xe5, 0x4d,
+    0x31, 0xdd, 0x5b, 0xda, 0x29, 0x55, 0xbc, 0xd4, 0x02, 0xd4, 0x87, 0xcc, 0x79, 0xac, 0x0e, 0xfa,
+    0x32, 0x01, 0x52, 0x47, 0xc5, 0x8f, 0x67, 0x85, 0x36, 0x69, 0xce, 0x52, 0xd3, 0x63, 0x3a, 0x94,
+    0xea, 0xa7, 0xe2, 0x70, 0xc7, 0x32, 0xd2, 0x69, 0x67, 0x81, 0x9a, 0xa4, 0x4c, 0xe6, 0x91, 0x4c,
+    0xd2, 0x5b, 0xa0, 0x58, 0x50, 0x55, 0x46, 0xaf, 0x6a, 0xcb, 0x43, 0x50, 0xdc, 0xbd, 0x8d, 0x62,
+    0xb3, 0x54, 0xba, 0x1e, 0x49, 0x1d, 0x95, 0x63, 0xbd, 0x3e, 0xf0, 0xd2, 0xac, 0xe4, 0x2c, 0xaa,
+    0x52, 0x72, 0x21, 0x1f, 0x48, 0xf3, 0x30, 0x27, 0x9b, 0x42, 0x16, 0x4d, 0xaa, 0xbe, 0x89, 0x97,
+    0xb7, 0x03, 0x18, 0x00, 0x93, 0x06, 0x54, 0xe4, 0x09, 0x1d, 0x64, 0x3e, 0x82, 0x77, 0xa9, 0xa1,
+    0x00, 0x6d, 0xc6, 0xdd, 0xb9, 0x06, 0xe6, 0xb2, 0x28, 0x0b, 0x7f, 0x4f, 0x3b, 0x67, 0x42, 0x2f,
+    0xf6, 0x47, 0xae, 0xe7, 0xc0, 0x80, 0xa4, 0x9a, 0x8d, 0x4c, 0xcd, 0x46, 0x52, 0xb3, 0x81, 0x35,
+    0x29, 0xc8, 0x73, 0x27, 0x18, 0x1b, 0x4d, 0xc0, 0x21, 0x6c, 0x24, 0x79, 0xf5, 0x3f, 0xb9, 0xed,
+    0x9b, 0x6c, 0x36, 0xe2, 0xbe, 0xf0, 0x81, 0xa0, 0x57, 0xc0, 0x0f, 0x04, 0x7e, 0xd6, 0xda, 0xc0,
+    0xa9, 0x82, 0x6e, 0xa5, 0x87, 0xc4, 0x98, 0x5d, 0xf3, 0x38, 0xf1, 0x9f, 0xc1, 0x70, 0x05, 0xc2,
+    0x15, 0x76, 0xa5, 0x5e, 0x5f, 0x82, 0xf5, 0x88, 0xca, 0x97, 0x90, 0x63, 0x07, 0x9b, 0xa2, 0x46,
+    0xd4, 0x26, 0x15, 0x23, 0xbb, 0xa4, 0xeb, 0x95, 0x21, 0x92, 0x0c, 0x62, 0x27, 0xc0, 0x3b, 0xc2,
+    0x4d, 0xcc, 0x6b, 0xb2, 0xbe, 0xed, 0x79, 0xe8, 0x74, 0x6f, 0xb2, 0xa0, 0xf7, 0x19, 0xb9, 0x00,
+    0x3f, 0xd6, 0x34, 0xf4, 0x18, 0xfd, 0xb7, 0xce, 0x04, 0x06, 0x4c, 0x44, 0x84, 0xc7, 0x24, 0x98,
+    0xcc, 0xf8, 0x1c, 0xc1, 0xac, 0x2e, 0x92, 0xe5, 0x55, 0x06, 0x98, 0x83, 0x02, 0x3b, 0x11, 0x53,
+    0x25, 0x3a, 0x6d, 0x10, 0x68, 0x4d, 0x7d, 0x91, 0x69, 0x6f, 0xeb, 0xdd, 0xb3, 0xe5, 0x9f, 0x61,
+    0xce, 0xc5, 0x32, 0xc2, 0xb0, 0xdd, 0x96, 0x59, 0xcc, 0xc8, 0x66, 0x4e, 0xfb, 0x7d, 0xfc, 0xd0,
+    0x03, 0x1a, 0x52, 0x92, 0x64, 0x12, 0x1b, 0xe1, 0x82, 0x38, 0xa2, 0xf8, 0x94, 0x26, 0xfb, 0xfc,
+    0xd7, 0xef, 0x6f, 0x0e, 0x95, 0x54, 0xa9, 0x46, 0xe0, 0xbb, 0x7a, 0xa6, 0x32, 0xa2, 0xb3, 0x04,
+    0xa1, 0x3c, 0x0c, 0x83, 0x50, 0x34, 0x2a, 0xc1, 0x4b, 0x58, 0xb2, 0x88, 0x09, 0xec, 0x78, 0x14,
+    0x82, 0xed, 0x4a, 0xe8, 0x52, 0xfb, 0xd3, 0x34, 0x36, 0xff, 0xb1, 0xf9, 0xbb, 0x00, 0x30, 0x88,
+    0xf1, 0x64, 0x88, 0x0d, 0x79, 0xb8, 0x86, 0x0c, 0x84, 0x6a, 0x3e, 0x7f, 0xa0, 0xaf, 0xeb, 0xe0,
+    0x67, 0x5c, 0x4c, 0xec, 0x4e, 0x9c, 0x75, 0x40, 0x3c, 0x44, 0x87, 0x23, 0x4c, 0xc2, 0x03, 0x10,
+    0xa6, 0x1d, 0xa0, 0x2f, 0xc7, 0x04, 0x61, 0xab, 0x96, 0x72, 0xe7, 0x6b, 0x4d, 0xf8, 0x6f, 0x81,
+    0x7e, 0x30, 0x61, 0x70, 0x7f, 0x49, 0xcc, 0x04, 0x88, 0x5f, 0x22, 0xcb, 0x54, 0xe0, 0xd0, 0x0e,
+    0x46, 0x49, 0x1d, 0x4d, 0x76, 0xae, 0x34, 0xf8, 0x42, 0x55, 0xed, 0xec, 0xbe, 0xdd, 0x3d, 0xde,
+    0x05, 0xde, 0xd0, 0x37, 0x0d, 0x44, 0xe1, 0xb4, 0xea, 0xb4, 0x9a, 0x4c, 0xed, 0x13, 0x74, 0x7d,
+    0x3c, 0x40, 0xe5, 0x07, 0x9b, 0xc7, 0xdb, 0x6f, 0xaa, 0xea, 0x4e, 0x2a, 0xc9, 0x56, 0x0d, 0xe6,
+    0xd8, 0x43, 0xd4, 0x8c, 0x5e, 0xf2, 0xaa, 0x8a, 0x65, 0x15, 0xd9, 0x7a, 0xa7, 0x0f, 0x52, 0xed,
+    0x49, 0x75, 0xad, 0xd3, 0xa4, 0x52, 0x78, 0xc3, 0xcd, 0x14, 0xb1, 0x0f, 0xb1, 0xca, 0xc4, 0xa6,
+    0x19, 0xcd, 0x0b, 0xa8, 0x71, 0x92, 0xed, 0x18, 0x74, 0x24, 0x92, 0x7c, 0x27, 0x1f, 0x4f, 0x09,
+    0x06, 0x6a, 0x33, 0x06, 0xfd, 0x95, 0xe4, 0x90, 0x04, 0x18, 0x3c, 0x71, 0x1f, 0xc0, 0x1a, 0x32,
+    0x2b, 0xa2, 0xda, 0x9e, 0x51, 0xb2, 0x7a, 0xc7, 0xe3, 0xfa, 0xa0, 0x64, 0x2a, 0xd6, 0x43, 0xf5,
+    0x64, 0x07, 0x46, 0xcc, 0x26, 0x3c, 0x12, 0x13, 0xfe, 0x23, 0x7a, 0x4e, 0x55, 0x72, 0xcd, 0xf6,
+    0x78, 0x18, 0x9b, 0xc6, 0x81, 0xc7, 0x71, 0xc3, 0x52, 0x9e, 0xb1, 0xb7, 0xf5, 0x76, 0x3c, 0xc2,
+    0x01, 0x96, 0xd1, 0xdc, 0x30, 0x90, 0x89, 0x86, 0x20, 0x1c, 0x53, 0x37, 0xac, 0xd3, 0xae, 0xe9,
+    0x2b, 0xf9, 0x8a, 0xaa, 0x5f, 0x65, 0x59, 0xf8, 0x81, 0x0e, 0x3f, 0x43, 0x4e, 0x53, 0xd0, 0x0e,
+    0x1a, 0x3f, 0x7d, 0xb2, 0xc8, 0xc5, 0x87, 0x73, 0xa4, 0xf1, 0xb8, 0xb8, 0xa3, 0x83, 0x56, 0xe8,
+    0x15, 0xd0, 0x28, 0x10, 0x80, 0x65, 0x6f, 0x59, 0x16, 0xd2, 0xf4, 0x83, 0x18, 0xdd, 0x5f, 0x6b,
+    0xa0, 0x23, 0x57, 0x59, 0x5d, 0xee, 0xcb, 0xd5, 0x9b, 0x35, 0x9c, 0xb3, 0x21, 0x01, 0xe5, 0xa6,
+    0xae, 0x38, 0xa8, 0x28, 0x6a, 0xd6, 0x80, 0x03, 0xa8, 0xd4, 0x76, 0x44, 0xb2, 0x58, 0x4b, 0x69,
+    0x9a, 0x53, 0xa6, 0xe5, 0x8c, 0x3b, 0x51, 0xb7, 0x5a, 0x66, 0x17, 0x6f, 0x58, 0x4b, 0xaf, 0xfc,
+    0x4a, 0x14, 0x1a, 0x87, 0x09, 0x83, 0x5b, 0x6a, 0x59, 0x23, 0x2e, 0x00, 0x34, 0xb3, 0xcb, 0x68,
+    0xd5, 0x26, 0xea, 0x62, 0xec, 0x52, 0xa7, 0xa4, 0x3b, 0xe9, 0x02, 0xaf, 0xb5, 0x87, 0x98, 0x92,
+    0xa1, 0xed, 0xd2, 0xe8, 0x6c, 0x1b, 0x65, 0xd3, 0x73, 0xa9, 0x2c, 0xe0, 0x76, 0xb5, 0xe8, 0x59,
+    0xa6, 0xdc, 0x13, 0x48, 0x6e, 0x7e, 0x2a, 0x47, 0x6c, 0x95, 0xc2, 0x98, 0xb9, 0xd3, 0x4c, 0x09,
+    0xa4, 0xb6, 0x72, 0xa9, 0xac, 0x5c, 0x88, 0x79, 0x1c, 0x48, 0x0a, 0xca, 0x2a, 0xce, 0xda, 0x10,
+    0x91, 0x36, 0x0f, 0x6b, 0x7d, 0xe0, 0xa7, 0x33, 0x36, 0x10, 0xaa, 0x03, 0xe5, 0x8d, 0x9f, 0xaf,
+    0xaa, 0x8f, 0x8a, 0x40, 0x98, 0x91, 0xae, 0x5d, 0xc8, 0xd6, 0x18, 0xdb, 0x13, 0x04, 0x44, 0x0a,
+    0xc5, 0x6d, 0x6c, 0xf2, 0xf6, 0x30, 0xf9, 0x55, 0x9b, 0x3c, 0x05, 0xea, 0x45, 0xde, 0xdc, 0x86,
+    0x04, 0x01, 0x45, 0xb2, 0x42, 0x91, 0xf8, 0x3e, 0x67, 0x30, 0x64, 0xa4, 0xe5, 0x40, 0xd4, 0x81,
+    0x39, 0xa0, 0xa0, 0xd8, 0x53, 0x26, 0x4d, 0xf9, 0x9b, 0xc2, 0x58, 0x50, 0xf2, 0xf1, 0x2b, 0x42,
+    0xac, 0xd7, 0x25, 0x28, 0xfc, 0x98, 0x45, 0xf9, 0x95, 0xf7, 0xa3, 0x01, 0x5f, 0xdc, 0xc8, 0xac,
+    0xaf, 0x2a, 0x67, 0x1a, 0xfa, 0xd3, 0xeb, 0x3f, 0x72, 0x91, 0xb9, 0xde, 0xad, 0x83, 0x4e, 0xac,
+    0xd7, 0x1b, 0xe5, 0xa3, 0x8b, 0x8c, 0x82, 0x92, 0x51, 0x94, 0x1d, 0x6d, 0x32, 0xe9, 0x6a, 0x14,
+    0xae, 0xa6, 0xf3, 0xbe, 0xd2, 0x68, 0x90, 0x2a, 0x25, 0x7f, 0x06, 0x6b, 0xed, 0x60, 0x66, 0xfd,
+    0xfe, 0xee, 0xed, 0x9b, 0x38, 0x9e, 0x1c, 0xf2, 0xbf, 0xa6, 0xa8, 0xac, 0xa1, 0x99, 0x00, 0x62,
+    0x09, 0x41, 0xb0, 0x6c, 0xc7, 0xd9, 0xc5, 0x71, 0x85, 0x97, 0x97, 0xa0, 0x8b, 0xdd, 0x4c, 0xef,
+    0x61, 0x4b, 0xd7, 0x48, 0x26, 0xbf, 0x8c, 0x95, 0x5d, 0x02, 0x8f, 0x52, 0xe0, 0xb6, 0x83, 0x31,
+    0xe8, 0x6f, 0x5c, 0x31, 0xaa, 0xaa, 0x27, 0x3c, 0xc4, 0xf0, 0x1d, 0xcc, 0xa0, 0x58, 0x83, 0x75,
+    0x46, 0xd0, 0x42, 0x73, 0xb7, 0xe9, 0x25, 0x0e, 0x62, 0xdb, 0x03, 0x56, 0x15, 0x20, 0x27, 0x68,
+    0x38, 0xed, 0x01, 0x33, 0xf3, 0x59, 0x3f, 0xe1, 0x27, 0x93, 0x72, 0xc3, 0x3d, 0x07, 0x23, 0x47,
+    0xb5, 0x4c, 0x45, 0x64, 0x39, 0x1c, 0x4f, 0x59, 0xfd, 0x49, 0x5d, 0xa8, 0xc5, 0x8a, 0x2b, 0xe5,
+    0x1a, 0xf8, 0xb1, 0x42, 0xbc, 0xb0, 0xde, 0x89, 0xd1, 0xaf, 0x2e, 0x11, 0x48, 0x8d, 0xa9, 0xde,
+    0xc8, 0xf2, 0x6a, 0x0a, 0x8e, 0xa4, 0xba, 0x1c, 0x7a, 0x73, 0x0d, 0x7d, 0xed, 0xd2, 0xc8, 0x5b,
+    0x5d, 0xc8, 0xc4, 0x2b, 0x51, 0x5e, 0x4c, 0x22, 0x20, 0x25, 0x36, 0x97, 0x54, 0x5d, 0x8d, 0x67,
+    0x4a, 0x2d, 0xac, 0x38, 0xd4, 0x8e, 0x12, 0xba, 0x57, 0x17, 0x2b, 0x44, 0x57, 0x4e, 0xa2, 0x68,
+    0xfb, 0x7e, 0xb2, 0x11, 0x87, 0xa5, 0x95, 0xd5, 0x67, 0xe4, 0x86, 0x8a, 0x1a, 0x55, 0xcd, 0x6c,
+    0x77, 0x34, 0xc4, 0x88, 0xff, 0x84, 0xeb, 0x85, 0x19, 0x1b, 0xd9, 0x97, 0x9c, 0x64, 0xfe, 0x11,
+    0x0e, 0x74, 0x61, 0x78, 0x6d, 0xcb, 0x15, 0x03, 0x0e, 0xe0, 0x48, 0xea, 0x1a, 0x90, 0x52, 0x9c,
+    0x3d, 0x76, 0x94, 0x76, 0xc1, 0x64, 0xb9, 0x6a, 0x47, 0x36, 0x0c, 0x60, 0xb1, 0x08, 0x0b, 0x18,
+    0x4d, 0x39, 0xdd, 0x64, 0xbc, 0xdd, 0x6a, 0xf2, 0x91, 0x21, 0x30, 0xba, 0x45, 0x20, 0xbe, 0xc3,
+    0xb7, 0x93, 0x5a, 0x96, 0x88, 0x64, 0xcf, 0xb9, 0xd3, 0xda, 0x4d, 0x48, 0x9f, 0x5f, 0xa2, 0x29,
+    0x25, 0xb2, 0x9c, 0xf6, 0x41, 0x43, 0x49, 0x5a, 0x99, 0x14, 0x5c, 0x07, 0xa3, 0x52, 0x68, 0xa1,
+    0x82, 0x6b, 0x41, 0xb3, 0x78, 0xcb, 0xfa, 0xb7, 0x00, 0x7f, 0x93, 0x36, 0x0c, 0x79, 0x86, 0xb7,
+    0xf7, 0x1f, 0x81, 0x11, 0x60, 0x32, 0x10, 0xc3, 0x1e, 0x53, 0x43, 0x98, 0x91, 0x9e, 0x66, 0x3f,
+    0xfe, 0xc8, 0x1e, 0xf5, 0xe8, 0x49, 0xf3, 0x87, 0xb5, 0xba, 0x72, 0xe5, 0xce, 0x1e, 0x25, 0x50,
+    0x05, 0xa0, 0x04, 0xc6, 0x26, 0x83, 0x03, 0x16, 0x75, 0x3d, 0xf1, 0xd0, 0xd0, 0xf0, 0xac, 0xe5,
+    0x80, 0x36, 0x8a, 0x40, 0x04, 0x23, 0x9f, 0x3b, 0x19, 0xea, 0xfb, 0x21, 0xb7, 0xa5, 0x28, 0xc8,
+    0x4e, 0x4c, 0x9d, 0x34, 0x0f, 0xc9, 0x17, 0x52, 0x1b, 0xc9, 0x7c, 0x21, 0x17, 0x9c, 0xf9, 0xb5,
+    0x26, 0x7e, 0x6c, 0x4d, 0x06, 0xa2, 0x81, 0xb1, 0x19, 0xe2, 0x77, 0x9b, 0x08, 0xa9, 0xf0, 0x39,
+    0x30, 0x98, 0x68, 0xe9, 0xfb, 0x89, 0xf5, 0x76, 0x1d, 0xe7, 0x2f, 0xfb, 0x32, 0x70, 0x1d, 0x78,
+    0x81, 0x37, 0xb1, 0x04, 0xce, 0xe3, 0x27, 0xb3, 0x81, 0xe6, 0xc7, 0x5c, 0xbd, 0x86, 0xa1, 0x2c,
+    0x42, 0xb1, 0xba, 0x5e, 0x97, 0x9f, 0x32, 0x5c, 0x95, 0x4b, 0x60, 0xdc, 0x78, 0x92, 0xb3, 0x06,
+    0xb4, 0xe4, 0x58, 0xf9, 0x0a, 0x1b, 0x6a, 0xf2, 0x10, 0x53, 0xee, 0x6a, 0xbe, 0x41, 0x4f, 0xb1,
+    0x3e, 0xf8, 0xab, 0x21, 0x49, 0xa6, 0x69, 0x89, 0x1a, 0xde, 0xc5, 0xa2, 0x52, 0x32, 0x83, 0xea,
+    0xcf, 0x30, 0xa4, 0x6c, 0x6c, 0xde, 0x7b, 0xa8, 0xdc, 0xd7, 0x39, 0x91, 0xb0, 0x0d, 0x8c, 0x50,
+    0xb1, 0x33, 0xbf, 0xde, 0x59, 0x73, 0x5f, 0xe6, 0x7c, 0x0c, 0x6b, 0xb8, 0x19, 0x5f, 0x23, 0x27,
+    0x83, 0x25, 0xc8, 0x16, 0x4c, 0x57, 0x60, 0xa7, 0xee, 0x99, 0x45, 0x9b, 0x74, 0x37, 0x7a, 0x03,
+    0x75, 0x97, 0xc4, 0xdf, 0xa3, 0x03, 0xe6, 0x69, 0xca, 0xac, 0xc8, 0x7d, 0xa7, 0xce, 0x4c, 0x6a,
+    0x2c, 0xa8, 0xcd, 0xcc, 0x50, 0xca, 0x6b, 0xce, 0xa4, 0xd8, 0x4d, 0x56, 0x93, 0x64, 0x64, 0x4d,
+    0xf6, 0x49, 0x2c, 0x9d, 0x26, 0xc2, 0xfc, 0x55, 0x32, 0x44, 0xd1, 0x1a, 0x32, 0x47, 0x7a, 0x26,
+    0x13, 0x27, 0xf5, 0xfd, 0x1d, 0xe9, 0x9a, 0x03, 0x3d, 0x11, 0xe1, 0x86, 0x5e, 0x95, 0xf0, 0x28,
+    0x6a, 0xee, 0xf0, 0x84, 0x06, 0xf4, 0x73, 0x6b, 0x3a, 0x06, 0xd3, 0x33, 0x4d, 0x2b, 0x74, 0x90,
+    0x18, 0x3a, 0xa9, 0xae, 0xa1, 0x0a, 0x23, 0x52, 0xa1, 0xba, 0x42, 0x65, 0x77, 0x59, 0x47, 0xac,
+    0x69, 0x91, 0x24, 0xeb, 0x18, 0x47, 0xf2, 0x92, 0xb0, 0xe6, 0x42, 0x47, 0x32, 0x33, 0xc4, 0x36,
+    0xa9, 0x3f, 0x86, 0xec, 0x34, 0x24, 0x9f, 0x84, 0x46, 0x14, 0x9c, 0x52, 0x54, 0xea, 0x5a, 0x52,
+    0xa7, 0x1c, 0x24, 0xbc, 0x21, 0xe4, 0x1b, 0x17, 0xd9, 0xf9, 0x46, 0x66, 0xe6, 0xbf, 0xde, 0x14,
+    0x0a, 0x63, 0xf6, 0xd1, 0x35, 0x18, 0x80, 0x63, 0x24, 0xdf, 0x54, 0xce, 0xcd, 0xea, 0x76, 0xe1,
+    0x36, 0x1e, 0xa4, 0x1a, 0x6c, 0x95, 0x76, 0xf4, 0xd0, 0xd0, 0x3d, 0x57, 0xcb, 0x7f, 0x4c, 0x14,
+    0xfb, 0x4d, 0x75, 0x68, 0x77, 0x5f, 0x1a, 0x0e, 0x49, 0xa2, 0x21, 0xbe, 0xbd, 0x4d, 0x45, 0x99,
+    0x01, 0xe8, 0xdc, 0x89, 0x78, 0xc3, 0x6c, 0x8c, 0x0f, 0xa0, 0xbd, 0x72, 0x84, 0xff, 0xfa, 0x5f,
+    0x42, 0xf9, 0x81, 0x5e, 0x05, 0xe3, 0x0a, 0x0c, 0x28, 0x8e, 0xb5, 0xa1, 0xbc, 0x72, 0x47, 0xed,
+    0x59, 0x25, 0x56, 0xb4, 0x74, 0x13, 0x83, 0xed, 0x2c, 0x87, 0xc2, 0x2a, 0x3b, 0x3d, 0xcb, 0x2b,
+    0x46, 0xc2, 0xa4, 0xe9, 0x3e, 0x81, 0x03, 0x6d, 0xba, 0x1a, 0x6d, 0x8f, 0x44, 0x75, 0x84, 0x55,
+    0xb8, 0xe8, 0x19, 0xa3, 0xd9, 0xeb, 0xb4, 0xc1, 0x26, 0xae, 0xaf, 0x27, 0xa1, 0xa6, 0x02, 0x64,
+    0x49, 0x95, 0xc1, 0xa0, 0xd0, 0x11, 0x84, 0xd8, 0xa7, 0xa9, 0x00, 0x69, 0x09, 0xa9, 0x25, 0x40,
+    0x79, 0xab, 0xfd, 0xdc, 0x1a, 0x11, 0x70, 0xe2, 0x4d, 0x87, 0xae, 0x0f, 0x16, 0xe6, 0x29, 0xc5,
+    0xd4, 0x41, 0xef, 0x80, 0xb1, 0x36, 0x05, 0x43, 0x5d, 0x75, 0x2a, 0x3e, 0x61, 0x3b, 0x8c, 0x33,
+    0xb9, 0x88, 0x10, 0x10, 0x14, 0x35, 0x03, 0xdc, 0xd5, 0x6d, 0xd3, 0xbf, 0x47, 0xc7, 0x91, 0x90,
+    0x63, 0x4d, 0x38, 0x79, 0xdd, 0x08, 0x57, 0x49, 0x85, 0x6b, 0x9c, 0xc0, 0xa4, 0x58, 0x83, 0x6c,
+    0xd2, 0x6c, 0x47, 0x11, 0x85, 0xd0, 0xf6, 0xf7, 0xb0, 0x7a, 0x91, 0x2d, 0x6f, 0xd6, 0x44, 0x4c,
+    0xa8, 0x46, 0x7a, 0xba, 0x7d, 0x88, 0xbc, 0xd6, 0x56, 0xa8, 0xfa, 0x18, 0x51, 0xaa, 0xee, 0xab,
+    0x10, 0xa2, 0x0c, 0x4a, 0x26, 0x84, 0x46, 0xe9, 0x28, 0xb1, 0xa5, 0x6d, 0x26, 0xd8, 0x84, 0xa5,
+    0x33, 0xb0, 0xb8, 0xe3, 0xc6, 0x69, 0x6a, 0x53, 0xec, 0x0e, 0xa7, 0x64, 0x68, 0x39, 0xe2, 0x84,
+    0x21, 0xce, 0xe9, 0xd3, 0x45, 0x75, 0x7c, 0x32, 0x2d, 0x27, 0x68, 0xc8, 0xac, 0x17, 0xa3, 0x3d,
+    0x3f, 0x13, 0x69, 0x11, 0x57, 0xd2, 0x99, 0x82, 0x77, 0xc5, 0x91, 0x7d, 0x41, 0xbd, 0x48, 0x1f,
+    0x81, 0xd5, 0x3b, 0x10, 0xb3, 0xe7, 0x76, 0x5d, 0xb2, 0x83, 0xa2, 0x9b, 0x3b, 0x09, 0x7f, 0x7e,
+    0x35, 0x56, 0x8c, 0x55, 0xa3, 0x6b, 0xd0, 0xd7, 0x87, 0xf3, 0x2d, 0x22, 0xc1, 0x9d, 0xd7, 0xac,
+    0x1f, 0x27, 0xf2, 0xee, 0x59, 0xb1, 0x08, 0x90, 0x35, 0x29, 0xbf, 0x35, 0x79, 0xcf, 0x2a, 0x64,
+    0x02, 0x1a, 0xb6, 0x13, 0xcc, 0x7c, 0xe5, 0x22, 0x12, 0x8d, 0x73, 0x54, 0x8a, 0xde, 0x40, 0x05,
+    0x56, 0xd9, 0x48, 0xb9, 0xf8, 0x55, 0xae, 0x16, 0x6b, 0x24, 0x44, 0x3c, 0x6d, 0x86, 0x42, 0xfb,
+    0xab, 0x7a, 0x58, 0xef, 0xfe, 0x98, 0x34, 0x8a, 0xfb, 0xf8, 0x69, 0xf9, 0x93, 0xc3, 0x3d, 0x5c,
+    0x42, 0x06, 0x3e, 0x3a, 0x19, 0x4a, 0x8c, 0xed, 0x1b, 0x65, 0xe3, 0x56, 0xed, 0x70, 0x21, 0xa3,
+    0x42, 0x7e, 0xe9, 0x82, 0xec, 0xe1, 0xd9, 0x22, 0x15, 0x3b, 0xa9, 0x31, 0x4e, 0xe6, 0x66, 0x78,
+    0x27, 0xd2, 0x6e, 0x6b, 0x19, 0x2a, 0x42, 0xb3, 0xa4, 0x39, 0x77, 0x68, 0x03, 0xa8, 0x0b, 0x19,
+    0x6d, 0x9a, 0x36, 0x07, 0x48, 0x56, 0x1f, 0xd2, 0x4e, 0xa8, 0x54, 0x7b, 0x41, 0x3a, 0x95, 0x12,
+    0xa8, 0x92, 0xca, 0x72, 0x29, 0xc6, 0x3a, 0x90, 0xc9, 0xc9, 0x42, 0x4c, 0xb2, 0x98, 0x4b, 0x2f,
+    0x80, 0xc6, 0x60, 0x4a, 0xaa, 0x44, 0x5f, 0xb5, 0x6e, 0xcb, 0x0e, 0x9f, 0x9c, 0x9f, 0x48, 0xc2,
+    0x68, 0x84, 0x1c, 0x72, 0x15, 0x77, 0xa8, 0x5a, 0x4a, 0xef, 0xd9, 0x86, 0xd2, 0x2d, 0x47, 0xf3,
+    0x06, 0x53, 0x14, 0xf6, 0x2b, 0x96, 0x0e, 0x89, 0x1a, 0x51, 0xea, 0x28, 0xa7, 0x43, 0xfc, 0xac,
+    0xfa, 0xc8, 0x8d, 0xa5, 0x3c, 0x3e, 0x74, 0x8d, 0xe2, 0x8c, 0xe9, 0x0f, 0xcd, 0x4e, 0x33, 0x97,
+    0x45, 0x81, 0x53, 0x32, 0x8c, 0x14, 0xd7, 0x17, 0x4f, 0xbb, 0x0d, 0x35, 0x38, 0x51, 0xaf, 0x90,
+    0x77, 0x4c, 0xee, 0x5f, 0x68, 0xca, 0x09, 0x28, 0x4f, 0xe4, 0x45, 0xb5, 0x02, 0x47, 0xb0, 0x13,
+    0xc5, 0xd5, 0xab, 0xcc, 0xc5, 0x7a, 0x58, 0xf5, 0xb2, 0xb4, 0xbd, 0xa8, 0x7f, 0xd3, 0xa8, 0x51,
+    0x1c, 0x35, 0x82, 0x6e, 0xe1, 0xbc, 0x5c, 0x97, 0x41, 0xaf, 0x02, 0x1a, 0xe1, 0xaa, 0xcc, 0xe5,
+    0xb6, 0x71, 0x07, 0xf3, 0xf8, 0x96, 0x19, 0xcd, 0x4a, 0xc2, 0xdc, 0xd0, 0x9c, 0x11, 0x8d, 0xd4,
+    0x16, 0x27, 0xa7, 0x67, 0x6b, 0xf3, 0x2c, 0xc0, 0x45, 0xcc, 0x3a, 0x9a, 0x31, 0xf9, 0x6c, 0xbb,
+    0x64, 0x41, 0x87, 0xeb, 0x90, 0xaa, 0x35, 0x1d, 0x5a, 0x70, 0x79, 0xeb, 0x25, 0x5d, 0xc5, 0xa5,
+    0x25, 0x73, 0x0b, 0x39, 0xcc, 0xa0, 0xb5, 0x5c, 0xd6, 0x0e, 0x42, 0x36, 0x7c, 0x47, 0x4f, 0x58,
+    0x93, 0x69, 0x34, 0x32, 0x55, 0x2b, 0x64, 0xe0, 0x5f, 0xd5, 0xb2, 0x4d, 0x60, 0x93, 0x22, 0x62,
+    0x2a, 0x41, 0x40, 0x3b, 0xb4, 0xc4, 0xd4, 0x94, 0x1b, 0x3f, 0x55, 0x61, 0x1f, 0x78, 0xaa, 0x50,
+    0x85, 0x04, 0x8b, 0xcd, 0x9c, 0x75, 0xfc, 0x10, 0x3b, 0x1f, 0xb8, 0x60, 0x02, 0x0a, 0x63, 0x83,
+    0xae, 0x3d, 0x3d, 0xa2, 0xc8, 0x49, 0xe9, 0xf5, 0x14, 0x2f, 0x40, 0x5f, 0xf2, 0x65, 0x24, 0x20,
+    0x40, 0x03, 0xc3, 0x90, 0x10, 0x71, 0xde, 0xf2, 0x08, 0xbf, 0x62, 0x8d, 0xa1, 0x8e, 0xbe, 0x43,
+    0x80, 0xd2, 0x7e, 0x89, 0xc7, 0xda, 0xc6, 0x32, 0x58, 0x51, 0x3e, 0xf4, 0x30, 0x79, 0x57, 0x13,
+    0x1a, 0xb0, 0x9a, 0x4f, 0xbc, 0x77, 0x44, 0xef, 0xa6, 0x31, 0xc3, 0x78, 0x7f, 0xe4, 0x0d, 0x85,
+    0xc2, 0xe1, 0xbc, 0x3e, 0x8b, 0xa8, 0x52, 0xca, 0xc7, 0x43, 0x1d, 0x76, 0x78, 0xad, 0xb6, 0x99,
+    0xed, 0x30, 0xb4, 0xaf, 0x7b, 0xd3, 0xc1, 0x80, 0x16, 0x47, 0x12, 0x24, 0xf0, 0x51, 0x9b, 0x6b,
+    0xbb, 0xb8, 0x22, 0x02, 0x1d, 0x5a, 0xa0, 0xa2, 0x79, 0xcd, 0x09, 0x30, 0xa7, 0xc9, 0xba, 0x18,
+    0x60, 0x26, 0xd6, 0x92, 0xc7, 0x78, 0xc1, 0x2e, 0x75, 0xb0, 0x86, 0x86, 0x82, 0xeb, 0x32, 0x78,
+    0x78, 0x7e, 0x71, 0x51, 0x17, 0x64, 0xe3, 0x6e, 0x19, 0x41, 0x3b, 0x16, 0x68, 0x41, 0xd9, 0xcc,
+    0xe4, 0xac, 0x1b, 0x9e, 0xc8, 0x1d, 0x4f, 0x70, 0x1b, 0x1f, 0xa6, 0xad, 0x15, 0x26, 0xce, 0x59,
+    0x46, 0x56, 0xbd, 0xc9, 0x30, 0xcc, 0xc7, 0x8e, 0x02, 0x3f, 0x69, 0x1f, 0xf6, 0x07, 0x28, 0x35,
+    0xdc, 0x32, 0x88, 0x31, 0xdc, 0x2d, 0x98, 0xc6, 0xb9, 0x40, 0xfa, 0xa4, 0x0f, 0xd1, 0x4d, 0xca,
+    0x64, 0x0b, 0x74, 0xaa, 0xc5, 0x36, 0x76, 0x86, 0xea, 0x30, 0xd4, 0xe9, 0x26, 0x80, 0x84, 0x72,
+    0x9c, 0xd8, 0xa6, 0xd8, 0x2f, 0x40, 0x1e, 0xe5, 0x80, 0x65, 0x4f, 0x9b, 0xdc, 0x16, 0xd8, 0xc0,
+    0x11, 0x9d, 0xdd, 0xaf, 0x6f, 0x43, 0xd3, 0xd0, 0x29, 0x23, 0xea, 0xa8, 0xe7, 0x2a, 0x94, 0x70,
+    0xfa, 0xb6, 0x39, 0xed, 0x2e, 0xa5, 0x4e, 0x6e, 0xf4, 0x87, 0xd2, 0x26, 0x92, 0x8a, 0x61, 0x0a,
+    0x06, 0x6c, 0x13, 0x59, 0xb7, 0x45, 0xac, 0x93, 0x3a, 0x67, 0x8b, 0x58, 0xcb, 0x06, 0x21, 0x45,
+    0x30, 0xd3, 0x97, 0x6b, 0xc4, 0x0a, 0xcc, 0xb2, 0xac, 0x33, 0x25, 0xba, 0x94, 0x2b, 0xa5, 0xe6,
+    0xc4, 0xf5, 0xe3, 0x17, 0x84, 0x47, 0xab, 0x43, 0xc5, 0x0b, 0x23, 0xdc, 0x69, 0xe7, 0x4c, 0x84,
+    0xd8, 0xe2, 0xe2, 0x33, 0xb4, 0x67, 0xea, 0xdb, 0x50, 0x26, 0x15, 0xb2, 0x30, 0xaa, 0x5e, 0x00,
+    0xe2, 0x5c, 0x40, 0xb2, 0x64, 0x76, 0x1b, 0x62, 0x46, 0x4b, 0x55, 0xa7, 0xce, 0xee, 0x4c, 0x35,
+    0xe9, 0x48, 0x7a, 0x17, 0x0d, 0x81, 0x24, 0x0c, 0xa2, 0xb6, 0xc8, 0xf3, 0x5e, 0x24, 0x27, 0x81,
+    0xb3, 0xc4, 0xc7, 0x37, 0x30, 0x0a, 0x06, 0x19, 0x3d, 0x2f, 0xf8, 0xb4, 0xae, 0x7d, 0xa7, 0x43,
+    0xf3, 0x32, 0xe7, 0x51, 0xad, 0xa9, 0xc0, 0x50, 0x3c, 0xea, 0x68, 0x1a, 0x74, 0x80, 0x2e, 0xb6,
+    0x87, 0xcc, 0x78, 0x5a, 0x00, 0xc5, 0xe1, 0xc4, 0x1c, 0x98, 0xe4, 0x71, 0x0b, 0xc9, 0x32, 0x98,
+    0x74, 0x8d, 0xeb, 0xdf, 0x03, 0x69, 0x58, 0x1c, 0x58, 0x02, 0xf2, 0x65, 0x8c, 0xdc, 0xe1, 0xc8,
+    0x13, 0x11, 0x9f, 0xec, 0x6b, 0x3f, 0x00, 0x75, 0xb2, 0x6a, 0x3c, 0xb6, 0x7b, 0x83, 0x15, 0x7b,
+    0x60, 0x80, 0xe4, 0x2d, 0x4b, 0xc9, 0x23, 0x5f, 0x84, 0x21, 0x26, 0x5d, 0x03, 0x05, 0x3c, 0xa9,
+    0x54, 0xf1, 0x3f, 0xa5, 0x42, 0xde, 0x1d, 0x82, 0x66, 0x5d, 0x70, 0x41, 0x36, 0x9d, 0x24, 0x5d,
+    0xba, 0xdd, 0x4d, 0x63, 0x53, 0xee, 0x95, 0xf3, 0x10, 0xb7, 0x46, 0x79, 0xe2, 0x90, 0x1f, 0x40,
+    0x5f, 0x5d, 0x0b, 0x8a, 0x6f, 0x54, 0x9d, 0x60, 0x86, 0x0d, 0x6f, 0xab, 0x11, 0x61, 0x28, 0xe8,
+    0x17, 0x1f, 0x28, 0x6e, 0x0c, 0x1f, 0x4c, 0x1d, 0x0d, 0x69, 0xb3, 0x22, 0x1e, 0x5d, 0xc9, 0xa9,
+    0x20, 0x72, 0x33, 0xd9, 0x57, 0xd1, 0xda, 0x44, 0xca, 0x4e, 0xeb, 0x89, 0xe4, 0x0b, 0x63, 0x79,
+    0x8c, 0x19, 0x09, 0xcc, 0x20, 0xa0, 0xa4, 0x14, 0x05, 0xf1, 0x83, 0x36, 0x9c, 0x8b, 0x48, 0x68,
+    0x86, 0xa4, 0xbc, 0x63, 0x98, 0xfb, 0x8a, 0xe2, 0x40, 0x59, 0x96, 0x3c, 0x9f, 0x4b, 0xfc, 0x6e,
+    0x93, 0x37, 0xbc, 0x14, 0x0c, 0xa6, 0xbb, 0x20, 0x74, 0xa2, 0x52, 0x11, 0x15, 0x10, 0x22, 0xae,
+    0x5b, 0xf8, 0x2f, 0xe6, 0xed, 0x82, 0x0b, 0x70, 0x3a, 0x9a, 0x81, 0xb5, 0xa5, 0x14, 0x36, 0x32,
+    0x3e, 0xab, 0xd2, 0x3a, 0xe4, 0x57, 0x7e, 0x6f, 0xaf, 0x04, 0xa7, 0x01, 0x29, 0x30, 0x42, 0x87,
+    0xcd, 0x43, 0x47, 0x6d, 0x57, 0xcf, 0xf2, 0xec, 0x74, 0x13, 0xe3, 0xaa, 0x46, 0xa8, 0xc9, 0x66,
+    0xf8, 0x3d, 0x38, 0x71, 0xa4, 0x56, 0xec, 0x73, 0xdf, 0x46, 0x24, 0x55, 0x78, 0x0f, 0x12, 0x65,
+    0xcf, 0xb0, 0x81, 0x0d, 0xd3, 0x32, 0x98, 0xac, 0xf9, 0xf3, 0xad, 0x74, 0xca, 0x67, 0x2a, 0x3f,
+    0xa7, 0x95, 0x21, 0xe5, 0x0e, 0x55, 0x25, 0xc3, 0xa7, 0x80, 0x5d, 0xb5, 0xb1, 0x8c, 0x2d, 0x4a,
+    0xdc, 0xe4, 0x17, 0xa8, 0xca, 0x65, 0x4d, 0x66, 0x16, 0x84, 0x4d, 0xa6, 0x8b, 0x4d, 0x73, 0x4d,
+    0xce, 0xcc, 0x22, 0x48, 0xef, 0x1a, 0x2f, 0x7d, 0x6a, 0xb3, 0x6e, 0xe7, 0xd9, 0x8b, 0x95, 0x9f,
+    0x9f, 0x03, 0xfd, 0xc1, 0x2b, 0xf7, 0x8a, 0x3b, 0x26, 0x19, 0xd5, 0x06, 0x7b, 0xb7, 0x65, 0xe4,
+    0x25, 0x50, 0x15, 0xcd, 0x8a, 0xdf, 0x2d, 0x5b, 0x78, 0x72, 0xc7, 0x38, 0x11, 0x42, 0x8d, 0xf4,
+    0x2a, 0x06, 0xab, 0x7a, 0x12, 0xee, 0x66, 0x79, 0xb7, 0x29, 0xb2, 0xc1, 0x6e, 0x99, 0x82, 0xc1,
+    0x89, 0x31, 0x79, 0x78, 0x72, 0x5d, 0x54, 0x03, 0xba, 0xa9, 0x2f, 0x77, 0x44, 0xbd, 0xeb, 0x2c,
+    0xdf, 0x0a, 0x4a, 0x4d, 0xa2, 0x49, 0x4a, 0x96, 0xd2, 0xa7, 0xd8, 0x21, 0x3e, 0x83, 0x58, 0xd4,
+    0x1e, 0x55, 0xb3, 0x04, 0xc1, 0xe7, 0xf6, 0x12, 0xd3, 0x16, 0x52, 0x6e, 0xb2, 0x1e, 0x4d, 0x83,
+    0x91, 0x70, 0xd9, 0xa3, 0x78, 0x3c, 0xbe, 0xde, 0xef, 0x7d, 0x16, 0xe7, 0x09, 0x26, 0x22, 0x64,
+    0x1e, 0xd4, 0xa4, 0x38, 0x66, 0x85, 0x3f, 0x75, 0x51, 0x5a, 0x40, 0xe2, 0x24, 0xa7, 0xe6, 0x3a,
+    0xb1, 0x7a, 0x72, 0x07, 0xd7, 0x26, 0x61, 0x48, 0x8d, 0x34, 0x34, 0x02, 0x4d, 0x01, 0x8b, 0x42,
+    0x3a, 0xa6, 0xc0, 0x85, 0x0a, 0x7b, 0x46, 0x76, 0x96, 0x3c, 0xcf, 0x65, 0xd6, 0xb7, 0x85, 0x7d,
+    0x83, 0xf9, 0x71, 0xa0, 0x0e, 0xa5, 0xe2, 0x62, 0xff, 0x82, 0xfb, 0x8f, 0x98, 0x0c, 0xc4, 0x08,
+    0x39, 0xf9, 0x30, 0x30, 0x2e, 0x09, 0x96, 0x42, 0x56, 0x3d, 0x6b, 0x0c, 0xe9, 0xb1, 0x5e, 0xb2,
+    0x99, 0x7d, 0x28, 0x17, 0x2a, 0x02, 0xe2, 0x71, 0xd1, 0x27, 0x2f, 0xec, 0xbf, 0x62, 0x87, 0xa8,
+    0x3c, 0xea, 0x14, 0xf5, 0x02, 0x1d, 0xa3, 0x1e, 0xbf, 0xb7, 0x73, 0x32, 0x64, 0xa4, 0xd7, 0xb6,
+    0xca, 0x33, 0x3b, 0xc2, 0xa7, 0x98, 0x3f, 0xc6, 0x93, 0x64, 0xae, 0x15, 0xa9, 0x15, 0xd7, 0xd2,
+    0xa6, 0x27, 0xfb, 0x2a, 0xc5, 0x26, 0x7b, 0xe2, 0x4f, 0x9a, 0x17, 0xcd, 0x5a, 0xe6, 0xe0, 0x5f,
+    0x65, 0xe1, 0xc2, 0x81, 0xc0, 0x4c, 0x79, 0xed, 0x5c, 0xe0, 0xed, 0x18, 0xd2, 0xf3, 0x82, 0x09,
+    0x8e, 0xe4, 0xd8, 0xe0, 0x5c, 0xe2, 0xb5, 0x23, 0x83, 0x49, 0x49, 0xff, 0xd6, 0x92, 0xf9, 0xd3,
+    0x86, 0x69, 0xa5, 0xe2, 0xd0, 0xe1, 0x9c, 0x2a, 0x33, 0x87, 0x11, 0x93, 0x72, 0xe9, 0x99, 0xc4,
+    0xca, 0xa2, 0xc5, 0xb3, 0x8a, 0x69, 0x69, 0x75, 0x64, 0xb1, 0xb2, 0x70, 0xd9, 0x51, 0xc6, 0x4c,
+    0x71, 0x3c, 0xd1, 0xb8, 0x70, 0x69, 0x3a, 0xe9, 0xa8, 0x17, 0x8f, 0x6f, 0x2f, 0x9c, 0x3d, 0x08,
+    0x29, 0x0b, 0x3f, 0x9c, 0xd8, 0xeb, 0x77, 0x7e, 0xdf, 0x53, 0xec, 0xf1, 0x0e, 0x73, 0x14, 0xf9,
+    0xe4, 0xd4, 0x64, 0x65, 0x93, 0xd4, 0x69, 0xca, 0xa4, 0x0b, 0xd4, 0xa1, 0xca, 0x79, 0x25, 0xf0,
+    0xb0, 0xe5, 0x83, 0x37, 0x3b, 0xf3, 0xbd, 0x89, 0xbb, 0xb4, 0xfb, 0x12, 0x43, 0x7e, 0x28, 0x54,
+    0xbe, 0x72, 0x6c, 0xe9, 0x67, 0x11, 0x65, 0xe0, 0x94, 0x50, 0x6d, 0xde, 0xbc, 0xe0, 0xcc, 0x4c,
+    0x31, 0x6a, 0xad, 0x36, 0xa7, 0x89, 0xb2, 0x1d, 0xb5, 0xa7, 0xae, 0x75, 0x3e, 0x7d, 0xe2, 0x03,
+    0x7b, 0x3f, 0x2d, 0xbf, 0x8a, 0x44, 0x8a, 0xf3, 0xb2, 0xea, 0x9c, 0xec, 0xdc, 0x5a, 0xe5, 0xf9,
+    0xd9, 0x54, 0x89, 0x24, 0xc7, 0x68, 0xe7, 0x16, 0xcb, 0x72, 0x32, 0x39, 0x65, 0x3b, 0xb7, 0x8c,
+    0xc6, 0x4b, 0x59, 0x84, 0x22, 0x64, 0xe7, 0x97, 0xc1, 0xc3, 0xb9, 0x0f, 0x2e, 0x00, 0x22, 0xe0,
+    0xe1, 0x38, 0x3c, 0x02, 0x7e, 0x8f, 0x4c, 0x28, 0x9f, 0xac, 0x5e, 0xc8, 0x76, 0x40, 0xdf, 0xa4,
+    0xd9, 0xea, 0xe2, 0xf1, 0xd6, 0x75, 0xdc, 0x6b, 0xd3, 0x22, 0x46, 0x34, 0x80, 0x4e, 0x93, 0xde,
+    0xa4, 0xdf, 0xaf, 0x25, 0x4e, 0x93, 0x6a, 0x70, 0xd9, 0x1a, 0xd3, 0xaf, 0x5f, 0x2e, 0x2a, 0x70,
+    0x8b, 0x1e, 0xa0, 0xcc, 0xc9, 0x44, 0x5a, 0x13, 0x49, 0x86, 0xb6, 0xc0, 0x9c, 0xd3, 0xd5, 0x25,
+    0xcb, 0x5d, 0x18, 0x9f, 0xea, 0xd8, 0xd0, 0x6a, 0xae, 0xc3, 0xaa, 0x07, 0xac, 0x2a, 0xa1, 0x90,
+    0x60, 0x84, 0xa9, 0xdc, 0x36, 0x99, 0x53, 0xbb, 0x02, 0xc9, 0x32, 0x5a, 0x93, 0xff, 0x42, 0x03,
+    0xdf, 0xd1, 0x69, 0xc1, 0xa4, 0x75, 0x81, 0x73, 0xd7, 0xb6, 0xd1, 0xe7, 0xc0, 0xe6, 0xc9, 0x1e,
+    0xe6, 0xe7, 0xe8, 0x79, 0x10, 0xd1, 0x4b, 0x4f, 0x8d, 0xdf, 0x57, 0xe3, 0xa6, 0x18, 0xa8, 0x0b,
+    0x80, 0xd5, 0xf3, 0x1a, 0x82, 0xd9, 0x69, 0xb3, 0x27, 0x73, 0x07, 0xe9, 0x44, 0x1f, 0xa0, 0xe9,
+    0x81, 0xf6, 0x4a, 0xf8, 0xf4, 0x34, 0xf2, 0x43, 0x0f, 0x50, 0xfd, 0x2b, 0xe8, 0xfd, 0xb1, 0x53,
+    0x22, 0xe6, 0xf2, 0x8a, 0x9a, 0x88, 0xfa, 0x40, 0xed, 0x68, 0x00, 0xe8, 0xc3, 0xd1, 0x90, 0xf1,
+    0x19, 0x78, 0xfc, 0x12, 0xa4, 0x31, 0xd9, 0xaf, 0x15, 0x5f, 0x35, 0x9f, 0xa3, 0xd0, 0x95, 0x67,
+    0xa1, 0xae, 0x22, 0x85, 0xe2, 0x2b, 0x64, 0x2a, 0x95, 0x43, 0xe0, 0x6d, 0xb1, 0xa9, 0x6d, 0xd6,
+    0x97, 0x1c, 0x05, 0xd2, 0xb3, 0xc3, 0x4f, 0x18, 0xb5, 0x99, 0xc2, 0x51, 0x10, 0x27, 0xac, 0xde,
+    0x44, 0xe5, 0xca, 0x23, 0x5f, 0x03, 0x5c, 0x16, 0x19, 0xd5, 0x87, 0xe8, 0x2c, 0x02, 0x35, 0xd4,
+    0x69, 0x66, 0x4a, 0x24, 0x6f, 0xe2, 0xdb, 0xea, 0x19, 0x07, 0x7f, 0x7a, 0x03, 0x48, 0x16, 0xa9,
+    0xee, 0xe6, 0x07, 0x42, 0xde, 0x50, 0x49, 0x00, 0x16, 0x50, 0xa7, 0xee, 0x19, 0xfb, 0x29, 0x8b,
+    0x15, 0xc8, 0x5a, 0x5a, 0x59, 0x11, 0xc4, 0xc0, 0xb0, 0xf7, 0x8e, 0xf0, 0x83, 0xd1, 0x18, 0x4a,
+    0x39, 0x8a, 0x3c, 0x13, 0xc3, 0x8b, 0x4d, 0x17, 0x8a, 0x2c, 0x77, 0x57, 0xf2, 0xf4, 0xe3, 0xc2,
+    0xb3, 0xde, 0x64, 0x2f, 0x3a, 0x4f, 0x70, 0xd5, 0xf0, 0xa4, 0x51, 0x4f, 0x71, 0x50, 0x7b, 0xb0,
+    0x58, 0xd2, 0x15, 0x4f, 0xd9, 0x52, 0xae, 0x35, 0xa0, 0x68, 0x13, 0xfa, 0x9a, 0x29, 0x60, 0x8b,
+    0x3d, 0x6b, 0xa6, 0x19, 0xf9, 0x98, 0xa8, 0xc4, 0x33, 0x6e, 0x0a, 0x97, 0xd1, 0x2d, 0xe2, 0x84,
+    0x27, 0x58, 0x09, 0x70, 0x55, 0xb8, 0xe5, 0x1f, 0x56, 0xae, 0x85, 0xed, 0x6d, 0x82, 0x85, 0xb7,
+    0x08, 0x1d, 0xe2, 0x5a, 0xf6, 0x55, 0xbc, 0xcd, 0xf5, 0xbb, 0xc9, 0xf8, 0x21, 0xd1, 0xdc, 0xb8,
+    0xb1, 0x61, 0x3b, 0xd7, 0xd5, 0xfe, 0xed, 0xb2, 0x70, 0x1a, 0xdc, 0x8d, 0xcb, 0x85, 0x2f, 0x2b,
+    0x9f, 0xdc, 0xdd, 0xed, 0xef, 0x06, 0x39, 0x40, 0xb3, 0xf5, 0xa7, 0x17, 0xe9, 0xa8, 0x4f, 0xfe,
+    0x06, 0x01, 0x5e, 0x96, 0x25, 0xce, 0x91, 0x8a, 0xe7, 0x64, 0x27, 0x26, 0x7b, 0x49, 0x43, 0xbb,
+    0x17, 0x38, 0xd7, 0xf8, 0x8b, 0x1f, 0x39, 0xdf, 0xf8, 0x1f, 0x52, 0xa2, 0xff, 0x47, 0xb9, 0xa0,
+    0x00, 0x00,
+};
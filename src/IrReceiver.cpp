@@ -82,14 +82,14 @@ void IrReceiver_Cyclic() {
                 }
                 case RC_MUTE: {
                     if (rcActionOk) {
-                        if (AudioPlayer_GetCurrentVolume() > 0) {
-                            lastVolume = AudioPlayer_GetCurrentVolume();
-                            AudioPlayer_SetCurrentVolume(0u);
+                        if (AudioPlayer_GetCurrentVolumeFine() > 0) {
+                            lastVolume = AudioPlayer_GetCurrentVolumeFine();
+                            AudioPlayer_SetCurrentVolumeFine(0u);
                         } else {
-                            AudioPlayer_SetCurrentVolume(lastVolume); // Remember last volume if mute is pressed again
+                            AudioPlayer_SetCurrentVolumeFine(lastVolume); // Remember last volume if mute is pressed again
                         }
 
-                        uint8_t currentVolume = AudioPlayer_GetCurrentVolume();
+                        uint8_t currentVolume = AudioPlayer_GetCurrentVolumeFine();
                         xQueueSend(gVolumeQueue, &currentVolume, 0);
                         Serial.println(F("RC: Mute"));
                     }
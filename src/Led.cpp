@@ -3,10 +3,12 @@
 #include <esp_task_wdt.h>
 #include "settings.h"
 #include "AudioPlayer.h"
+#include "AudioStats.h"
 #include "Battery.h"
 #include "Button.h"
 #include "Led.h"
 #include "Log.h"
+#include "Spectrum.h"
 #include "System.h"
 #include "Wlan.h"
 
@@ -31,8 +33,15 @@
     static uint8_t Led_Brightness = LED_INITIAL_BRIGHTNESS;
     static uint8_t Led_NightBrightness = LED_INITIAL_NIGHT_BRIGHTNESS;
 
+    #ifdef SPECTRUM_ENABLE
+        static bool Led_SpectrumActive = false;     // Spectrum instead of playlist-progress while playing
+    #endif
+
     static void Led_Task(void *parameter);
     static uint8_t Led_Address(uint8_t number);
+    #ifdef SPECTRUM_ENABLE
+        static void Led_DrawSpectrum(CRGB *_leds);
+    #endif
 
     // Only enable measurements if valid GPIO is used
     #ifdef MEASURE_BATTERY_VOLTAGE
@@ -68,6 +77,10 @@ void Led_Init(void) {
             Log_Println((char *) FPSTR(wroteNmBrightnessToNvs), LOGLEVEL_ERROR);
         }
 
+        #ifdef SPECTRUM_ENABLE
+            Led_SpectrumActive = gPrefsSettings.getUChar("ledSpectrum", 0);
+        #endif
+
         xTaskCreatePinnedToCore(
             Led_Task,   /* Function to implement the task */
             "Led_Task", /* Name of the task */
@@ -127,6 +140,23 @@ void Led_SetBrightness(uint8_t value) {
     #endif
 }
 
+// Switches LED-animation while playing between playlist-progress and spectrum (stored in NVS)
+void Led_ToggleSpectrum(void) {
+    #if defined(NEOPIXEL_ENABLE) && defined(SPECTRUM_ENABLE)
+        Led_SpectrumActive = !Led_SpectrumActive;
+        gPrefsSettings.putUChar("ledSpectrum", Led_SpectrumActive);
+        Log_Println(Led_SpectrumActive ? (char *) FPSTR(ledSpectrumOn) : (char *) FPSTR(ledSpectrumOff), LOGLEVEL_INFO);
+    #endif
+}
+
+bool Led_IsSpectrumActive(void) {
+    #if defined(NEOPIXEL_ENABLE) && defined(SPECTRUM_ENABLE)
+        return Led_SpectrumActive;
+    #else
+        return false;
+    #endif
+}
+
 // Switches Neopixel-addressing from clockwise to counter clockwise (and vice versa)
 uint8_t Led_Address(uint8_t number) {
     #ifdef NEOPIXEL_REVERSE_ROTATION
@@ -153,6 +183,9 @@ static void Led_Task(void *parameter) {
         static uint8_t webstreamColor = 0;
         static unsigned long lastSwitchTimestamp = 0;
         static bool redrawProgress = false;
+        #ifdef SPECTRUM_ENABLE
+            static uint32_t lastSpectrumFrameTimestamp = 0;
+        #endif
         static uint8_t lastLedBrightness = Led_Brightness;
         static CRGB::HTMLColorCode idleColor;
         static CRGB::HTMLColorCode speechColor = CRGB::Yellow;
@@ -588,9 +621,30 @@ static void Led_Task(void *parameter) {
                         redrawProgress = true;
                     }
 
+                    #ifdef SPECTRUM_ENABLE
+                        const bool showSpectrum = Led_SpectrumActive && !gPlayProperties.pausePlay && !System_AreControlsLocked();
+                    #else
+                        const bool showSpectrum = false;
+                    #endif
+
+                    // Spectrum is drawn with a fixed frame-rate; progress/webstream is redrawn once it's left (pause, lock)
+                    if (showSpectrum) {
+                        #ifdef SPECTRUM_ENABLE
+                            const uint32_t frameTime = 1000u / spectrumLedFrameRate;
+                            if (millis() - lastSpectrumFrameTimestamp >= frameTime) {
+                                if (millis() - lastSpectrumFrameTimestamp >= 2 * frameTime) {    // Don't catch up after a delay
+                                    lastSpectrumFrameTimestamp = millis();
+                                } else {
+                                    lastSpectrumFrameTimestamp += frameTime;
+                                }
+                                Led_DrawSpectrum(leds);
+                            }
+                            redrawProgress = true;
+                        #endif
+                    }
                     // Single-LED: led indicates between gradient green (beginning) => red (end)
                     // Multiple-LED: growing number of leds indicate between gradient green (beginning) => red (end)
-                    if (!gPlayProperties.isWebstream) {
+                    else if (!gPlayProperties.isWebstream) {
                         if (gPlayProperties.currentRelPos != lastPos || redrawProgress) {
                             redrawProgress = false;
                             lastPos = gPlayProperties.currentRelPos;
@@ -663,9 +717,27 @@ static void Led_Task(void *parameter) {
                     vTaskDelay(portTICK_RATE_MS * 5);
                 }
             }
-            vTaskDelay(portTICK_RATE_MS * 1);
+            vTaskDelay(portTICK_RATE_MS * (AudioStats_IsLoadReductionActive() ? audioStatsLedReducedDelay : 1));
             //esp_task_wdt_reset();
         }
         vTaskDelete(NULL);
     #endif
 }
+
+#if defined(NEOPIXEL_ENABLE) && defined(SPECTRUM_ENABLE)
+    // Single-LED: shows overall level (VU) with gradient green => red
+    // Multiple-LED: bands (low => high frequencies) are spread clockwise over the ring; brightness follows their levels
+    void Led_DrawSpectrum(CRGB *_leds) {
+        spectrumFrame frame;
+        Spectrum_Get(&frame);   // All levels are 0 if there's no recent analysis
+        FastLED.clear();
+        if (NUM_LEDS == 1) {
+            _leds[0] = CHSV(85 - frame.peak / 3, 255, frame.peak);
+        } else {
+            for (uint8_t led = 0; led < NUM_LEDS; led++) {
+                const uint8_t band = (uint16_t) led * SPECTRUM_BANDS / NUM_LEDS;
+                _leds[Led_Address(led)] = CHSV(band * 224 / SPECTRUM_BANDS, 255, frame.level[band]);
+            }
+        }
+    }
+#endif
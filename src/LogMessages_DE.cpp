@@ -59,6 +59,7 @@
     const char rfidTagUnknownInNvs[] PROGMEM = "RFID-Karte ist im NVS nicht hinterlegt.";
     const char goToSleepDueToIdle[] PROGMEM = "Gehe in Deep Sleep wegen Inaktivität...";
     const char goToSleepDueToTimer[] PROGMEM = "Gehe in Deep Sleep wegen Sleep Timer...";
+    const char sleepTimerFadeOut[] PROGMEM = "Sleep-Timer läuft bald ab; Wiedergabe wird ausgeblendet";
     const char goToSleepNow[] PROGMEM = "Gehe jetzt in Deep Sleep!";
     const char maxLoudnessReached[] PROGMEM = "Maximale Lautstärke bereits erreicht!";
     const char minLoudnessReached[] PROGMEM = "Minimale Lautstärke bereits erreicht!";
@@ -166,6 +167,23 @@
     const char fileWritten[] PROGMEM = "Datei geschrieben";
     const char writeFailed[] PROGMEM = "Schreibvorgang fehlgeschlagen";
     const char writingFile[] PROGMEM = "Schreibe Datei";
+    const char uploadStalled[] PROGMEM = "Upload abgebrochen: SD nimmt keine Daten an";
+    const char uploadFinished[] PROGMEM = "Upload abgeschlossen";
+    const char uploadInitFailed[] PROGMEM = "Upload-Puffer konnte nicht reserviert werden";
+    const char uploadAborted[] PROGMEM = "Upload vom Client abgebrochen, unvollständige Datei gelöscht";
+    const char uploadWriterBusy[] PROGMEM = "Upload übersprungen: vorherige Datei wird noch geschrieben";
+    const char archiveInitFailed[] PROGMEM = "Speicher zum Entpacken des Archivs konnte nicht reserviert werden";
+    const char archiveExtracting[] PROGMEM = "Entpacke Archiv nach";
+    const char archiveExtracted[] PROGMEM = "Archiv entpackt";
+    const char archiveInvalid[] PROGMEM = "Archiv ist ungültig oder beschädigt";
+    const char archiveEntrySkipped[] PROGMEM = "Eintrag des Archivs übersprungen (ungültiger Pfad)";
+    const char settingsInvalid[] PROGMEM = "Ungültige Einstellung, es wurde nichts gespeichert";
+    const char settingsWriteError[] PROGMEM = "Einstellungen konnten nicht in NVS geschrieben werden";
+    const char settingsSaved[] PROGMEM = "Einstellungen gespeichert (geänderte Werte)";
+    const char backupImportInvalid[] PROGMEM = "Backup-Datei enthält ungültige Einträge, es wurde nichts importiert";
+    const char backupImportNoSpace[] PROGMEM = "Nicht genügend Platz im NVS für den Import";
+    const char backupImportFailed[] PROGMEM = "Import fehlgeschlagen, RFID-Zuweisungen sind unverändert";
+    const char backupImportFinished[] PROGMEM = "Import abgeschlossen, Anzahl der Einträge";
     const char failedToOpenFileForAppending[] PROGMEM = "Öffnen der Datei zum Schreiben der JSON-Datei fehlgeschlagen";
     const char listingDirectory[] PROGMEM = "Verzeichnisinhalt anzeigen";
     const char failedToOpenDirectory[] PROGMEM = "Öffnen des Verzeichnisses fehlgeschlagen";
@@ -211,4 +229,40 @@
     const char noPlaylist[] PROGMEM = "Keine Playlist aktiv.";
     const char rfidTagRemoved[] PROGMEM = "RFID-Karte wurde entfernt";
     const char rfidTagReapplied[] PROGMEM = "RFID-Karte erneut aufgelegt";
+    const char unableToCreateSeekTableQ[] PROGMEM = "Konnte Seek-Table-Queue nicht anlegen";
+    const char seekTableCreated[] PROGMEM = "Seek-Table erstellt";
+    const char seekTableCreationFailed[] PROGMEM = "Seek-Table konnte nicht erstellt werden";
+    const char seekTableCreationQueued[] PROGMEM = "Seek-Table wird im Hintergrund erstellt";
+    const char seekTableLoaded[] PROGMEM = "Seek-Table geladen; Anzahl Frames";
+    const char seekTableUsingToc[] PROGMEM = "Keine Seek-Table vorhanden; verwende TOC des Xing/VBRI-Headers";
+    const char audioUnderrunDetected[] PROGMEM = "Audio-Unterlauf erkannt; Anzahl für aktuellen Titel";
+    const char audioInputBufferEnlarged[] PROGMEM = "Audio-Eingangspuffer für nächsten Titel vergrößert auf (Bytes)";
+    const char audioLoadReductionActive[] PROGMEM = "Zu viele Audio-Unterläufe; reduziere LED-Animation und Web-Updates";
+    const char audioLoadReductionInactive[] PROGMEM = "Keine Audio-Unterläufe mehr; LED-Animation und Web-Updates wieder normal";
+    const char eqFiltersActivated[] PROGMEM = "Equalizer: Anzahl aktiver Filter";
+    const char eqFilterInvalid[] PROGMEM = "Equalizer: Ungültiger Filter wird ignoriert";
+    const char replayGainFromTag[] PROGMEM = "ReplayGain aus Tag";
+    const char replayGainFromMeasurement[] PROGMEM = "Verstärkung aus gemessener Lautheit";
+    const char replayGainMeasuring[] PROGMEM = "Kein ReplayGain-Tag; Lautheit des Titels wird gemessen";
+    const char replayGainWebstream[] PROGMEM = "Webstream: Feste Verstärkung + Limiter";
+    const char loudnessMeasured[] PROGMEM = "Gemessene Lautheit gespeichert";
+    const char resamplerActive[] PROGMEM = "Resampler";
+    const char webStreamInitFailed[] PROGMEM = "Webstream-Puffer konnte nicht reserviert werden";
+    const char webStreamBuffering[] PROGMEM = "Webstream wird gepuffert; Verbindungsaufbau dauerte";
+    const char webStreamConnectFailed[] PROGMEM = "Verbindung zum Webstream fehlgeschlagen";
+    const char webStreamReconnecting[] PROGMEM = "Verbindung zum Webstream verloren; verbinde neu. Pufferfüllstand";
+    const char webStreamReconnected[] PROGMEM = "Webstream wieder verbunden";
+    const char webStreamRebuffering[] PROGMEM = "Webstream-Puffer leergelaufen; puffere neu";
+    const char webStreamStackFree[] PROGMEM = "Minimal freier Stack des Webstream-Tasks (Bytes)";
+    const char coverImageCached[] PROGMEM = "Cover-Bild in Cache extrahiert";
+    const char coverImageCacheFailed[] PROGMEM = "Cover-Bild konnte nicht in Cache extrahiert werden";
+    const char unableToCreateAnnounceQ[] PROGMEM = "Konnte Ansage-Queue nicht anlegen";
+    const char announceClipMissing[] PROGMEM = "Ansage-Clip nicht gefunden";
+    const char announceClipInvalid[] PROGMEM = "Ansage-Clip ungültig (16 Bit PCM WAV mit gleicher Samplerate erforderlich)";
+    const char uiSoundsLoaded[] PROGMEM = "UI-Sounds geladen";
+    const char playbackSpeedChanged[] PROGMEM = "Wiedergabegeschwindigkeit geändert";
+    const char pcmFastPathActive[] PROGMEM = "WAV-Datei wird direkt abgespielt";
+    const char ledSpectrumOn[] PROGMEM = "LED-Animation zeigt Spektrum während der Wiedergabe";
+    const char ledSpectrumOff[] PROGMEM = "LED-Animation zeigt Playlist-Fortschritt während der Wiedergabe";
+    const char pcmFastPathFinished[] PROGMEM = "Ende der WAV-Datei";
 #endif
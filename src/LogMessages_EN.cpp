@@ -59,6 +59,7 @@
     const char rfidTagUnknownInNvs[] PROGMEM = "RFID-tag is unkown to NVS.";
     const char goToSleepDueToIdle[] PROGMEM = "Going to deepsleep due to inactivity-timer...";
     const char goToSleepDueToTimer[] PROGMEM = "Going to deepsleep due to sleep timer...";
+    const char sleepTimerFadeOut[] PROGMEM = "Sleep-timer expires soon; fading out playback";
     const char goToSleepNow[] PROGMEM = "Going to deepsleep now!";
     const char maxLoudnessReached[] PROGMEM = "Already reached max volume!";
     const char minLoudnessReached[] PROGMEM = "Already reached min volume!";
@@ -166,6 +167,23 @@
     const char fileWritten[] PROGMEM = "File written";
     const char writeFailed[] PROGMEM = "Write failed";
     const char writingFile[] PROGMEM = "Writing file";
+    const char uploadStalled[] PROGMEM = "Upload aborted: SD does not accept data";
+    const char uploadFinished[] PROGMEM = "Upload finished";
+    const char uploadInitFailed[] PROGMEM = "Unable to allocate upload-buffer";
+    const char uploadAborted[] PROGMEM = "Upload aborted by client, partial file removed";
+    const char uploadWriterBusy[] PROGMEM = "Upload skipped: previous file is still being written";
+    const char archiveInitFailed[] PROGMEM = "Unable to allocate memory for extracting archive";
+    const char archiveExtracting[] PROGMEM = "Extracting archive to";
+    const char archiveExtracted[] PROGMEM = "Archive extracted";
+    const char archiveInvalid[] PROGMEM = "Archive is invalid or broken";
+    const char archiveEntrySkipped[] PROGMEM = "Skipped entry of archive (invalid path)";
+    const char settingsInvalid[] PROGMEM = "Invalid setting, nothing was saved";
+    const char settingsWriteError[] PROGMEM = "Settings couldn't be written to NVS";
+    const char settingsSaved[] PROGMEM = "Settings saved (changed values)";
+    const char backupImportInvalid[] PROGMEM = "Backup-file contains invalid entries, nothing was imported";
+    const char backupImportNoSpace[] PROGMEM = "Not enough space in NVS for import";
+    const char backupImportFailed[] PROGMEM = "Import failed, RFID-assignments are unchanged";
+    const char backupImportFinished[] PROGMEM = "Import finished, number of entries";
     const char failedToOpenFileForAppending[] PROGMEM = "Failed to open file for appending";
     const char listingDirectory[] PROGMEM = "Listing directory";
     const char failedToOpenDirectory[] PROGMEM = "Failed to open directory";
@@ -211,5 +229,41 @@
     const char noPlaylist[] PROGMEM = "No active playlist.";
     const char rfidTagRemoved[] PROGMEM = "RFID-tag removed";
     const char rfidTagReapplied[] PROGMEM = "RFID-tag reapplied";
+    const char unableToCreateSeekTableQ[] PROGMEM = "Unable to create seek-table-queue";
+    const char seekTableCreated[] PROGMEM = "Seek-table created";
+    const char seekTableCreationFailed[] PROGMEM = "Unable to create seek-table";
+    const char seekTableCreationQueued[] PROGMEM = "Seek-table is being created in background";
+    const char seekTableLoaded[] PROGMEM = "Seek-table loaded; number of frames";
+    const char seekTableUsingToc[] PROGMEM = "No seek-table available; using TOC of Xing/VBRI-header";
+    const char audioUnderrunDetected[] PROGMEM = "Audio underrun detected; number for current track";
+    const char audioInputBufferEnlarged[] PROGMEM = "Enlarged audio input-buffer for next track to (bytes)";
+    const char audioLoadReductionActive[] PROGMEM = "Too many audio underruns; reducing LED-animation and web-updates";
+    const char audioLoadReductionInactive[] PROGMEM = "No more audio underruns; LED-animation and web-updates back to normal";
+    const char eqFiltersActivated[] PROGMEM = "Equalizer: number of active filters";
+    const char eqFilterInvalid[] PROGMEM = "Equalizer: invalid filter is skipped";
+    const char replayGainFromTag[] PROGMEM = "ReplayGain from tag";
+    const char replayGainFromMeasurement[] PROGMEM = "Gain from measured loudness";
+    const char replayGainMeasuring[] PROGMEM = "No ReplayGain-tag; measuring loudness of track";
+    const char replayGainWebstream[] PROGMEM = "Webstream: fixed gain + limiter";
+    const char loudnessMeasured[] PROGMEM = "Measured loudness saved";
+    const char resamplerActive[] PROGMEM = "Resampler";
+    const char webStreamInitFailed[] PROGMEM = "Unable to allocate webstream-buffer";
+    const char webStreamBuffering[] PROGMEM = "Webstream is buffered; connect took";
+    const char webStreamConnectFailed[] PROGMEM = "Unable to connect to webstream";
+    const char webStreamReconnecting[] PROGMEM = "Webstream-connection lost; reconnecting. Buffer-fill";
+    const char webStreamReconnected[] PROGMEM = "Webstream reconnected";
+    const char webStreamRebuffering[] PROGMEM = "Webstream-buffer ran empty; rebuffering";
+    const char webStreamStackFree[] PROGMEM = "Min. free stack of webstream-task (bytes)";
+    const char coverImageCached[] PROGMEM = "Cover-image extracted to cache";
+    const char coverImageCacheFailed[] PROGMEM = "Unable to extract cover-image to cache";
+    const char unableToCreateAnnounceQ[] PROGMEM = "Unable to create announcement-queue";
+    const char announceClipMissing[] PROGMEM = "Announcement-clip not found";
+    const char announceClipInvalid[] PROGMEM = "Announcement-clip invalid (16 bit PCM WAV with same sample rate required)";
+    const char uiSoundsLoaded[] PROGMEM = "UI-sounds loaded";
+    const char playbackSpeedChanged[] PROGMEM = "Playback-speed changed";
+    const char pcmFastPathActive[] PROGMEM = "WAV-file is played via fast path";
+    const char ledSpectrumOn[] PROGMEM = "LED-animation shows spectrum while playing";
+    const char ledSpectrumOff[] PROGMEM = "LED-animation shows playlist-progress while playing";
+    const char pcmFastPathFinished[] PROGMEM = "End of WAV-file";
 
 #endif
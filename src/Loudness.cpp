@@ -0,0 +1,210 @@
+#include <Arduino.h>
+#include "settings.h"
+#include "Loudness.h"
+#include "AudioDsp.h"
+#include "Common.h"
+#include "Log.h"
+#include "MemX.h"
+#include "SdCard.h"
+
+#ifdef REPLAYGAIN_ENABLE
+    #define LOUDNESS_MAX_TXXX_LENGTH    128u    // TXXX-frames exceeding this length can't contain ReplayGain-info
+
+    static char *Loudness_CurrentTrack = NULL;  // Track whose loudness is currently measured (NULL if not measured)
+
+    static bool Loudness_ReadReplayGainTag(const char *_track, float *_gainDb);
+    static bool Loudness_ParseTxxxFrame(const uint8_t *_frame, const uint32_t _length, const char *_description, float *_gainDb);
+    static bool Loudness_ReadSidecar(const char *_track, float *_loudness);
+    static void Loudness_WriteSidecar(const char *_track, const float _loudness);
+    static void Loudness_GetSidecarPath(const char *_track, char *_path, const size_t _size);
+    static uint32_t Loudness_ReadSyncsafe(const uint8_t *_buf);
+    static uint32_t Loudness_ReadBigEndian(const uint8_t *_buf);
+#endif
+
+// Is called every time a new track is started. Gain is taken from (in this order):
+// ReplayGain-tag, loudness measured during a former playback, nothing (=> loudness is measured now).
+// Webstreams can't be analyzed; they get a fixed gain and a limiter.
+void Loudness_TrackStarted(const char *_track, const bool _isWebstream) {
+    #ifdef REPLAYGAIN_ENABLE
+        Loudness_TrackFinished();
+
+        if (_isWebstream) {
+            AudioDsp_SetReplayGain(replayGainWebstreamGain, true, false);
+            snprintf(Log_Buffer, Log_BufferLength, "%s: %.2f dB", (char *) FPSTR(replayGainWebstream), replayGainWebstreamGain);
+            Log_Println(Log_Buffer, LOGLEVEL_INFO);
+            return;
+        }
+
+        float gain;
+        float loudness;
+        bool measure = false;
+        if (Loudness_ReadReplayGainTag(_track, &gain)) {
+            snprintf(Log_Buffer, Log_BufferLength, "%s: %.2f dB", (char *) FPSTR(replayGainFromTag), gain);
+            Log_Println(Log_Buffer, LOGLEVEL_INFO);
+        } else if (Loudness_ReadSidecar(_track, &loudness)) {
+            gain = replayGainTargetLoudness - loudness;
+            snprintf(Log_Buffer, Log_BufferLength, "%s: %.2f LUFS => %.2f dB", (char *) FPSTR(replayGainFromMeasurement), loudness, gain);
+            Log_Println(Log_Buffer, LOGLEVEL_INFO);
+        } else {
+            gain = 0.0f;
+            measure = true;
+            Loudness_CurrentTrack = x_strdup(_track);
+            Log_Println((char *) FPSTR(replayGainMeasuring), LOGLEVEL_INFO);
+        }
+
+        gain = constrain(gain + replayGainPreamp, -replayGainMaxGain, replayGainMaxGain);
+        AudioDsp_SetReplayGain(gain, gain > 0.0f, measure);    // Limiter avoids clipping if track is amplified
+    #endif
+}
+
+// Stores loudness of the current track if it was measured long enough
+void Loudness_TrackFinished(void) {
+    #ifdef REPLAYGAIN_ENABLE
+        if (Loudness_CurrentTrack == NULL) {
+            return;
+        }
+
+        float loudness;
+        uint32_t measuredSeconds;
+        if (AudioDsp_GetIntegratedLoudness(&loudness, &measuredSeconds) && measuredSeconds >= replayGainMinMeasureTime) {
+            Loudness_WriteSidecar(Loudness_CurrentTrack, loudness);
+            snprintf(Log_Buffer, Log_BufferLength, "%s: %.2f LUFS (%u s)", (char *) FPSTR(loudnessMeasured), loudness, measuredSeconds);
+            Log_Println(Log_Buffer, LOGLEVEL_INFO);
+        }
+
+        free(Loudness_CurrentTrack);
+        Loudness_CurrentTrack = NULL;
+    #endif
+}
+
+#ifdef REPLAYGAIN_ENABLE
+// Searches ID3v2.3/2.4-tag for TXXX-frame "REPLAYGAIN_TRACK_GAIN" (or "REPLAYGAIN_ALBUM_GAIN")
+bool Loudness_ReadReplayGainTag(const char *_track, float *_gainDb) {
+    File file = gFSystem.open(_track, FILE_READ);
+    if (!file) {
+        return false;
+    }
+
+    uint8_t header[10];
+    if (file.read(header, sizeof(header)) != sizeof(header) || memcmp(header, "ID3", 3) || header[3] < 3 || header[3] > 4) {
+        file.close();
+        return false;
+    }
+    const uint8_t version = header[3];
+    const uint32_t tagEnd = sizeof(header) + Loudness_ReadSyncsafe(&header[6]);
+    uint32_t pos = sizeof(header);
+
+    if (header[5] & 0x40) {     // Extended header
+        uint8_t extendedHeader[4];
+        if (file.read(extendedHeader, sizeof(extendedHeader)) != sizeof(extendedHeader)) {
+            file.close();
+            return false;
+        }
+        pos += (version == 4) ? Loudness_ReadSyncsafe(extendedHeader) : Loudness_ReadBigEndian(extendedHeader) + 4;
+    }
+
+    const char *description = replayGainUseAlbumGain ? "REPLAYGAIN_ALBUM_GAIN" : "REPLAYGAIN_TRACK_GAIN";
+    uint8_t frame[LOUDNESS_MAX_TXXX_LENGTH];
+    bool found = false;
+
+    while (!found && pos + 10 <= tagEnd) {
+        uint8_t frameHeader[10];
+        if (!file.seek(pos) || file.read(frameHeader, sizeof(frameHeader)) != sizeof(frameHeader) || !frameHeader[0]) {
+            break;  // Padding reached
+        }
+        const uint32_t frameSize = (version == 4) ? Loudness_ReadSyncsafe(&frameHeader[4]) : Loudness_ReadBigEndian(&frameHeader[4]);
+
+        if (!memcmp(frameHeader, "TXXX", 4) && frameSize > 1 && frameSize <= sizeof(frame)) {
+            if (file.read(frame, frameSize) == frameSize) {
+                found = Loudness_ParseTxxxFrame(frame, frameSize, description, _gainDb);
+            }
+        }
+        pos += sizeof(frameHeader) + frameSize;
+    }
+
+    file.close();
+    return found;
+}
+
+// TXXX: <encoding> <description> 0 <value>. UTF-16 is reduced to ASCII as ReplayGain-values are plain ASCII anyway.
+bool Loudness_ParseTxxxFrame(const uint8_t *_frame, const uint32_t _length, const char *_description, float *_gainDb) {
+    char text[LOUDNESS_MAX_TXXX_LENGTH];
+    const uint8_t encoding = _frame[0];
+    uint8_t textLength = 0;
+    uint8_t valueStart = 0;
+
+    if (encoding == 1 || encoding == 2) {   // UTF-16 (with/without BOM)
+        for (uint32_t i = 1; i + 1 < _length && textLength < sizeof(text) - 1; i += 2) {
+            if ((_frame[i] == 0xFF && _frame[i + 1] == 0xFE) || (_frame[i] == 0xFE && _frame[i + 1] == 0xFF)) {
+                continue;   // BOM
+            }
+            text[textLength++] = _frame[i] ? _frame[i] : _frame[i + 1];
+        }
+    } else {
+        for (uint32_t i = 1; i < _length && textLength < sizeof(text) - 1; i++) {
+            text[textLength++] = _frame[i];
+        }
+    }
+    text[textLength] = '\0';
+
+    for (uint8_t i = 0; i < textLength; i++) {
+        if (text[i] == '\0') {
+            valueStart = i + 1;
+            break;
+        }
+    }
+    if (!valueStart || strcasecmp(text, _description)) {
+        return false;
+    }
+
+    *_gainDb = atof(&text[valueStart]);     // e.g. "-6.54 dB"
+    return true;
+}
+
+bool Loudness_ReadSidecar(const char *_track, float *_loudness) {
+    char sidecarPath[MAX_FILEPATH_LENTGH + 10];
+    Loudness_GetSidecarPath(_track, sidecarPath, sizeof(sidecarPath));
+    if (!gFSystem.exists(sidecarPath)) {
+        return false;
+    }
+
+    File file = gFSystem.open(sidecarPath, FILE_READ);
+    if (!file) {
+        return false;
+    }
+    char buf[12];
+    size_t length = file.read((uint8_t *) buf, sizeof(buf) - 1);
+    file.close();
+    buf[length] = '\0';
+    if (!length) {
+        return false;
+    }
+
+    *_loudness = atoi(buf) / 100.0f;    // Stored in 1/100 LUFS
+    return true;
+}
+
+void Loudness_WriteSidecar(const char *_track, const float _loudness) {
+    char sidecarPath[MAX_FILEPATH_LENTGH + 10];
+    Loudness_GetSidecarPath(_track, sidecarPath, sizeof(sidecarPath));
+
+    File file = gFSystem.open(sidecarPath, FILE_WRITE);
+    if (!file) {
+        return;
+    }
+    file.printf("%d\n", (int32_t) lroundf(_loudness * 100.0f));
+    file.close();
+}
+
+void Loudness_GetSidecarPath(const char *_track, char *_path, const size_t _size) {
+    snprintf(_path, _size, "%s%s", _track, (char *) FPSTR(replayGainFileSuffix));
+}
+
+uint32_t Loudness_ReadSyncsafe(const uint8_t *_buf) {
+    return ((uint32_t) (_buf[0] & 0x7F) << 21) | ((uint32_t) (_buf[1] & 0x7F) << 14) | ((uint32_t) (_buf[2] & 0x7F) << 7) | (_buf[3] & 0x7F);
+}
+
+uint32_t Loudness_ReadBigEndian(const uint8_t *_buf) {
+    return ((uint32_t) _buf[0] << 24) | ((uint32_t) _buf[1] << 16) | ((uint32_t) _buf[2] << 8) | _buf[3];
+}
+#endif
@@ -0,0 +1,4 @@
+#pragma once
+
+void Loudness_TrackStarted(const char *_track, const bool _isWebstream);
+void Loudness_TrackFinished(void);
@@ -7,6 +7,7 @@
 #include "Log.h"
 #include "MemX.h"
 #include "System.h"
+#include "TimeStretch.h"
 #include "Queues.h"
 #include "Wlan.h"
 
@@ -249,6 +250,7 @@ bool Mqtt_Reconnect() {
 
                 // Loudness-subscription
                 Mqtt_PubSubClient.subscribe((char *) FPSTR(topicLoudnessCmnd));
+                Mqtt_PubSubClient.subscribe((char *) FPSTR(topicLoudnessFineCmnd));
 
                 // Sleep-Timer-subscription
                 Mqtt_PubSubClient.subscribe((char *) FPSTR(topicSleepTimerCmnd));
@@ -265,16 +267,21 @@ bool Mqtt_Reconnect() {
                 // LED-brightness
                 Mqtt_PubSubClient.subscribe((char *) FPSTR(topicLedBrightnessCmnd));
 
+                // Playback-speed
+                Mqtt_PubSubClient.subscribe((char *) FPSTR(topicPlaybackSpeedCmnd));
+
                 // Publish some stuff
                 publishMqtt((char *) FPSTR(topicState), "Online", false);
                 publishMqtt((char *) FPSTR(topicTrackState), "---", false);
                 publishMqtt((char *) FPSTR(topicLoudnessState), AudioPlayer_GetCurrentVolume(), false);
+                publishMqtt((char *) FPSTR(topicLoudnessFineState), AudioPlayer_GetCurrentVolumeFine(), false);
                 publishMqtt((char *) FPSTR(topicSleepTimerState), System_GetSleepTimerTimeStamp(), false);
                 publishMqtt((char *) FPSTR(topicLockControlsState), "OFF", false);
                 publishMqtt((char *) FPSTR(topicPlaymodeState), gPlayProperties.playMode, false);
                 publishMqtt((char *) FPSTR(topicLedBrightnessState), Led_GetBrightness(), false);
                 publishMqtt((char *) FPSTR(topicRepeatModeState), 0, false);
                 publishMqtt((char *) FPSTR(topicCurrentIPv4IP), Wlan_GetIpAddress().c_str(), false);
+                publishMqtt((char *) FPSTR(topicPlaybackSpeedState), TimeStretch_GetSpeed(), false);
 
                 return Mqtt_PubSubClient.connected();
             } else {
@@ -312,6 +319,10 @@ void Mqtt_ClientCallback(const char *topic, const byte *payload, uint32_t length
             unsigned long vol = strtoul(receivedString, NULL, 10);
             AudioPlayer_VolumeToQueueSender(vol, true);
         }
+        else if (strcmp_P(topic, topicLoudnessFineCmnd) == 0) {
+            unsigned long vol = strtoul(receivedString, NULL, 10);
+            AudioPlayer_VolumeFineToQueueSender(vol, true);
+        }
         // Modify sleep-timer?
         else if (strcmp_P(topic, topicSleepTimerCmnd) == 0) {
             if (gPlayProperties.playMode == NO_PLAYLIST) { // Don't allow sleep-modications if no playlist is active
@@ -458,6 +469,12 @@ void Mqtt_ClientCallback(const char *topic, const byte *payload, uint32_t length
             publishMqtt((char *) FPSTR(topicLedBrightnessState), Led_GetBrightness(), false);
         }
 
+        // Playback-speed (in percent)
+        else if (strcmp_P(topic, topicPlaybackSpeedCmnd) == 0) {
+            TimeStretch_SetSpeed(strtol(receivedString, NULL, 10));
+            publishMqtt((char *) FPSTR(topicPlaybackSpeedState), TimeStretch_GetSpeed(), false);
+        }
+
         // Requested something that isn't specified?
         else {
             snprintf(Log_Buffer, Log_BufferLength, "%s: %s", (char *) FPSTR(noValidTopic), topic);
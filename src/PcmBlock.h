@@ -0,0 +1,18 @@
+#pragma once
+#include <stdint.h>
+
+/* Block-operations of the PCM fast path (refer PcmPlayer.cpp). Don't depend on Arduino; so they're covered by the native unit-tests. */
+
+#ifndef IRAM_ATTR               // Host-build (unit-tests)
+    #define IRAM_ATTR
+#endif
+
+// Expands mono-samples (first half of _frames) in place to stereo-frames (right << 16 | left).
+// Backwards; so no sample is overwritten before it's read.
+static inline void IRAM_ATTR PcmBlock_ExpandMono(uint32_t *_frames, const uint32_t _numberOfFrames) {
+    const int16_t *samples = (const int16_t *) _frames;
+    for (uint32_t i = _numberOfFrames; i-- > 0;) {
+        const uint16_t sample = samples[i];
+        _frames[i] = ((uint32_t) sample << 16) | sample;
+    }
+}
@@ -0,0 +1,285 @@
+#include <Arduino.h>
+#include "settings.h"
+#include "PcmPlayer.h"
+#include "AudioDsp.h"
+#include "AudioPlayer.h"
+#include "AudioStats.h"
+#include "ChannelRouter.h"
+#include "Common.h"
+#include "Log.h"
+#include "PcmBlock.h"
+#include "Resampler.h"
+#include "SdCard.h"
+#include "Spectrum.h"
+#include "TimeStretch.h"
+#include "UiSound.h"
+#include "WavFile.h"
+
+/* Fast path for uncompressed WAV-files (16 bit PCM, mono/stereo): audio-lib is bypassed completely. Sample-data is read
+   in blocks that end at sector-boundaries straight into the buffer that is passed to i2s_write(); so there's no input-ringbuffer
+   and no per-sample callback. Samples are only touched if needed: mono is expanded to stereo, channel-routing, volume/EQ/fades,
+   UI-sounds, time-stretching and resampling are applied by the same chain as for the audio-lib. If all of them are neutral
+   (e.g. max. volume, stereo, no EQ), blocks go to I2S unmodified. */
+
+#ifdef PCM_FASTPATH_ENABLE
+    #include <driver/i2s.h>
+
+    #define PCMPLAYER_SECTOR_SIZE           512u
+    #define PCMPLAYER_BLOCK_FRAMES          (pcmFastPathBlockSize / sizeof(uint32_t))
+
+    static_assert(pcmFastPathBlockSize >= 2u * PCMPLAYER_SECTOR_SIZE && !(pcmFastPathBlockSize % PCMPLAYER_SECTOR_SIZE), "pcmFastPathBlockSize must be a multiple of 512 bytes (min. 1024)");
+
+    static File PcmPlayer_File;
+    static wavFormat PcmPlayer_Format;
+    static uint32_t PcmPlayer_Pos = 0;                          // Position in file (in bytes); like audio-lib's getFilePos()
+    static uint32_t PcmPlayer_FrameSize = 0;                    // Bytes per frame in file
+    static bool PcmPlayer_Active = false;
+    static bool PcmPlayer_Paused = false;
+    static uint32_t PcmPlayer_Buffer[PCMPLAYER_BLOCK_FRAMES];
+
+    static bool PcmPlayer_SilencePending = false;               // Track ended; DMA-buffer is flushed unless the next track follows right away
+
+    static uint32_t PcmPlayer_Read(void);
+    static void PcmPlayer_Close(void);
+    static void PcmPlayer_WriteSilence(void);
+#endif
+
+// Starts playback if file is a WAV-file that is supported by the fast path. Returns false otherwise (=> use audio-lib).
+bool PcmPlayer_Start(const char *_path) {
+    #ifdef PCM_FASTPATH_ENABLE
+        PcmPlayer_SilencePending = false;   // Next track follows gapless (no matter if it's played by fast path or by audio-lib)
+        PcmPlayer_Stop();
+        if (!endsWith(_path, ".wav") && !endsWith(_path, ".WAV")) {
+            return false;
+        }
+
+        PcmPlayer_File = gFSystem.open(_path, FILE_READ);
+        if (!PcmPlayer_File) {
+            return false;
+        }
+        if (!WavFile_ParseHeader(PcmPlayer_File, &PcmPlayer_Format) || PcmPlayer_Format.bitsPerSample != 16 || PcmPlayer_Format.channels > 2 ||
+            PcmPlayer_Format.sampleRate < 8000 || PcmPlayer_Format.sampleRate > 48000) {
+            PcmPlayer_File.close();
+            return false;
+        }
+
+        PcmPlayer_FrameSize = PcmPlayer_Format.channels * sizeof(int16_t);
+        PcmPlayer_Pos = PcmPlayer_Format.dataOffset;
+        PcmPlayer_Paused = false;
+        PcmPlayer_Active = true;
+        i2s_set_sample_rates(I2S_NUM_0, Resampler_GetOutputRate(PcmPlayer_Format.sampleRate));
+
+        snprintf(Log_Buffer, Log_BufferLength, "%s: %u Hz, %u ch", (char *) FPSTR(pcmFastPathActive), PcmPlayer_Format.sampleRate, PcmPlayer_Format.channels);
+        Log_Println(Log_Buffer, LOGLEVEL_INFO);
+        return true;
+    #else
+        return false;
+    #endif
+}
+
+void PcmPlayer_Stop(void) {
+    #ifdef PCM_FASTPATH_ENABLE
+        if (!PcmPlayer_Active) {
+            PcmPlayer_FlushSilence();
+            return;
+        }
+        if (!PcmPlayer_Paused) {
+            PcmPlayer_WriteSilence();
+        }
+        PcmPlayer_Close();
+    #endif
+}
+
+// Called by AudioPlayer_Task while fast path is inactive: if the last track ended and no track followed, DMA-buffer is filled with silence
+void PcmPlayer_FlushSilence(void) {
+    #ifdef PCM_FASTPATH_ENABLE
+        if (PcmPlayer_SilencePending) {
+            PcmPlayer_SilencePending = false;
+            PcmPlayer_WriteSilence();
+        }
+    #endif
+}
+
+void PcmPlayer_PauseResume(void) {
+    #ifdef PCM_FASTPATH_ENABLE
+        if (!PcmPlayer_Active) {
+            return;
+        }
+        PcmPlayer_Paused = !PcmPlayer_Paused;
+        if (PcmPlayer_Paused) {
+            PcmPlayer_WriteSilence();
+        }
+    #endif
+}
+
+// Called by AudioPlayer_Task instead of audio->loop(); writes one block to I2S (blocks if DMA-buffer is full)
+void PcmPlayer_Loop(void) {
+    #ifdef PCM_FASTPATH_ENABLE
+        if (!PcmPlayer_Active || PcmPlayer_Paused) {
+            return;
+        }
+
+        const uint32_t numberOfFrames = PcmPlayer_Read();
+        if (!numberOfFrames) {     // End of file (or read-error); no silence yet as next track might follow gapless
+            PcmPlayer_Close();
+            PcmPlayer_SilencePending = true;
+            Log_Println((char *) FPSTR(pcmFastPathFinished), LOGLEVEL_INFO);
+            gPlayProperties.trackFinished = true;
+            return;
+        }
+
+        const uint32_t sampleRate = PcmPlayer_Format.sampleRate;
+        uint32_t outputFrames = numberOfFrames;
+        Spectrum_ProcessBlock(PcmPlayer_Buffer, numberOfFrames, sampleRate);
+        const bool bypass = AudioDsp_IsTransparent() && ChannelRouter_IsTransparent() && !UiSound_IsActive() && !TimeStretch_IsActive() && Resampler_GetOutputRate(sampleRate) == sampleRate;
+        if (bypass) {
+            AudioStats_OnOutputFrames(numberOfFrames);
+        } else {
+            const bool uiSoundActive = UiSound_IsActive();
+            if (!uiSoundActive) {       // Routing is applied to the whole block (faster); otherwise it has to follow mixing of UI-sounds
+                ChannelRouter_ProcessBlock(PcmPlayer_Buffer, numberOfFrames, sampleRate);
+            }
+            outputFrames = 0;
+            for (uint32_t i = 0; i < numberOfFrames; i++) {
+                uint32_t frame = PcmPlayer_Buffer[i];
+                bool continueI2S;
+                if (uiSoundActive) {
+                    UiSound_Process(&frame, sampleRate);
+                    ChannelRouter_Process(&frame, sampleRate);
+                }
+                AudioDsp_Process(&frame);
+                TimeStretch_Process(&frame, &continueI2S, sampleRate);  // Writes to I2S itself if stretching or resampling is needed
+                if (continueI2S) {
+                    PcmPlayer_Buffer[outputFrames++] = frame;
+                }
+            }
+        }
+
+        if (outputFrames) {
+            size_t bytesWritten;
+            i2s_write(I2S_NUM_0, PcmPlayer_Buffer, outputFrames * sizeof(uint32_t), &bytesWritten, portMAX_DELAY);
+        }
+    #endif
+}
+
+// File is open (playing or paused)
+bool PcmPlayer_IsActive(void) {
+    #ifdef PCM_FASTPATH_ENABLE
+        return PcmPlayer_Active;
+    #else
+        return false;
+    #endif
+}
+
+// Like audio-lib's isRunning(): false while paused
+bool PcmPlayer_IsRunning(void) {
+    #ifdef PCM_FASTPATH_ENABLE
+        return PcmPlayer_Active && !PcmPlayer_Paused;
+    #else
+        return false;
+    #endif
+}
+
+uint32_t PcmPlayer_GetSampleRate(void) {
+    #ifdef PCM_FASTPATH_ENABLE
+        return PcmPlayer_Active ? PcmPlayer_Format.sampleRate : 0;
+    #else
+        return 0;
+    #endif
+}
+
+uint32_t PcmPlayer_GetFilePos(void) {
+    #ifdef PCM_FASTPATH_ENABLE
+        return PcmPlayer_Active ? PcmPlayer_Pos : 0;
+    #else
+        return 0;
+    #endif
+}
+
+uint32_t PcmPlayer_GetFileSize(void) {
+    #ifdef PCM_FASTPATH_ENABLE
+        return PcmPlayer_Active ? PcmPlayer_File.size() : 0;
+    #else
+        return 0;
+    #endif
+}
+
+// Elapsed playtime (in seconds)
+uint32_t PcmPlayer_GetCurrentTime(void) {
+    #ifdef PCM_FASTPATH_ENABLE
+        if (!PcmPlayer_Active) {
+            return 0;
+        }
+        return (PcmPlayer_Pos - PcmPlayer_Format.dataOffset) / PcmPlayer_FrameSize / PcmPlayer_Format.sampleRate;
+    #else
+        return 0;
+    #endif
+}
+
+// Position is aligned to a frame; positions within the header start at the first sample
+bool PcmPlayer_SetFilePos(const uint32_t _pos) {
+    #ifdef PCM_FASTPATH_ENABLE
+        if (!PcmPlayer_Active) {
+            return false;
+        }
+        const uint32_t dataEnd = PcmPlayer_Format.dataOffset + PcmPlayer_Format.dataSize;
+        if (_pos >= dataEnd) {
+            return false;
+        }
+        const uint32_t offset = (_pos > PcmPlayer_Format.dataOffset) ? _pos - PcmPlayer_Format.dataOffset : 0;
+        PcmPlayer_Pos = PcmPlayer_Format.dataOffset + offset - (offset % PcmPlayer_FrameSize);
+        return PcmPlayer_File.seek(PcmPlayer_Pos);
+    #else
+        return false;
+    #endif
+}
+
+bool PcmPlayer_SetTimeOffset(const int32_t _seconds) {
+    #ifdef PCM_FASTPATH_ENABLE
+        if (!PcmPlayer_Active) {
+            return false;
+        }
+        const int64_t pos = (int64_t) PcmPlayer_Pos + (int64_t) _seconds * PcmPlayer_Format.sampleRate * PcmPlayer_FrameSize;
+        return PcmPlayer_SetFilePos((pos > 0) ? pos : 0);
+    #else
+        return false;
+    #endif
+}
+
+#ifdef PCM_FASTPATH_ENABLE
+// Reads next block as stereo-frames into PcmPlayer_Buffer. Every read but the first one after a seek starts at a sector-boundary.
+// Returns number of frames.
+uint32_t PcmPlayer_Read(void) {
+    const uint32_t dataEnd = PcmPlayer_Format.dataOffset + PcmPlayer_Format.dataSize;
+    const uint32_t bufferBytes = PCMPLAYER_BLOCK_FRAMES * PcmPlayer_FrameSize;     // Mono needs half of the buffer; it's expanded in place
+    uint32_t bytes = std::min(dataEnd - PcmPlayer_Pos, bufferBytes - (PcmPlayer_Pos % PCMPLAYER_SECTOR_SIZE));
+    bytes -= bytes % PcmPlayer_FrameSize;
+    if (!bytes) {
+        return 0;
+    }
+
+    const uint32_t bytesRead = PcmPlayer_File.read((uint8_t *) PcmPlayer_Buffer, bytes);
+    PcmPlayer_Pos += bytesRead;
+    const uint32_t numberOfFrames = bytesRead / PcmPlayer_FrameSize;
+
+    if (PcmPlayer_Format.channels == 1) {
+        PcmBlock_ExpandMono(PcmPlayer_Buffer, numberOfFrames);
+    }
+    return numberOfFrames;
+}
+
+void PcmPlayer_Close(void) {
+    PcmPlayer_File.close();
+    PcmPlayer_Active = false;
+    PcmPlayer_Paused = false;
+}
+
+// Fill DMA-buffer with silence; otherwise I2S would repeat its content until somebody writes again
+void PcmPlayer_WriteSilence(void) {
+    memset(PcmPlayer_Buffer, 0, sizeof(PcmPlayer_Buffer));
+    for (uint32_t frames = 0; frames < AudioStats_GetDmaBufferFrames(); frames += PCMPLAYER_BLOCK_FRAMES) {
+        size_t bytesWritten;
+        i2s_write(I2S_NUM_0, PcmPlayer_Buffer, sizeof(PcmPlayer_Buffer), &bytesWritten, portMAX_DELAY);
+    }
+}
+#endif
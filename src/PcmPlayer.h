@@ -0,0 +1,15 @@
+#pragma once
+
+bool PcmPlayer_Start(const char *_path);
+void PcmPlayer_Stop(void);
+void PcmPlayer_FlushSilence(void);
+void PcmPlayer_PauseResume(void);
+void PcmPlayer_Loop(void);
+bool PcmPlayer_IsActive(void);
+bool PcmPlayer_IsRunning(void);
+uint32_t PcmPlayer_GetSampleRate(void);
+uint32_t PcmPlayer_GetFilePos(void);
+uint32_t PcmPlayer_GetFileSize(void);
+uint32_t PcmPlayer_GetCurrentTime(void);
+bool PcmPlayer_SetFilePos(const uint32_t _pos);
+bool PcmPlayer_SetTimeOffset(const int32_t _seconds);
@@ -10,7 +10,7 @@ QueueHandle_t gRfidCardQueue;
 
 void Queues_Init(void) {
     // Create queues
-    gVolumeQueue = xQueueCreate(1, sizeof(int));
+    gVolumeQueue = xQueueCreate(1, sizeof(uint8_t));      // Fine volume (0..255)
     if (gVolumeQueue == NULL) {
         Log_Println((char *) FPSTR(unableToCreateVolQ), LOGLEVEL_ERROR);
     }
@@ -0,0 +1,88 @@
+#include <Arduino.h>
+#include "settings.h"
+#include "Resampler.h"
+#include "AudioStats.h"
+#include "Log.h"
+#include "ResamplerFilter.h"
+#include <driver/i2s.h>
+
+#ifdef RESAMPLER_ENABLE
+    #define RESAMPLER_MAX_OUTPUT_FRAMES     8u                          // Max. output-frames per input-frame (e.g. 8 kHz => 48 kHz: 6)
+    #define RESAMPLER_MIN_INPUT_RATE        (resamplerOutputRate / RESAMPLER_MAX_OUTPUT_FRAMES)
+
+    static_assert(resamplerOutputRate < (1u << (32 - RESAMPLER_POSITION_SHIFT)), "resamplerOutputRate is too high");
+    static_assert(resamplerTaps >= 4 && resamplerTaps <= RESAMPLER_MAX_TAPS && !(resamplerTaps % 2), "resamplerTaps must be even and between 4 and 32");
+
+    static int16_t Resampler_Coefficients[RESAMPLER_PHASES + 1][resamplerTaps];
+    static resamplerFilterState Resampler_Filter;
+    static bool Resampler_Bypass = true;
+    static uint32_t Resampler_InputRate = 0;                    // 0 => rate has to be (re-)evaluated with next frame
+
+    static void Resampler_SetInputRate(const uint32_t _inputRate);
+#endif
+
+// Filter is prepared for the input-rate of the new track/stream with its first frame
+void Resampler_TrackStarted(void) {
+    #ifdef RESAMPLER_ENABLE
+        Resampler_InputRate = 0;
+    #endif
+}
+
+// Rate I2S is actually running with
+uint32_t Resampler_GetOutputRate(const uint32_t _inputRate) {
+    #ifdef RESAMPLER_ENABLE
+        if (_inputRate >= RESAMPLER_MIN_INPUT_RATE) {
+            return resamplerOutputRate;
+        }
+    #endif
+    return _inputRate;
+}
+
+// Called by audio-lib (via audio_process_i2s()) for every frame after DSP-processing.
+// If input-rate differs from output-rate, frames are resampled and written to I2S here (=> *_continueI2S = false).
+void Resampler_Process(uint32_t *_sample, bool *_continueI2S, const uint32_t _inputRate) {
+    *_continueI2S = true;
+    #ifdef RESAMPLER_ENABLE
+        if (_inputRate != Resampler_InputRate) {
+            Resampler_SetInputRate(_inputRate);
+        }
+        if (Resampler_Bypass) {
+            AudioStats_OnOutputFrame();
+            return;
+        }
+        *_continueI2S = false;
+
+        uint32_t output[RESAMPLER_MAX_OUTPUT_FRAMES];
+        const uint8_t numberOfFrames = ResamplerFilter_Push(&Resampler_Filter, *_sample, output, RESAMPLER_MAX_OUTPUT_FRAMES);
+        if (numberOfFrames) {
+            size_t bytesWritten;
+            i2s_write(I2S_NUM_0, output, numberOfFrames * sizeof(output[0]), &bytesWritten, portMAX_DELAY);
+            for (uint8_t i = 0; i < bytesWritten / sizeof(output[0]); i++) {
+                AudioStats_OnOutputFrame();
+            }
+        }
+    #else
+        AudioStats_OnOutputFrame();
+    #endif
+}
+
+#ifdef RESAMPLER_ENABLE
+// Prepares filter for the new input-rate (I2S already runs with output-rate; refer AudioOutput.cpp). Called once per track.
+void Resampler_SetInputRate(const uint32_t _inputRate) {
+    Resampler_InputRate = _inputRate;
+    Resampler_Bypass = (_inputRate < RESAMPLER_MIN_INPUT_RATE || _inputRate == resamplerOutputRate);     // Unknown, too low for the output-buffer or nothing to do
+    if (_inputRate < RESAMPLER_MIN_INPUT_RATE) {
+        return;
+    }
+
+    if (!Resampler_Bypass) {
+        // Cutoff follows the lower of both rates in order to suppress aliasing when downsampling
+        ResamplerFilter_Design(Resampler_Coefficients[0], resamplerTaps, resamplerCutoff * std::min(1.0f, (float) resamplerOutputRate / _inputRate));
+        ResamplerFilter_Start(&Resampler_Filter, Resampler_Coefficients[0], resamplerTaps, _inputRate, resamplerOutputRate);
+    }
+
+    snprintf(Log_Buffer, Log_BufferLength, "%s: %u Hz => %u Hz", (char *) FPSTR(resamplerActive), _inputRate, resamplerOutputRate);
+    Log_Println(Log_Buffer, LOGLEVEL_DEBUG);
+}
+#endif
+
@@ -0,0 +1,5 @@
+#pragma once
+
+void Resampler_TrackStarted(void);
+void Resampler_Process(uint32_t *_sample, bool *_continueI2S, const uint32_t _inputRate);
+uint32_t Resampler_GetOutputRate(const uint32_t _inputRate);
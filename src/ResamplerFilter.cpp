@@ -0,0 +1,37 @@
+#include <math.h>
+#include <string.h>
+#include "ResamplerFilter.h"
+
+// Windowed sinc (Blackman). _cutoff is relative to the Nyquist-frequency of the input.
+// Coefficient [p][i] weights the input-frame i frames before the newest one for an output-frame at fraction p/RESAMPLER_PHASES.
+void ResamplerFilter_Design(int16_t *_coefficients, const uint8_t _taps, const float _cutoff) {
+    const float halfLength = _taps / 2.0f;
+
+    for (uint8_t p = 0; p <= RESAMPLER_PHASES; p++) {
+        float coefficients[RESAMPLER_MAX_TAPS];
+        float sum = 0.0f;
+        for (uint8_t i = 0; i < _taps; i++) {
+            const float t = (float) p / RESAMPLER_PHASES + i - halfLength;
+            const float x = M_PI * _cutoff * t;
+            const float sinc = (fabsf(x) < 1e-6f) ? 1.0f : sinf(x) / x;
+            const float w = (t + halfLength) / (2.0f * halfLength);     // 0..1
+            const float window = (fabsf(t) >= halfLength) ? 0.0f : 0.42f - 0.5f * cosf(2.0f * M_PI * w) + 0.08f * cosf(4.0f * M_PI * w);
+            coefficients[i] = _cutoff * sinc * window;
+            sum += coefficients[i];
+        }
+        for (uint8_t i = 0; i < _taps; i++) {   // Normalize every phase to unity-gain at DC
+            _coefficients[p * _taps + i] = (int16_t) lroundf(coefficients[i] / sum * (1 << RESAMPLER_COEF_SHIFT));
+        }
+    }
+}
+
+// Starts with empty history. _coefficients have to stay valid while the filter is used.
+void ResamplerFilter_Start(resamplerFilterState *_state, const int16_t *_coefficients, const uint8_t _taps, const uint32_t _inputRate, const uint32_t _outputRate) {
+    memset(_state->history, 0, sizeof(_state->history));
+    _state->coefficients = _coefficients;
+    _state->historyPos = 0;
+    _state->taps = _taps;
+    _state->position = 0;
+    _state->inputRate = _inputRate;
+    _state->outputRate = _outputRate;
+}
@@ -0,0 +1,64 @@
+#pragma once
+#include <stdint.h>
+
+/* Polyphase-filter of the resampler. Doesn't depend on Arduino; so it's covered by the native unit-tests. */
+
+#ifndef IRAM_ATTR               // Host-build (unit-tests)
+    #define IRAM_ATTR
+#endif
+
+#define RESAMPLER_PHASES_SHIFT          6u                          // 64 phases; coefficients between two phases are interpolated linearly
+#define RESAMPLER_PHASES                (1u << RESAMPLER_PHASES_SHIFT)
+#define RESAMPLER_COEF_SHIFT            14                          // Coefficients are stored as Q1.14
+#define RESAMPLER_POSITION_SHIFT        16                          // Fraction between two input-frames is passed to the filter as Q0.16
+#define RESAMPLER_MAX_TAPS              32u
+
+typedef struct {
+    const int16_t *coefficients;                    // (RESAMPLER_PHASES + 1) * taps; refer ResamplerFilter_Design()
+    int16_t history[2][RESAMPLER_MAX_TAPS * 2];     // Ringbuffer per channel; mirrored so the filter can read contiguously
+    uint8_t historyPos;
+    uint8_t taps;
+    uint32_t position;                              // Position of next output-frame behind the current input-frame (in 1/outputRate input-frames)
+    uint32_t inputRate;                             // Input-frames per output-frame (in 1/outputRate). Exact, so there's no drift.
+    uint32_t outputRate;
+} resamplerFilterState;
+
+// _coefficients has to provide (RESAMPLER_PHASES + 1) * _taps entries
+void ResamplerFilter_Design(int16_t *_coefficients, const uint8_t _taps, const float _cutoff);
+void ResamplerFilter_Start(resamplerFilterState *_state, const int16_t *_coefficients, const uint8_t _taps, const uint32_t _inputRate, const uint32_t _outputRate);
+
+// Calculates one output-sample. Cost is bounded to _taps MACs (+ interpolation) independent of the rates.
+// _history points to the newest input-frame; older ones follow. _fraction is the position of the output-frame behind it (Q0.16).
+static inline int16_t IRAM_ATTR ResamplerFilter_Run(const int16_t *_history, const int16_t *_coefficients, const uint8_t _taps, const uint32_t _fraction) {
+    const uint32_t phase = _fraction >> (RESAMPLER_POSITION_SHIFT - RESAMPLER_PHASES_SHIFT);
+    const int32_t fraction = _fraction & ((1u << (RESAMPLER_POSITION_SHIFT - RESAMPLER_PHASES_SHIFT)) - 1);
+    const int16_t *c0 = &_coefficients[phase * _taps];
+    const int16_t *c1 = c0 + _taps;
+    int32_t sum = 0;
+
+    for (uint8_t i = 0; i < _taps; i++) {
+        const int32_t coefficient = c0[i] + (((c1[i] - c0[i]) * fraction + (1 << (RESAMPLER_POSITION_SHIFT - RESAMPLER_PHASES_SHIFT - 1))) >> (RESAMPLER_POSITION_SHIFT - RESAMPLER_PHASES_SHIFT));
+        sum += _history[i] * coefficient;
+    }
+    sum = (sum + (1 << (RESAMPLER_COEF_SHIFT - 1))) >> RESAMPLER_COEF_SHIFT;
+    return (int16_t) (sum < -32768 ? -32768 : (sum > 32767 ? 32767 : sum));
+}
+
+// Takes one input-frame (right << 16 | left) and writes the output-frames that fall behind it (max. _maxFrames). Returns their number.
+static inline uint8_t IRAM_ATTR ResamplerFilter_Push(resamplerFilterState *_state, const uint32_t _frame, uint32_t *_output, const uint8_t _maxFrames) {
+    const uint8_t taps = _state->taps;
+    _state->historyPos = _state->historyPos ? _state->historyPos - 1 : taps - 1;
+    _state->history[0][_state->historyPos] = _state->history[0][_state->historyPos + taps] = (int16_t) (_frame & 0xFFFF);
+    _state->history[1][_state->historyPos] = _state->history[1][_state->historyPos + taps] = (int16_t) (_frame >> 16);
+
+    uint8_t numberOfFrames = 0;
+    while (_state->position < _state->outputRate && numberOfFrames < _maxFrames) {
+        const uint32_t fraction = (_state->position << RESAMPLER_POSITION_SHIFT) / _state->outputRate;
+        const int16_t left = ResamplerFilter_Run(&_state->history[0][_state->historyPos], _state->coefficients, taps, fraction);
+        const int16_t right = ResamplerFilter_Run(&_state->history[1][_state->historyPos], _state->coefficients, taps, fraction);
+        _output[numberOfFrames++] = ((uint32_t) (uint16_t) right << 16) | (uint16_t) left;
+        _state->position += _state->inputRate;
+    }
+    _state->position -= _state->outputRate;
+    return numberOfFrames;
+}
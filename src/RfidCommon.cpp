@@ -4,11 +4,14 @@
 #include "AudioPlayer.h"
 #include "Cmd.h"
 #include "Common.h"
+#include "Led.h"
 #include "Log.h"
 #include "MemX.h"
 #include "Mqtt.h"
 #include "Queues.h"
 #include "System.h"
+#include "TimeStretch.h"
+#include "UiSound.h"
 #include "Web.h"
 
 unsigned long Rfid_LastRfidCheckTimestamp = 0;
@@ -22,6 +25,7 @@ void Rfid_PreferenceLookupHandler(void) {
     uint32_t _lastPlayPos = 0;
     uint16_t _trackLastPlayed = 0;
     uint32_t _playMode = 1;
+    uint8_t _playbackSpeed = TIMESTRETCH_SPEED_NORMAL;
 
     rfidStatus = xQueueReceive(gRfidCardQueue, &rfidTagId, 0);
     if (rfidStatus == pdPASS) {
@@ -35,7 +39,8 @@ void Rfid_PreferenceLookupHandler(void) {
         String s = gPrefsRfid.getString(gCurrentRfidTagId, "-1"); // Try to lookup rfidId in NVS
         if (!s.compareTo("-1")) {
             Log_Println((char *) FPSTR(rfidTagUnknownInNvs), LOGLEVEL_ERROR);
-            System_IndicateError();
+            Led_Indicate(LedIndicatorType::Error);
+            UiSound_Play(UISOUND_CARD_UNKNOWN);
             return;
         }
 
@@ -51,12 +56,14 @@ void Rfid_PreferenceLookupHandler(void) {
                 _playMode = strtoul(token, NULL, 10);
             } else if (i == 4) {
                 _trackLastPlayed = strtoul(token, NULL, 10);
+            } else if (i == 5) {
+                _playbackSpeed = strtoul(token, NULL, 10);
             }
             i++;
             token = strtok(NULL, stringDelimiter);
         }
 
-        if (i != 5) {
+        if (i != 5 && i != 6) {     // Playback-speed is optional (wasn't stored by older versions)
             Log_Println((char *) FPSTR(errorOccuredNvs), LOGLEVEL_ERROR);
             System_IndicateError();
         } else {
@@ -76,6 +83,8 @@ void Rfid_PreferenceLookupHandler(void) {
                     }
                 #endif
 
+                UiSound_Play(UISOUND_CARD_ACCEPTED);
+                TimeStretch_SetSpeed(_playbackSpeed);
                 AudioPlayer_TrackQueueDispatcher(_file, _lastPlayPos, _playMode, _trackLastPlayed);
             }
         }
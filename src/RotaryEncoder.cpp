@@ -4,6 +4,7 @@
 #include "AudioPlayer.h"
 #include "Log.h"
 #include "System.h"
+#include "UiSound.h"
 
 #ifdef USEROTARY_ENABLE
 #include <ESP32Encoder.h>
@@ -15,7 +16,6 @@
     // Rotary encoder-helper
     int32_t lastEncoderValue;
     int32_t currentEncoderValue;
-    int32_t lastVolume = -1;                                // Don't change -1 as initial-value!
 #endif
 
 void RotaryEncoder_Init(void) {
@@ -23,46 +23,46 @@ void RotaryEncoder_Init(void) {
     #ifdef USEROTARY_ENABLE
         encoder.attachHalfQuad(ROTARYENCODER_CLK, ROTARYENCODER_DT);
         encoder.clearCount();
-        encoder.setCount(AudioPlayer_GetInitVolume() * 2); // Ganzes Raster ist immer +2, daher initiale Lautstärke mit 2 multiplizieren
+        lastEncoderValue = encoder.getCount();
     #endif
 }
 
+// Encoder is evaluated relatively to the current volume. So it only needs to forget pending counts if volume was changed elsewhere.
 void RotaryEncoder_Readjust(void) {
     #ifdef USEROTARY_ENABLE
         encoder.clearCount();
-        encoder.setCount(AudioPlayer_GetCurrentVolume() * 2);
+        lastEncoderValue = encoder.getCount();
     #endif
 }
 
-// Handles volume directed by rotary encoder
+// Handles volume directed by rotary encoder. Every detent changes volume by rotaryEncoderVolumeStep fine steps.
 void RotaryEncoder_Cyclic(void) {
     #ifdef USEROTARY_ENABLE
         if (System_AreControlsLocked()) {
-            encoder.clearCount();
-            encoder.setCount(AudioPlayer_GetCurrentVolume() * 2);
+            RotaryEncoder_Readjust();
             return;
         }
 
         currentEncoderValue = encoder.getCount();
-        // Only if initial run or value has changed. And only after "full step" of rotary encoder
-        if (((lastEncoderValue != currentEncoderValue) || lastVolume == -1) && (currentEncoderValue % 2 == 0)) {
+        // Only if value has changed. And only after "full step" of rotary encoder
+        if ((lastEncoderValue != currentEncoderValue) && (currentEncoderValue % 2 == 0)) {
             System_UpdateActivityTimer(); // Set inactive back if rotary encoder was used
-            if ((AudioPlayer_GetMaxVolume() * 2) < currentEncoderValue) {
-                encoder.clearCount();
-                encoder.setCount(AudioPlayer_GetMaxVolume() * 2);
+            const int32_t minVolume = AudioPlayer_VolumeToFine(AudioPlayer_GetMinVolume());
+            const int32_t maxVolume = AudioPlayer_VolumeToFine(AudioPlayer_GetMaxVolume());
+            int32_t newVolume = AudioPlayer_GetCurrentVolumeFine() + (currentEncoderValue - lastEncoderValue) / 2 * rotaryEncoderVolumeStep;
+            lastEncoderValue = currentEncoderValue;
+
+            if (newVolume > maxVolume) {
+                newVolume = maxVolume;
                 Log_Println((char *) FPSTR(maxLoudnessReached), LOGLEVEL_INFO);
-                currentEncoderValue = encoder.getCount();
-            } else if (currentEncoderValue < AudioPlayer_GetMinVolume()) {
-                encoder.clearCount();
-                encoder.setCount(AudioPlayer_GetMinVolume());
+                UiSound_Play(UISOUND_VOLUME_LIMIT);
+            } else if (newVolume < minVolume) {
+                newVolume = minVolume;
                 Log_Println((char *) FPSTR(minLoudnessReached), LOGLEVEL_INFO);
-                currentEncoderValue = encoder.getCount();
+                UiSound_Play(UISOUND_VOLUME_LIMIT);
             }
-            lastEncoderValue = currentEncoderValue;
-            AudioPlayer_SetCurrentVolume(lastEncoderValue / 2u);
-            if (AudioPlayer_GetCurrentVolume() != lastVolume) {
-                lastVolume = AudioPlayer_GetCurrentVolume();
-                AudioPlayer_VolumeToQueueSender(AudioPlayer_GetCurrentVolume(), false);
+            if (newVolume != AudioPlayer_GetCurrentVolumeFine()) {
+                AudioPlayer_VolumeFineToQueueSender(newVolume, false);
             }
         }
     #endif
@@ -14,6 +14,10 @@
     fs::FS gFSystem = (fs::FS)SD;
 #endif
 
+#if defined(SEEKTABLE_ENABLE) || defined(REPLAYGAIN_ENABLE)
+    static void SdCard_MoveSidecar(const char *_srcTrack, const char *_dstTrack, const char *_suffix);
+#endif
+
 void SdCard_Init(void) {
     #ifndef SINGLE_SPI_ENABLE
         #ifdef SD_MMC_1BIT_MODE
@@ -320,3 +324,32 @@ char **SdCard_ReturnPlaylist(const char *fileName, const uint32_t _playMode) {
 
     return ++files; // return ptr+1 (starting at 1st payload-item); ptr+0 contains number of items
 }
+
+// Keeps sidecar-files (seek-table, measured loudness) in sync if a track is renamed (_dstTrack) or deleted (_dstTrack == NULL) via explorer
+void SdCard_MoveSidecars(const char *_srcTrack, const char *_dstTrack) {
+    #ifdef SEEKTABLE_ENABLE
+        SdCard_MoveSidecar(_srcTrack, _dstTrack, (const char *) FPSTR(seekTableFileSuffix));
+    #endif
+    #ifdef REPLAYGAIN_ENABLE
+        SdCard_MoveSidecar(_srcTrack, _dstTrack, (const char *) FPSTR(replayGainFileSuffix));
+    #endif
+}
+
+#if defined(SEEKTABLE_ENABLE) || defined(REPLAYGAIN_ENABLE)
+// Sidecar-file is named like its track plus _suffix
+void SdCard_MoveSidecar(const char *_srcTrack, const char *_dstTrack, const char *_suffix) {
+    char srcSidecarPath[MAX_FILEPATH_LENTGH + 10];
+    snprintf(srcSidecarPath, sizeof(srcSidecarPath), "%s%s", _srcTrack, _suffix);
+    if (!gFSystem.exists(srcSidecarPath)) {
+        return;
+    }
+
+    if (_dstTrack == NULL) {
+        gFSystem.remove(srcSidecarPath);
+    } else {
+        char dstSidecarPath[MAX_FILEPATH_LENTGH + 10];
+        snprintf(dstSidecarPath, sizeof(dstSidecarPath), "%s%s", _dstTrack, _suffix);
+        gFSystem.rename(srcSidecarPath, dstSidecarPath);
+    }
+}
+#endif
@@ -12,3 +12,4 @@ void SdCard_Init(void);
 void SdCard_Exit(void);
 sdcard_type_t SdCard_GetType(void);
 char **SdCard_ReturnPlaylist(const char *fileName, const uint32_t _playMode);
+void SdCard_MoveSidecars(const char *_srcTrack, const char *_dstTrack);
@@ -0,0 +1,643 @@
+#include <Arduino.h>
+#include "settings.h"
+#include "SeekTable.h"
+#include "Common.h"
+#include "Log.h"
+#include "MemX.h"
+#include "SdCard.h"
+
+#ifdef SEEKTABLE_ENABLE
+    #define SEEKTABLE_VERSION       1u
+    #define SEEKTABLE_ENTRY_CHUNK   64u     // Number of entries that are buffered before being written to sidecar
+    #define SEEKTABLE_MAX_VBRI_TOC  1000u   // Limit for VBRI-TOC-entries that are loaded into RAM
+
+    /* Layout of the sidecar-file:
+       header followed by <entryCount> uint32-offsets. Entry n contains the byte-offset of frame (n * framesPerEntry). */
+    typedef struct {
+        char magic[4];
+        uint8_t version;
+        uint8_t reserved;
+        uint16_t samplesPerFrame;       // 1152 (MPEG1) or 576 (MPEG2/2.5)
+        uint32_t fileSize;              // Size of the audio-file the table was created for (used to detect outdated tables)
+        uint32_t sampleRate;
+        uint32_t framesPerEntry;
+        uint32_t entryCount;
+        uint32_t frameCount;
+    } __attribute__((packed)) seekTableHeader;
+
+    typedef struct {
+        uint32_t sampleRate;
+        uint16_t samplesPerFrame;
+        uint16_t frameLength;
+        uint8_t version;                // 3: MPEG1, 2: MPEG2, 0: MPEG2.5
+        uint8_t channelMode;            // 3: mono
+    } mp3FrameInfo;
+
+    static const char SeekTable_Magic[4] = {'E', 'S', 'K', 'T'};
+    static const uint16_t SeekTable_BitratesV1[15] = {0, 32, 40, 48, 56, 64, 80, 96, 112, 128, 160, 192, 224, 256, 320};
+    static const uint16_t SeekTable_BitratesV2[15] = {0, 8, 16, 24, 32, 40, 48, 56, 64, 80, 96, 112, 128, 144, 160};
+    static const uint32_t SeekTable_SampleRates[3] = {44100, 48000, 32000};
+
+    static QueueHandle_t SeekTable_BuildQueue;
+    static char *SeekTable_CurrentTrack = NULL;
+    static seekTableHeader SeekTable_Header;
+    static bool SeekTable_IndexActive = false;
+    static bool SeekTable_BuildRequested = false;
+
+    // Coarse table of contents (from Xing- or VBRI-header). Used until the exact table is available.
+    static uint32_t *SeekTable_TocFrames = NULL;
+    static uint32_t *SeekTable_TocOffsets = NULL;
+    static uint16_t SeekTable_TocCount = 0;
+    static uint32_t SeekTable_TocSampleRate = 0;
+    static uint16_t SeekTable_TocSamplesPerFrame = 0;
+
+    static void SeekTable_Task(void *parameter);
+    static bool SeekTable_Build(const char *_track);
+    static bool SeekTable_OpenIndex(void);
+    static void SeekTable_LoadToc(void);
+    static void SeekTable_RequestBuild(void);
+    static void SeekTable_GetIndexPath(const char *_track, char *_path, const size_t _size);
+    static const char *SeekTable_GetIndexPathStatic(void);
+    static bool SeekTable_ParseFrameHeader(const uint8_t *_buf, mp3FrameInfo *_info);
+    static bool SeekTable_ReadFrameHeader(File &_file, const uint32_t _pos, mp3FrameInfo *_info);
+    static bool SeekTable_FindFrame(File &_file, uint32_t _pos, mp3FrameInfo *_info, uint32_t *_framePos);
+    static uint32_t SeekTable_SkipId3(File &_file);
+    static uint32_t SeekTable_ReadEntry(File &_indexFile, const uint32_t _entry);
+    static uint32_t SeekTable_FrameForPos(File &_indexFile, File &_audioFile, const uint32_t _pos);
+    static uint32_t SeekTable_PosForFrame(File &_indexFile, File &_audioFile, const uint32_t _frame);
+    static bool SeekTable_GetTocSeekPosition(const uint32_t _currentPos, const int32_t _offsetSeconds, uint32_t *_newPos);
+#endif
+
+void SeekTable_Init(void) {
+    #ifdef SEEKTABLE_ENABLE
+        SeekTable_BuildQueue = xQueueCreate(2, sizeof(char *));
+        if (SeekTable_BuildQueue == NULL) {
+            Log_Println((char *) FPSTR(unableToCreateSeekTableQ), LOGLEVEL_ERROR);
+            return;
+        }
+
+        xTaskCreatePinnedToCore(
+            SeekTable_Task,         /* Function to implement the task */
+            "seekTable",            /* Name of the task */
+            3000,                   /* Stack size in words */
+            NULL,                   /* Task input parameter */
+            1,                      /* Priority of the task */
+            NULL,                   /* Task handle. */
+            0                       /* Core where the task should run */
+        );
+    #endif
+}
+
+// Is called every time a new track from SD is started. Loads the sidecar-file (if valid) or falls back to
+// Xing/VBRI-TOC. If requested, the exact table is created in background if it doesn't exist yet.
+void SeekTable_Prepare(const char *_track, const bool _buildIfMissing) {
+    #ifdef SEEKTABLE_ENABLE
+        SeekTable_Release();
+
+        if (!endsWith(_track, ".mp3") && !endsWith(_track, ".MP3")) {
+            return;
+        }
+        SeekTable_CurrentTrack = x_strdup(_track);
+        if (SeekTable_CurrentTrack == NULL) {
+            return;
+        }
+
+        if (SeekTable_OpenIndex()) {
+            return;
+        }
+
+        SeekTable_LoadToc();
+        if (_buildIfMissing) {
+            SeekTable_RequestBuild();
+        }
+    #endif
+}
+
+void SeekTable_Release(void) {
+    #ifdef SEEKTABLE_ENABLE
+        free(SeekTable_CurrentTrack);
+        SeekTable_CurrentTrack = NULL;
+        free(SeekTable_TocFrames);
+        SeekTable_TocFrames = NULL;
+        free(SeekTable_TocOffsets);
+        SeekTable_TocOffsets = NULL;
+        SeekTable_TocCount = 0;
+        SeekTable_IndexActive = false;
+        SeekTable_BuildRequested = false;
+    #endif
+}
+
+// Calculates the byte-offset of the frame that is _offsetSeconds away from the frame at _currentPos.
+// Returns false if no table is available for the current track (caller has to fall back to the decoder's estimation).
+bool SeekTable_GetSeekPosition(const uint32_t _currentPos, const int32_t _offsetSeconds, uint32_t *_newPos) {
+    #ifdef SEEKTABLE_ENABLE
+        if (SeekTable_CurrentTrack == NULL) {
+            return false;
+        }
+
+        if (!SeekTable_IndexActive && !SeekTable_OpenIndex()) {
+            // No exact table available yet => create it for upcoming seeks
+            SeekTable_RequestBuild();
+            return SeekTable_GetTocSeekPosition(_currentPos, _offsetSeconds, _newPos);
+        }
+
+        File indexFile = gFSystem.open(SeekTable_GetIndexPathStatic(), FILE_READ);
+        File audioFile = gFSystem.open(SeekTable_CurrentTrack, FILE_READ);
+        if (!indexFile || !audioFile) {
+            indexFile.close();
+            audioFile.close();
+            return false;
+        }
+
+        int64_t targetFrame = (int64_t) SeekTable_FrameForPos(indexFile, audioFile, _currentPos);
+        targetFrame += ((int64_t) _offsetSeconds * SeekTable_Header.sampleRate) / SeekTable_Header.samplesPerFrame;
+        if (targetFrame < 0) {
+            targetFrame = 0;
+        } else if (targetFrame >= SeekTable_Header.frameCount) {
+            targetFrame = SeekTable_Header.frameCount - 1;
+        }
+
+        *_newPos = SeekTable_PosForFrame(indexFile, audioFile, (uint32_t) targetFrame);
+        indexFile.close();
+        audioFile.close();
+        return true;
+    #else
+        return false;
+    #endif
+}
+
+// Returns the start of the frame _pos is located in (e.g. to resume an audiobook exactly at a frame-boundary).
+// If no table is available, _pos is returned unchanged.
+uint32_t SeekTable_AlignToFrame(const uint32_t _pos) {
+    #ifdef SEEKTABLE_ENABLE
+        if (SeekTable_CurrentTrack == NULL || (!SeekTable_IndexActive && !SeekTable_OpenIndex())) {
+            return _pos;
+        }
+
+        File indexFile = gFSystem.open(SeekTable_GetIndexPathStatic(), FILE_READ);
+        File audioFile = gFSystem.open(SeekTable_CurrentTrack, FILE_READ);
+        uint32_t alignedPos = _pos;
+        if (indexFile && audioFile) {
+            alignedPos = SeekTable_PosForFrame(indexFile, audioFile, SeekTable_FrameForPos(indexFile, audioFile, _pos));
+        }
+        indexFile.close();
+        audioFile.close();
+        return alignedPos;
+    #else
+        return _pos;
+    #endif
+}
+
+#ifdef SEEKTABLE_ENABLE
+// Creates seek-tables in background. Runs with low priority on core 0 as mp3-decoding takes place on core 1.
+void SeekTable_Task(void *parameter) {
+    char *track;
+
+    for (;;) {
+        if (xQueueReceive(SeekTable_BuildQueue, &track, portMAX_DELAY) == pdPASS) {
+            uint32_t startTimestamp = millis();
+            if (SeekTable_Build(track)) {
+                snprintf(Log_Buffer, Log_BufferLength, "%s: %s (%u ms)", (char *) FPSTR(seekTableCreated), track, millis() - startTimestamp);
+                Log_Println(Log_Buffer, LOGLEVEL_INFO);
+            } else {
+                snprintf(Log_Buffer, Log_BufferLength, "%s: %s", (char *) FPSTR(seekTableCreationFailed), track);
+                Log_Println(Log_Buffer, LOGLEVEL_ERROR);
+            }
+            free(track);
+        }
+    }
+    vTaskDelete(NULL);
+}
+
+// Scans all frame-headers of the given file once and writes every n-th frame-offset to the sidecar-file.
+bool SeekTable_Build(const char *_track) {
+    char indexPath[MAX_FILEPATH_LENTGH + 10];
+    SeekTable_GetIndexPath(_track, indexPath, sizeof(indexPath));
+
+    File audioFile = gFSystem.open(_track, FILE_READ);
+    if (!audioFile) {
+        return false;
+    }
+
+    const uint32_t fileSize = audioFile.size();
+    mp3FrameInfo firstFrame;
+    mp3FrameInfo info;
+    uint32_t pos;
+    if (!SeekTable_FindFrame(audioFile, SeekTable_SkipId3(audioFile), &firstFrame, &pos)) {
+        audioFile.close();
+        return false;
+    }
+
+    uint8_t *readBuf = (uint8_t *) x_malloc(seekTableReadBufferSize);
+    uint32_t *entries = (uint32_t *) x_malloc(sizeof(uint32_t) * SEEKTABLE_ENTRY_CHUNK);
+    File indexFile = gFSystem.open(indexPath, FILE_WRITE);
+    if (readBuf == NULL || entries == NULL || !indexFile) {
+        free(readBuf);
+        free(entries);
+        indexFile.close();
+        audioFile.close();
+        return false;
+    }
+
+    seekTableHeader header;
+    memset(&header, 0, sizeof(header));
+    memcpy(header.magic, SeekTable_Magic, sizeof(header.magic));
+    header.version = SEEKTABLE_VERSION;
+    header.samplesPerFrame = firstFrame.samplesPerFrame;
+    header.fileSize = fileSize;
+    header.sampleRate = firstFrame.sampleRate;
+    header.framesPerEntry = seekTableFramesPerEntry;
+    indexFile.write((uint8_t *) &header, sizeof(header)); // Placeholder; is rewritten once counters are known
+
+    uint32_t bufStart = 0;
+    uint32_t bufLen = 0;
+    uint32_t entriesBuffered = 0;
+    bool writeOk = true;
+
+    while (pos + 4 <= fileSize && writeOk) {
+        if (pos < bufStart || pos + 4 > bufStart + bufLen) {
+            audioFile.seek(pos);
+            bufStart = pos;
+            bufLen = audioFile.read(readBuf, seekTableReadBufferSize);
+            if (bufLen < 4) {
+                break;
+            }
+            vTaskDelay(portTICK_PERIOD_MS * 1); // Don't block SD for playback
+        }
+
+        if (!SeekTable_ParseFrameHeader(readBuf + (pos - bufStart), &info) || info.sampleRate != firstFrame.sampleRate) {
+            // Lost sync (corrupted frame or trailing ID3v1/APE-tag) => try to resync
+            if (!SeekTable_FindFrame(audioFile, pos + 1, &info, &pos) || info.sampleRate != firstFrame.sampleRate) {
+                break;
+            }
+            bufLen = 0;
+            continue;
+        }
+
+        if (header.frameCount % seekTableFramesPerEntry == 0) {
+            entries[entriesBuffered++] = pos;
+            if (entriesBuffered == SEEKTABLE_ENTRY_CHUNK) {
+                writeOk = (indexFile.write((uint8_t *) entries, sizeof(uint32_t) * entriesBuffered) == sizeof(uint32_t) * entriesBuffered);
+                header.entryCount += entriesBuffered;
+                entriesBuffered = 0;
+            }
+        }
+        header.frameCount++;
+        pos += info.frameLength;
+    }
+
+    if (entriesBuffered && writeOk) {
+        writeOk = (indexFile.write((uint8_t *) entries, sizeof(uint32_t) * entriesBuffered) == sizeof(uint32_t) * entriesBuffered);
+        header.entryCount += entriesBuffered;
+    }
+
+    if (writeOk && header.entryCount) {
+        indexFile.seek(0);
+        writeOk = (indexFile.write((uint8_t *) &header, sizeof(header)) == sizeof(header));
+    }
+
+    indexFile.close();
+    audioFile.close();
+    free(readBuf);
+    free(entries);
+
+    if (!writeOk || !header.entryCount) {
+        gFSystem.remove(indexPath);
+        return false;
+    }
+    return true;
+}
+
+// Checks if a valid sidecar-file exists for the current track and loads its header.
+bool SeekTable_OpenIndex(void) {
+    File indexFile = gFSystem.open(SeekTable_GetIndexPathStatic(), FILE_READ);
+    if (!indexFile) {
+        return false;
+    }
+    File audioFile = gFSystem.open(SeekTable_CurrentTrack, FILE_READ);
+    if (!audioFile) {
+        indexFile.close();
+        return false;
+    }
+
+    seekTableHeader header;
+    bool valid = (indexFile.read((uint8_t *) &header, sizeof(header)) == sizeof(header)) &&
+                 !memcmp(header.magic, SeekTable_Magic, sizeof(header.magic)) &&
+                 header.version == SEEKTABLE_VERSION &&
+                 header.fileSize == audioFile.size() &&
+                 header.entryCount > 0 && header.framesPerEntry > 0 && header.samplesPerFrame > 0 &&
+                 indexFile.size() >= sizeof(header) + header.entryCount * sizeof(uint32_t);
+    indexFile.close();
+    audioFile.close();
+
+    if (valid) {
+        SeekTable_Header = header;
+        SeekTable_IndexActive = true;
+        snprintf(Log_Buffer, Log_BufferLength, "%s: %u", (char *) FPSTR(seekTableLoaded), header.frameCount);
+        Log_Println(Log_Buffer, LOGLEVEL_DEBUG);
+    }
+    return valid;
+}
+
+// Loads the TOC of a Xing/Info- or VBRI-header (if present) into RAM.
+void SeekTable_LoadToc(void) {
+    File audioFile = gFSystem.open(SeekTable_CurrentTrack, FILE_READ);
+    if (!audioFile) {
+        return;
+    }
+
+    mp3FrameInfo info;
+    uint32_t framePos;
+    uint8_t buf[160];
+    if (!SeekTable_FindFrame(audioFile, SeekTable_SkipId3(audioFile), &info, &framePos) || !audioFile.seek(framePos) || audioFile.read(buf, sizeof(buf)) != sizeof(buf)) {
+        audioFile.close();
+        return;
+    }
+
+    // Offset of Xing-header depends on size of side-information
+    uint8_t xingOffset;
+    if (info.version == 3) {
+        xingOffset = (info.channelMode == 3) ? 21 : 36;
+    } else {
+        xingOffset = (info.channelMode == 3) ? 13 : 21;
+    }
+
+    if (!memcmp(buf + xingOffset, "Xing", 4) || !memcmp(buf + xingOffset, "Info", 4)) {
+        const uint8_t *p = buf + xingOffset + 4;
+        const uint32_t flags = (p[0] << 24) | (p[1] << 16) | (p[2] << 8) | p[3];
+        p += 4;
+        uint32_t frames = 0;
+        uint32_t bytes = audioFile.size() - framePos;
+        if (flags & 0x01) {
+            frames = (p[0] << 24) | (p[1] << 16) | (p[2] << 8) | p[3];
+            p += 4;
+        }
+        if (flags & 0x02) {
+            bytes = (p[0] << 24) | (p[1] << 16) | (p[2] << 8) | p[3];
+            p += 4;
+        }
+        if ((flags & 0x04) && frames && (p + 100 <= buf + sizeof(buf))) {
+            SeekTable_TocFrames = (uint32_t *) x_malloc(sizeof(uint32_t) * 101);
+            SeekTable_TocOffsets = (uint32_t *) x_malloc(sizeof(uint32_t) * 101);
+            if (SeekTable_TocFrames != NULL && SeekTable_TocOffsets != NULL) {
+                for (uint8_t i = 0; i < 100; i++) {
+                    SeekTable_TocFrames[i] = (uint32_t) (((uint64_t) frames * i) / 100);
+                    SeekTable_TocOffsets[i] = framePos + (uint32_t) (((uint64_t) bytes * p[i]) / 256);
+                }
+                SeekTable_TocFrames[100] = frames;
+                SeekTable_TocOffsets[100] = framePos + bytes;
+                SeekTable_TocCount = 101;
+            }
+        }
+    } else if (!memcmp(buf + 36, "VBRI", 4)) {
+        const uint8_t *p = buf + 36 + 4;
+        const uint32_t frames = (p[10] << 24) | (p[11] << 16) | (p[12] << 8) | p[13];
+        uint16_t tocEntries = (p[14] << 8) | p[15];
+        const uint16_t tocScale = (p[16] << 8) | p[17];
+        const uint16_t entrySize = (p[18] << 8) | p[19];
+        const uint16_t framesPerEntry = (p[20] << 8) | p[21];
+        if (tocEntries > SEEKTABLE_MAX_VBRI_TOC) {
+            tocEntries = SEEKTABLE_MAX_VBRI_TOC;
+        }
+        if (frames && tocEntries && entrySize >= 1 && entrySize <= 4) {
+            SeekTable_TocFrames = (uint32_t *) x_malloc(sizeof(uint32_t) * (tocEntries + 1));
+            SeekTable_TocOffsets = (uint32_t *) x_malloc(sizeof(uint32_t) * (tocEntries + 1));
+            if (SeekTable_TocFrames != NULL && SeekTable_TocOffsets != NULL && audioFile.seek(framePos + 36 + 4 + 22)) {
+                uint32_t offset = framePos;
+                SeekTable_TocFrames[0] = 0;
+                SeekTable_TocOffsets[0] = offset;
+                uint16_t i;
+                for (i = 0; i < tocEntries; i++) {
+                    uint8_t entry[4];
+                    if (audioFile.read(entry, entrySize) != entrySize) {
+                        break;
+                    }
+                    uint32_t segmentSize = 0;
+                    for (uint8_t j = 0; j < entrySize; j++) {
+                        segmentSize = (segmentSize << 8) | entry[j];
+                    }
+                    offset += segmentSize * tocScale;
+                    SeekTable_TocFrames[i + 1] = min((uint32_t) (i + 1) * framesPerEntry, frames);
+                    SeekTable_TocOffsets[i + 1] = offset;
+                }
+                SeekTable_TocCount = i + 1;
+            }
+        }
+    }
+    audioFile.close();
+
+    if (SeekTable_TocCount < 2) {
+        free(SeekTable_TocFrames);
+        SeekTable_TocFrames = NULL;
+        free(SeekTable_TocOffsets);
+        SeekTable_TocOffsets = NULL;
+        SeekTable_TocCount = 0;
+    } else {
+        SeekTable_TocSampleRate = info.sampleRate;
+        SeekTable_TocSamplesPerFrame = info.samplesPerFrame;
+        Log_Println((char *) FPSTR(seekTableUsingToc), LOGLEVEL_DEBUG);
+    }
+}
+
+// Estimates the target-position by interpolating between the entries of Xing/VBRI-TOC.
+// Target is aligned to the next frame-header afterwards.
+bool SeekTable_GetTocSeekPosition(const uint32_t _currentPos, const int32_t _offsetSeconds, uint32_t *_newPos) {
+    if (!SeekTable_TocCount) {
+        return false;
+    }
+
+    uint16_t i = 0;
+    while (i + 2 < SeekTable_TocCount && SeekTable_TocOffsets[i + 1] <= _currentPos) {
+        i++;
+    }
+    int64_t frame = SeekTable_TocFrames[i];
+    uint32_t segmentBytes = SeekTable_TocOffsets[i + 1] - SeekTable_TocOffsets[i];
+    if (segmentBytes && _currentPos > SeekTable_TocOffsets[i]) {
+        frame += ((uint64_t) min(_currentPos - SeekTable_TocOffsets[i], segmentBytes) * (SeekTable_TocFrames[i + 1] - SeekTable_TocFrames[i])) / segmentBytes;
+    }
+
+    frame += ((int64_t) _offsetSeconds * SeekTable_TocSampleRate) / SeekTable_TocSamplesPerFrame;
+    const uint32_t lastFrame = SeekTable_TocFrames[SeekTable_TocCount - 1];
+    if (frame < 0) {
+        frame = 0;
+    } else if (frame >= lastFrame) {
+        frame = lastFrame ? lastFrame - 1 : 0;
+    }
+
+    i = 0;
+    while (i + 2 < SeekTable_TocCount && SeekTable_TocFrames[i + 1] <= frame) {
+        i++;
+    }
+    uint32_t segmentFrames = SeekTable_TocFrames[i + 1] - SeekTable_TocFrames[i];
+    uint32_t pos = SeekTable_TocOffsets[i];
+    if (segmentFrames) {
+        pos += ((uint64_t) (frame - SeekTable_TocFrames[i]) * (SeekTable_TocOffsets[i + 1] - SeekTable_TocOffsets[i])) / segmentFrames;
+    }
+
+    File audioFile = gFSystem.open(SeekTable_CurrentTrack, FILE_READ);
+    if (!audioFile) {
+        return false;
+    }
+    mp3FrameInfo info;
+    bool found = SeekTable_FindFrame(audioFile, pos, &info, _newPos);
+    audioFile.close();
+    return found;
+}
+
+void SeekTable_RequestBuild(void) {
+    if (SeekTable_BuildRequested || SeekTable_CurrentTrack == NULL) {
+        return;
+    }
+
+    char *track = x_strdup(SeekTable_CurrentTrack);
+    if (track == NULL) {
+        return;
+    }
+    if (xQueueSend(SeekTable_BuildQueue, &track, 0) != pdPASS) {
+        free(track);
+        return;
+    }
+    SeekTable_BuildRequested = true;
+    snprintf(Log_Buffer, Log_BufferLength, "%s: %s", (char *) FPSTR(seekTableCreationQueued), track);
+    Log_Println(Log_Buffer, LOGLEVEL_INFO);
+}
+
+void SeekTable_GetIndexPath(const char *_track, char *_path, const size_t _size) {
+    snprintf(_path, _size, "%s%s", _track, (char *) FPSTR(seekTableFileSuffix));
+}
+
+// Returns sidecar-path of the current track (buffer is only valid until next call)
+const char *SeekTable_GetIndexPathStatic(void) {
+    static char indexPath[MAX_FILEPATH_LENTGH + 10];
+    SeekTable_GetIndexPath(SeekTable_CurrentTrack, indexPath, sizeof(indexPath));
+    return indexPath;
+}
+
+// Decodes a MPEG-audio layer III frame-header. Returns false if header is invalid.
+bool SeekTable_ParseFrameHeader(const uint8_t *_buf, mp3FrameInfo *_info) {
+    if (_buf[0] != 0xFF || (_buf[1] & 0xE0) != 0xE0) {
+        return false;
+    }
+
+    const uint8_t version = (_buf[1] >> 3) & 0x03;
+    const uint8_t layer = (_buf[1] >> 1) & 0x03;
+    const uint8_t bitrateIndex = _buf[2] >> 4;
+    const uint8_t sampleRateIndex = (_buf[2] >> 2) & 0x03;
+    const uint8_t padding = (_buf[2] >> 1) & 0x01;
+
+    if (version == 1 || layer != 1 || bitrateIndex == 0 || bitrateIndex == 15 || sampleRateIndex == 3) {
+        return false;
+    }
+
+    _info->version = version;
+    _info->sampleRate = SeekTable_SampleRates[sampleRateIndex] >> ((version == 3) ? 0 : ((version == 2) ? 1 : 2));
+    _info->samplesPerFrame = (version == 3) ? 1152 : 576;
+    const uint32_t bitrate = ((version == 3) ? SeekTable_BitratesV1[bitrateIndex] : SeekTable_BitratesV2[bitrateIndex]) * 1000u;
+    _info->frameLength = ((_info->samplesPerFrame / 8) * bitrate) / _info->sampleRate + padding;
+    _info->channelMode = _buf[3] >> 6;
+    return true;
+}
+
+bool SeekTable_ReadFrameHeader(File &_file, const uint32_t _pos, mp3FrameInfo *_info) {
+    uint8_t buf[4];
+    if (!_file.seek(_pos) || _file.read(buf, sizeof(buf)) != sizeof(buf)) {
+        return false;
+    }
+    return SeekTable_ParseFrameHeader(buf, _info);
+}
+
+// Searches for the next valid frame starting at _pos. A frame is only considered as valid if it's followed by
+// another valid frame (or end of file) in order to avoid false syncs within audio-data.
+bool SeekTable_FindFrame(File &_file, uint32_t _pos, mp3FrameInfo *_info, uint32_t *_framePos) {
+    const uint32_t fileSize = _file.size();
+    const uint32_t searchEnd = min(fileSize, _pos + seekTableMaxResyncLength);
+    uint8_t buf[256];
+
+    while (_pos + 4 <= searchEnd) {
+        if (!_file.seek(_pos)) {
+            return false;
+        }
+        const size_t len = _file.read(buf, sizeof(buf));
+        if (len < 4) {
+            return false;
+        }
+        for (size_t i = 0; i + 4 <= len; i++) {
+            if (buf[i] != 0xFF || !SeekTable_ParseFrameHeader(buf + i, _info)) {
+                continue;
+            }
+            const uint32_t candidate = _pos + i;
+            mp3FrameInfo next;
+            const uint32_t nextPos = candidate + _info->frameLength;
+            if (nextPos + 4 > fileSize || (SeekTable_ReadFrameHeader(_file, nextPos, &next) && next.sampleRate == _info->sampleRate)) {
+                *_framePos = candidate;
+                return true;
+            }
+        }
+        _pos += len - 3;
+    }
+    return false;
+}
+
+// Returns the position right after ID3v2-tag(s); 0 if there's no tag.
+uint32_t SeekTable_SkipId3(File &_file) {
+    uint32_t pos = 0;
+    uint8_t buf[10];
+
+    while (_file.seek(pos) && _file.read(buf, sizeof(buf)) == sizeof(buf) && !memcmp(buf, "ID3", 3)) {
+        const uint32_t tagSize = ((buf[6] & 0x7F) << 21) | ((buf[7] & 0x7F) << 14) | ((buf[8] & 0x7F) << 7) | (buf[9] & 0x7F);
+        pos += 10 + tagSize + ((buf[5] & 0x10) ? 10 : 0);
+    }
+    return pos;
+}
+
+uint32_t SeekTable_ReadEntry(File &_indexFile, const uint32_t _entry) {
+    uint32_t offset = 0;
+    _indexFile.seek(sizeof(seekTableHeader) + _entry * sizeof(uint32_t));
+    _indexFile.read((uint8_t *) &offset, sizeof(offset));
+    return offset;
+}
+
+// Binary search for the last table-entry <= _pos; the remaining distance is walked frame by frame.
+uint32_t SeekTable_FrameForPos(File &_indexFile, File &_audioFile, const uint32_t _pos) {
+    uint32_t low = 0;
+    uint32_t high = SeekTable_Header.entryCount - 1;
+
+    while (low < high) {
+        const uint32_t mid = (low + high + 1) / 2;
+        if (SeekTable_ReadEntry(_indexFile, mid) <= _pos) {
+            low = mid;
+        } else {
+            high = mid - 1;
+        }
+    }
+
+    uint32_t frame = low * SeekTable_Header.framesPerEntry;
+    uint32_t offset = SeekTable_ReadEntry(_indexFile, low);
+    mp3FrameInfo info;
+    for (uint32_t i = 1; i < SeekTable_Header.framesPerEntry && frame + 1 < SeekTable_Header.frameCount; i++) {
+        if (!SeekTable_ReadFrameHeader(_audioFile, offset, &info) || offset + info.frameLength > _pos) {
+            break;
+        }
+        offset += info.frameLength;
+        frame++;
+    }
+    return frame;
+}
+
+uint32_t SeekTable_PosForFrame(File &_indexFile, File &_audioFile, const uint32_t _frame) {
+    uint32_t entry = _frame / SeekTable_Header.framesPerEntry;
+    if (entry >= SeekTable_Header.entryCount) {
+        entry = SeekTable_Header.entryCount - 1;
+    }
+
+    uint32_t offset = SeekTable_ReadEntry(_indexFile, entry);
+    mp3FrameInfo info;
+    for (uint32_t frame = entry * SeekTable_Header.framesPerEntry; frame < _frame; frame++) {
+        if (!SeekTable_ReadFrameHeader(_audioFile, offset, &info)) {
+            break;
+        }
+        offset += info.frameLength;
+    }
+    return offset;
+}
+#endif
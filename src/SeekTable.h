@@ -0,0 +1,7 @@
+#pragma once
+
+void SeekTable_Init(void);
+void SeekTable_Prepare(const char *_track, const bool _buildIfMissing);
+void SeekTable_Release(void);
+bool SeekTable_GetSeekPosition(const uint32_t _currentPos, const int32_t _offsetSeconds, uint32_t *_newPos);
+uint32_t SeekTable_AlignToFrame(const uint32_t _pos);
@@ -0,0 +1,280 @@
+#include <Arduino.h>
+#include "settings.h"
+#include "Spectrum.h"
+#include "AudioStats.h"
+#include "Led.h"
+#include "Web.h"
+
+/* Octave-band analysis of playback for LED-animation and webgui. A mono-downmix runs through a bank of band-pass biquads
+   (fixed-point, coefficients Q4.28); energy per band is summed up over 1/spectrumUpdateRate s and converted to dB.
+   Analysis is done by the audio-task (audio_process_i2s() or PCM fast path) and is only active while LEDs or a
+   webgui-client show the result. Its CPU-time is measured per window; if it exceeds spectrumCpuBudget, input is decimated
+   (averaged) by 2, 4 or 8 and bands that don't fit below the reduced Nyquist-frequency are dropped.
+   Results are published via a sequence-lock: the audio-task never waits; readers retry if they raced with an update. */
+
+#ifdef SPECTRUM_ENABLE
+    #define SPECTRUM_COEF_SHIFT             28u
+    #define SPECTRUM_SAMPLE_SHIFT           8u      // 16 bit-samples are processed as 24 bit (less rounding-noise in low bands)
+    #define SPECTRUM_MAX_DECIMATION_SHIFT   3u
+    #define SPECTRUM_BAND_Q                 1.414f  // Bandwidth of one octave
+    #define SPECTRUM_STALE_TIME             200u    // Frames older than this are treated as silence (pause/stop) (in ms)
+    #define SPECTRUM_READ_RETRIES           4u
+
+    typedef struct {                        // Band-pass (constant 0 dB peak-gain): b1 = 0, b2 = -b0
+        int32_t b0;
+        int32_t a1;
+        int32_t a2;
+    } spectrumCoefficients;
+
+    typedef struct {
+        int32_t x1;
+        int32_t x2;
+        int32_t y1;
+        int32_t y2;
+        uint64_t energy;
+    } spectrumBandState;
+
+    static const float Spectrum_CenterFrequencies[SPECTRUM_BANDS] = {63.0f, 125.0f, 250.0f, 500.0f, 1000.0f, 2000.0f, 4000.0f, 8000.0f};
+
+    static volatile bool Spectrum_Enabled = false;          // Analysis only runs if somebody shows its result
+    static uint32_t Spectrum_SampleRate = 0;                // 0 => (re-)configuration needed
+    static uint8_t Spectrum_DecimationShift = 0;
+    static uint8_t Spectrum_ActiveBands = 0;
+    static spectrumCoefficients Spectrum_Coefficients[SPECTRUM_BANDS];
+    static spectrumBandState Spectrum_State[SPECTRUM_BANDS];
+    static int32_t Spectrum_DecimationSum = 0;
+    static uint8_t Spectrum_DecimationCount = 0;
+    static uint32_t Spectrum_WindowSamples = 0;             // Samples per window (after decimation)
+    static uint32_t Spectrum_WindowCount = 0;
+    static uint32_t Spectrum_WindowInputSamples = 0;
+    static uint32_t Spectrum_WindowCycles = 0;
+    static uint32_t Spectrum_CyclesPerInputSample = 0;      // CPU-cycles that pass per input-sample in realtime
+    static uint8_t Spectrum_LowLoadWindows = 0;
+    static uint8_t Spectrum_Level[SPECTRUM_BANDS];
+    static uint8_t Spectrum_ReleaseStep = 1;
+
+    static volatile uint32_t Spectrum_Sequence = 0;         // Odd while Spectrum_Frame is written
+    static spectrumFrame Spectrum_Frame;
+
+    static uint16_t Spectrum_StatsLoad = 0;                 // CPU-load of last window (in permille)
+    static uint16_t Spectrum_StatsMaxLoad = 0;
+    static uint32_t Spectrum_StatsWindows = 0;
+    static uint32_t Spectrum_StatsDecimationChanges = 0;
+    static volatile uint32_t Spectrum_StatsReadRetries = 0;
+    static volatile uint32_t Spectrum_StatsReadFailures = 0;
+
+    static void Spectrum_Configure(const uint32_t _sampleRate);
+    static void Spectrum_Publish(void);
+#endif
+
+// Enables analysis if LEDs or webgui need it and pushes levels to webgui
+void Spectrum_Cyclic(void) {
+    #ifdef SPECTRUM_ENABLE
+        static uint32_t lastWebTimestamp = 0;
+        static bool lastWebFrameValid = false;
+
+        const bool webClients = Web_HasWebsocketClients();
+        Spectrum_Enabled = Led_IsSpectrumActive() || webClients;
+
+        if (!webClients || AudioStats_IsLoadReductionActive() || millis() - lastWebTimestamp < spectrumWebInterval) {
+            return;
+        }
+        lastWebTimestamp = millis();
+
+        spectrumFrame frame;
+        const bool valid = Spectrum_Get(&frame);
+        if (valid || lastWebFrameValid) {       // After playback stopped, one frame with zeros is sent
+            Web_SendWebsocketData(0, 62);
+        }
+        lastWebFrameValid = valid;
+    #endif
+}
+
+// Called by audio-task for every frame (right << 16 | left) before it's processed
+void IRAM_ATTR Spectrum_Process(const uint32_t _sample, const uint32_t _sampleRate) {
+    #ifdef SPECTRUM_ENABLE
+        if (!Spectrum_Enabled) {
+            Spectrum_SampleRate = 0;
+            return;
+        }
+        const uint32_t start = ESP.getCycleCount();
+        if (_sampleRate != Spectrum_SampleRate) {
+            Spectrum_Configure(_sampleRate);
+        }
+        Spectrum_WindowInputSamples++;
+
+        Spectrum_DecimationSum += (int16_t) (_sample & 0xFFFF) + (int16_t) (_sample >> 16);
+        if (++Spectrum_DecimationCount < (1u << Spectrum_DecimationShift)) {
+            Spectrum_WindowCycles += ESP.getCycleCount() - start;
+            return;
+        }
+        const int32_t x = (Spectrum_DecimationSum << (SPECTRUM_SAMPLE_SHIFT - 1)) >> Spectrum_DecimationShift;
+        Spectrum_DecimationSum = 0;
+        Spectrum_DecimationCount = 0;
+
+        for (uint8_t i = 0; i < Spectrum_ActiveBands; i++) {
+            const spectrumCoefficients *c = &Spectrum_Coefficients[i];
+            spectrumBandState *s = &Spectrum_State[i];
+            const int64_t acc = (int64_t) c->b0 * (x - s->x2) - (int64_t) c->a1 * s->y1 - (int64_t) c->a2 * s->y2;
+            const int32_t y = (int32_t) ((acc + (1 << (SPECTRUM_COEF_SHIFT - 1))) >> SPECTRUM_COEF_SHIFT);
+            s->x2 = s->x1;
+            s->x1 = x;
+            s->y2 = s->y1;
+            s->y1 = y;
+            s->energy += (int64_t) y * y;
+        }
+
+        if (++Spectrum_WindowCount >= Spectrum_WindowSamples) {
+            Spectrum_Publish();
+        }
+        Spectrum_WindowCycles += ESP.getCycleCount() - start;
+    #endif
+}
+
+// Same for blocks that bypass per-frame processing (PCM fast path)
+void Spectrum_ProcessBlock(const uint32_t *_frames, const uint32_t _numberOfFrames, const uint32_t _sampleRate) {
+    #ifdef SPECTRUM_ENABLE
+        if (!Spectrum_Enabled) {
+            Spectrum_SampleRate = 0;
+            return;
+        }
+        for (uint32_t i = 0; i < _numberOfFrames; i++) {
+            Spectrum_Process(_frames[i], _sampleRate);
+        }
+    #endif
+}
+
+// Returns latest levels; false (and all levels 0) if nothing was analysed recently (pause, stop, analysis disabled)
+bool Spectrum_Get(spectrumFrame *_frame) {
+    #ifdef SPECTRUM_ENABLE
+        for (uint8_t retry = 0; retry < SPECTRUM_READ_RETRIES; retry++) {
+            const uint32_t sequence = Spectrum_Sequence;
+            if (!(sequence & 1u)) {
+                __sync_synchronize();
+                *_frame = Spectrum_Frame;
+                __sync_synchronize();
+                if (sequence == Spectrum_Sequence) {
+                    if (sequence && millis() - _frame->timestamp < SPECTRUM_STALE_TIME) {
+                        return true;
+                    }
+                    memset(_frame, 0, sizeof(spectrumFrame));
+                    return false;
+                }
+            }
+            Spectrum_StatsReadRetries++;
+        }
+        Spectrum_StatsReadFailures++;
+    #endif
+    memset(_frame, 0, sizeof(spectrumFrame));
+    return false;
+}
+
+#ifdef SPECTRUM_ENABLE
+    // Calculates band-pass-coefficients according to "Cookbook formulae for audio EQ biquad filter coefficients" (R. Bristow-Johnson)
+    void Spectrum_Configure(const uint32_t _sampleRate) {
+        const float rate = (float) _sampleRate / (1u << Spectrum_DecimationShift);
+        Spectrum_ActiveBands = 0;
+        for (uint8_t i = 0; i < SPECTRUM_BANDS; i++) {
+            if (Spectrum_CenterFrequencies[i] > 0.4f * rate) {
+                break;
+            }
+            const float w0 = 2.0f * (float) M_PI * Spectrum_CenterFrequencies[i] / rate;
+            const float alpha = sinf(w0) / (2.0f * SPECTRUM_BAND_Q);
+            const float a0 = 1.0f + alpha;
+            Spectrum_Coefficients[i].b0 = lroundf(alpha / a0 * (1 << SPECTRUM_COEF_SHIFT));
+            Spectrum_Coefficients[i].a1 = lroundf(-2.0f * cosf(w0) / a0 * (1 << SPECTRUM_COEF_SHIFT));
+            Spectrum_Coefficients[i].a2 = lroundf((1.0f - alpha) / a0 * (1 << SPECTRUM_COEF_SHIFT));
+            Spectrum_ActiveBands++;
+        }
+        memset(Spectrum_State, 0, sizeof(Spectrum_State));
+        memset(Spectrum_Level, 0, sizeof(Spectrum_Level));
+
+        Spectrum_SampleRate = _sampleRate;
+        Spectrum_DecimationSum = 0;
+        Spectrum_DecimationCount = 0;
+        Spectrum_WindowSamples = rate / spectrumUpdateRate;
+        Spectrum_WindowCount = 0;
+        Spectrum_WindowInputSamples = 0;
+        Spectrum_WindowCycles = 0;
+        Spectrum_LowLoadWindows = 0;
+        Spectrum_CyclesPerInputSample = ESP.getCpuFreqMHz() * 1000000u / _sampleRate;
+        Spectrum_ReleaseStep = 255u * spectrumReleaseRate / (spectrumDynamicRange * spectrumUpdateRate);
+        if (!Spectrum_ReleaseStep) {
+            Spectrum_ReleaseStep = 1;
+        }
+    }
+
+    // Converts energy of finished window to levels, publishes them and adjusts decimation to CPU-budget
+    void Spectrum_Publish(void) {
+        uint8_t peak = 0;
+        for (uint8_t i = 0; i < SPECTRUM_BANDS; i++) {
+            uint8_t level = 0;
+            if (i < Spectrum_ActiveBands) {
+                const float mean = (float) Spectrum_State[i].energy / Spectrum_WindowSamples;
+                const float db = 10.0f * log10f(mean / (float) (1u << 23) / (float) (1u << 23) + 1e-12f);
+                level = constrain((db + spectrumDynamicRange) * 255.0f / spectrumDynamicRange, 0.0f, 255.0f);
+                Spectrum_State[i].energy = 0;
+            }
+            if (level >= Spectrum_Level[i]) {       // Rises immediately, falls slowly
+                Spectrum_Level[i] = level;
+            } else {
+                Spectrum_Level[i] = (Spectrum_Level[i] - level > Spectrum_ReleaseStep) ? Spectrum_Level[i] - Spectrum_ReleaseStep : level;
+            }
+            if (Spectrum_Level[i] > peak) {
+                peak = Spectrum_Level[i];
+            }
+        }
+
+        Spectrum_Sequence++;
+        __sync_synchronize();
+        memcpy(Spectrum_Frame.level, Spectrum_Level, sizeof(Spectrum_Frame.level));
+        Spectrum_Frame.peak = peak;
+        Spectrum_Frame.timestamp = millis();
+        __sync_synchronize();
+        Spectrum_Sequence++;
+
+        // CPU-budget: decimate if exceeded; go back once load stayed low for a second
+        const uint16_t load = (uint64_t) Spectrum_WindowCycles * 1000u / ((uint64_t) Spectrum_WindowInputSamples * Spectrum_CyclesPerInputSample);
+        Spectrum_StatsLoad = load;
+        if (load > Spectrum_StatsMaxLoad) {
+            Spectrum_StatsMaxLoad = load;
+        }
+        Spectrum_StatsWindows++;
+        Spectrum_WindowCount = 0;
+        Spectrum_WindowInputSamples = 0;
+        Spectrum_WindowCycles = 0;
+
+        if (load > spectrumCpuBudget * 10u && Spectrum_DecimationShift < SPECTRUM_MAX_DECIMATION_SHIFT) {
+            Spectrum_DecimationShift++;
+            Spectrum_SampleRate = 0;
+            Spectrum_StatsDecimationChanges++;
+        } else if (load < spectrumCpuBudget * 10u / 3u && Spectrum_DecimationShift > 0) {
+            if (++Spectrum_LowLoadWindows >= spectrumUpdateRate) {
+                Spectrum_DecimationShift--;
+                Spectrum_SampleRate = 0;
+                Spectrum_StatsDecimationChanges++;
+            }
+        } else {
+            Spectrum_LowLoadWindows = 0;
+        }
+    }
+#endif
+
+#ifdef ENABLE_ESPUINO_DEBUG
+    void Spectrum_PrintStats(void) {
+        #ifdef SPECTRUM_ENABLE
+            spectrumFrame frame;
+            const bool valid = Spectrum_Get(&frame);
+            Serial.printf("=====\nSpectrum: %s, %u Hz, decimation %u, %u of %u bands\n", Spectrum_Enabled ? "on" : "off", Spectrum_SampleRate, 1u << Spectrum_DecimationShift, Spectrum_ActiveBands, SPECTRUM_BANDS);
+            Serial.printf("Load: %u.%u %% (max. %u.%u %%, budget %u %%), %u decimation-change(s)\n", Spectrum_StatsLoad / 10, Spectrum_StatsLoad % 10, Spectrum_StatsMaxLoad / 10, Spectrum_StatsMaxLoad % 10, spectrumCpuBudget, Spectrum_StatsDecimationChanges);
+            Serial.printf("Windows: %u, read-retries: %u, failed reads: %u\n", Spectrum_StatsWindows, Spectrum_StatsReadRetries, Spectrum_StatsReadFailures);
+            Serial.print(F("Levels:"));
+            for (uint8_t i = 0; i < SPECTRUM_BANDS; i++) {
+                Serial.printf(" %u", frame.level[i]);
+            }
+            Serial.println(valid ? F("\n=====") : F(" (stale)\n====="));
+        #else
+            Serial.println(F("Spectrum is disabled"));
+        #endif
+    }
+#endif
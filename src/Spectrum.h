@@ -0,0 +1,18 @@
+#pragma once
+
+#define SPECTRUM_BANDS                  8u      // Octave-bands 63 Hz..8 kHz
+
+typedef struct {
+    uint8_t level[SPECTRUM_BANDS];              // Level per band (0..255 => -spectrumDynamicRange..0 dBFS)
+    uint8_t peak;                               // Max. of all bands (VU)
+    uint32_t timestamp;                         // millis() of analysis
+} spectrumFrame;
+
+void Spectrum_Cyclic(void);
+void Spectrum_Process(const uint32_t _sample, const uint32_t _sampleRate);
+void Spectrum_ProcessBlock(const uint32_t *_frames, const uint32_t _numberOfFrames, const uint32_t _sampleRate);
+bool Spectrum_Get(spectrumFrame *_frame);
+
+#ifdef ENABLE_ESPUINO_DEBUG
+    void Spectrum_PrintStats(void);
+#endif
@@ -1,6 +1,8 @@
 #include <Arduino.h>
 #include "settings.h"
 #include "System.h"
+#include "Announce.h"
+#include "AudioDsp.h"
 #include "AudioPlayer.h"
 #include "Rfid.h"
 #include "Led.h"
@@ -8,14 +10,12 @@
 #include "Mqtt.h"
 #include "SdCard.h"
 #include "Port.h"
+#include "UiSound.h"
 #include "freertos/FreeRTOS.h"
 #include "freertos/task.h"
 #include "esp_system.h"
 #include "Audio.h"
 
-constexpr const char prefsRfidNamespace[] PROGMEM = "rfidTags";     // Namespace used to save IDs of rfid-tags
-constexpr const char prefsSettingsNamespace[] PROGMEM = "settings"; // Namespace used for generic settings
-
 Preferences gPrefsRfid;
 Preferences gPrefsSettings;
 
@@ -23,6 +23,7 @@ unsigned long System_LastTimeActiveTimestamp = 0u;  // Timestamp of last user-in
 unsigned long System_SleepTimerStartTimestamp = 0u; // Flag if sleep-timer is active
 bool System_GoToSleep = false;                      // Flag for turning uC immediately into deepsleep
 bool System_Sleeping = false;                       // Flag for turning into deepsleep is in progress
+bool System_SleepFadeActive = false;                // Flag if audio is faded out due to sleep-timer
 bool System_LockControls = false;                   // Flag if buttons and rotary encoder is locked
 uint8_t System_MaxInactivityTime = 10u;             // Time in minutes, after uC is put to deep sleep because of inactivity (and modified later via GUI)
 uint8_t System_SleepTimer = 30u;                    // Sleep timer in minutes that can be optionally used (and modified later via MQTT or RFID)
@@ -32,6 +33,7 @@ volatile uint8_t System_OperationMode;
 
 void System_SleepHandler(void);
 void System_DeepSleepManager(void);
+static void System_CancelSleepFade(void);
 
 void System_Init(void) {
     srand(esp_random());
@@ -74,11 +76,13 @@ bool System_IsSleepRequested(void) {
 
 bool System_SetSleepTimer(uint8_t minutes) {
     bool sleepTimerEnabled = false;
+    System_CancelSleepFade();
 
     if (System_SleepTimerStartTimestamp && (System_SleepTimer == minutes)) {
         System_SleepTimerStartTimestamp = 0u;
         Led_ResetToInitialBrightness();
         Log_Println((char *) FPSTR(modificatorSleepd), LOGLEVEL_NOTICE);
+        Announce_SleepTimer(0);
         #ifdef MQTT_ENABLE
             publishMqtt((char *) FPSTR(topicLedBrightnessState), Led_GetBrightness(), false);
         #endif
@@ -88,6 +92,7 @@ bool System_SetSleepTimer(uint8_t minutes) {
         sleepTimerEnabled = true;
 
         Led_ResetToNightBrightness();
+        Announce_SleepTimer(minutes);
         if (minutes == 15) {
             Log_Println((char *)FPSTR(modificatorSleepTimer15), LOGLEVEL_NOTICE);
         } else if (minutes == 30) {
@@ -109,9 +114,18 @@ bool System_SetSleepTimer(uint8_t minutes) {
 
 void System_DisableSleepTimer(void) {
     System_SleepTimerStartTimestamp = 0u;
+    System_CancelSleepFade();
     Led_ResetToInitialBrightness();
 }
 
+// Brings volume back if sleep-timer is changed/disabled while fading out
+void System_CancelSleepFade(void) {
+    if (System_SleepFadeActive) {
+        System_SleepFadeActive = false;
+        AudioDsp_SleepFadeTo(true, fadeTimePause);
+    }
+}
+
 bool System_IsSleepTimerEnabled(void) {
     return (System_SleepTimerStartTimestamp > 0u || gPlayProperties.sleepAfterCurrentTrack || gPlayProperties.sleepAfterPlaylist || gPlayProperties.playUntilTrackNumber);
 }
@@ -155,10 +169,12 @@ bool System_AreControlsLocked(void) {
 
 void System_IndicateError(void) {
     Led_Indicate(LedIndicatorType::Error);
+    UiSound_Play(UISOUND_ERROR);
 }
 
 void System_IndicateOk(void) {
     Led_Indicate(LedIndicatorType::Ok);
+    UiSound_Play(UISOUND_OK);
 }
 
 // Writes to NVS, if bluetooth or "normal" mode is desired
@@ -190,6 +206,11 @@ void System_SleepHandler(void) {
         if (m - System_SleepTimerStartTimestamp >= (System_SleepTimer * 1000u * 60u)) {
             Log_Println((char *) FPSTR(goToSleepDueToTimer), LOGLEVEL_INFO);
             System_RequestSleep();
+        } else if (!System_SleepFadeActive && (m - System_SleepTimerStartTimestamp + sleepTimerFadeTime * 1000u * 60u >= System_SleepTimer * 1000u * 60u)) {
+            // Fade out slowly during the last minutes instead of cutting off audio
+            System_SleepFadeActive = true;
+            AudioDsp_SleepFadeTo(false, System_SleepTimer * 1000u * 60u - (m - System_SleepTimerStartTimestamp));
+            Log_Println((char *) FPSTR(sleepTimerFadeOut), LOGLEVEL_INFO);
         }
     }
 }
@@ -1,6 +1,9 @@
 #pragma once
 #include <Preferences.h>
 
+constexpr const char prefsRfidNamespace[] PROGMEM = "rfidTags";     // Namespace used to save IDs of rfid-tags
+constexpr const char prefsSettingsNamespace[] PROGMEM = "settings"; // Namespace used for generic settings
+
 extern Preferences gPrefsRfid;
 extern Preferences gPrefsSettings;
 
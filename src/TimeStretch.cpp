@@ -0,0 +1,165 @@
+#include <Arduino.h>
+#include "settings.h"
+#include "TimeStretch.h"
+#include "Log.h"
+#include "MemX.h"
+#include "Mqtt.h"
+#include "Resampler.h"
+#include "Web.h"
+
+// Time-stretching (WSOLA; refer Wsola.cpp). At 100 % frames are passed through without any latency or load.
+#ifdef TIMESTRETCH_ENABLE
+    #include <driver/i2s.h>
+    #include "Wsola.h"
+
+    #define TIMESTRETCH_OUTPUT_FRAMES       64u
+
+    static_assert(TIMESTRETCH_SPEED_NORMAL == WSOLA_SPEED_NORMAL, "Speed of WSOLA has to be in percent");
+
+    static wsolaState TimeStretch_State;
+    static uint32_t TimeStretch_BufferSize = 0;                                 // Capacity of TimeStretch_State.input (in frames)
+    static uint32_t TimeStretch_SampleRate = 0;
+    static uint32_t TimeStretch_OutputBuffer[TIMESTRETCH_OUTPUT_FRAMES];
+    static uint8_t TimeStretch_OutputBufferFrames = 0;
+    static volatile uint8_t TimeStretch_Speed = TIMESTRETCH_SPEED_NORMAL;     // Requested speed
+
+    static bool TimeStretch_Configure(const uint32_t _sampleRate);
+    static void TimeStretch_Free(void);
+    static void TimeStretch_Output(const uint32_t _frame);
+    static void TimeStretch_Flush(void);
+#endif
+
+// Speed in percent (TIMESTRETCH_SPEED_MIN..TIMESTRETCH_SPEED_MAX); 100 => normal speed
+void TimeStretch_SetSpeed(const int16_t _speed) {
+    #ifdef TIMESTRETCH_ENABLE
+        const uint8_t speed = constrain(_speed, (int16_t) TIMESTRETCH_SPEED_MIN, (int16_t) TIMESTRETCH_SPEED_MAX);
+        if (speed == TimeStretch_Speed) {
+            return;
+        }
+        TimeStretch_Speed = speed;
+        snprintf(Log_Buffer, Log_BufferLength, "%s: %u %%", (char *) FPSTR(playbackSpeedChanged), speed);
+        Log_Println(Log_Buffer, LOGLEVEL_INFO);
+        Web_SendWebsocketData(0, 51);
+        #ifdef MQTT_ENABLE
+            publishMqtt((char *) FPSTR(topicPlaybackSpeedState), speed, false);
+        #endif
+    #endif
+}
+
+uint8_t TimeStretch_GetSpeed(void) {
+    #ifdef TIMESTRETCH_ENABLE
+        return TimeStretch_Speed;
+    #else
+        return TIMESTRETCH_SPEED_NORMAL;
+    #endif
+}
+
+// Returns true if frames are (or will be) stretched; false if they're passed through
+bool TimeStretch_IsActive(void) {
+    #ifdef TIMESTRETCH_ENABLE
+        return TimeStretch_State.active || TimeStretch_Speed != TIMESTRETCH_SPEED_NORMAL;
+    #else
+        return false;
+    #endif
+}
+
+// Frames of the previous track are dropped; new track starts with pass-through until its first frame arrives
+void TimeStretch_TrackStarted(void) {
+    #ifdef TIMESTRETCH_ENABLE
+        TimeStretch_State.active = false;
+        TimeStretch_State.inputFrames = 0;
+        TimeStretch_OutputBufferFrames = 0;
+    #endif
+}
+
+// Called by audio-lib (via audio_process_i2s()) for every frame after DSP-processing. Output is passed to the resampler.
+// While stretching, frames are written to I2S here (=> *_continueI2S = false).
+void TimeStretch_Process(uint32_t *_sample, bool *_continueI2S, const uint32_t _sampleRate) {
+    #ifdef TIMESTRETCH_ENABLE
+        const uint8_t speed = TimeStretch_Speed;
+
+        if (TimeStretch_State.active && _sampleRate != TimeStretch_SampleRate) {
+            TimeStretch_State.active = false;
+        }
+        if (!TimeStretch_State.active) {
+            if (speed == TIMESTRETCH_SPEED_NORMAL || !TimeStretch_Configure(_sampleRate)) {
+                Resampler_Process(_sample, _continueI2S, _sampleRate);
+                return;
+            }
+        }
+
+        *_continueI2S = false;
+        Wsola_Push(&TimeStretch_State, *_sample, speed);
+        if (!TimeStretch_State.active) {     // Back to normal speed; following frames are passed through
+            TimeStretch_Flush();
+        }
+    #else
+        Resampler_Process(_sample, _continueI2S, _sampleRate);
+    #endif
+}
+
+#ifdef TIMESTRETCH_ENABLE
+// Calculates lengths for the sample rate and (re-)allocates buffers if needed. Returns false if stretching isn't possible.
+bool TimeStretch_Configure(const uint32_t _sampleRate) {
+    if (!_sampleRate) {
+        return false;
+    }
+    const uint16_t sequenceFrames = _sampleRate * timeStretchSequenceTime / 1000u;
+    const uint16_t seekFrames = _sampleRate * timeStretchSeekTime / 1000u;
+    const uint16_t overlapFrames = _sampleRate * timeStretchOverlapTime / 1000u;
+    const uint32_t bufferSize = WSOLA_INPUT_FRAMES(sequenceFrames, seekFrames);
+
+    if (bufferSize > TimeStretch_BufferSize) {
+        TimeStretch_Free();
+        TimeStretch_State.input = (uint32_t *) x_malloc(bufferSize * sizeof(uint32_t));
+        TimeStretch_State.overlap = (uint32_t *) x_malloc(overlapFrames * sizeof(uint32_t));
+        TimeStretch_State.overlapMono = (int16_t *) x_malloc(overlapFrames * sizeof(int16_t));
+        TimeStretch_State.seekMono = (int16_t *) x_malloc((seekFrames + overlapFrames) * sizeof(int16_t));
+        if (!TimeStretch_State.input || !TimeStretch_State.overlap || !TimeStretch_State.overlapMono || !TimeStretch_State.seekMono) {
+            TimeStretch_Free();
+            return false;
+        }
+        TimeStretch_BufferSize = bufferSize;
+    }
+
+    TimeStretch_SampleRate = _sampleRate;
+    TimeStretch_State.output = TimeStretch_Output;
+    Wsola_Start(&TimeStretch_State, sequenceFrames, seekFrames, overlapFrames);
+    return true;
+}
+
+void TimeStretch_Free(void) {
+    free(TimeStretch_State.input);
+    free(TimeStretch_State.overlap);
+    free(TimeStretch_State.overlapMono);
+    free(TimeStretch_State.seekMono);
+    TimeStretch_State.input = NULL;
+    TimeStretch_State.overlap = NULL;
+    TimeStretch_State.overlapMono = NULL;
+    TimeStretch_State.seekMono = NULL;
+    TimeStretch_BufferSize = 0;
+}
+
+// Passes frame to resampler and collects it for I2S (unless resampler wrote it already)
+void TimeStretch_Output(const uint32_t _frame) {
+    uint32_t frame = _frame;
+    bool continueI2S;
+    Resampler_Process(&frame, &continueI2S, TimeStretch_SampleRate);
+    if (!continueI2S) {
+        return;
+    }
+    TimeStretch_OutputBuffer[TimeStretch_OutputBufferFrames++] = frame;
+    if (TimeStretch_OutputBufferFrames == TIMESTRETCH_OUTPUT_FRAMES) {
+        TimeStretch_Flush();
+    }
+}
+
+void TimeStretch_Flush(void) {
+    if (!TimeStretch_OutputBufferFrames) {
+        return;
+    }
+    size_t bytesWritten;
+    i2s_write(I2S_NUM_0, TimeStretch_OutputBuffer, TimeStretch_OutputBufferFrames * sizeof(uint32_t), &bytesWritten, portMAX_DELAY);
+    TimeStretch_OutputBufferFrames = 0;
+}
+#endif
@@ -0,0 +1,11 @@
+#pragma once
+
+#define TIMESTRETCH_SPEED_NORMAL        100u    // Playback-speed in percent
+#define TIMESTRETCH_SPEED_MIN           50u
+#define TIMESTRETCH_SPEED_MAX           200u
+
+void TimeStretch_SetSpeed(const int16_t _speed);
+uint8_t TimeStretch_GetSpeed(void);
+bool TimeStretch_IsActive(void);
+void TimeStretch_TrackStarted(void);
+void TimeStretch_Process(uint32_t *_sample, bool *_continueI2S, const uint32_t _sampleRate);
@@ -0,0 +1,203 @@
+#include <Arduino.h>
+#include <driver/i2s.h>
+#include "settings.h"
+#include "UiSound.h"
+#include "AudioDsp.h"
+#include "AudioStats.h"
+#include "ChannelRouter.h"
+#include "Log.h"
+#include "Resampler.h"
+#include "WavFile.h"
+
+/* Short feedback-sounds (clicks, chimes) are loaded from SD into RAM at startup. While a track is playing,
+   they're mixed into its frames (before volume is applied); so there's no need to interrupt playback.
+   Without playback, they're rendered by AudioPlayer_Task directly to I2S.
+   As mixing is done before the I2S-DMA-queue, the queue can be shortened for low latency (uiSoundLowLatency).
+   Only one sound per user-action: a click is dropped if another sound is requested along with it. */
+
+#ifdef UISOUND_ENABLE
+    #define UISOUND_RENDER_FRAMES       64u
+
+    typedef struct {
+        int16_t *data;                          // Mono; NULL if sound isn't available
+        uint32_t frames;
+        uint32_t sampleRate;
+    } uiSoundClip;
+
+    static const char *UiSound_FileNames[UISOUND_COUNT] = {"click", "ok", "error", "cardok", "cardunknown", "volumelimit"};
+    static uiSoundClip UiSound_Clips[UISOUND_COUNT];
+    static volatile uint32_t UiSound_Requests = 0;          // Bitmask; set by any task and taken over by audio-task
+    static volatile uint32_t UiSound_RequestCount = 0;      // Number of requests since boot (refer Cmd_Action())
+    static bool UiSound_Available = false;                  // At least one sound was loaded
+    static portMUX_TYPE UiSound_RequestMux = portMUX_INITIALIZER_UNLOCKED;
+    static uint32_t UiSound_Active = 0;                     // Bitmask of sounds that are currently mixed
+    static uint32_t UiSound_Position[UISOUND_COUNT];        // Q16.16 (frames of clip)
+    static uint32_t UiSound_Increment[UISOUND_COUNT];       // Q16.16; converts clip's sample rate to the one of playback
+    static int32_t UiSound_Gain = 0;                        // Q1.15
+
+    static void UiSound_Start(uint32_t _sounds, const uint32_t _sampleRate);
+    static int16_t UiSound_Saturate(const int32_t _value);
+#endif
+
+void UiSound_Init(void) {
+    #ifdef UISOUND_ENABLE
+        static_assert(uiSoundMaxClipFrames < 65536u, "uiSoundMaxClipFrames is too large for Q16.16-position");
+        UiSound_Gain = (int32_t) roundf(powf(10.0f, std::min(uiSoundLevel, 0.0f) / 20.0f) * 32768.0f);
+
+        uint8_t numberOfSounds = 0;
+        for (uint8_t i = 0; i < UISOUND_COUNT; i++) {
+            char path[48];
+            snprintf(path, sizeof(path) / sizeof(path[0]), "%s/%s.wav", (char *) FPSTR(uiSoundDirectory), UiSound_FileNames[i]);
+            UiSound_Clips[i].data = WavFile_LoadMono(path, uiSoundMaxClipFrames, &UiSound_Clips[i].frames, &UiSound_Clips[i].sampleRate);
+            if (UiSound_Clips[i].data != NULL) {
+                numberOfSounds++;
+            }
+        }
+        UiSound_Available = (numberOfSounds > 0);
+        if (numberOfSounds) {
+            snprintf(Log_Buffer, Log_BufferLength, "%s: %u", (char *) FPSTR(uiSoundsLoaded), numberOfSounds);
+            Log_Println(Log_Buffer, LOGLEVEL_INFO);
+        }
+    #endif
+}
+
+// Can be called from any task. Restarts the sound if it's already playing.
+void UiSound_Play(const uint8_t _sound) {
+    #ifdef UISOUND_ENABLE
+        if (_sound >= UISOUND_COUNT || UiSound_Clips[_sound].data == NULL) {
+            return;
+        }
+        portENTER_CRITICAL(&UiSound_RequestMux);
+        UiSound_Requests |= (1u << _sound);
+        UiSound_RequestCount++;
+        portEXIT_CRITICAL(&UiSound_RequestMux);
+    #endif
+}
+
+// Used to find out if an action gave feedback (ok, error, ...) itself
+uint32_t UiSound_GetRequestCount(void) {
+    #ifdef UISOUND_ENABLE
+        return UiSound_RequestCount;
+    #else
+        return 0;
+    #endif
+}
+
+// Called before I2S-driver is installed: shortens DMA-queue (if enabled and sounds are available) as it determines latency of sounds during playback
+void UiSound_AdjustDmaBuffers(int *_count, int *_length) {
+    #ifdef UISOUND_ENABLE
+        if (uiSoundLowLatency && UiSound_Available) {
+            *_count = uiSoundDmaBufferCount;
+            *_length = uiSoundDmaBufferLength;
+        }
+    #endif
+}
+
+bool UiSound_IsActive(void) {
+    #ifdef UISOUND_ENABLE
+        return UiSound_Requests || UiSound_Active;
+    #else
+        return false;
+    #endif
+}
+
+// Called by audio-lib (via audio_process_i2s()) for every frame before DSP-processing
+void IRAM_ATTR UiSound_Process(uint32_t *_sample, const uint32_t _sampleRate) {
+    #ifdef UISOUND_ENABLE
+        if (UiSound_Requests) {
+            portENTER_CRITICAL(&UiSound_RequestMux);
+            const uint32_t requests = UiSound_Requests;
+            UiSound_Requests = 0;
+            portEXIT_CRITICAL(&UiSound_RequestMux);
+            UiSound_Start(requests, _sampleRate);
+        }
+        if (!UiSound_Active) {
+            return;
+        }
+
+        int32_t mix = 0;
+        for (uint8_t i = 0; i < UISOUND_COUNT; i++) {
+            if (!(UiSound_Active & (1u << i))) {
+                continue;
+            }
+            const uiSoundClip *clip = &UiSound_Clips[i];
+            const uint32_t index = UiSound_Position[i] >> 16;
+            const int32_t current = clip->data[index];
+            const int32_t next = (index + 1 < clip->frames) ? clip->data[index + 1] : 0;
+            mix += current + (((next - current) * (int32_t) ((UiSound_Position[i] & 0xFFFF) >> 1)) >> 15);    // Linear interpolation
+
+            UiSound_Position[i] += UiSound_Increment[i];
+            if ((UiSound_Position[i] >> 16) >= clip->frames) {
+                UiSound_Active &= ~(1u << i);
+            }
+        }
+        mix = ((int64_t) mix * UiSound_Gain) >> 15;
+
+        const int32_t left = (int16_t) (*_sample & 0xFFFF) + mix;
+        const int32_t right = (int16_t) (*_sample >> 16) + mix;
+        *_sample = ((uint32_t) (uint16_t) UiSound_Saturate(right) << 16) | (uint16_t) UiSound_Saturate(left);
+    #endif
+}
+
+// Called by AudioPlayer_Task if audio-lib is idle or paused. Blocks until all sounds are played.
+void UiSound_Render(const uint32_t _sampleRate) {
+    #ifdef UISOUND_ENABLE
+        uint32_t sampleRate = _sampleRate;
+        if (!sampleRate) {  // Nothing was played since boot => I2S isn't configured yet
+            sampleRate = uiSoundIdleSampleRate;
+            i2s_set_sample_rates(I2S_NUM_0, Resampler_GetOutputRate(sampleRate));
+        }
+        AudioDsp_Update(sampleRate);
+        AudioDsp_FadeTo(true, 0);
+
+        uint32_t output[UISOUND_RENDER_FRAMES];
+        uint32_t silenceFrames = 0;
+        while (silenceFrames < AudioStats_GetDmaBufferFrames()) {     // Finally fill DMA-buffer with silence; otherwise I2S would repeat it
+            uint8_t numberOfFrames = 0;
+            for (uint8_t i = 0; i < UISOUND_RENDER_FRAMES; i++) {
+                uint32_t sample = 0;
+                bool continueI2S;
+                if (UiSound_IsActive()) {
+                    if (silenceFrames) {    // Sound was requested meanwhile
+                        AudioDsp_FadeTo(true, 0);
+                        silenceFrames = 0;
+                    }
+                    UiSound_Process(&sample, sampleRate);
+                } else if (!silenceFrames++) {
+                    AudioDsp_FadeTo(false, 0);      // Restore state of paused/stopped playback
+                }
+                ChannelRouter_Process(&sample, sampleRate);
+                AudioDsp_Process(&sample);
+                Resampler_Process(&sample, &continueI2S, sampleRate);
+                if (continueI2S) {
+                    output[numberOfFrames++] = sample;
+                }
+            }
+            if (numberOfFrames) {
+                size_t bytesWritten;
+                i2s_write(I2S_NUM_0, output, numberOfFrames * sizeof(output[0]), &bytesWritten, portMAX_DELAY);
+            }
+        }
+    #endif
+}
+
+#ifdef UISOUND_ENABLE
+void UiSound_Start(uint32_t _sounds, const uint32_t _sampleRate) {
+    if (_sounds & ~(1u << UISOUND_CLICK)) {     // Any other sound replaces the click
+        _sounds &= ~(1u << UISOUND_CLICK);
+        UiSound_Active &= ~(1u << UISOUND_CLICK);
+    }
+    for (uint8_t i = 0; i < UISOUND_COUNT; i++) {
+        if (!(_sounds & (1u << i))) {
+            continue;
+        }
+        UiSound_Position[i] = 0;
+        UiSound_Increment[i] = _sampleRate ? ((uint64_t) UiSound_Clips[i].sampleRate << 16) / _sampleRate : (1u << 16);
+        UiSound_Active |= (1u << i);
+    }
+}
+
+int16_t UiSound_Saturate(const int32_t _value) {
+    return (_value > INT16_MAX) ? INT16_MAX : ((_value < INT16_MIN) ? INT16_MIN : _value);
+}
+#endif
@@ -0,0 +1,17 @@
+#pragma once
+
+#define UISOUND_CLICK                   0u
+#define UISOUND_OK                      1u
+#define UISOUND_ERROR                   2u
+#define UISOUND_CARD_ACCEPTED           3u
+#define UISOUND_CARD_UNKNOWN            4u
+#define UISOUND_VOLUME_LIMIT            5u
+#define UISOUND_COUNT                   6u
+
+void UiSound_Init(void);
+void UiSound_Play(const uint8_t _sound);
+uint32_t UiSound_GetRequestCount(void);
+void UiSound_AdjustDmaBuffers(int *_count, int *_length);
+bool UiSound_IsActive(void);
+void UiSound_Process(uint32_t *_sample, const uint32_t _sampleRate);
+void UiSound_Render(const uint32_t _sampleRate);
@@ -0,0 +1,85 @@
+#include <Arduino.h>
+#include "settings.h"
+#include "WavFile.h"
+#include "MemX.h"
+#include "SdCard.h"
+
+#define WAVFILE_FORMAT_PCM          1u
+#define WAVFILE_FORMAT_EXTENSIBLE   0xFFFEu
+
+// Reads RIFF/WAVE-header of an uncompressed PCM-file. On success, file is positioned at the first sample.
+bool WavFile_ParseHeader(File &_file, wavFormat *_format) {
+    uint8_t header[16];
+    if (_file.read(header, 12) != 12 || memcmp(header, "RIFF", 4) || memcmp(header + 8, "WAVE", 4)) {
+        return false;
+    }
+
+    bool pcm = false;
+    while (_file.read(header, 8) == 8) {
+        uint32_t chunkSize;
+        memcpy(&chunkSize, header + 4, sizeof(chunkSize));
+        const uint32_t nextChunk = _file.position() + chunkSize + (chunkSize & 1u);     // Chunks are word-aligned
+
+        if (!memcmp(header, "fmt ", 4) && chunkSize >= 16) {
+            uint16_t format;
+            if (_file.read(header, 16) != 16) {
+                return false;
+            }
+            memcpy(&format, header, sizeof(format));
+            memcpy(&_format->channels, header + 2, sizeof(_format->channels));
+            memcpy(&_format->sampleRate, header + 4, sizeof(_format->sampleRate));
+            memcpy(&_format->bitsPerSample, header + 14, sizeof(_format->bitsPerSample));
+            pcm = (format == WAVFILE_FORMAT_PCM || format == WAVFILE_FORMAT_EXTENSIBLE);
+        } else if (!memcmp(header, "data", 4)) {
+            if (!pcm || !_format->channels || !_format->sampleRate) {
+                return false;
+            }
+            _format->dataOffset = _file.position();
+            _format->dataSize = std::min(chunkSize, (uint32_t) (_file.size() - _format->dataOffset));  // Size is sometimes invalid if file was streamed
+            return true;
+        }
+        _file.seek(nextChunk);
+    }
+    return false;
+}
+
+// Loads 16 bit-file (mono or stereo) into RAM (PSRAM if available) and returns it as mono. Returns NULL on error.
+int16_t *WavFile_LoadMono(const char *_path, const uint32_t _maxFrames, uint32_t *_frames, uint32_t *_sampleRate) {
+    if (!gFSystem.exists(_path)) {
+        return NULL;
+    }
+    File file = gFSystem.open(_path, FILE_READ);
+    wavFormat format;
+    if (!WavFile_ParseHeader(file, &format) || format.bitsPerSample != 16 || format.channels > 2 || format.sampleRate < 8000 || format.sampleRate > 48000) {
+        file.close();
+        return NULL;
+    }
+
+    const uint32_t frames = std::min((uint32_t) (format.dataSize / (sizeof(int16_t) * format.channels)), _maxFrames);
+    int16_t *data = (int16_t *) x_malloc(frames * sizeof(int16_t));
+    if (data == NULL) {
+        file.close();
+        return NULL;
+    }
+
+    int16_t buffer[256];
+    uint32_t frame = 0;
+    while (frame < frames) {
+        const uint32_t framesToRead = std::min(frames - frame, (uint32_t) (sizeof(buffer) / sizeof(buffer[0]) / format.channels));
+        if (file.read((uint8_t *) buffer, framesToRead * format.channels * sizeof(int16_t)) != framesToRead * format.channels * sizeof(int16_t)) {
+            break;
+        }
+        for (uint32_t i = 0; i < framesToRead; i++) {
+            data[frame++] = (format.channels == 2) ? (buffer[2 * i] + buffer[2 * i + 1]) / 2 : buffer[i];
+        }
+    }
+    file.close();
+    if (frame < frames) {
+        free(data);
+        return NULL;
+    }
+
+    *_frames = frames;
+    *_sampleRate = format.sampleRate;
+    return data;
+}
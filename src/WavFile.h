@@ -0,0 +1,13 @@
+#pragma once
+#include <FS.h>
+
+typedef struct {
+    uint16_t channels;
+    uint16_t bitsPerSample;
+    uint32_t sampleRate;
+    uint32_t dataOffset;                        // Position of first sample in file (in bytes)
+    uint32_t dataSize;                          // Size of sample-data (in bytes)
+} wavFormat;
+
+bool WavFile_ParseHeader(File &_file, wavFormat *_format);
+int16_t *WavFile_LoadMono(const char *_path, const uint32_t _maxFrames, uint32_t *_frames, uint32_t *_sampleRate);
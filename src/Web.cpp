@@ -1,13 +1,16 @@
 #include <Arduino.h>
 #include <WiFi.h>
 #include <Update.h>
-#include <nvsDump.h>
 #include <esp_task_wdt.h>
-#include "freertos/ringbuf.h"
+#include <nvs.h>
+#include <memory>
 #include "ESPAsyncWebServer.h"
 #include "ArduinoJson.h"
 #include "settings.h"
 #include "AudioPlayer.h"
+#include "Archive.h"
+#include "AudioStats.h"
+#include "Backup.h"
 #include "Battery.h"
 #include "Cmd.h"
 #include "Common.h"
@@ -18,8 +21,11 @@
 #include "Mqtt.h"
 #include "Rfid.h"
 #include "SdCard.h"
+#include "Spectrum.h"
 #include "System.h"
+#include "TimeStretch.h"
 #include "Web.h"
+#include "WebStream.h"
 #include "Wlan.h"
 #include "revision.h"
 
@@ -46,6 +52,43 @@ typedef struct {
     char nvsEntry[275];
 } nvs_t;
 
+// Directory-listing (explorer) is generated piece by piece while it's sent
+#define EXPLORER_LIST_TIME_BUDGET       20u     // Max. time (in ms) chunk-callback keeps reading directory without output
+#define EXPLORER_LIST_CHUNK_SIZE        (6 * MAX_FILEPATH_LENTGH + 32)  // One entry; worst case every character is escaped (\u00xx)
+#define EXPLORER_SORTED_PAGE_MAX        32u     // Max. entries per sorted page (they're kept in RAM until directory was scanned)
+
+typedef enum {
+    EXPLORER_LIST_HEADER = 0,
+    EXPLORER_LIST_SCAN,
+    EXPLORER_LIST_ENTRIES,
+    EXPLORER_LIST_FOOTER,
+    EXPLORER_LIST_DONE
+} explorerListPhase;
+
+typedef struct {
+    char name[MAX_FILEPATH_LENTGH];
+    bool dir;
+} explorerListEntry;
+
+typedef struct {
+    File root;
+    explorerListPhase phase;
+    bool paginated;                     // {"entries":[...],"next":...} instead of plain array
+    bool sorted;
+    bool more;                          // There are entries behind this page
+    uint32_t offset;                    // Entries to skip (unsorted)
+    uint32_t limit;                     // Max. entries (0 => all)
+    uint32_t skipped;
+    uint32_t count;                     // Entries sent
+    char after[MAX_FILEPATH_LENTGH];    // Sorted: only entries behind this name
+    explorerListEntry entry;
+    explorerListEntry *page;            // Sorted: entries of page
+    uint32_t pageEntries;
+    char *chunk;                        // Piece of response that wasn't sent completely yet
+    size_t chunkLength;
+    size_t chunkPos;
+} explorerListState;
+
 const char mqttTab[] PROGMEM = "<a class=\"nav-item nav-link\" id=\"nav-mqtt-tab\" data-toggle=\"tab\" href=\"#nav-mqtt\" role=\"tab\" aria-controls=\"nav-mqtt\" aria-selected=\"false\"><i class=\"fas fa-network-wired\"></i> MQTT</a>";
 const char ftpTab[] PROGMEM = "<a class=\"nav-item nav-link\" id=\"nav-ftp-tab\" data-toggle=\"tab\" href=\"#nav-ftp\" role=\"tab\" aria-controls=\"nav-ftp\" aria-selected=\"false\"><i class=\"fas fa-folder\"></i> FTP</a>";
 
@@ -55,25 +98,207 @@ AsyncEventSource events("/events");
 
 static bool webserverStarted = false;
 
-static RingbufHandle_t explorerFileUploadRingBuffer;
-static QueueHandle_t explorerFileUploadStatusQueue;
-static TaskHandle_t fileStorageTaskHandle;
+// Upload: async_tcp puts data into ringbuffer, the (persistent) writer-task writes it to SD in batches.
+// Ringbuffer-size is a multiple of batch-size => batches are contiguous and aligned within the file.
+#define EXPLORER_UPLOAD_NOTIFY_OPEN     1u
+#define EXPLORER_UPLOAD_NOTIFY_DATA     2u
+#define EXPLORER_UPLOAD_NOTIFY_CLOSE    4u
+#define EXPLORER_UPLOAD_NOTIFY_ABORT    8u      // Client disconnected before file was complete => it's closed and removed
+
+static uint8_t *explorerUploadBuffer = NULL;
+static uint32_t explorerUploadBufferSize = 0;
+static uint32_t explorerUploadBatchSize = 0;
+static uint32_t explorerUploadReadPos = 0;      // Writer-task only
+static uint32_t explorerUploadWritePos = 0;     // async_tcp only
+static uint32_t explorerUploadFill = 0;
+static portMUX_TYPE explorerUploadMux = portMUX_INITIALIZER_UNLOCKED;
+static volatile bool explorerUploadError = false;   // Writing current file failed => its remaining data is discarded
+static bool explorerUploadArchive = false;      // tar(.gz) is extracted into directory instead of being stored
+static bool explorerUploadGzip = false;
+static char explorerUploadFilePath[MAX_FILEPATH_LENTGH];
+static SemaphoreHandle_t explorerUploadSpaceSemaphore;  // Given by writer-task after data was written
+static SemaphoreHandle_t explorerUploadDoneSemaphore;   // Given by writer-task after file was closed
+static TaskHandle_t explorerUploadTaskHandle;
+static bool explorerUploadOpen = false;         // async_tcp only: file was opened and its final chunk isn't received yet
+static bool explorerUploadClosing = false;      // async_tcp only: writer-task didn't confirm closing of last file yet
+static bool explorerUploadDiscard = false;      // async_tcp only: data of current file is discarded (writer-task busy)
+static AsyncWebServerRequest *explorerUploadRequest = NULL;     // Upload-request currently received
+static uint32_t explorerUploadWaitDeadline = 0;    // async_tcp only: all waits for writer-task of one callback end by then (refer uploadStallTimeout)
+
+// Websocket-push: state is marked as changed (dirty) and sent by Web_PublishState()
+#define WEB_PUSH_TRACKINFO              (1u << 0)
+#define WEB_PUSH_COVERIMG               (1u << 1)
+#define WEB_PUSH_VOLUME                 (1u << 2)
+#define WEB_PUSH_SPEED                  (1u << 3)
+#define WEB_PUSH_AUDIOSTATS             (1u << 4)
+#define WEB_PUSH_WEBSTREAMSTATS         (1u << 5)
+#define WEB_PUSH_SPECTRUM               (1u << 6)
+#define WEB_PUSH_ARCHIVE                (1u << 7)
+#define WEB_PUSH_RFIDIMPORT             (1u << 8)
+
+#define WEB_BINARY_SPECTRUM             1u      // Type (first byte) of binary frames
+#define WEB_PUSH_REPLY_SLOTS            4u      // Clients whose request of full state can be pending at the same time
+
+typedef struct {
+    bool pausePlay;
+    uint16_t currentTrackNumber;
+    uint16_t numberOfTracks;
+    uint8_t trackVolume;
+    uint32_t nameHash;
+    uint8_t volume;
+    uint8_t volumeFine;
+    int16_t speed;
+} webPushState;
+
+typedef struct {
+    uint32_t client;                        // 0 => slot is free
+    uint32_t flags;
+} webPushReply;
+
+typedef struct {
+    uint32_t events;
+    uint32_t frames;
+    uint32_t bytes;
+} webPushStats;
+
+static uint32_t Web_PushDirty = 0;
+static bool Web_PushFull = true;            // Next frame contains all fields, not only changed ones
+static webPushReply Web_PushReplies[WEB_PUSH_REPLY_SLOTS];  // Full state requested by a single client
+static uint32_t Web_LastPushTimestamp = 0;
+static portMUX_TYPE Web_PushMux = portMUX_INITIALIZER_UNLOCKED;
+static webPushState Web_PushLast;           // Values of last frame
+static webPushStats Web_PushStats = {0, 0, 0};
+static StaticJsonDocument<768> Web_PushDocument;
+static char Web_PushTitle[MAX_FILEPATH_LENTGH + 20];
+static char Web_PushTitleUtf8[2 * (MAX_FILEPATH_LENTGH + 20)];
+
+// Download: file is read while response is sent
+typedef struct {
+    File file;
+    uint32_t remaining;                 // Bytes of requested range not yet sent
+    uint32_t budget;                    // Bytes allowed to send right now (while audio is played from SD)
+    uint32_t budgetTimestamp;
+} explorerDownloadState;
+
+// Statistics of all files of an upload-request
+static uint32_t explorerUploadTotalBytes = 0;
+static uint32_t explorerUploadTotalStart = 0;
+static uint16_t explorerUploadTotalFiles = 0;
+static uint16_t explorerUploadFailedFiles = 0;
+
+// Settings of webgui: read once from NVS, kept in RAM (served by /api/settings and templates) and written back as batch
+#define WEB_SETTINGS_BODY_MAX           1024u   // Max. size of request-body of POST /api/settings
+
+typedef enum {
+    WEB_SETTING_U8,
+    WEB_SETTING_U32,
+    WEB_SETTING_FLOAT,
+    WEB_SETTING_STRING
+} webSettingType;
+
+typedef struct {
+    uint32_t initVolume;
+    uint32_t maxVolumeSpeaker;
+    uint32_t maxVolumeHeadphone;
+    uint8_t initBrightness;
+    uint8_t nightBrightness;
+    uint32_t maxInactivity;
+    float warningLowVoltage;
+    float voltageIndicatorLow;
+    float voltageIndicatorHigh;
+    uint32_t voltageCheckInterval;
+    uint8_t mqttEnable;
+    char mqttServer[mqttServerLength];
+    char mqttUser[mqttUserLength];
+    char mqttPassword[mqttPasswordLength];
+    uint32_t mqttPort;
+    char ftpUser[ftpUserLength];
+    char ftpPassword[ftpPasswordLength];
+    char hostname[33];
+} webSettings;
+
+typedef struct {
+    const char *section;                // JSON-object (same as used by websocket)
+    const char *name;                   // JSON-name
+    const char *nvsKey;
+    webSettingType type;
+    size_t offset;                      // Position in webSettings
+    size_t size;
+    float min;                          // Strings: min. length
+    float max;                          // Strings: max. length
+    float defaultValue;                 // If not found in NVS (strings: "-1")
+} webSettingDescriptor;
+
+static const webSettingDescriptor webSettingDescriptors[] = {
+    { "general", "iVol", "initVolume", WEB_SETTING_U32, offsetof(webSettings, initVolume), sizeof(uint32_t), 1, 21, 0 },
+    { "general", "mVolSpeaker", "maxVolumeSp", WEB_SETTING_U32, offsetof(webSettings, maxVolumeSpeaker), sizeof(uint32_t), 1, 21, 0 },
+    { "general", "mVolHeadphone", "maxVolumeHp", WEB_SETTING_U32, offsetof(webSettings, maxVolumeHeadphone), sizeof(uint32_t), 1, 21, 0 },
+    { "general", "iBright", "iLedBrightness", WEB_SETTING_U8, offsetof(webSettings, initBrightness), sizeof(uint8_t), 0, 255, 0 },
+    { "general", "nBright", "nLedBrightness", WEB_SETTING_U8, offsetof(webSettings, nightBrightness), sizeof(uint8_t), 0, 255, 0 },
+    { "general", "iTime", "mInactiviyT", WEB_SETTING_U32, offsetof(webSettings, maxInactivity), sizeof(uint32_t), 0, 255, 0 },
+    { "general", "vWarning", "wLowVoltage", WEB_SETTING_FLOAT, offsetof(webSettings, warningLowVoltage), sizeof(float), 2.0, 5.0, s_warningLowVoltage },
+    { "general", "vIndLow", "vIndicatorLow", WEB_SETTING_FLOAT, offsetof(webSettings, voltageIndicatorLow), sizeof(float), 2.0, 5.0, s_voltageIndicatorLow },
+    { "general", "vIndHi", "vIndicatorHigh", WEB_SETTING_FLOAT, offsetof(webSettings, voltageIndicatorHigh), sizeof(float), 2.0, 5.0, s_voltageIndicatorHigh },
+    { "general", "vInt", "vCheckIntv", WEB_SETTING_U32, offsetof(webSettings, voltageCheckInterval), sizeof(uint32_t), 1, 255, s_voltageCheckInterval },
+    { "mqtt", "mqttEnable", "enableMQTT", WEB_SETTING_U8, offsetof(webSettings, mqttEnable), sizeof(uint8_t), 0, 1, 0 },
+    { "mqtt", "mqttServer", "mqttServer", WEB_SETTING_STRING, offsetof(webSettings, mqttServer), mqttServerLength, 0, mqttServerLength - 1, 0 },
+    { "mqtt", "mqttUser", "mqttUser", WEB_SETTING_STRING, offsetof(webSettings, mqttUser), mqttUserLength, 0, mqttUserLength - 1, 0 },
+    { "mqtt", "mqttPwd", "mqttPassword", WEB_SETTING_STRING, offsetof(webSettings, mqttPassword), mqttPasswordLength, 0, mqttPasswordLength - 1, 0 },
+    { "mqtt", "mqttPort", "mqttPort", WEB_SETTING_U32, offsetof(webSettings, mqttPort), sizeof(uint32_t), 1, 65535, 1883 },
+    { "ftp", "ftpUser", "ftpuser", WEB_SETTING_STRING, offsetof(webSettings, ftpUser), ftpUserLength, 1, ftpUserLength - 1, 0 },
+    { "ftp", "ftpPwd", "ftppassword", WEB_SETTING_STRING, offsetof(webSettings, ftpPassword), ftpPasswordLength, 1, ftpPasswordLength - 1, 0 },
+    { "wifiConfig", "hostname", "Hostname", WEB_SETTING_STRING, offsetof(webSettings, hostname), 33, 2, 32, 0 }
+};
+
+static webSettings Web_Settings;            // Only accessed by async_tcp (and Web_Init() before webserver is started)
 
-void Web_DumpSdToNvs(const char *_filename);
 static void handleUpload(AsyncWebServerRequest *request, String filename, size_t index, uint8_t *data, size_t len, bool final);
 static void explorerHandleFileUpload(AsyncWebServerRequest *request, String filename, size_t index, uint8_t *data, size_t len, bool final);
-static void explorerHandleFileStorageTask(void *parameter);
+static bool explorerUploadInit(void);
+static void explorerUploadPutData(const uint8_t *_data, size_t _length);
+static void explorerUploadFinished(AsyncWebServerRequest *request);
+static void explorerUploadTask(void *parameter);
+static bool explorerUploadWaitClosed(void);
+static TickType_t explorerUploadWaitTicks(void);
+static void explorerUploadAbort(AsyncWebServerRequest *request);
 static void explorerHandleListRequest(AsyncWebServerRequest *request);
+static bool explorerListReadEntry(explorerListState *_state, explorerListEntry *_entry);
+static void explorerListAppendName(explorerListState *_state, const char *_name);
+static void explorerListAppendEntry(explorerListState *_state, const explorerListEntry *_entry);
+static void explorerListInsertSorted(explorerListState *_state, const explorerListEntry *_entry);
+static bool explorerListStep(explorerListState *_state, const uint32_t _startMs);
+static size_t explorerListFillChunk(explorerListState *_state, uint8_t *_buffer, const size_t _maxLen);
+static void explorerListFree(explorerListState *_state);
 static void explorerHandleDeleteRequest(AsyncWebServerRequest *request);
 static void explorerHandleCreateRequest(AsyncWebServerRequest *request);
 static void explorerHandleRenameRequest(AsyncWebServerRequest *request);
 static void explorerHandleAudioRequest(AsyncWebServerRequest *request);
+static void Web_RequestFullState(const uint32_t _client, const uint32_t _flags);
+static uint32_t Web_GetPushFlag(const uint8_t _code);
+static void Web_SendJson(uint32_t client, JsonDocument &doc);
+static void Web_SendBuffer(uint32_t client, AsyncWebSocketMessageBuffer *buffer, const bool binary);
+static void Web_PublishState(void);
+static void Web_SendReplies(void);
+static void Web_AddState(JsonObject object, const uint32_t _flags, const bool _full, webPushState *_last);
+static void Web_AddTrackinfo(JsonObject object, const bool _full, webPushState *_last);
+static void explorerHandleDownloadRequest(AsyncWebServerRequest *request);
+static size_t explorerDownloadFillBuffer(explorerDownloadState *_state, uint8_t *_buffer, size_t _maxLen);
+static const char *explorerGetContentType(const char *_path);
 static void handleCoverImageRequest(AsyncWebServerRequest *request);
-
-static bool Web_DumpNvsToSd(const char *_namespace, const char *_destFile);
+static uint32_t Web_HashCover(const char *_fileName, const size_t _pos, const size_t _size);
+static bool Web_GetCachedCover(const uint32_t _hash, char *_cachePath, const size_t _pathSize, char *_mimeType, const size_t _mimeSize);
+static void Web_PruneCoverCache(void);
 
 static void onWebsocketEvent(AsyncWebSocket *server, AsyncWebSocketClient *client, AwsEventType type, void *arg, uint8_t *data, size_t len);
 static String templateProcessor(const String &templ);
+static void handleTemplatesRequest(AsyncWebServerRequest *request);
+static void Web_LoadSettings(void);
+static esp_err_t Web_ApplySettings(JsonObjectConst _settings);
+static void Web_AddSettings(JsonObject _object);
+static void handleSettingsRequest(AsyncWebServerRequest *request);
+static void handleSettingsPostBody(AsyncWebServerRequest *request, uint8_t *data, size_t len, size_t index, size_t total);
+static void handleSettingsPostRequest(AsyncWebServerRequest *request);
+static void Web_SendGzipPage(AsyncWebServerRequest *request, const uint8_t *_data, const size_t _length, const char *_etag);
 static void webserverStart(void);
 void Web_DeleteCachefile(const char *fileOrDirectory);
 
@@ -90,8 +315,10 @@ struct SpiRamAllocator {
 using SpiRamJsonDocument = BasicJsonDocument<SpiRamAllocator>;
 
 void Web_Init(void) {
+    Web_LoadSettings();
+
     wServer.on("/", HTTP_GET, [](AsyncWebServerRequest *request) {
-        request->send_P(200, "text/html", accesspoint_HTML);
+        Web_SendGzipPage(request, accesspoint_HTML_GZ, sizeof(accesspoint_HTML_GZ), accesspoint_HTML_ETAG);
     });
 
     wServer.on("/init", HTTP_POST, [](AsyncWebServerRequest *request) {
@@ -103,7 +330,7 @@ void Web_Init(void) {
             gPrefsSettings.putString("Password", request->getParam("pwd", true)->value());
             gPrefsSettings.putString("Hostname", request->getParam("hostname", true)->value());
         }
-        request->send_P(200, "text/html", accesspoint_HTML);
+        Web_SendGzipPage(request, accesspoint_HTML_GZ, sizeof(accesspoint_HTML_GZ), accesspoint_HTML_ETAG);
     });
 
     wServer.on("/restart", HTTP_GET, [](AsyncWebServerRequest *request) {
@@ -136,6 +363,7 @@ void Web_Init(void) {
 void Web_Cyclic(void) {
     webserverStart();
     ws.cleanupClients();
+    Web_PublishState();
 }
 
 void notFound(AsyncWebServerRequest *request) {
@@ -158,9 +386,16 @@ void webserverStart(void) {
                 request->send(gFSystem, "/.html/index.htm", String(), false, templateProcessor);
             } else {
                 // serve webpage from PROGMEM
-                request->send_P(200, "text/html", management_HTML, templateProcessor);    
+                Web_SendGzipPage(request, management_HTML_GZ, sizeof(management_HTML_GZ), management_HTML_ETAG);
             }
         });
+
+        // Values of the placeholders of the (static) webpage
+        wServer.on("/templates.js", HTTP_GET, handleTemplatesRequest);
+
+        // Settings (JSON); POST applies a batch of changes
+        wServer.on("/api/settings", HTTP_GET, handleSettingsRequest);
+        wServer.on("/api/settings", HTTP_POST, handleSettingsPostRequest, NULL, handleSettingsPostBody);
         // Log
         wServer.on("/log", HTTP_GET, [](AsyncWebServerRequest *request) {
             request->send(200, "text/plain; charset=utf-8", Log_GetRingBuffer());
@@ -205,7 +440,11 @@ void webserverStart(void) {
         // NVS-backup-upload
         wServer.on(
             "/upload", HTTP_POST, [](AsyncWebServerRequest *request) {
-                request->send_P(200, "text/html", backupRecoveryWebsite);
+                if (Backup_GetImportStats()->error) {
+                    request->send(400, "text/plain", "Import failed");
+                } else {
+                    request->send_P(200, "text/html", backupRecoveryWebsite);
+                }
             },
             handleUpload);
 
@@ -257,17 +496,14 @@ void webserverStart(void) {
             request->send_P(200, "text/html", eraseRfidNvsWeb);
             Log_Println((char *) FPSTR(eraseRfidNvs), LOGLEVEL_NOTICE);
             gPrefsRfid.clear();
-            Web_DumpNvsToSd("rfidTags", (const char*) FPSTR(backupFile));
+            Backup_Export((const char *) FPSTR(prefsRfidNamespace), (const char *) FPSTR(backupFile));
         });
 
         // Fileexplorer (realtime)
         wServer.on("/explorer", HTTP_GET, explorerHandleListRequest);
 
         wServer.on(
-            "/explorer", HTTP_POST, [](AsyncWebServerRequest *request) {
-                request->send(200);
-            },
-            explorerHandleFileUpload);
+            "/explorer", HTTP_POST, explorerUploadFinished, explorerHandleFileUpload);
 
         wServer.on("/explorer", HTTP_DELETE, explorerHandleDeleteRequest);
 
@@ -277,6 +513,9 @@ void webserverStart(void) {
 
         wServer.on("/exploreraudio", HTTP_POST, explorerHandleAudioRequest);
 
+        // Download or preview of a file (supports Range-requests)
+        wServer.on("/explorerdownload", HTTP_GET, explorerHandleDownloadRequest);
+
         // current cover image
         wServer.on("/cover", HTTP_GET, handleCoverImageRequest);
 
@@ -312,12 +551,48 @@ void webserverStart(void) {
     }
 }
 
+// Webpages in PROGMEM are gzip-compressed (processHtml.py); ETag is a hash of the content.
+// Browser revalidates on every load (no-cache) and gets 304 unless firmware (and so the page) changed.
+void Web_SendGzipPage(AsyncWebServerRequest *request, const uint8_t *_data, const size_t _length, const char *_etag) {
+    AsyncWebServerResponse *response;
+    if (request->method() == HTTP_GET && request->hasHeader("If-None-Match") && request->getHeader("If-None-Match")->value().indexOf(_etag) >= 0) {
+        response = request->beginResponse(304);
+    } else {
+        response = request->beginResponse_P(200, "text/html", _data, _length);
+        response->addHeader("Content-Encoding", "gzip");
+    }
+    response->addHeader("ETag", _etag);
+    response->addHeader("Cache-Control", "no-cache");
+    request->send(response);
+}
+
+// Placeholders of the webpage; their values are delivered by templates.js (settings are loaded from /api/settings)
+static const char *const templateNames[] = {
+    "FTP_USER_LENGTH", "FTP_PWD_LENGTH", "SHOW_FTP_TAB", "CURRENT_VOLUME", "PLAYBACK_SPEED", "SHOW_MQTT_TAB",
+    "MQTT_USER_LENGTH", "MQTT_PWD_LENGTH", "MQTT_SERVER_LENGTH", "IPv4", "RFID_TAG_ID"
+};
+
+// Sends values of all placeholders as JavaScript-object (never cached)
+void handleTemplatesRequest(AsyncWebServerRequest *request) {
+    DynamicJsonDocument doc(3072);
+    for (const char *name : templateNames) {
+        doc[name] = templateProcessor(name);
+    }
+    String json;
+    serializeJson(doc, json);
+
+    AsyncWebServerResponse *response = request->beginResponse(200, "application/javascript", "var espuinoTemplate = " + json + ";");
+    response->addHeader("Cache-Control", "no-store");
+    request->send(response);
+}
+
 // Used for substitution of some variables/templates of html-files. Is called by webserver's template-engine
+// Settings are taken from RAM (Web_Settings), so no NVS-access is necessary
 String templateProcessor(const String &templ) {
     if (templ == "FTP_USER") {
-        return gPrefsSettings.getString("ftpuser", "-1");
+        return String(Web_Settings.ftpUser);
     } else if (templ == "FTP_PWD") {
-        return gPrefsSettings.getString("ftppassword", "-1");
+        return String(Web_Settings.ftpPassword);
     } else if (templ == "FTP_USER_LENGTH") {
         return String(ftpUserLength - 1);
     } else if (templ == "FTP_PWD_LENGTH") {
@@ -329,29 +604,31 @@ String templateProcessor(const String &templ) {
             return String();
         #endif
     } else if (templ == "INIT_LED_BRIGHTNESS") {
-        return String(gPrefsSettings.getUChar("iLedBrightness", 0));
+        return String(Web_Settings.initBrightness);
     } else if (templ == "NIGHT_LED_BRIGHTNESS") {
-        return String(gPrefsSettings.getUChar("nLedBrightness", 0));
+        return String(Web_Settings.nightBrightness);
     } else if (templ == "MAX_INACTIVITY") {
-        return String(gPrefsSettings.getUInt("mInactiviyT", 0));
+        return String(Web_Settings.maxInactivity);
     } else if (templ == "INIT_VOLUME") {
-        return String(gPrefsSettings.getUInt("initVolume", 0));
+        return String(Web_Settings.initVolume);
     } else if (templ == "CURRENT_VOLUME") {
         return String(AudioPlayer_GetCurrentVolume());
+    } else if (templ == "PLAYBACK_SPEED") {
+        return String(TimeStretch_GetSpeed());
     } else if (templ == "MAX_VOLUME_SPEAKER") {
-        return String(gPrefsSettings.getUInt("maxVolumeSp", 0));
+        return String(Web_Settings.maxVolumeSpeaker);
     } else if (templ == "MAX_VOLUME_HEADPHONE") {
-        return String(gPrefsSettings.getUInt("maxVolumeHp", 0));
+        return String(Web_Settings.maxVolumeHeadphone);
     } else if (templ == "WARNING_LOW_VOLTAGE") {
-        return String(gPrefsSettings.getFloat("wLowVoltage", warningLowVoltage));
+        return String(Web_Settings.warningLowVoltage);
     } else if (templ == "VOLTAGE_INDICATOR_LOW") {
-        return String(gPrefsSettings.getFloat("vIndicatorLow", voltageIndicatorLow));
+        return String(Web_Settings.voltageIndicatorLow);
     } else if (templ == "VOLTAGE_INDICATOR_HIGH") {
-        return String(gPrefsSettings.getFloat("vIndicatorHigh", voltageIndicatorHigh));
+        return String(Web_Settings.voltageIndicatorHigh);
     } else if (templ == "VOLTAGE_CHECK_INTERVAL") {
-        return String(gPrefsSettings.getUInt("vCheckIntv", voltageCheckInterval));
+        return String(Web_Settings.voltageCheckInterval);
     } else if (templ == "MQTT_SERVER") {
-        return gPrefsSettings.getString("mqttServer", "-1");
+        return String(Web_Settings.mqttServer);
     } else if (templ == "SHOW_MQTT_TAB") { // Only show MQTT-tab if MQTT-support was compiled
         #ifdef MQTT_ENABLE
             return (String) FPSTR(mqttTab);
@@ -365,9 +642,9 @@ String templateProcessor(const String &templ) {
             return String();
         }
     } else if (templ == "MQTT_USER") {
-        return gPrefsSettings.getString("mqttUser", "-1");
+        return String(Web_Settings.mqttUser);
     } else if (templ == "MQTT_PWD") {
-        return gPrefsSettings.getString("mqttPassword", "-1");
+        return String(Web_Settings.mqttPassword);
     } else if (templ == "MQTT_USER_LENGTH") {
         return String(mqttUserLength - 1);
     } else if (templ == "MQTT_PWD_LENGTH") {
@@ -383,15 +660,204 @@ String templateProcessor(const String &templ) {
     } else if (templ == "RFID_TAG_ID") {
         return String(gCurrentRfidTagId);
     } else if (templ == "HOSTNAME") {
-        return gPrefsSettings.getString("Hostname", "-1");
+        return String(Web_Settings.hostname);
     }
 
     return String();
 }
 
+// Reads settings of webgui from NVS into RAM (once; afterwards RAM-copy is updated by Web_ApplySettings())
+void Web_LoadSettings(void) {
+    memset(&Web_Settings, 0, sizeof(Web_Settings));
+    for (const webSettingDescriptor &setting : webSettingDescriptors) {
+        uint8_t *field = (uint8_t *) &Web_Settings + setting.offset;
+        switch (setting.type) {
+            case WEB_SETTING_U8:
+                *field = gPrefsSettings.getUChar(setting.nvsKey, setting.defaultValue);
+                break;
+            case WEB_SETTING_U32:
+                *(uint32_t *) field = gPrefsSettings.getUInt(setting.nvsKey, setting.defaultValue);
+                break;
+            case WEB_SETTING_FLOAT:
+                *(float *) field = gPrefsSettings.getFloat(setting.nvsKey, setting.defaultValue);
+                break;
+            case WEB_SETTING_STRING:
+                strncpy((char *) field, gPrefsSettings.getString(setting.nvsKey, "-1").c_str(), setting.size - 1);
+                break;
+        }
+    }
+}
+
+// Applies a batch of changes. Sections and names are the same as used by websocket ("general", "mqtt", "ftp", "wifiConfig");
+// every value is optional. All values are validated first: if one of them is invalid, nothing is written.
+// Changed values are written using one NVS-handle with a single commit; RAM-copy is updated afterwards.
+esp_err_t Web_ApplySettings(JsonObjectConst _settings) {
+    webSettings updated = Web_Settings;
+
+    for (const webSettingDescriptor &setting : webSettingDescriptors) {
+        JsonVariantConst value = _settings[setting.section][setting.name];
+        if (value.isNull()) {
+            continue;
+        }
+        uint8_t *field = (uint8_t *) &updated + setting.offset;
+        const char *str = value.as<const char *>();
+
+        if (setting.type == WEB_SETTING_STRING) {
+            if (!str || strlen(str) < setting.min || strlen(str) > setting.max) {
+                snprintf(Log_Buffer, Log_BufferLength, "%s: %s", (char *) FPSTR(settingsInvalid), setting.name);
+                Log_Println(Log_Buffer, LOGLEVEL_ERROR);
+                return ESP_ERR_INVALID_ARG;
+            }
+            memset(field, 0, setting.size);
+            memcpy(field, str, strlen(str));
+            continue;
+        }
+
+        // Webgui sends numbers as strings
+        float number = NAN;
+        if (str) {
+            char *end;
+            number = strtof(str, &end);
+            if (end == str || *end != '\0') {
+                number = NAN;
+            }
+        } else if (value.is<float>()) {
+            number = value.as<float>();
+        }
+        if (!(number >= setting.min && number <= setting.max)) {
+            snprintf(Log_Buffer, Log_BufferLength, "%s: %s", (char *) FPSTR(settingsInvalid), setting.name);
+            Log_Println(Log_Buffer, LOGLEVEL_ERROR);
+            return ESP_ERR_INVALID_ARG;
+        }
+        if (setting.type == WEB_SETTING_U8) {
+            *field = (uint8_t) number;
+        } else if (setting.type == WEB_SETTING_U32) {
+            *(uint32_t *) field = (uint32_t) number;
+        } else {
+            *(float *) field = number;
+        }
+    }
+
+    nvs_handle_t handle;
+    uint8_t writes = 0;
+    esp_err_t err = nvs_open((const char *) FPSTR(prefsSettingsNamespace), NVS_READWRITE, &handle);
+    if (err == ESP_OK) {
+        for (const webSettingDescriptor &setting : webSettingDescriptors) {
+            const uint8_t *field = (const uint8_t *) &updated + setting.offset;
+            if (!memcmp(field, (const uint8_t *) &Web_Settings + setting.offset, setting.size)) {
+                continue;   // Unchanged
+            }
+            switch (setting.type) {
+                case WEB_SETTING_U8:
+                    err = nvs_set_u8(handle, setting.nvsKey, *field);
+                    break;
+                case WEB_SETTING_U32:
+                    err = nvs_set_u32(handle, setting.nvsKey, *(const uint32_t *) field);
+                    break;
+                case WEB_SETTING_FLOAT:     // Same format as Preferences::putFloat()
+                    err = nvs_set_blob(handle, setting.nvsKey, field, sizeof(float));
+                    break;
+                case WEB_SETTING_STRING:
+                    err = nvs_set_str(handle, setting.nvsKey, (const char *) field);
+                    break;
+            }
+            if (err != ESP_OK) {
+                break;
+            }
+            writes++;
+        }
+        if (err == ESP_OK && writes) {
+            err = nvs_commit(handle);
+        }
+        nvs_close(handle);
+    }
+
+    if (err != ESP_OK) {
+        snprintf(Log_Buffer, Log_BufferLength, "%s: %s", (char *) FPSTR(settingsWriteError), esp_err_to_name(err));
+        Log_Println(Log_Buffer, LOGLEVEL_ERROR);
+        Web_LoadSettings();     // Some values might have been written already
+        return err;
+    }
+    Web_Settings = updated;
+    snprintf(Log_Buffer, Log_BufferLength, "%s: %u", (char *) FPSTR(settingsSaved), writes);
+    Log_Println(Log_Buffer, LOGLEVEL_INFO);
+    return ESP_OK;
+}
+
+// Adds all settings (grouped by section) to JSON-object
+void Web_AddSettings(JsonObject _object) {
+    for (const webSettingDescriptor &setting : webSettingDescriptors) {
+        JsonObject section = _object[setting.section];
+        if (section.isNull()) {
+            section = _object.createNestedObject(setting.section);
+        }
+        const uint8_t *field = (const uint8_t *) &Web_Settings + setting.offset;
+        switch (setting.type) {
+            case WEB_SETTING_U8:
+                section[setting.name] = *field;
+                break;
+            case WEB_SETTING_U32:
+                section[setting.name] = *(const uint32_t *) field;
+                break;
+            case WEB_SETTING_FLOAT:
+                section[setting.name] = *(const float *) field;
+                break;
+            case WEB_SETTING_STRING:
+                section[setting.name] = (const char *) field;
+                break;
+        }
+    }
+}
+
+// Sends settings from RAM as JSON (never cached)
+void handleSettingsRequest(AsyncWebServerRequest *request) {
+    DynamicJsonDocument doc(1024);
+    Web_AddSettings(doc.to<JsonObject>());
+
+    AsyncResponseStream *response = request->beginResponseStream("application/json");
+    response->addHeader("Cache-Control", "no-store");
+    serializeJson(doc, *response);
+    request->send(response);
+}
+
+// Collects body of POST /api/settings (Content-Type: application/json) in request's temp-object (freed by webserver)
+void handleSettingsPostBody(AsyncWebServerRequest *request, uint8_t *data, size_t len, size_t index, size_t total) {
+    if (total > WEB_SETTINGS_BODY_MAX) {
+        return;
+    }
+    if (!index) {
+        request->_tempObject = malloc(total + 1);
+    }
+    char *body = (char *) request->_tempObject;
+    if (!body || index + len > total) {
+        return;
+    }
+    memcpy(body + index, data, len);
+    body[index + len] = '\0';
+}
+
+// Applies batch of changes and answers with the resulting settings
+void handleSettingsPostRequest(AsyncWebServerRequest *request) {
+    DynamicJsonDocument doc(WEB_SETTINGS_BODY_MAX);
+    if (!request->_tempObject || deserializeJson(doc, (char *) request->_tempObject) || !doc.is<JsonObject>()) {
+        request->send(400, "text/plain", "Invalid JSON");
+        return;
+    }
+
+    esp_err_t err = Web_ApplySettings(doc.as<JsonObjectConst>());
+    if (err == ESP_ERR_INVALID_ARG) {
+        request->send(400, "text/plain", "Invalid value");
+        return;
+    } else if (err != ESP_OK) {
+        request->send(500, "text/plain", esp_err_to_name(err));
+        return;
+    }
+    handleSettingsRequest(request);
+}
+
 // Takes inputs from webgui, parses JSON and saves values in NVS
 // If operation was successful (NVS-write is verified) true is returned
-bool processJsonRequest(char *_serialJson) {
+bool processJsonRequest(char *_serialJson, const uint32_t _client) {
     if (!_serialJson)  {
         return false;
     }    
@@ -415,71 +881,8 @@ bool processJsonRequest(char *_serialJson) {
 
    JsonObject object = doc.as<JsonObject>();
 
-   if (doc.containsKey("general")) {
-        uint8_t iVol = doc["general"]["iVol"].as<uint8_t>();
-        uint8_t mVolSpeaker = doc["general"]["mVolSpeaker"].as<uint8_t>();
-        uint8_t mVolHeadphone = doc["general"]["mVolHeadphone"].as<uint8_t>();
-        uint8_t iBright = doc["general"]["iBright"].as<uint8_t>();
-        uint8_t nBright = doc["general"]["nBright"].as<uint8_t>();
-        uint8_t iTime = doc["general"]["iTime"].as<uint8_t>();
-        float vWarning = doc["general"]["vWarning"].as<float>();
-        float vIndLow = doc["general"]["vIndLow"].as<float>();
-        float vIndHi = doc["general"]["vIndHi"].as<float>();
-        uint8_t vInt = doc["general"]["vInt"].as<uint8_t>();
-
-        gPrefsSettings.putUInt("initVolume", iVol);
-        gPrefsSettings.putUInt("maxVolumeSp", mVolSpeaker);
-        gPrefsSettings.putUInt("maxVolumeHp", mVolHeadphone);
-        gPrefsSettings.putUChar("iLedBrightness", iBright);
-        gPrefsSettings.putUChar("nLedBrightness", nBright);
-        gPrefsSettings.putUInt("mInactiviyT", iTime);
-        gPrefsSettings.putFloat("wLowVoltage", vWarning);
-        gPrefsSettings.putFloat("vIndicatorLow", vIndLow);
-        gPrefsSettings.putFloat("vIndicatorHigh", vIndHi);
-        gPrefsSettings.putUInt("vCheckIntv", vInt);
-
-        // Check if settings were written successfully
-        if (gPrefsSettings.getUInt("initVolume", 0) != iVol ||
-            gPrefsSettings.getUInt("maxVolumeSp", 0) != mVolSpeaker ||
-            gPrefsSettings.getUInt("maxVolumeHp", 0) != mVolHeadphone ||
-            gPrefsSettings.getUChar("iLedBrightness", 0) != iBright ||
-            gPrefsSettings.getUChar("nLedBrightness", 0) != nBright ||
-            gPrefsSettings.getUInt("mInactiviyT", 0) != iTime ||
-            gPrefsSettings.getFloat("wLowVoltage", 999.99) != vWarning ||
-            gPrefsSettings.getFloat("vIndicatorLow", 999.99) != vIndLow ||
-            gPrefsSettings.getFloat("vIndicatorHigh", 999.99) != vIndHi ||
-            gPrefsSettings.getUInt("vCheckIntv", 17777) != vInt) {
-            return false;
-        }
-    } else if (doc.containsKey("ftp")) {
-        const char *_ftpUser = doc["ftp"]["ftpUser"];
-        const char *_ftpPwd = doc["ftp"]["ftpPwd"];
-
-        gPrefsSettings.putString("ftpuser", (String)_ftpUser);
-        gPrefsSettings.putString("ftppassword", (String)_ftpPwd);
-
-        if (!(String(_ftpUser).equals(gPrefsSettings.getString("ftpuser", "-1")) ||
-              String(_ftpPwd).equals(gPrefsSettings.getString("ftppassword", "-1")))) {
-            return false;
-        }
-    } else if (doc.containsKey("mqtt")) {
-        uint8_t _mqttEnable = doc["mqtt"]["mqttEnable"].as<uint8_t>();
-        const char *_mqttServer = object["mqtt"]["mqttServer"];
-        gPrefsSettings.putUChar("enableMQTT", _mqttEnable);
-        gPrefsSettings.putString("mqttServer", (String)_mqttServer);
-        const char *_mqttUser = doc["mqtt"]["mqttUser"];
-        const char *_mqttPwd = doc["mqtt"]["mqttPwd"];
-        uint16_t _mqttPort = doc["mqtt"]["mqttPort"].as<uint16_t>();
-
-        gPrefsSettings.putUChar("enableMQTT", _mqttEnable);
-        gPrefsSettings.putString("mqttServer", (String)_mqttServer);
-        gPrefsSettings.putString("mqttServer", (String)_mqttServer);
-        gPrefsSettings.putString("mqttUser", (String)_mqttUser);
-        gPrefsSettings.putString("mqttPassword", (String)_mqttPwd);
-        gPrefsSettings.putUInt("mqttPort", _mqttPort);
-
-        if ((gPrefsSettings.getUChar("enableMQTT", 99) != _mqttEnable) ||
-            (!String(_mqttServer).equals(gPrefsSettings.getString("mqttServer", "-1")))) {
+   if (doc.containsKey("general") || doc.containsKey("ftp") || doc.containsKey("mqtt")) {
+        if (Web_ApplySettings(object) != ESP_OK) {
             return false;
         }
     } else if (doc.containsKey("rfidMod")) {
@@ -488,6 +891,7 @@ bool processJsonRequest(char *_serialJson) {
         char rfidString[12];
         if (_modId <= 0) {
             gPrefsRfid.remove(_rfidIdModId);
+            Backup_JournalAppend(_rfidIdModId, NULL);   // Record removal in backup-file
         } else {
             snprintf(rfidString, sizeof(rfidString) / sizeof(rfidString[0]), "%s0%s0%s%u%s0", stringDelimiter, stringDelimiter, stringDelimiter, _modId, stringDelimiter);
             gPrefsRfid.putString(_rfidIdModId, rfidString);
@@ -496,8 +900,8 @@ bool processJsonRequest(char *_serialJson) {
             if (s.compareTo(rfidString)) {
                 return false;
             }
+            Backup_JournalAppend(_rfidIdModId, rfidString); // Append to backup-file every time when a new rfid-tag is programmed
         }
-        Web_DumpNvsToSd("rfidTags", (const char*) FPSTR(backupFile)); // Store backup-file every time when a new rfid-tag is programmed
     } else if (doc.containsKey("rfidAssign")) {
         const char *_rfidIdAssinId = object["rfidAssign"]["rfidIdMusic"];
         char _fileOrUrlAscii[MAX_FILEPATH_LENTGH];
@@ -513,104 +917,396 @@ bool processJsonRequest(char *_serialJson) {
         if (s.compareTo(rfidString)) {
             return false;
         }
-        Web_DumpNvsToSd("rfidTags", (const char*) FPSTR(backupFile)); // Store backup-file every time when a new rfid-tag is programmed
+        Backup_JournalAppend(_rfidIdAssinId, rfidString); // Append to backup-file every time when a new rfid-tag is programmed
     } else if (doc.containsKey("wifiConfig")) {
         const char *_ssid = object["wifiConfig"]["ssid"];
         const char *_pwd = object["wifiConfig"]["pwd"];
-        const char *_hostname = object["wifiConfig"]["hostname"];
 
+        if (Web_ApplySettings(object) != ESP_OK) {   // Hostname
+            return false;
+        }
         gPrefsSettings.putString("SSID", _ssid);
         gPrefsSettings.putString("Password", _pwd);
-        gPrefsSettings.putString("Hostname", (String)_hostname);
 
         String sSsid = gPrefsSettings.getString("SSID", "-1");
         String sPwd = gPrefsSettings.getString("Password", "-1");
-        String sHostname = gPrefsSettings.getString("Hostname", "-1");
 
         if (sSsid.compareTo(_ssid) || sPwd.compareTo(_pwd)) {
             return false;
         }
     }
     else if (doc.containsKey("ping")) {
-        Web_SendWebsocketData(0, 20);
+        Web_SendWebsocketData(_client, 20);
         return false;
     } else if (doc.containsKey("controls")) {
-        if (object["controls"].containsKey("set_volume")) {
-            uint8_t new_vol = doc["controls"]["set_volume"].as<uint8_t>();
+        if (object["controls"].containsKey("set_volume")) {      // Read as int and clamp (uint8_t would wrap out-of-range values)
+            int32_t new_vol = constrain(doc["controls"]["set_volume"].as<int32_t>(), (int32_t) AudioPlayer_GetMinVolume(), (int32_t) AudioPlayer_GetMaxVolume());
             AudioPlayer_VolumeToQueueSender(new_vol, true);
+        } if (object["controls"].containsKey("set_volume_fine")) {
+            int32_t new_vol = constrain(doc["controls"]["set_volume_fine"].as<int32_t>(), (int32_t) AudioPlayer_VolumeToFine(AudioPlayer_GetMinVolume()), (int32_t) AudioPlayer_VolumeToFine(AudioPlayer_GetMaxVolume()));
+            AudioPlayer_VolumeFineToQueueSender(new_vol, true);
+        } if (object["controls"].containsKey("set_speed")) {
+            TimeStretch_SetSpeed(doc["controls"]["set_speed"].as<int16_t>());
         } if (object["controls"].containsKey("action")) {
             uint8_t cmd = doc["controls"]["action"].as<uint8_t>();
             Cmd_Action(cmd);
         }
     } else if (doc.containsKey("trackinfo")) {
-        Web_SendWebsocketData(0, 30);
+        Web_RequestFullState(_client, WEB_PUSH_TRACKINFO);
     } else if (doc.containsKey("coverimg")) {
-        Web_SendWebsocketData(0, 40);
+        Web_RequestFullState(_client, WEB_PUSH_COVERIMG);
     } else if (doc.containsKey("volume")) {
-        Web_SendWebsocketData(0, 50);
+        Web_RequestFullState(_client, WEB_PUSH_VOLUME);
     }
     
     return true;
 }
 
-// Sends JSON-answers via websocket
+// Used to skip data nobody would see
+bool Web_HasWebsocketClients(void) {
+    return ws.count() > 0;
+}
+
+// Sends JSON-answers via websocket. Replies and events (status, pong, RFID) are sent right away; broadcasts of
+// state (track, volume, statistics, ...) only mark it as changed and are sent combined by Web_PublishState().
+// State for a single client is sent to this client only (with all fields).
 void Web_SendWebsocketData(uint32_t client, uint8_t code) {
-    char *jBuf = (char *) x_calloc(255, sizeof(char));
+    const uint32_t flag = Web_GetPushFlag(code);
 
-    const size_t CAPACITY = JSON_OBJECT_SIZE(1) + 200;
-    StaticJsonDocument<CAPACITY> doc;
-    JsonObject object = doc.to<JsonObject>();
+    portENTER_CRITICAL(&Web_PushMux);
+    Web_PushStats.events++;
+    if (flag && !client) {
+        Web_PushDirty |= flag;
+    }
+    portEXIT_CRITICAL(&Web_PushMux);
+    if (flag && client) {
+        Web_RequestFullState(client, flag);
+    }
+    if (flag || !ws.count()) {
+        return;
+    }
 
+    StaticJsonDocument<JSON_OBJECT_SIZE(1)> doc;
+    JsonObject object = doc.to<JsonObject>();
     if (code == 1) {
         object["status"] = "ok";
     } else if (code == 2) {
         object["status"] = "error";
     } else if (code == 10) {
-        object["rfidId"] = gCurrentRfidTagId;
+        object["rfidId"] = (const char *) gCurrentRfidTagId;
     } else if (code == 20) {
         object["pong"] = "pong";
-    } else if (code == 30) {
-        JsonObject entry = object.createNestedObject("trackinfo");
-        entry["pausePlay"] = gPlayProperties.pausePlay;
-        entry["currentTrackNumber"] = gPlayProperties.currentTrackNumber + 1;
-        entry["numberOfTracks"] = gPlayProperties.numberOfTracks;
-        entry["volume"] = AudioPlayer_GetCurrentVolume();
-        if (gPlayProperties.title)  {
-            // show current audio title from id3 metadata 
-            if (gPlayProperties.numberOfTracks > 1) {
-                snprintf(Log_Buffer, Log_BufferLength, "(%u / %u): %s", gPlayProperties.currentTrackNumber+1,  gPlayProperties.numberOfTracks, gPlayProperties.title);
-            } else {
-                snprintf(Log_Buffer, Log_BufferLength, "%s", gPlayProperties.title);
-            };
-            char utf8Buffer[200];
-            convertAsciiToUtf8(Log_Buffer, utf8Buffer);
-            entry["name"] = utf8Buffer;
-        } else  if (gPlayProperties.playMode == NO_PLAYLIST) {
-            // no active playlist
-            entry["name"] = (char *)FPSTR (noPlaylist);
-        } else {
-            // show current playlist item
-            snprintf(Log_Buffer, Log_BufferLength, "(%u / %u): %s", gPlayProperties.currentTrackNumber+1,  gPlayProperties.numberOfTracks, *(gPlayProperties.playlist + gPlayProperties.currentTrackNumber));
-            char utf8Buffer[200];
-            convertAsciiToUtf8(Log_Buffer, utf8Buffer);
-            entry["name"] = utf8Buffer;
+    }
+    Web_SendJson(client, doc);
+}
+
+// _flags with all their fields are sent to _client (e.g. a new one) with the next call of Web_PublishState().
+// If all slots are in use, they're sent to all clients instead.
+void Web_RequestFullState(const uint32_t _client, const uint32_t _flags) {
+    portENTER_CRITICAL(&Web_PushMux);
+    webPushReply *slot = NULL;
+    for (uint8_t i = 0; i < WEB_PUSH_REPLY_SLOTS; i++) {
+        if (Web_PushReplies[i].client == _client) {
+            slot = &Web_PushReplies[i];
+            break;
         }
-    } else if (code == 40) {
-        object["coverimg"] = "coverimg";
-    } else if (code == 50) {
-        object["volume"] = AudioPlayer_GetCurrentVolume();
-    };
+        if (!slot && !Web_PushReplies[i].client) {
+            slot = &Web_PushReplies[i];
+        }
+    }
+    if (slot) {
+        slot->client = _client;
+        slot->flags |= _flags;
+    } else {
+        Web_PushDirty |= _flags;
+        Web_PushFull = true;
+    }
+    portEXIT_CRITICAL(&Web_PushMux);
+}
 
-    serializeJson(doc, jBuf, 255);
+// Maps code of Web_SendWebsocketData() to its flag of state; 0 for replies/events
+uint32_t Web_GetPushFlag(const uint8_t _code) {
+    switch (_code) {
+        case 30: return WEB_PUSH_TRACKINFO;
+        case 40: return WEB_PUSH_COVERIMG;
+        case 50: return WEB_PUSH_VOLUME;
+        case 51: return WEB_PUSH_SPEED;
+        case 60: return WEB_PUSH_AUDIOSTATS;
+        case 61: return WEB_PUSH_WEBSTREAMSTATS;
+        case 62: return WEB_PUSH_SPECTRUM;
+        case 63: return WEB_PUSH_ARCHIVE;
+        case 64: return WEB_PUSH_RFIDIMPORT;
+        default: return 0;
+    }
+}
 
+// Serializes into one buffer that is shared by all clients. It's allocated per frame as AsyncWebSocket frees it once the last
+// client sent it; frames are coalesced (max. webPushMaxRate per second), so that's at most a few small allocations per second.
+void Web_SendJson(uint32_t client, JsonDocument &doc) {
+    const size_t length = measureJson(doc);
+    AsyncWebSocketMessageBuffer *buffer = ws.makeBuffer(length);
+    if (buffer == NULL) {
+        return;
+    }
+    serializeJson(doc, (char *) buffer->get(), length + 1);
+    Web_SendBuffer(client, buffer, false);
+}
+
+void Web_SendBuffer(uint32_t client, AsyncWebSocketMessageBuffer *buffer, const bool binary) {
+    uint32_t receivers = 1;
     if (client == 0) {
-        ws.printfAll(jBuf);
+        receivers = ws.count();
+        if (binary) {
+            ws.binaryAll(buffer);
+        } else {
+            ws.textAll(buffer);
+        }
+    } else {
+        AsyncWebSocketClient *wsClient = ws.client(client);
+        if (wsClient == NULL) {
+            return;
+        }
+        if (binary) {
+            wsClient->binary(buffer);
+        } else {
+            wsClient->text(buffer);
+        }
+    }
+
+    portENTER_CRITICAL(&Web_PushMux);
+    Web_PushStats.frames += receivers;
+    Web_PushStats.bytes += buffer->length() * receivers;
+    portEXIT_CRITICAL(&Web_PushMux);
+}
+
+// Called by Web_Cyclic(): sends all changes of state since the last frame as one frame (max. webPushMaxRate per second).
+// So bursts (e.g. turning the rotary encoder) are coalesced. While load-reduction is active, frames are sent less often.
+void Web_PublishState(void) {
+    Web_SendReplies();
+
+    const uint32_t pushInterval = AudioStats_IsLoadReductionActive() ? audioStatsWebReducedInterval : 1000u / webPushMaxRate;
+    if (millis() - Web_LastPushTimestamp < pushInterval) {
+        return;
+    }
+
+    portENTER_CRITICAL(&Web_PushMux);
+    uint32_t dirty = Web_PushDirty;
+    const bool full = Web_PushFull;
+    if (dirty) {
+        Web_PushDirty = 0;
+        Web_PushFull = false;
+    }
+    portEXIT_CRITICAL(&Web_PushMux);
+
+    if (!dirty) {
+        return;
+    }
+    if (!ws.count()) {          // Next client gets everything
+        portENTER_CRITICAL(&Web_PushMux);
+        Web_PushFull = true;
+        portEXIT_CRITICAL(&Web_PushMux);
+        return;
+    }
+    Web_LastPushTimestamp = millis();
+
+    #ifdef WEBSOCKET_BINARY_ENABLE
+        if (dirty & WEB_PUSH_SPECTRUM) {        // [type, level of each band]
+            dirty &= ~WEB_PUSH_SPECTRUM;
+            AsyncWebSocketMessageBuffer *buffer = ws.makeBuffer(1 + SPECTRUM_BANDS);
+            if (buffer != NULL) {
+                spectrumFrame frame;
+                Spectrum_Get(&frame);
+                uint8_t *data = buffer->get();
+                data[0] = WEB_BINARY_SPECTRUM;
+                memcpy(data + 1, frame.level, SPECTRUM_BANDS);
+                Web_SendBuffer(0, buffer, true);
+            }
+        }
+    #endif
+
+    Web_PushDocument.clear();
+    JsonObject object = Web_PushDocument.to<JsonObject>();
+    Web_AddState(object, dirty, full, &Web_PushLast);
+    if (object.size()) {
+        Web_SendJson(0, Web_PushDocument);
+    }
+}
+
+// Sends state requested by single clients (with all fields) to them only
+void Web_SendReplies(void) {
+    webPushReply replies[WEB_PUSH_REPLY_SLOTS];
+    portENTER_CRITICAL(&Web_PushMux);
+    memcpy(replies, Web_PushReplies, sizeof(replies));
+    memset(Web_PushReplies, 0, sizeof(Web_PushReplies));
+    portEXIT_CRITICAL(&Web_PushMux);
+
+    for (uint8_t i = 0; i < WEB_PUSH_REPLY_SLOTS; i++) {
+        if (!replies[i].client) {
+            continue;
+        }
+        Web_PushDocument.clear();
+        JsonObject object = Web_PushDocument.to<JsonObject>();
+        Web_AddState(object, replies[i].flags, true, NULL);      // Doesn't change what's known about all clients
+        if (object.size()) {
+            Web_SendJson(replies[i].client, Web_PushDocument);
+        }
+    }
+}
+
+// Adds state of _flags: all fields if _full, otherwise only those that differ from _last. _last (if given) is updated.
+void Web_AddState(JsonObject object, const uint32_t _flags, const bool _full, webPushState *_last) {
+    if (_flags & WEB_PUSH_TRACKINFO) {
+        Web_AddTrackinfo(object, _full, _last);
+    }
+    if (_flags & WEB_PUSH_COVERIMG) {
+        object["coverimg"] = "coverimg";
+    }
+    if (_flags & WEB_PUSH_VOLUME) {
+        const uint8_t volume = AudioPlayer_GetCurrentVolume();
+        const uint8_t volumeFine = AudioPlayer_GetCurrentVolumeFine();
+        if (_full || volume != _last->volume) {
+            object["volume"] = volume;
+        }
+        if (_full || volumeFine != _last->volumeFine) {
+            object["volumeFine"] = volumeFine;
+        }
+        if (_last) {
+            _last->volume = volume;
+            _last->volumeFine = volumeFine;
+        }
+    }
+    if (_flags & WEB_PUSH_SPEED) {
+        const int16_t speed = TimeStretch_GetSpeed();
+        if (_full || speed != _last->speed) {
+            object["speed"] = speed;
+        }
+        if (_last) {
+            _last->speed = speed;
+        }
+    }
+    if (_flags & WEB_PUSH_AUDIOSTATS) {
+        const audioStats *stats = AudioStats_Get();
+        JsonObject entry = object.createNestedObject("audiostats");
+        entry["underruns"] = stats->underrunsTrack;
+        entry["underrunsTotal"] = stats->underrunsTotal;
+        entry["dmaFill"] = stats->dmaFill;
+        entry["decodeAvg"] = stats->decodeAvgUs;
+        entry["decodeMax"] = stats->decodeMaxUs;
+        entry["load"] = stats->decodeLoad;
+        entry["stall"] = stats->longestStallMs;
+        entry["inBuf"] = stats->inputBufferSize;
+        entry["reduced"] = stats->loadReduction;
+    }
+    if (_flags & WEB_PUSH_WEBSTREAMSTATS) {
+        const webStreamStats *stats = WebStream_GetStats();
+        JsonObject entry = object.createNestedObject("webstreamstats");
+        entry["bufFill"] = stats->bufferFill;
+        entry["rebuffers"] = stats->rebuffers;
+        entry["reconnects"] = stats->reconnects;
+        entry["latency"] = stats->connectLatencyMs;
+        entry["stack"] = stats->stackFree;
+    }
+    if (_flags & WEB_PUSH_SPECTRUM) {
+        spectrumFrame frame;
+        Spectrum_Get(&frame);
+        JsonArray levels = object.createNestedArray("spectrum");
+        for (uint8_t i = 0; i < SPECTRUM_BANDS; i++) {
+            levels.add(frame.level[i]);
+        }
+    }
+    if (_flags & WEB_PUSH_ARCHIVE) {
+        const archiveStats *stats = Archive_GetStats();
+        JsonObject entry = object.createNestedObject("archive");
+        entry["files"] = stats->files;
+        entry["bytes"] = stats->bytes;
+        entry["active"] = stats->active;
+        entry["error"] = stats->error;
+    }
+    if (_flags & WEB_PUSH_RFIDIMPORT) {
+        const backupImportStats *stats = Backup_GetImportStats();
+        JsonObject entry = object.createNestedObject("rfidImport");
+        entry["records"] = stats->records;
+        entry["written"] = stats->written;
+        entry["invalid"] = stats->invalid;
+        entry["active"] = stats->active;
+        entry["error"] = stats->error;
+    }
+}
+
+// Adds fields of trackinfo (all if _full, otherwise those that changed since _last)
+void Web_AddTrackinfo(JsonObject object, const bool _full, webPushState *_last) {
+    if (gPlayProperties.title) {
+        // show current audio title from id3 metadata
+        if (gPlayProperties.numberOfTracks > 1) {
+            snprintf(Web_PushTitle, sizeof(Web_PushTitle), "(%u / %u): %s", gPlayProperties.currentTrackNumber+1,  gPlayProperties.numberOfTracks, gPlayProperties.title);
+        } else {
+            snprintf(Web_PushTitle, sizeof(Web_PushTitle), "%s", gPlayProperties.title);
+        }
+    } else if (gPlayProperties.playMode == NO_PLAYLIST) {
+        // no active playlist
+        snprintf(Web_PushTitle, sizeof(Web_PushTitle), "%s", (char *) FPSTR(noPlaylist));
     } else {
-        ws.printf(client, jBuf);
+        // show current playlist item
+        snprintf(Web_PushTitle, sizeof(Web_PushTitle), "(%u / %u): %s", gPlayProperties.currentTrackNumber+1,  gPlayProperties.numberOfTracks, *(gPlayProperties.playlist + gPlayProperties.currentTrackNumber));
+    }
+
+    uint32_t nameHash = 2166136261u;        // FNV-1a
+    for (const char *c = Web_PushTitle; *c; c++) {
+        nameHash = (nameHash ^ (uint8_t) *c) * 16777619u;
+    }
+
+    JsonObject entry = object.createNestedObject("trackinfo");
+    if (_full || gPlayProperties.pausePlay != _last->pausePlay) {
+        entry["pausePlay"] = gPlayProperties.pausePlay;
+    }
+    if (_full || gPlayProperties.currentTrackNumber != _last->currentTrackNumber) {
+        entry["currentTrackNumber"] = gPlayProperties.currentTrackNumber + 1;
+    }
+    if (_full || gPlayProperties.numberOfTracks != _last->numberOfTracks) {
+        entry["numberOfTracks"] = gPlayProperties.numberOfTracks;
+    }
+    if (_full || AudioPlayer_GetCurrentVolume() != _last->trackVolume) {
+        entry["volume"] = AudioPlayer_GetCurrentVolume();
+    }
+    if (_full || nameHash != _last->nameHash) {
+        convertAsciiToUtf8(Web_PushTitle, Web_PushTitleUtf8);
+        entry["name"] = (const char *) Web_PushTitleUtf8;
+    }
+    if (_last) {
+        _last->pausePlay = gPlayProperties.pausePlay;
+        _last->currentTrackNumber = gPlayProperties.currentTrackNumber;
+        _last->numberOfTracks = gPlayProperties.numberOfTracks;
+        _last->trackVolume = AudioPlayer_GetCurrentVolume();
+        _last->nameHash = nameHash;
+    }
+
+    if (!entry.size()) {
+        object.remove("trackinfo");
     }
-    free(jBuf);
 }
 
+#ifdef ENABLE_ESPUINO_DEBUG
+    // Events: calls of Web_SendWebsocketData() (each of them was sent as a frame to all clients before).
+    // Frames/bytes: actually sent (per client).
+    void Web_PrintPushStats(void) {
+        static uint32_t lastTimestamp = 0;
+        static webPushStats last = {0, 0, 0};
+
+        portENTER_CRITICAL(&Web_PushMux);
+        const webPushStats current = Web_PushStats;
+        portEXIT_CRITICAL(&Web_PushMux);
+        const uint32_t duration = (millis() - lastTimestamp) ? (millis() - lastTimestamp) : 1;
+        const uint32_t events = current.events - last.events;
+        const uint32_t frames = current.frames - last.frames;
+        const uint32_t bytes = current.bytes - last.bytes;
+
+        snprintf(Log_Buffer, Log_BufferLength, "Websocket (%u clients) over %u ms: %u events/s, %u frames/s, %u bytes/s", ws.count(), duration, events * 1000u / duration, frames * 1000u / duration, (uint32_t) ((uint64_t) bytes * 1000u / duration));
+        Log_Println(Log_Buffer, LOGLEVEL_NOTICE);
+        last = current;
+        lastTimestamp = millis();
+    }
+#endif
+
 
 // Processes websocket-requests
 void onWebsocketEvent(AsyncWebSocket *server, AsyncWebSocketClient *client, AwsEventType type, void *arg, uint8_t *data, size_t len) {
@@ -618,6 +1314,7 @@ void onWebsocketEvent(AsyncWebSocket *server, AsyncWebSocketClient *client, AwsE
     if (type == WS_EVT_CONNECT) {
         //client connected
         Serial.printf("ws[%s][%u] connect\n", server->url(), client->id());
+        Web_RequestFullState(client->id(), WEB_PUSH_TRACKINFO | WEB_PUSH_VOLUME | WEB_PUSH_SPEED);
         //client->printf("Hello Client %u :)", client->id());
         //client->ping();
     } else if (type == WS_EVT_DISCONNECT) {
@@ -636,7 +1333,7 @@ void onWebsocketEvent(AsyncWebSocket *server, AsyncWebSocketClient *client, AwsE
             //the whole message is in a single frame and we got all of it's data
             Serial.printf("ws[%s][%u] %s-message[%llu]: ", server->url(), client->id(), (info->opcode == WS_TEXT) ? "text" : "binary", info->len);
 
-            if (processJsonRequest((char *)data)) {
+            if (processJsonRequest((char *)data, client->id())) {
                 if (data && (strncmp((char *)data, "getTrack", 8))) {   // Don't send back ok-feedback if track's name is requested in background
                     Web_SendWebsocketData(client->id(), 1);
                 }
@@ -660,132 +1357,483 @@ void onWebsocketEvent(AsyncWebSocket *server, AsyncWebSocketClient *client, AwsE
 void explorerHandleFileUpload(AsyncWebServerRequest *request, String filename, size_t index, uint8_t *data, size_t len, bool final) {
 
     System_UpdateActivityTimer();
+    // async_tcp calls this (and explorerUploadFinished() after the last chunk) from one _onData(); so waits of both share one budget
+    explorerUploadWaitDeadline = millis() + uploadStallTimeout;
 
     // New File
     if (!index) {
         String utf8FilePath;
-        static char filePath[MAX_FILEPATH_LENTGH];
-        if (request->hasParam("path")) {
+        explorerUploadArchive = request->hasParam("extract") && Archive_IsArchive(filename.c_str(), &explorerUploadGzip);
+        if (explorerUploadArchive) {
+            utf8FilePath = request->hasParam("path") ? request->getParam("path")->value() : "/";
+        } else if (request->hasParam("path")) {
             AsyncWebParameter *param = request->getParam("path");
             utf8FilePath = param->value() + "/" + filename;
         } else {
             utf8FilePath = "/" + filename;
         }
 
-        convertUtf8ToAscii(utf8FilePath, filePath);
+        if (explorerUploadRequest != request) {     // First file of request
+            explorerUploadRequest = request;
+            explorerUploadTotalStart = millis();
+            request->onDisconnect([request]() {
+                explorerUploadAbort(request);
+            });
+        }
+        explorerUploadTotalFiles++;
+        explorerUploadDiscard = false;
+        if (!explorerUploadInit()) {
+            explorerUploadFailedFiles++;
+            return;
+        }
+        if (!explorerUploadWaitClosed()) {
+            explorerUploadDiscard = true;
+            explorerUploadFailedFiles++;
+            snprintf(Log_Buffer, Log_BufferLength, "%s: %s", (char *) FPSTR(uploadWriterBusy), utf8FilePath.c_str());
+            Log_Println(Log_Buffer, LOGLEVEL_ERROR);
+            return;
+        }
 
-        snprintf(Log_Buffer, Log_BufferLength, "%s: %s", (char *)FPSTR (writingFile), utf8FilePath.c_str());
-        Log_Println(Log_Buffer, LOGLEVEL_INFO);
-        Web_DeleteCachefile(utf8FilePath.c_str());
+        // Writer-task is idle (previous file was closed) => buffer can be reset
+        convertUtf8ToAscii(utf8FilePath, explorerUploadFilePath);
+        explorerUploadReadPos = 0;
+        explorerUploadWritePos = 0;
+        explorerUploadFill = 0;
+        explorerUploadError = false;
+        xSemaphoreTake(explorerUploadSpaceSemaphore, 0);
 
-        // Create Ringbuffer for upload
-        if (explorerFileUploadRingBuffer == NULL) {
-            explorerFileUploadRingBuffer = xRingbufferCreate(4096, RINGBUF_TYPE_BYTEBUF);
+        if (!explorerUploadArchive) {       // Archive: playlist-caches are deleted after extraction
+            snprintf(Log_Buffer, Log_BufferLength, "%s: %s", (char *)FPSTR (writingFile), utf8FilePath.c_str());
+            Log_Println(Log_Buffer, LOGLEVEL_INFO);
+            Web_DeleteCachefile(utf8FilePath.c_str());
         }
 
-        // Create Queue for receiving a signal from the store task as synchronisation
-        if (explorerFileUploadStatusQueue == NULL) {
-            explorerFileUploadStatusQueue = xQueueCreate(1, sizeof(uint8_t));
-        }
+        xTaskNotify(explorerUploadTaskHandle, EXPLORER_UPLOAD_NOTIFY_OPEN, eSetBits);
+        explorerUploadOpen = true;
+    }
 
-        // Create Task for handling the storage of the data
-        xTaskCreatePinnedToCore(
-            explorerHandleFileStorageTask, /* Function to implement the task */
-            "fileStorageTask",             /* Name of the task */
-            4000,                          /* Stack size in words */
-            filePath,                      /* Task input parameter */
-            2 | portPRIVILEGE_BIT,         /* Priority of the task */
-            &fileStorageTaskHandle,        /* Task handle. */
-            1                              /* Core where the task should run */
-        );
+    if (explorerUploadBuffer == NULL || explorerUploadDiscard) {
+        return;
     }
 
     if (len) {
-        // stream the incoming chunk to the ringbuffer
-        xRingbufferSend(explorerFileUploadRingBuffer, data, len, portTICK_PERIOD_MS * 1000);
+        explorerUploadPutData(data, len);
     }
 
     if (final) {
-        // notify storage task that last data was stored on the ring buffer
-        xTaskNotify(fileStorageTaskHandle, 1u, eNoAction);
-        // watit until the storage task is sending the signal to finish
-        uint8_t signal;
-        xQueueReceive(explorerFileUploadStatusQueue, &signal, portMAX_DELAY);
+        // Writer-task writes remaining data and closes file; wait for it (within what's left of this callback's budget)
+        // as next file reuses the buffer. If it takes longer, next file (or end of request) checks again.
+        xTaskNotify(explorerUploadTaskHandle, EXPLORER_UPLOAD_NOTIFY_CLOSE, eSetBits);
+        explorerUploadOpen = false;
+        explorerUploadClosing = true;
+        explorerUploadWaitClosed();
+    }
+}
 
-        // delete task
-        vTaskDelete(fileStorageTaskHandle);
+// Waits (limited by the budget of the current callback) until writer-task closed the last file. Returns false if it's still busy.
+bool explorerUploadWaitClosed(void) {
+    if (explorerUploadClosing && xSemaphoreTake(explorerUploadDoneSemaphore, explorerUploadWaitTicks()) == pdTRUE) {
+        explorerUploadClosing = false;
     }
+    return !explorerUploadClosing;
 }
 
-void explorerHandleFileStorageTask(void *parameter) {
+// Time left to wait for writer-task in the current async_tcp-callback (0 => budget is used up; only polls)
+TickType_t explorerUploadWaitTicks(void) {
+    const int32_t remaining = (int32_t) (explorerUploadWaitDeadline - millis());
+    return (remaining > 0) ? remaining / portTICK_PERIOD_MS : 0;
+}
 
-    File uploadFile;
-    size_t item_size;
-    size_t bytesOk = 0;
-    size_t bytesNok = 0;
-    uint32_t transferStartTimestamp = millis();
-    uint8_t *item;
-    uint8_t value = 0;
+// Client disconnected (async_tcp): a file that's incomplete is removed by writer-task and statistics are reset.
+// Also called after a finished request, then there's nothing left to do.
+void explorerUploadAbort(AsyncWebServerRequest *request) {
+    if (explorerUploadRequest != request) {
+        return;
+    }
+    explorerUploadRequest = NULL;
+    if (explorerUploadOpen) {
+        explorerUploadOpen = false;
+        explorerUploadClosing = true;
+        xTaskNotify(explorerUploadTaskHandle, EXPLORER_UPLOAD_NOTIFY_ABORT, eSetBits);
+    }
+    explorerUploadTotalBytes = 0;
+    explorerUploadTotalFiles = 0;
+    explorerUploadFailedFiles = 0;
+}
 
-    BaseType_t uploadFileNotification;
-    uint32_t uploadFileNotificationValue;
+// Buffer and writer-task are created with the first upload and kept afterwards
+bool explorerUploadInit(void) {
+    if (explorerUploadBuffer != NULL) {
+        return true;
+    }
 
-    uploadFile = gFSystem.open((char *)parameter, "w");
+    const uint32_t bufferSize = psramFound() ? uploadBufferSize : uploadBufferSizeNoPsram;
+    explorerUploadBuffer = (uint8_t *) x_malloc(bufferSize);
+    explorerUploadSpaceSemaphore = xSemaphoreCreateBinary();
+    explorerUploadDoneSemaphore = xSemaphoreCreateBinary();
+    if (explorerUploadBuffer == NULL || explorerUploadSpaceSemaphore == NULL || explorerUploadDoneSemaphore == NULL) {
+        free(explorerUploadBuffer);
+        explorerUploadBuffer = NULL;
+        Log_Println((char *) FPSTR(uploadInitFailed), LOGLEVEL_ERROR);
+        return false;
+    }
+    explorerUploadBufferSize = bufferSize;
+    explorerUploadBatchSize = (uploadWriteBatch < bufferSize / 2) ? uploadWriteBatch : bufferSize / 2;
+
+    xTaskCreatePinnedToCore(
+        explorerUploadTask,     /* Function to implement the task */
+        "fileStorageTask",      /* Name of the task */
+        4000,                   /* Stack size in words */
+        NULL,                   /* Task input parameter */
+        2 | portPRIVILEGE_BIT,  /* Priority of the task */
+        &explorerUploadTaskHandle,  /* Task handle. */
+        1                       /* Core where the task should run */
+    );
+    return true;
+}
+
+// Copies data to ringbuffer. If it's full, async_tcp waits for the writer-task. Meanwhile received data isn't
+// acknowledged, so the TCP-window closes and the client pauses (back-pressure) instead of data being dropped.
+// All waits of a chunk are limited by the callback's budget; if it's used up, the file is marked as failed.
+void explorerUploadPutData(const uint8_t *_data, size_t _length) {
+    while (_length) {
+        if (explorerUploadError) {
+            return;     // Data of this file is discarded
+        }
+
+        portENTER_CRITICAL(&explorerUploadMux);
+        uint32_t space = explorerUploadBufferSize - explorerUploadFill;
+        portEXIT_CRITICAL(&explorerUploadMux);
+
+        if (!space) {
+            xTaskNotify(explorerUploadTaskHandle, EXPLORER_UPLOAD_NOTIFY_DATA, eSetBits);
+            if (xSemaphoreTake(explorerUploadSpaceSemaphore, explorerUploadWaitTicks()) != pdTRUE) {
+                explorerUploadError = true;
+                snprintf(Log_Buffer, Log_BufferLength, "%s: %s", (char *) FPSTR(uploadStalled), explorerUploadFilePath);
+                Log_Println(Log_Buffer, LOGLEVEL_ERROR);
+            }
+            continue;
+        }
+
+        uint32_t bytes = explorerUploadBufferSize - explorerUploadWritePos;     // Contiguous part
+        if (bytes > space) {
+            bytes = space;
+        }
+        if (bytes > _length) {
+            bytes = _length;
+        }
+        memcpy(explorerUploadBuffer + explorerUploadWritePos, _data, bytes);
+        explorerUploadWritePos = (explorerUploadWritePos + bytes) % explorerUploadBufferSize;
+        _data += bytes;
+        _length -= bytes;
+
+        portENTER_CRITICAL(&explorerUploadMux);
+        explorerUploadFill += bytes;
+        space = explorerUploadFill;
+        portEXIT_CRITICAL(&explorerUploadMux);
+
+        if (space >= explorerUploadBatchSize) {
+            xTaskNotify(explorerUploadTaskHandle, EXPLORER_UPLOAD_NOTIFY_DATA, eSetBits);
+        }
+    }
+}
+
+// Called after all files of an upload-request were received
+void explorerUploadFinished(AsyncWebServerRequest *request) {
+    if (!explorerUploadWaitClosed()) {      // Result of last file is unknown (only waits for what's left of the last chunk's budget)
+        explorerUploadFailedFiles++;
+    }
+    const uint32_t duration = millis() - explorerUploadTotalStart;
+    snprintf(Log_Buffer, Log_BufferLength, "%s: %u files (%u failed) => %u bytes in %u ms (%u kB/s)", (char *) FPSTR(uploadFinished), explorerUploadTotalFiles, explorerUploadFailedFiles, explorerUploadTotalBytes, duration, explorerUploadTotalBytes / (duration ? duration : 1));
+    Log_Println(Log_Buffer, LOGLEVEL_INFO);
+    request->send(explorerUploadFailedFiles ? 500 : 200);
+
+    explorerUploadRequest = NULL;
+    explorerUploadTotalBytes = 0;
+    explorerUploadTotalFiles = 0;
+    explorerUploadFailedFiles = 0;
+}
+
+// Writes full batches; the remainder only once file is closed
+void explorerUploadTask(void *parameter) {
+    File uploadFile;
+    uint32_t notification;
+    uint32_t bytesOk = 0;
+    uint32_t bytesNok = 0;
+    uint32_t transferStartTimestamp = 0;
 
     for (;;) {
-        //esp_task_wdt_reset();
+        xTaskNotifyWait(0, ULONG_MAX, &notification, portMAX_DELAY);
 
-        item = (uint8_t *)xRingbufferReceive(explorerFileUploadRingBuffer, &item_size, portTICK_PERIOD_MS * 100);
-        if (item != NULL) {
-            if (!uploadFile.write(item, item_size)) {
-                bytesNok += item_size;
+        if (notification & EXPLORER_UPLOAD_NOTIFY_OPEN) {
+            if (explorerUploadArchive) {
+                explorerUploadError = !Archive_Begin(explorerUploadFilePath, explorerUploadGzip);
             } else {
-                bytesOk += item_size;
+                uploadFile = gFSystem.open(explorerUploadFilePath, FILE_WRITE);
             }
-            vRingbufferReturnItem(explorerFileUploadRingBuffer, (void *)item);
-        } else {
-            // No data in the buffer, check if all data arrived for the file
-            uploadFileNotification = xTaskNotifyWait(0, 0, &uploadFileNotificationValue, 0);
-            if (uploadFileNotification == pdPASS) {
-                uploadFile.close();
-                snprintf(Log_Buffer, Log_BufferLength, "%s: %s => %zu bytes in %lu ms (%lu kB/s)", (char *)FPSTR (fileWritten), (char *)parameter, bytesNok+bytesOk, (millis() - transferStartTimestamp), (bytesNok+bytesOk)/(millis() - transferStartTimestamp));
-                Log_Println(Log_Buffer, LOGLEVEL_INFO);
-                snprintf(Log_Buffer, Log_BufferLength, "Bytes [ok] %zu / [not ok] %zu\n", bytesOk, bytesNok);
-                Log_Println(Log_Buffer, LOGLEVEL_DEBUG);
-                // done exit loop to terminate
+            if (!explorerUploadArchive && !uploadFile) {
+                explorerUploadError = true;
+                snprintf(Log_Buffer, Log_BufferLength, "%s: %s", (char *) FPSTR(failedOpenFileForWrite), explorerUploadFilePath);
+                Log_Println(Log_Buffer, LOGLEVEL_ERROR);
+            }
+            bytesOk = 0;
+            bytesNok = 0;
+            transferStartTimestamp = millis();
+        }
+
+        for (;;) {
+            portENTER_CRITICAL(&explorerUploadMux);
+            uint32_t bytes = explorerUploadFill;
+            portEXIT_CRITICAL(&explorerUploadMux);
+
+            if (notification & EXPLORER_UPLOAD_NOTIFY_ABORT) {     // Buffered data is dropped
+                portENTER_CRITICAL(&explorerUploadMux);
+                explorerUploadFill = 0;
+                portEXIT_CRITICAL(&explorerUploadMux);
                 break;
             }
-            vTaskDelay(portTICK_PERIOD_MS * 20);
+            if (bytes >= explorerUploadBatchSize) {
+                bytes = explorerUploadBatchSize;
+            } else if (!(notification & EXPLORER_UPLOAD_NOTIFY_CLOSE) || !bytes) {
+                break;
+            }
+            if (bytes > explorerUploadBufferSize - explorerUploadReadPos) {      // Remainder may wrap around
+                bytes = explorerUploadBufferSize - explorerUploadReadPos;
+            }
+
+            if (explorerUploadArchive) {
+                if (!explorerUploadError && Archive_Write(explorerUploadBuffer + explorerUploadReadPos, bytes)) {
+                    bytesOk += bytes;
+                } else {
+                    explorerUploadError = true;
+                    bytesNok += bytes;
+                }
+            } else if (!explorerUploadError && uploadFile.write(explorerUploadBuffer + explorerUploadReadPos, bytes) == bytes) {
+                bytesOk += bytes;
+            } else {
+                if (!explorerUploadError) {
+                    snprintf(Log_Buffer, Log_BufferLength, "%s: %s", (char *) FPSTR(writeFailed), explorerUploadFilePath);
+                    Log_Println(Log_Buffer, LOGLEVEL_ERROR);
+                }
+                explorerUploadError = true;
+                bytesNok += bytes;
+            }
+            explorerUploadReadPos = (explorerUploadReadPos + bytes) % explorerUploadBufferSize;
+
+            portENTER_CRITICAL(&explorerUploadMux);
+            explorerUploadFill -= bytes;
+            portEXIT_CRITICAL(&explorerUploadMux);
+            xSemaphoreGive(explorerUploadSpaceSemaphore);
+        }
+
+        if (notification & EXPLORER_UPLOAD_NOTIFY_ABORT) {
+            if (uploadFile) {
+                uploadFile.close();
+                gFSystem.remove(explorerUploadFilePath);
+            }
+            if (explorerUploadArchive) {
+                Archive_End();
+            }
+            snprintf(Log_Buffer, Log_BufferLength, "%s: %s", (char *) FPSTR(uploadAborted), explorerUploadFilePath);
+            Log_Println(Log_Buffer, LOGLEVEL_ERROR);
+            xSemaphoreGive(explorerUploadDoneSemaphore);
+        } else if (notification & EXPLORER_UPLOAD_NOTIFY_CLOSE) {
+            if (uploadFile) {
+                uploadFile.close();
+            }
+            if (explorerUploadArchive && !Archive_End()) {
+                explorerUploadError = true;
+            }
+            const uint32_t duration = millis() - transferStartTimestamp;
+            snprintf(Log_Buffer, Log_BufferLength, "%s: %s => %u bytes in %u ms (%u kB/s)", (char *)FPSTR (fileWritten), explorerUploadFilePath, bytesOk, duration, bytesOk / (duration ? duration : 1));
+            Log_Println(Log_Buffer, LOGLEVEL_INFO);
+            snprintf(Log_Buffer, Log_BufferLength, "Bytes [ok] %u / [not ok] %u\n", bytesOk, bytesNok);
+            Log_Println(Log_Buffer, LOGLEVEL_DEBUG);
+
+            explorerUploadTotalBytes += bytesOk;
+            if (explorerUploadError) {
+                explorerUploadFailedFiles++;
+            }
+            xSemaphoreGive(explorerUploadDoneSemaphore);
         }
-        #ifdef SD_MMC_1BIT_MODE
-            vTaskDelay(portTICK_PERIOD_MS * 1);
-        #else
-            vTaskDelay(portTICK_PERIOD_MS * 6);
-        #endif
     }
-    // send signal to upload function to terminate
-    xQueueSend(explorerFileUploadStatusQueue, &value, 0);
-    vTaskDelete(NULL);
 }
 
 // Sends a list of the content of a directory as JSON file
 // requires a GET parameter path for the directory
-void explorerHandleListRequest(AsyncWebServerRequest *request) {
-    //DynamicJsonDocument jsonBuffer(8192);
-    #ifdef BOARD_HAS_PSRAM
-        SpiRamJsonDocument jsonBuffer(65636);
-    #else
-        StaticJsonDocument<8192> jsonBuffer;
-    #endif
+// Returns next visible entry of directory (hidden ones like MacOS spotlight-files are skipped); false if there's none
+bool explorerListReadEntry(explorerListState *_state, explorerListEntry *_entry) {
+    File file = _state->root.openNextFile();
+    while (file) {
+        const char *name = strrchr(file.name(), '/');
+        name = name ? name + 1 : file.name();
+        if (name[0] != '.') {
+            strncpy(_entry->name, name, sizeof(_entry->name) - 1);
+            _entry->name[sizeof(_entry->name) - 1] = '\0';
+            _entry->dir = file.isDirectory();
+            return true;
+        }
+        file = _state->root.openNextFile();
+    }
+    return false;
+}
 
-    String serializedJsonString;
-    AsyncWebParameter *param;
+// Appends name as UTF-8 JSON-string (with quotes) to the pending piece of the response
+void explorerListAppendName(explorerListState *_state, const char *_name) {
+    char utf8Name[2 * MAX_FILEPATH_LENTGH];    // Umlauts take two bytes
+    convertAsciiToUtf8(_name, utf8Name);
+    char *out = _state->chunk + _state->chunkLength;
+    *out++ = '"';
+    for (const char *c = utf8Name; *c; c++) {
+        if (*c == '"' || *c == '\\') {
+            *out++ = '\\';
+            *out++ = *c;
+        } else if ((uint8_t) *c < 0x20) {
+            out += sprintf(out, "\\u%04x", (uint8_t) *c);
+        } else {
+            *out++ = *c;
+        }
+    }
+    *out++ = '"';
+    _state->chunkLength = out - _state->chunk;
+}
+
+void explorerListAppendEntry(explorerListState *_state, const explorerListEntry *_entry) {
+    _state->chunkLength = snprintf(_state->chunk, EXPLORER_LIST_CHUNK_SIZE, "%s{\"name\":", _state->count ? "," : "");
+    explorerListAppendName(_state, _entry->name);
+    _state->chunkLength += snprintf(_state->chunk + _state->chunkLength, EXPLORER_LIST_CHUNK_SIZE - _state->chunkLength, ",\"dir\":%s}", _entry->dir ? "true" : "false");
+    _state->count++;
+}
+
+// Entries of a sorted page are kept in order; if page is full, the last one is pushed out
+void explorerListInsertSorted(explorerListState *_state, const explorerListEntry *_entry) {
+    uint32_t pos = _state->pageEntries;
+    while (pos > 0 && naturalCompare(_entry->name, _state->page[pos - 1].name) < 0) {
+        pos--;
+    }
+    if (_state->pageEntries == _state->limit) {
+        _state->more = true;
+        if (pos == _state->limit) {
+            return;
+        }
+        _state->pageEntries--;
+    }
+    memmove(&_state->page[pos + 1], &_state->page[pos], (_state->pageEntries - pos) * sizeof(explorerListEntry));
+    _state->page[pos] = *_entry;
+    _state->pageEntries++;
+}
+
+// Generates the next piece of the response. Returns false if time-budget for directory-reads is used up before.
+bool explorerListStep(explorerListState *_state, const uint32_t _startMs) {
+    switch (_state->phase) {
+        case EXPLORER_LIST_HEADER:
+            _state->chunkLength = snprintf(_state->chunk, EXPLORER_LIST_CHUNK_SIZE, _state->paginated ? "{\"entries\":[" : "[");
+            _state->phase = _state->sorted ? EXPLORER_LIST_SCAN : EXPLORER_LIST_ENTRIES;
+            return true;
+
+        case EXPLORER_LIST_SCAN:
+            while (millis() - _startMs < EXPLORER_LIST_TIME_BUDGET) {
+                if (!explorerListReadEntry(_state, &_state->entry)) {
+                    _state->phase = EXPLORER_LIST_ENTRIES;
+                    return true;
+                }
+                if (!_state->after[0] || naturalCompare(_state->entry.name, _state->after) > 0) {
+                    explorerListInsertSorted(_state, &_state->entry);
+                }
+            }
+            return false;
+
+        case EXPLORER_LIST_ENTRIES:
+            if (_state->sorted) {
+                if (_state->count < _state->pageEntries) {
+                    explorerListAppendEntry(_state, &_state->page[_state->count]);
+                } else {
+                    _state->phase = EXPLORER_LIST_FOOTER;
+                }
+                return true;
+            }
+            while (millis() - _startMs < EXPLORER_LIST_TIME_BUDGET) {
+                if (!explorerListReadEntry(_state, &_state->entry)) {
+                    _state->phase = EXPLORER_LIST_FOOTER;
+                    return true;
+                }
+                if (_state->skipped < _state->offset) {
+                    _state->skipped++;
+                    continue;
+                }
+                if (_state->limit && _state->count >= _state->limit) {
+                    _state->more = true;
+                    _state->phase = EXPLORER_LIST_FOOTER;
+                    return true;
+                }
+                explorerListAppendEntry(_state, &_state->entry);
+                return true;
+            }
+            return false;
+
+        case EXPLORER_LIST_FOOTER:
+            if (!_state->paginated) {
+                _state->chunkLength = snprintf(_state->chunk, EXPLORER_LIST_CHUNK_SIZE, "]");
+            } else if (!_state->more) {
+                _state->chunkLength = snprintf(_state->chunk, EXPLORER_LIST_CHUNK_SIZE, "],\"next\":null}");
+            } else if (_state->sorted) {     // Cursor is name of last entry
+                _state->chunkLength = snprintf(_state->chunk, EXPLORER_LIST_CHUNK_SIZE, "],\"next\":");
+                explorerListAppendName(_state, _state->page[_state->pageEntries - 1].name);
+                _state->chunk[_state->chunkLength++] = '}';
+            } else {                        // Cursor is offset
+                _state->chunkLength = snprintf(_state->chunk, EXPLORER_LIST_CHUNK_SIZE, "],\"next\":%u}", (unsigned int) (_state->offset + _state->count));
+            }
+            _state->phase = EXPLORER_LIST_DONE;
+            return true;
+
+        default:
+            return true;
+    }
+}
+
+// Chunk-callback (async_tcp-task): fills buffer with as many pieces as fit. Scanning (sorted) and skipping to offset
+// continue within one call; only if the time-budget is used up without any output, RESPONSE_TRY_AGAIN lets async_tcp
+// continue with other work before it asks again.
+size_t explorerListFillChunk(explorerListState *_state, uint8_t *_buffer, const size_t _maxLen) {
+    size_t length = 0;
+    const uint32_t startMs = millis();
+    for (;;) {
+        if (_state->chunkPos < _state->chunkLength) {
+            const size_t bytes = std::min(_maxLen - length, _state->chunkLength - _state->chunkPos);
+            memcpy(_buffer + length, _state->chunk + _state->chunkPos, bytes);
+            length += bytes;
+            _state->chunkPos += bytes;
+            if (_state->chunkPos < _state->chunkLength) {   // Buffer is full
+                return length;
+            }
+        }
+        _state->chunkLength = 0;
+        _state->chunkPos = 0;
+        if (_state->phase == EXPLORER_LIST_DONE) {
+            return length;      // 0 => end of response
+        }
+        if (!explorerListStep(_state, startMs)) {
+            return length ? length : RESPONSE_TRY_AGAIN;
+        }
+    }
+}
+
+void explorerListFree(explorerListState *_state) {
+    _state->root.close();
+    free(_state->chunk);
+    free(_state->page);
+    delete _state;
+}
+
+// Lists directory as JSON: [{"name":"...","dir":false},...]
+// Optional parameters: limit (entries per page), offset (unsorted) or sort=1 + after (natural sorting; cursor is name of
+// last entry of previous page). Paginated responses are {"entries":[...],"next":<cursor or null>}.
+// Memory doesn't depend on the number of entries: response is generated while it's sent (sorted: one page is kept).
+void explorerHandleListRequest(AsyncWebServerRequest *request) {
     char filePath[MAX_FILEPATH_LENTGH];
-    JsonArray obj = jsonBuffer.createNestedArray();
     File root;
     if (request->hasParam("path")) {
-        param = request->getParam("path");
-        convertUtf8ToAscii(param->value(), filePath);
+        convertUtf8ToAscii(request->getParam("path")->value(), filePath);
         root = gFSystem.open(filePath);
     } else {
         root = gFSystem.open("/");
@@ -794,40 +1842,45 @@ void explorerHandleListRequest(AsyncWebServerRequest *request) {
     if (!root) {
         snprintf(Log_Buffer, Log_BufferLength, (char *) FPSTR(failedToOpenDirectory));
         Log_Println(Log_Buffer, LOGLEVEL_DEBUG);
+        request->send(404);
         return;
     }
 
     if (!root.isDirectory()) {
         snprintf(Log_Buffer, Log_BufferLength, (char *) FPSTR(notADirectory));
         Log_Println(Log_Buffer, LOGLEVEL_DEBUG);
+        request->send(400);
         return;
     }
 
-    File file = root.openNextFile();
-
-    while (file) {
-        // ignore hidden folders, e.g. MacOS spotlight files
-        if (!startsWith(file.name(), (char *)"/.")) {
-            JsonObject entry = obj.createNestedObject();
-            convertAsciiToUtf8(file.name(), filePath);
-            std::string path = filePath;
-            std::string fileName = path.substr(path.find_last_of("/") + 1);
-
-            entry["name"] = fileName;
-            entry["dir"].set(file.isDirectory());
+    explorerListState *state = new explorerListState();
+    state->root = root;
+    state->phase = EXPLORER_LIST_HEADER;
+    state->sorted = request->hasParam("sort") && request->getParam("sort")->value().toInt();
+    state->paginated = state->sorted || request->hasParam("limit") || request->hasParam("offset");
+    state->offset = request->hasParam("offset") ? request->getParam("offset")->value().toInt() : 0;
+    state->limit = request->hasParam("limit") ? request->getParam("limit")->value().toInt() : 0;
+    if (state->sorted) {
+        if (!state->limit || state->limit > EXPLORER_SORTED_PAGE_MAX) {
+            state->limit = EXPLORER_SORTED_PAGE_MAX;
         }
-        file = root.openNextFile();
-
-        // If playback is active this can (at least sometimes) prevent scattering
-        if (!gPlayProperties.pausePlay) {
-            vTaskDelay(portTICK_PERIOD_MS * 5);
-        } else {
-            vTaskDelay(portTICK_PERIOD_MS * 1);
+        if (request->hasParam("after")) {
+            convertUtf8ToAscii(request->getParam("after")->value(), state->after);
         }
+        state->page = (explorerListEntry *) x_malloc(state->limit * sizeof(explorerListEntry));
+    }
+    state->chunk = x_malloc(EXPLORER_LIST_CHUNK_SIZE);
+    if (!state->chunk || (state->sorted && !state->page)) {
+        explorerListFree(state);
+        request->send(500);
+        return;
     }
 
-    serializeJson(obj, serializedJsonString);
-    request->send(200, "application/json; charset=utf-8", serializedJsonString);
+    std::shared_ptr<explorerListState> listState(state, explorerListFree);    // Freed with the response
+    AsyncWebServerResponse *response = request->beginChunkedResponse("application/json; charset=utf-8", [listState](uint8_t *buffer, size_t maxLen, size_t index) -> size_t {
+        return explorerListFillChunk(listState.get(), buffer, maxLen);
+    });
+    request->send(response);
 }
 
 bool explorerDeleteDirectory(File dir) {
@@ -891,6 +1944,7 @@ void explorerHandleDeleteRequest(AsyncWebServerRequest *request) {
                     snprintf(Log_Buffer, Log_BufferLength, "DELETE:  %s deleted", param->value().c_str());
                     Log_Println(Log_Buffer, LOGLEVEL_INFO);
                     Web_DeleteCachefile(filePath);
+                    SdCard_MoveSidecars(filePath, NULL);
                 } else {
                     snprintf(Log_Buffer, Log_BufferLength, "DELETE:  Cannot delete %s", param->value().c_str());
                     Log_Println(Log_Buffer, LOGLEVEL_ERROR);
@@ -946,6 +2000,7 @@ void explorerHandleRenameRequest(AsyncWebServerRequest *request) {
                 snprintf(Log_Buffer, Log_BufferLength, "RENAME:  %s renamed to %s", srcPath->value().c_str(), dstPath->value().c_str());
                 Log_Println(Log_Buffer, LOGLEVEL_INFO);
                 Web_DeleteCachefile(dstFullFilePath);
+                SdCard_MoveSidecars(srcFullFilePath, dstFullFilePath);
             } else {
                 snprintf(Log_Buffer, Log_BufferLength, "RENAME:  Cannot rename %s", srcPath->value().c_str());
                 Log_Println(Log_Buffer, LOGLEVEL_ERROR);
@@ -984,159 +2039,176 @@ void explorerHandleAudioRequest(AsyncWebServerRequest *request) {
     request->send(200);
 }
 
-// Takes stream from file-upload and writes payload into a temporary sd-file.
-void handleUpload(AsyncWebServerRequest *request, String filename, size_t index, uint8_t *data, size_t len, bool final) {
-    static File tmpFile;
-    static size_t fileIndex = 0;
-    static char tmpFileName[13];
-    esp_task_wdt_reset();
-
-    if (!index) {
-        snprintf(tmpFileName, 13, "/_%lu", millis());
-        tmpFile = gFSystem.open(tmpFileName, FILE_WRITE);
-    } else {
-        tmpFile.seek(fileIndex);
-    }
-
-    if (!tmpFile) {
-        Log_Println((char *) FPSTR(errorWritingTmpfile), LOGLEVEL_ERROR);
+// Sends a file (parameter path); download=1 makes browsers save it instead of showing/playing it.
+// A single byte-range (header "Range: bytes=...") is answered with 206, so browsers can seek and downloads can be resumed.
+void explorerHandleDownloadRequest(AsyncWebServerRequest *request) {
+    if (!request->hasParam("path")) {
+        request->send(400);
         return;
     }
+    const String utf8FilePath = request->getParam("path")->value();
+    char filePath[MAX_FILEPATH_LENTGH];
+    convertUtf8ToAscii(utf8FilePath, filePath);
 
-    for (size_t i = 0; i < len; i++) {
-        tmpFile.printf("%c", data[i]);
-    }
-    fileIndex += len;
-
-    if (final) {
-        tmpFile.close();
-        Web_DumpSdToNvs(tmpFileName);
-        fileIndex = 0;
-    }
-}
-
-// Parses content of temporary backup-file and writes payload into NVS
-void Web_DumpSdToNvs(const char *_filename) {
-    char ebuf[290];
-    uint16_t j = 0;
-    char *token;
-    bool count = false;
-    uint16_t importCount = 0;
-    uint16_t invalidCount = 0;
-    nvs_t nvsEntry[1];
-    char buf;
-    File tmpFile = gFSystem.open(_filename);
-
-    if (!tmpFile) {
-        Log_Println((char *) FPSTR(errorReadingTmpfile), LOGLEVEL_ERROR);
+    File file = gFSystem.open(filePath);
+    if (!file || file.isDirectory()) {
+        request->send(404);
         return;
     }
 
-    Led_SetPause(true);
-    while (tmpFile.available() > 0) {
-        buf = tmpFile.read();
-        if (buf != '\n') {
-            ebuf[j++] = buf;
-        } else {
-            ebuf[j] = '\0';
-            j = 0;
-            token = strtok(ebuf, stringOuterDelimiter);
-            while (token != NULL) {
-                if (!count) {
-                    count = true;
-                    memcpy(nvsEntry[0].nvsKey, token, strlen(token));
-                    nvsEntry[0].nvsKey[strlen(token)] = '\0';
-                } else {
-                    count = false;
-                    memcpy(nvsEntry[0].nvsEntry, token, strlen(token));
-                    nvsEntry[0].nvsEntry[strlen(token)] = '\0';
+    const uint32_t size = file.size();
+    uint32_t first = 0;
+    uint32_t last = size ? size - 1 : 0;
+    bool partial = false;
+    if (request->hasHeader("Range")) {
+        const String range = request->getHeader("Range")->value();
+        const int dash = range.indexOf('-');
+        if (range.startsWith("bytes=") && dash > 0 && range.indexOf(',') < 0) {     // Multiple ranges are answered with whole file
+            const String from = range.substring(6, dash);
+            const String to = range.substring(dash + 1);
+            if (from.length()) {
+                first = from.toInt();
+                if (to.length() && (uint32_t) to.toInt() < last) {
+                    last = to.toInt();
                 }
-                token = strtok(NULL, stringOuterDelimiter);
+            } else if (to.length()) {       // Suffix: last n bytes
+                const uint32_t suffix = to.toInt();
+                first = (suffix < size) ? size - suffix : 0;
             }
-            if (isNumber(nvsEntry[0].nvsKey) && nvsEntry[0].nvsEntry[0] == '#') {
-                snprintf(Log_Buffer, Log_BufferLength, "[%u] %s: %s => %s", ++importCount, (char *) FPSTR(writeEntryToNvs), nvsEntry[0].nvsKey, nvsEntry[0].nvsEntry);
-                Log_Println(Log_Buffer, LOGLEVEL_NOTICE);
-                gPrefsRfid.putString(nvsEntry[0].nvsKey, nvsEntry[0].nvsEntry);
-            } else {
-                invalidCount++;
+            if (!size || first > last || (!from.length() && !to.length())) {
+                char contentRange[24];
+                snprintf(contentRange, sizeof(contentRange), "bytes */%u", size);
+                AsyncWebServerResponse *response = request->beginResponse(416);
+                response->addHeader("Content-Range", contentRange);
+                request->send(response);
+                file.close();
+                return;
             }
+            partial = true;
         }
     }
 
-    Led_SetPause(false);
-    snprintf(Log_Buffer, Log_BufferLength, "%s: %u", (char *) FPSTR(importCountNokNvs), invalidCount);
-    Log_Println(Log_Buffer, LOGLEVEL_NOTICE);
-    tmpFile.close();
-    gFSystem.remove(_filename);
-}
+    if (!file.seek(first)) {
+        file.close();
+        request->send(500);
+        return;
+    }
 
-// Dumps all RFID-entries from NVS into a file on SD-card
-bool Web_DumpNvsToSd(const char *_namespace, const char *_destFile) {
-    Led_SetPause(true);          // Workaround to prevent exceptions due to Neopixel-signalisation while NVS-write
-    esp_partition_iterator_t pi; // Iterator for find
-    const esp_partition_t *nvs;  // Pointer to partition struct
-    esp_err_t result = ESP_OK;
-    const char *partname = "nvs";
-    uint8_t pagenr = 0;   // Page number in NVS
-    uint8_t i;            // Index in Entry 0..125
-    uint8_t bm;           // Bitmap for an entry
-    uint32_t offset = 0;  // Offset in nvs partition
-    uint8_t namespace_ID; // Namespace ID found
-
-    pi = esp_partition_find(ESP_PARTITION_TYPE_DATA,   // Get partition iterator for
-                            ESP_PARTITION_SUBTYPE_ANY, // this partition
-                            partname);
-    if (pi) {
-        nvs = esp_partition_get(pi);        // Get partition struct
-        esp_partition_iterator_release(pi); // Release the iterator
-        dbgprint("Partition %s found, %d bytes", partname, nvs->size);
-    } else {
-        snprintf(Log_Buffer, Log_BufferLength, "Partition %s not found!", partname);
-        Log_Println(Log_Buffer, LOGLEVEL_ERROR);
-        return NULL;
+    explorerDownloadState *state = new explorerDownloadState();
+    state->file = file;
+    state->remaining = size ? last - first + 1 : 0;
+    state->budget = 0;
+    state->budgetTimestamp = millis();
+    std::shared_ptr<explorerDownloadState> downloadState(state, [](explorerDownloadState *_state) {     // Freed with the response
+        _state->file.close();
+        delete _state;
+    });
+
+    AsyncWebServerResponse *response = request->beginResponse(explorerGetContentType(filePath), state->remaining, [downloadState](uint8_t *buffer, size_t maxLen, size_t index) -> size_t {
+        return explorerDownloadFillBuffer(downloadState.get(), buffer, maxLen);
+    });
+    response->addHeader("Accept-Ranges", "bytes");
+    if (partial) {
+        char contentRange[40];
+        snprintf(contentRange, sizeof(contentRange), "bytes %u-%u/%u", first, last, size);
+        response->setCode(206);
+        response->addHeader("Content-Range", contentRange);
     }
-    namespace_ID = FindNsID(nvs, _namespace); // Find ID of our namespace in NVS
-    File backupFile = gFSystem.open(_destFile, FILE_WRITE);
-    if (!backupFile) {
-        return false;
+    if (request->hasParam("download")) {
+        const String disposition = "attachment; filename=\"" + utf8FilePath.substring(utf8FilePath.lastIndexOf('/') + 1) + "\"";
+        response->addHeader("Content-Disposition", disposition);
+    }
+    request->send(response);
+}
+
+// Reads next piece of file into buffer of the response. While audio is played from SD, reading is limited to
+// downloadRateWhilePlaying and pauses while I2S is about to run dry, so playback doesn't underrun.
+size_t explorerDownloadFillBuffer(explorerDownloadState *_state, uint8_t *_buffer, size_t _maxLen) {
+    if (!_state->remaining) {
+        return 0;
     }
-    while (offset < nvs->size) {
-        result = esp_partition_read(nvs, offset, // Read 1 page in nvs partition
-                                    &buf,
-                                    sizeof(nvs_page));
-        if (result != ESP_OK) {
-            snprintf(Log_Buffer, Log_BufferLength, "Error reading NVS!");
-            Log_Println(Log_Buffer, LOGLEVEL_ERROR);
-            return false;
-        }
 
-        i = 0;
+    size_t bytes = (_maxLen < downloadChunkSize) ? _maxLen : downloadChunkSize;
+    if (bytes > _state->remaining) {
+        bytes = _state->remaining;
+    }
 
-        while (i < 126) {
-            bm = (buf.Bitmap[i / 4] >> ((i % 4) * 2)) & 0x03; // Get bitmap for this entry
-            if (bm == 2) {
-                if ((namespace_ID == 0xFF) || // Show all if ID = 0xFF
-                    (buf.Entry[i].Ns == namespace_ID)) { // otherwise just my namespace
-                    if (isNumber(buf.Entry[i].Key)) {
-                        String s = gPrefsRfid.getString((const char *)buf.Entry[i].Key);
-                        backupFile.printf("%s%s%s%s\n", stringOuterDelimiter, buf.Entry[i].Key, stringOuterDelimiter, s.c_str());
-                    }
-                }
-                i += buf.Entry[i].Span; // Next entry
-            } else {
-                i++;
-            }
+    const uint32_t now = millis();
+    if (gPlayProperties.playMode != NO_PLAYLIST && !gPlayProperties.pausePlay && !gPlayProperties.isWebstream) {
+        // Token-bucket: kB/s ~ bytes/ms. If nothing was sent, async_tcp asks again with its next poll (500 ms),
+        // so budget may accumulate for this period.
+        _state->budget += (now - _state->budgetTimestamp) * downloadRateWhilePlaying;
+        if (_state->budget > downloadRateWhilePlaying * 500u) {
+            _state->budget = downloadRateWhilePlaying * 500u;
+        }
+        _state->budgetTimestamp = now;
+        if (!_state->budget || AudioStats_Get()->dmaFill < downloadMinDmaFill) {
+            return RESPONSE_TRY_AGAIN;
         }
-        offset += sizeof(nvs_page); // Prepare to read next page in nvs
-        pagenr++;
+        if (bytes > _state->budget) {
+            bytes = _state->budget;
+        }
+    } else {
+        _state->budgetTimestamp = now;
     }
 
-    backupFile.close();
-    Led_SetPause(false);
+    bytes = _state->file.read(_buffer, bytes);
+    if (!bytes) {       // Read-error: response ends (shorter than announced => client detects it)
+        _state->remaining = 0;
+        return 0;
+    }
+    _state->remaining -= bytes;
+    if (_state->budget >= bytes) {
+        _state->budget -= bytes;
+    }
+    return bytes;
+}
 
-    return true;
+const char *explorerGetContentType(const char *_path) {
+    char extension[6];
+    const char *dot = strrchr(_path, '.');
+    snprintf(extension, sizeof(extension), "%s", dot ? dot + 1 : "");
+    for (char *c = extension; *c; c++) {
+        *c = tolower(*c);
+    }
+
+    if (!strcmp(extension, "mp3")) {
+        return "audio/mpeg";
+    } else if (!strcmp(extension, "m4a") || !strcmp(extension, "aac")) {
+        return "audio/mp4";
+    } else if (!strcmp(extension, "ogg") || !strcmp(extension, "oga")) {
+        return "audio/ogg";
+    } else if (!strcmp(extension, "flac")) {
+        return "audio/flac";
+    } else if (!strcmp(extension, "wav")) {
+        return "audio/wav";
+    } else if (!strcmp(extension, "jpg") || !strcmp(extension, "jpeg")) {
+        return "image/jpeg";
+    } else if (!strcmp(extension, "png")) {
+        return "image/png";
+    } else if (!strcmp(extension, "txt") || !strcmp(extension, "csv") || !strcmp(extension, "m3u")) {
+        return "text/plain";
+    }
+    return "application/octet-stream";
 }
 
+// Takes stream from file-upload and writes payload into a temporary sd-file.
+// Backup-file is validated while being uploaded and imported afterwards (refer Backup.cpp)
+void handleUpload(AsyncWebServerRequest *request, String filename, size_t index, uint8_t *data, size_t len, bool final) {
+    static AsyncWebServerRequest *uploadRequest = NULL;     // Only one import at a time
+
+    if (!index) {
+        uploadRequest = Backup_ImportBegin() ? request : NULL;
+    }
+    if (request != uploadRequest) {
+        return;
+    }
+    Backup_ImportWrite(data, len);
+    if (final) {
+        Backup_ImportEnd();
+        uploadRequest = NULL;
+    }
+}
 
 // handle album cover image request
 static void handleCoverImageRequest(AsyncWebServerRequest *request) {
@@ -1157,46 +2229,146 @@ static void handleCoverImageRequest(AsyncWebServerRequest *request) {
         return;
     }
 
+    // Cache-file (and ETag) are derived from track + position/size of the APIC-frame; so cover is only extracted once per track
+    const uint32_t coverHash = Web_HashCover(gPlayProperties.coverFileName, gPlayProperties.coverFilePos, gPlayProperties.coverFileSize);
+    char eTag[24];
+    snprintf(eTag, sizeof(eTag) / sizeof(eTag[0]), "\"%08x-%x\"", coverHash, gPlayProperties.coverFileSize);
+    if (request->hasHeader("If-None-Match") && request->getHeader("If-None-Match")->value() == eTag) {
+        request->send(304);
+        return;
+    }
+
+    char cachePath[48];
+    char mimeType[16];
+    if (!Web_GetCachedCover(coverHash, cachePath, sizeof(cachePath) / sizeof(cachePath[0]), mimeType, sizeof(mimeType) / sizeof(mimeType[0]))) {
+        request->send(500, "text/plain", "cover image not available");
+        return;
+    }
+    snprintf(Log_Buffer, Log_BufferLength, "serve cover image (%s): %s", mimeType, gPlayProperties.coverFileName);
+    Log_Println(Log_Buffer, LOGLEVEL_NOTICE);
+
+    // AsyncFileResponse reads the next chunk only once TCP has room for it (flow-control is done by the TCP-window)
+    AsyncWebServerResponse *response = request->beginResponse(gFSystem, cachePath, mimeType);
+    response->addHeader("ETag", eTag);
+    response->addHeader("Cache-Control", "no-cache");   // Browser may cache but has to revalidate (=> 304 if cover is unchanged)
+    request->send(response);
+}
+
+// FNV-1a-hash of track-path and position/size of its cover-image
+static uint32_t Web_HashCover(const char *_fileName, const size_t _pos, const size_t _size) {
+    uint32_t hash = 2166136261u;
+    for (const char *c = _fileName; *c; c++) {
+        hash = (hash ^ (uint8_t) *c) * 16777619u;
+    }
+    const uint32_t values[2] = {(uint32_t) _pos, (uint32_t) _size};
+    for (uint8_t i = 0; i < sizeof(values); i++) {
+        hash = (hash ^ ((const uint8_t *) values)[i]) * 16777619u;
+    }
+    return hash;
+}
+
+// Returns path + mime-type of the cache-file of current cover-image. Extracts image from ID3-tag (APIC) if not yet cached.
+static bool Web_GetCachedCover(const uint32_t _hash, char *_cachePath, const size_t _pathSize, char *_mimeType, const size_t _mimeSize) {
+    snprintf(_cachePath, _pathSize, "%s/%08x.png", (char *) FPSTR(coverCacheDirectory), _hash);
+    if (gFSystem.exists(_cachePath)) {
+        strncpy(_mimeType, "image/png", _mimeSize);
+        return true;
+    }
+    snprintf(_cachePath, _pathSize, "%s/%08x.jpg", (char *) FPSTR(coverCacheDirectory), _hash);
+    strncpy(_mimeType, "image/jpeg", _mimeSize);
+    if (gFSystem.exists(_cachePath)) {
+        return true;
+    }
+
     File coverFile = gFSystem.open(gPlayProperties.coverFileName, FILE_READ);
+    if (!coverFile) {
+        return false;
+    }
     // seek to start position, skip 1 byte encoding
     coverFile.seek(gPlayProperties.coverFilePos + 1);
     // mime-type (null terminated)
-    char mimeType[255];
-    for (uint8_t i = 0u; i < 255; i++) {
+    char mimeType[64];
+    for (uint8_t i = 0u; i < sizeof(mimeType); i++) {
         mimeType[i] = coverFile.read();
-        if (uint8_t(mimeType[i]) == 0) 
-            break;  
+        if (uint8_t(mimeType[i]) == 0) {
+            break;
+        }
+    }
+    mimeType[sizeof(mimeType) - 1] = '\0';
+    if (strstr(mimeType, "png") != NULL) {
+        snprintf(_cachePath, _pathSize, "%s/%08x.png", (char *) FPSTR(coverCacheDirectory), _hash);
+        strncpy(_mimeType, "image/png", _mimeSize);
     }
-    snprintf(Log_Buffer, Log_BufferLength, "serve cover image (%s): %s", (char *) mimeType, gPlayProperties.coverFileName);
-    Log_Println(Log_Buffer, LOGLEVEL_NOTICE);
-  
     // skip image type (1 Byte)
     coverFile.read();
     // skip description (null terminated)
     for (uint8_t i = 0u; i < 255; i++) {
-        if (uint8_t(coverFile.read()) == 0)
-            break;  
+        if (uint8_t(coverFile.read()) == 0) {
+            break;
+        }
     }
 
-    int imageSize = gPlayProperties.coverFileSize - coverFile.position();
+    Web_PruneCoverCache();
+    char tmpPath[52];
+    snprintf(tmpPath, sizeof(tmpPath) / sizeof(tmpPath[0]), "%s.tmp", _cachePath);
+    File cacheFile = gFSystem.open(tmpPath, FILE_WRITE);
+    uint8_t *buffer = (uint8_t *) x_malloc(coverCacheCopyBufferSize);
+    if (!cacheFile || buffer == NULL) {
+        free(buffer);
+        coverFile.close();
+        Log_Println((char *) FPSTR(coverImageCacheFailed), LOGLEVEL_ERROR);
+        return false;
+    }
 
-    AsyncWebServerResponse *response = request->beginResponse(
-        mimeType,
-        imageSize,
-        [coverFile](uint8_t *buffer, size_t maxLen, size_t total) -> size_t {
-            File file = coverFile; // local copy of file pointer
-            int bytes = file.read(buffer, maxLen);
-            // close file at the end
-            if (!file.available()) {
-                file.close();
-                    Log_Println("cover image serving finished, close file", LOGLEVEL_DEBUG);
-            }
-            // do not consume too much cpu time
-            vTaskDelay(portTICK_RATE_MS * 50u);  
-            return max(0, bytes); // return 0 even when no bytes were loaded
+    int32_t remaining = (int32_t) gPlayProperties.coverFileSize - (int32_t) coverFile.position();
+    bool success = remaining > 0;
+    while (remaining > 0) {
+        const int32_t bytes = coverFile.read(buffer, std::min(remaining, (int32_t) coverCacheCopyBufferSize));
+        if (bytes <= 0 || cacheFile.write(buffer, bytes) != (size_t) bytes) {
+            success = false;
+            break;
         }
-    );
-    response->addHeader("Cache Control","no-cache, must-revalidate");
-    request->send(response);
+        remaining -= bytes;
+    }
+    free(buffer);
+    coverFile.close();
+    cacheFile.close();
+
+    if (!success || !gFSystem.rename(tmpPath, _cachePath)) {
+        gFSystem.remove(tmpPath);
+        Log_Println((char *) FPSTR(coverImageCacheFailed), LOGLEVEL_ERROR);
+        return false;
+    }
+    snprintf(Log_Buffer, Log_BufferLength, "%s: %s", (char *) FPSTR(coverImageCached), _cachePath);
+    Log_Println(Log_Buffer, LOGLEVEL_INFO);
+    return true;
+}
+
+// Creates cache-directory if necessary. If cache is full, it's cleared completely (covers are extracted again on demand).
+static void Web_PruneCoverCache(void) {
+    if (!gFSystem.exists((char *) FPSTR(coverCacheDirectory))) {
+        gFSystem.mkdir((char *) FPSTR(coverCacheDirectory));
+        return;
+    }
+
+    File cacheDir = gFSystem.open((char *) FPSTR(coverCacheDirectory));
+    uint16_t fileCount = 0;
+    for (File entry = cacheDir.openNextFile(); entry; entry = cacheDir.openNextFile()) {
+        fileCount++;
+        entry.close();
+    }
+    if (fileCount < coverCacheMaxFiles) {
+        cacheDir.close();
+        return;
+    }
+
+    cacheDir.rewindDirectory();
+    char path[48];
+    for (File entry = cacheDir.openNextFile(); entry; entry = cacheDir.openNextFile()) {
+        snprintf(path, sizeof(path) / sizeof(path[0]), "%s/%s", (char *) FPSTR(coverCacheDirectory), strrchr(entry.name(), '/') ? strrchr(entry.name(), '/') + 1 : entry.name());
+        entry.close();
+        gFSystem.remove(path);
+    }
+    cacheDir.close();
 } 
 
@@ -3,3 +3,9 @@
 void Web_Init(void);
 void Web_Cyclic(void);
 void Web_SendWebsocketData(uint32_t client, uint8_t code);
+bool Web_HasWebsocketClients(void);
+void Web_DeleteCachefile(const char *fileOrDirectory);
+
+#ifdef ENABLE_ESPUINO_DEBUG
+    void Web_PrintPushStats(void);
+#endif
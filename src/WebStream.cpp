@@ -0,0 +1,531 @@
+#include <Arduino.h>
+#include <WiFi.h>
+#include <WiFiClientSecure.h>
+#include "Audio.h"
+#include "settings.h"
+#include "WebStream.h"
+#include "Common.h"
+#include "Log.h"
+#include "MemX.h"
+
+/* Webstreams are fetched by a local proxy: the upstream-task reads the stream into a ringbuffer in PSRAM,
+   the serve-task feeds the audio-lib (which is connected to http://127.0.0.1:<webStreamProxyPort>/) from it.
+   If upstream is lost, playback continues from the buffer while the upstream-task reconnects (with backoff).
+   ICY-metadata is stripped by the proxy; so data of different connections can be concatenated seamlessly. */
+
+#ifdef WEBSTREAM_BUFFER_ENABLE
+    #define WEBSTREAM_STATE_IDLE            0u
+    #define WEBSTREAM_STATE_CONNECTING      1u
+    #define WEBSTREAM_STATE_STREAMING       2u
+    #define WEBSTREAM_STATE_RECONNECTING    3u
+    #define WEBSTREAM_STATE_FAILED          4u
+
+    #define WEBSTREAM_MAX_REDIRECTS         3u
+    #define WEBSTREAM_CHUNK_SIZE            1024u
+    #define WEBSTREAM_MAX_CONTENT_TYPE      32u
+    #define WEBSTREAM_UPSTREAM_STACK        10240u  // TLS-handshake (WiFiClientSecure) needs ~7 KB, plus chunk-buffer; refer stats.stackFree
+
+    typedef struct {
+        char *url;                                  // NULL => stop
+        uint32_t id;
+    } webStreamRequest;
+
+    static webStreamStats WebStream_Stats = {0, 0, 0, 0, 0, 0};
+    static QueueHandle_t WebStream_RequestQueue;
+    static uint32_t WebStream_RequestId = 0;        // Only used by caller of WebStream_Start()/_Stop()
+    static volatile uint32_t WebStream_Session = 0; // Id of the request the upstream-task is working on
+    static volatile uint8_t WebStream_State = WEBSTREAM_STATE_IDLE;
+    static char WebStream_ContentType[WEBSTREAM_MAX_CONTENT_TYPE] = "audio/mpeg";
+
+    // Ringbuffer (single producer: upstream-task, single consumer: serve-task). Data is copied outside of the
+    // critical section; positions/fill are only changed inside. Consumer drops its update if session changed meanwhile.
+    static uint8_t *WebStream_Buffer = NULL;
+    static uint32_t WebStream_ReadPos = 0;
+    static uint32_t WebStream_WritePos = 0;
+    static uint32_t WebStream_Fill = 0;
+    static portMUX_TYPE WebStream_BufferMux = portMUX_INITIALIZER_UNLOCKED;
+
+    // ICY-metadata-parser (upstream-task)
+    static uint32_t WebStream_MetaInt = 0;
+    static uint32_t WebStream_BytesUntilMeta = 0;
+    static uint16_t WebStream_MetaRemaining = 0;
+    static uint16_t WebStream_MetaLength = 0;
+    static char WebStream_MetaData[256];
+
+    // Stream-title is handed over to the audio-task (refer WebStream_HandleTitle()) as gPlayProperties.title belongs to it
+    static char WebStream_Title[256];
+    static volatile bool WebStream_TitlePending = false;
+    static portMUX_TYPE WebStream_TitleMux = portMUX_INITIALIZER_UNLOCKED;
+
+    static void WebStream_UpstreamTask(void *parameter);
+    static void WebStream_ServeTask(void *parameter);
+    static bool WebStream_Connect(WiFiClient **_client, char **_url);
+    static bool WebStream_ReadLine(WiFiClient *_client, char *_buf, const size_t _size, const uint32_t _deadline);
+    static bool WebStream_ParseUrl(const char *_url, bool *_secure, char *_host, const size_t _hostSize, uint16_t *_port, const char **_path);
+    static void WebStream_ProcessData(const uint8_t *_data, const size_t _length);
+    static void WebStream_PutData(const uint8_t *_data, const size_t _length);
+    static void WebStream_HandleMetaData(void);
+    static uint32_t WebStream_GetFill(void);
+    static void WebStream_ResetBuffer(const uint32_t _session);
+#endif
+
+void WebStream_Init(void) {
+    #ifdef WEBSTREAM_BUFFER_ENABLE
+        if (!psramFound()) {
+            return;
+        }
+        WebStream_Buffer = (uint8_t *) ps_malloc(webStreamBufferSize);
+        WebStream_RequestQueue = xQueueCreate(2, sizeof(webStreamRequest));
+        if (WebStream_Buffer == NULL || WebStream_RequestQueue == NULL) {
+            free(WebStream_Buffer);
+            WebStream_Buffer = NULL;
+            Log_Println((char *) FPSTR(webStreamInitFailed), LOGLEVEL_ERROR);
+            return;
+        }
+
+        xTaskCreatePinnedToCore(
+            WebStream_UpstreamTask, /* Function to implement the task */
+            "webStreamUp",          /* Name of the task */
+            WEBSTREAM_UPSTREAM_STACK, /* Stack size in words */
+            NULL,                   /* Task input parameter */
+            1,                      /* Priority of the task */
+            NULL,                   /* Task handle. */
+            0                       /* Core where the task should run */
+        );
+        xTaskCreatePinnedToCore(
+            WebStream_ServeTask,    /* Function to implement the task */
+            "webStreamSrv",         /* Name of the task */
+            2560,                   /* Stack size in words */
+            NULL,                   /* Task input parameter */
+            1,                      /* Priority of the task */
+            NULL,                   /* Task handle. */
+            0                       /* Core where the task should run */
+        );
+    #endif
+}
+
+// Connects to _url via local proxy. Blocks until the response-header was received.
+// Returns false if proxy isn't available (no PSRAM, playlist-URL) or connect failed; caller should connect directly then.
+bool WebStream_Start(const char *_url, char *_localUrl, const size_t _size) {
+    #ifdef WEBSTREAM_BUFFER_ENABLE
+        if (WebStream_Buffer == NULL || endsWith(_url, ".m3u") || endsWith(_url, ".m3u8") || endsWith(_url, ".pls") || endsWith(_url, ".asx")) {
+            WebStream_Stop();
+            return false;
+        }
+
+        webStreamRequest request = {x_strdup(_url), ++WebStream_RequestId};
+        if (request.url == NULL || xQueueSend(WebStream_RequestQueue, &request, pdMS_TO_TICKS(1000)) != pdPASS) {
+            free(request.url);
+            return false;
+        }
+
+        const uint32_t startTimestamp = millis();
+        while (WebStream_Session != request.id || (WebStream_State != WEBSTREAM_STATE_STREAMING && WebStream_State != WEBSTREAM_STATE_FAILED)) {
+            if (millis() - startTimestamp > (WEBSTREAM_MAX_REDIRECTS + 1) * webStreamConnectTimeout * 2u) {
+                WebStream_Stop();
+                return false;
+            }
+            vTaskDelay(portTICK_PERIOD_MS * 10);
+        }
+        if (WebStream_State == WEBSTREAM_STATE_FAILED) {
+            return false;
+        }
+
+        snprintf(_localUrl, _size, "http://127.0.0.1:%u/", webStreamProxyPort);
+        snprintf(Log_Buffer, Log_BufferLength, "%s (%u ms)", (char *) FPSTR(webStreamBuffering), WebStream_Stats.connectLatencyMs);
+        Log_Println(Log_Buffer, LOGLEVEL_NOTICE);
+        return true;
+    #else
+        return false;
+    #endif
+}
+
+// Closes upstream and local connection (if active)
+void WebStream_Stop(void) {
+    #ifdef WEBSTREAM_BUFFER_ENABLE
+        if (WebStream_Buffer == NULL || WebStream_State == WEBSTREAM_STATE_IDLE) {
+            return;
+        }
+        webStreamRequest request = {NULL, ++WebStream_RequestId};
+        xQueueSend(WebStream_RequestQueue, &request, pdMS_TO_TICKS(1000));
+    #endif
+}
+
+const webStreamStats *WebStream_GetStats(void) {
+    #ifdef WEBSTREAM_BUFFER_ENABLE
+        WebStream_Stats.bufferFill = WebStream_Buffer ? (uint64_t) WebStream_GetFill() * 100u / webStreamBufferSize : 0;
+    #endif
+    return &WebStream_Stats;
+}
+
+// Called by audio-task: passes a stream-title received by upstream-task to audio_showstreamtitle()
+void WebStream_HandleTitle(void) {
+    #ifdef WEBSTREAM_BUFFER_ENABLE
+        if (!WebStream_TitlePending) {
+            return;
+        }
+        char title[sizeof(WebStream_Title)];
+        portENTER_CRITICAL(&WebStream_TitleMux);
+        memcpy(title, WebStream_Title, sizeof(title));
+        WebStream_TitlePending = false;
+        portEXIT_CRITICAL(&WebStream_TitleMux);
+        audio_showstreamtitle(title);
+    #endif
+}
+
+#ifdef WEBSTREAM_BUFFER_ENABLE
+// Reads upstream into buffer; reconnects with exponential backoff if connection is lost
+void WebStream_UpstreamTask(void *parameter) {
+    WiFiClient *client = NULL;
+    char *url = NULL;
+    uint32_t reconnectDelay = webStreamReconnectDelayMin;
+    uint32_t nextConnectTimestamp = 0;
+    uint32_t lastDataTimestamp = 0;
+    uint8_t chunk[WEBSTREAM_CHUNK_SIZE];
+    webStreamRequest request;
+
+    for (;;) {
+        if (xQueueReceive(WebStream_RequestQueue, &request, 0) == pdPASS) {
+            if (client != NULL) {
+                client->stop();
+                client = NULL;
+            }
+            free(url);
+            url = request.url;
+            reconnectDelay = webStreamReconnectDelayMin;
+            WebStream_State = (url != NULL) ? WEBSTREAM_STATE_CONNECTING : WEBSTREAM_STATE_IDLE;
+            WebStream_ResetBuffer(request.id);
+        }
+
+        switch (WebStream_State) {
+            case WEBSTREAM_STATE_CONNECTING:
+            case WEBSTREAM_STATE_RECONNECTING: {
+                if (WebStream_State == WEBSTREAM_STATE_RECONNECTING && (int32_t) (millis() - nextConnectTimestamp) < 0) {
+                    break;
+                }
+                const uint32_t connectTimestamp = millis();
+                if (WebStream_Connect(&client, &url)) {
+                    WebStream_Stats.connects++;
+                    WebStream_Stats.connectLatencyMs = millis() - connectTimestamp;
+                    if (WebStream_State == WEBSTREAM_STATE_RECONNECTING) {
+                        snprintf(Log_Buffer, Log_BufferLength, "%s (%u ms)", (char *) FPSTR(webStreamReconnected), WebStream_Stats.connectLatencyMs);
+                        Log_Println(Log_Buffer, LOGLEVEL_NOTICE);
+                    }
+                    WebStream_Stats.stackFree = uxTaskGetStackHighWaterMark(NULL);    // Connect (incl. TLS-handshake) is the deepest path
+                    snprintf(Log_Buffer, Log_BufferLength, "%s: %u", (char *) FPSTR(webStreamStackFree), WebStream_Stats.stackFree);
+                    Log_Println(Log_Buffer, LOGLEVEL_DEBUG);
+                    reconnectDelay = webStreamReconnectDelayMin;
+                    lastDataTimestamp = millis();
+                    WebStream_State = WEBSTREAM_STATE_STREAMING;
+                } else if (WebStream_State == WEBSTREAM_STATE_CONNECTING) {
+                    Log_Println((char *) FPSTR(webStreamConnectFailed), LOGLEVEL_ERROR);
+                    WebStream_State = WEBSTREAM_STATE_FAILED;      // Initial connect failed => caller connects directly
+                } else {
+                    nextConnectTimestamp = millis() + reconnectDelay;
+                    reconnectDelay = std::min(reconnectDelay * 2u, webStreamReconnectDelayMax);
+                }
+                break;
+            }
+
+            case WEBSTREAM_STATE_STREAMING: {
+                const uint32_t space = webStreamBufferSize - WebStream_GetFill();
+                const int available = client->available();
+                if (available > 0 && space > 0) {
+                    const int length = client->read(chunk, std::min((uint32_t) available, std::min(space, (uint32_t) sizeof(chunk))));
+                    if (length > 0) {
+                        WebStream_ProcessData(chunk, length);
+                        lastDataTimestamp = millis();
+                    }
+                    continue;   // Read as long as there's data
+                }
+                if (!space) {
+                    lastDataTimestamp = millis();   // Decoder is slower than upstream; that's not a timeout
+                } else if (!client->connected() || millis() - lastDataTimestamp > webStreamDataTimeout) {
+                    client->stop();
+                    client = NULL;
+                    WebStream_Stats.reconnects++;
+                    snprintf(Log_Buffer, Log_BufferLength, "%s (%u %%)", (char *) FPSTR(webStreamReconnecting), WebStream_GetStats()->bufferFill);
+                    Log_Println(Log_Buffer, LOGLEVEL_NOTICE);
+                    nextConnectTimestamp = millis() + reconnectDelay;
+                    WebStream_State = WEBSTREAM_STATE_RECONNECTING;
+                }
+                break;
+            }
+
+            default:
+                break;
+        }
+        vTaskDelay(portTICK_PERIOD_MS * 5);
+    }
+    vTaskDelete(NULL);
+}
+
+// Feeds the audio-lib from buffer. Starts (again) after buffer is filled up to webStreamPrebufferSize.
+void WebStream_ServeTask(void *parameter) {
+    WiFiServer server(webStreamProxyPort);
+    WiFiClient localClient;
+    bool serverStarted = false;
+    bool serving = false;
+    uint32_t session = 0;
+
+    for (;;) {
+        if (session != WebStream_Session) {
+            localClient.stop();
+            serving = false;
+            session = WebStream_Session;
+        }
+        if (WebStream_State == WEBSTREAM_STATE_IDLE || WebStream_State == WEBSTREAM_STATE_FAILED || WebStream_State == WEBSTREAM_STATE_CONNECTING) {
+            vTaskDelay(portTICK_PERIOD_MS * 20);
+            continue;
+        }
+        if (!serverStarted) {
+            server.begin();
+            server.setNoDelay(true);
+            serverStarted = true;
+        }
+
+        if (!localClient.connected()) {
+            localClient = server.available();
+            if (!localClient) {
+                vTaskDelay(portTICK_PERIOD_MS * 10);
+                continue;
+            }
+            if (!(localClient.remoteIP() == IPAddress(127, 0, 0, 1))) {   // Proxy is only meant for the audio-lib
+                localClient.stop();
+                continue;
+            }
+            char line[128];
+            const uint32_t deadline = millis() + 1000u;
+            while (WebStream_ReadLine(&localClient, line, sizeof(line), deadline) && line[0]) {     // Skip request
+            }
+            localClient.printf("HTTP/1.0 200 OK\r\nContent-Type: %s\r\nConnection: close\r\n\r\n", WebStream_ContentType);
+            serving = false;
+        }
+
+        const uint32_t fill = WebStream_GetFill();
+        if (!serving) {
+            if (fill < std::min(webStreamPrebufferSize, webStreamBufferSize / 2)) {
+                vTaskDelay(portTICK_PERIOD_MS * 10);
+                continue;
+            }
+            serving = true;
+        } else if (!fill) {
+            serving = false;
+            WebStream_Stats.rebuffers++;
+            Log_Println((char *) FPSTR(webStreamRebuffering), LOGLEVEL_NOTICE);
+            continue;
+        }
+
+        const uint32_t length = std::min(std::min(fill, webStreamBufferSize - WebStream_ReadPos), (uint32_t) WEBSTREAM_CHUNK_SIZE);
+        const size_t written = localClient.write(WebStream_Buffer + WebStream_ReadPos, length);
+        portENTER_CRITICAL(&WebStream_BufferMux);
+        if (session == WebStream_Session) {
+            WebStream_ReadPos = (WebStream_ReadPos + written) % webStreamBufferSize;
+            WebStream_Fill -= written;
+        }
+        portEXIT_CRITICAL(&WebStream_BufferMux);
+        if (written < length) {
+            vTaskDelay(portTICK_PERIOD_MS * 5);     // Audio-lib's input-buffer is full
+        }
+    }
+    vTaskDelete(NULL);
+}
+
+// Connects to upstream (following redirects) and parses response-header
+bool WebStream_Connect(WiFiClient **_client, char **_url) {
+    static WiFiClient plainClient;
+    static WiFiClientSecure secureClient;
+    char host[64];
+    char line[256];
+
+    for (uint8_t redirects = 0; redirects <= WEBSTREAM_MAX_REDIRECTS; redirects++) {
+        bool secure;
+        uint16_t port;
+        const char *path;
+        if (!WebStream_ParseUrl(*_url, &secure, host, sizeof(host), &port, &path)) {
+            return false;
+        }
+
+        WiFiClient *client = secure ? &secureClient : &plainClient;
+        if (secure) {
+            secureClient.setInsecure();
+        }
+        if (!client->connect(host, port, webStreamConnectTimeout)) {
+            return false;
+        }
+        client->printf("GET %s HTTP/1.0\r\nHost: %s\r\nIcy-MetaData: 1\r\nUser-Agent: ESPuino\r\nConnection: close\r\n\r\n", path, host);
+
+        const uint32_t deadline = millis() + webStreamConnectTimeout;
+        if (!WebStream_ReadLine(client, line, sizeof(line), deadline)) {
+            client->stop();
+            return false;
+        }
+        const char *status = strchr(line, ' ');
+        const uint16_t statusCode = status ? atoi(status + 1) : 0;
+
+        char *location = NULL;
+        WebStream_MetaInt = 0;
+        while (WebStream_ReadLine(client, line, sizeof(line), deadline) && line[0]) {
+            if (!strncasecmp(line, "content-type:", 13)) {
+                strncpy(WebStream_ContentType, line + 13 + strspn(line + 13, " "), sizeof(WebStream_ContentType) - 1);
+            } else if (!strncasecmp(line, "icy-metaint:", 12)) {
+                WebStream_MetaInt = atoi(line + 12);
+            } else if (!strncasecmp(line, "location:", 9) && location == NULL) {
+                location = x_strdup(line + 9 + strspn(line + 9, " "));
+            }
+        }
+
+        if (statusCode >= 300 && statusCode < 400 && location != NULL) {
+            client->stop();
+            free(*_url);
+            *_url = location;
+            continue;
+        }
+        free(location);
+        if (statusCode != 200) {
+            client->stop();
+            return false;
+        }
+
+        WebStream_BytesUntilMeta = WebStream_MetaInt;
+        WebStream_MetaRemaining = 0;
+        *_client = client;
+        return true;
+    }
+    return false;
+}
+
+// Reads a line of the HTTP-header (without CR/LF). Returns false on timeout.
+bool WebStream_ReadLine(WiFiClient *_client, char *_buf, const size_t _size, const uint32_t _deadline) {
+    size_t length = 0;
+    while ((int32_t) (millis() - _deadline) < 0) {
+        if (!_client->available()) {
+            if (!_client->connected()) {
+                return false;
+            }
+            vTaskDelay(portTICK_PERIOD_MS * 5);
+            continue;
+        }
+        const char c = _client->read();
+        if (c == '\n') {
+            _buf[length] = '\0';
+            return true;
+        } else if (c != '\r' && length < _size - 1) {
+            _buf[length++] = c;
+        }
+    }
+    return false;
+}
+
+bool WebStream_ParseUrl(const char *_url, bool *_secure, char *_host, const size_t _hostSize, uint16_t *_port, const char **_path) {
+    if (!strncasecmp(_url, "https://", 8)) {
+        *_secure = true;
+        *_port = 443;
+        _url += 8;
+    } else if (!strncasecmp(_url, "http://", 7)) {
+        *_secure = false;
+        *_port = 80;
+        _url += 7;
+    } else {
+        return false;
+    }
+
+    const char *path = strchr(_url, '/');
+    *_path = path ? path : "/";
+    const size_t hostLength = path ? (size_t) (path - _url) : strlen(_url);
+    if (!hostLength || hostLength >= _hostSize) {
+        return false;
+    }
+    memcpy(_host, _url, hostLength);
+    _host[hostLength] = '\0';
+
+    char *port = strchr(_host, ':');
+    if (port != NULL) {
+        *port = '\0';
+        *_port = atoi(port + 1);
+    }
+    return true;
+}
+
+// Strips ICY-metadata (every icy-metaint bytes: length-byte * 16 + metadata) and stores audio-data
+void WebStream_ProcessData(const uint8_t *_data, const size_t _length) {
+    size_t pos = 0;
+    while (pos < _length) {
+        if (!WebStream_MetaInt) {
+            WebStream_PutData(_data + pos, _length - pos);
+            return;
+        }
+        if (WebStream_MetaRemaining) {
+            const size_t length = std::min((size_t) WebStream_MetaRemaining, _length - pos);
+            for (size_t i = 0; i < length; i++) {
+                if (WebStream_MetaLength < sizeof(WebStream_MetaData) - 1) {
+                    WebStream_MetaData[WebStream_MetaLength++] = _data[pos + i];
+                }
+            }
+            pos += length;
+            WebStream_MetaRemaining -= length;
+            if (!WebStream_MetaRemaining) {
+                WebStream_HandleMetaData();
+                WebStream_BytesUntilMeta = WebStream_MetaInt;
+            }
+        } else if (!WebStream_BytesUntilMeta) {
+            WebStream_MetaRemaining = _data[pos++] * 16u;
+            WebStream_MetaLength = 0;
+            if (!WebStream_MetaRemaining) {
+                WebStream_BytesUntilMeta = WebStream_MetaInt;
+            }
+        } else {
+            const size_t length = std::min((size_t) WebStream_BytesUntilMeta, _length - pos);
+            WebStream_PutData(_data + pos, length);
+            WebStream_BytesUntilMeta -= length;
+            pos += length;
+        }
+    }
+}
+
+void WebStream_PutData(const uint8_t *_data, const size_t _length) {
+    const size_t firstPart = std::min(_length, (size_t) (webStreamBufferSize - WebStream_WritePos));
+    memcpy(WebStream_Buffer + WebStream_WritePos, _data, firstPart);
+    memcpy(WebStream_Buffer, _data + firstPart, _length - firstPart);
+    WebStream_WritePos = (WebStream_WritePos + _length) % webStreamBufferSize;
+    portENTER_CRITICAL(&WebStream_BufferMux);
+    WebStream_Fill += _length;
+    portEXIT_CRITICAL(&WebStream_BufferMux);
+}
+
+// Metadata looks like "StreamTitle='Artist - Title';StreamUrl='';"
+void WebStream_HandleMetaData(void) {
+    WebStream_MetaData[WebStream_MetaLength] = '\0';
+    char *title = strstr(WebStream_MetaData, "StreamTitle='");
+    if (title == NULL) {
+        return;
+    }
+    title += 13;
+    char *end = strstr(title, "';");
+    if (end != NULL) {
+        *end = '\0';
+    }
+    portENTER_CRITICAL(&WebStream_TitleMux);
+    strncpy(WebStream_Title, title, sizeof(WebStream_Title) - 1);
+    WebStream_Title[sizeof(WebStream_Title) - 1] = '\0';
+    WebStream_TitlePending = true;
+    portEXIT_CRITICAL(&WebStream_TitleMux);
+}
+
+uint32_t WebStream_GetFill(void) {
+    portENTER_CRITICAL(&WebStream_BufferMux);
+    const uint32_t fill = WebStream_Fill;
+    portEXIT_CRITICAL(&WebStream_BufferMux);
+    return fill;
+}
+
+// Empties buffer for a new session. Done atomically, so the serve-task can't consume data of the previous session from the emptied buffer.
+void WebStream_ResetBuffer(const uint32_t _session) {
+    portENTER_CRITICAL(&WebStream_BufferMux);
+    WebStream_Session = _session;
+    WebStream_ReadPos = 0;
+    WebStream_WritePos = 0;
+    WebStream_Fill = 0;
+    portEXIT_CRITICAL(&WebStream_BufferMux);
+}
+#endif
@@ -0,0 +1,16 @@
+#pragma once
+
+typedef struct {
+    uint32_t connects;                          // Successful connections to upstream (incl. reconnects)
+    uint32_t reconnects;                        // Connections lost while streaming
+    uint32_t rebuffers;                         // Buffer ran empty while feeding the decoder
+    uint32_t connectLatencyMs;                  // Duration of last connect (until response-header was received)
+    uint8_t bufferFill;                         // Fill-level of the buffer (in %)
+    uint32_t stackFree;                         // Min. free stack of upstream-task (in bytes; measured after connect)
+} webStreamStats;
+
+void WebStream_Init(void);
+bool WebStream_Start(const char *_url, char *_localUrl, const size_t _size);
+void WebStream_Stop(void);
+const webStreamStats *WebStream_GetStats(void);
+void WebStream_HandleTitle(void);
@@ -123,6 +123,9 @@ void Wlan_ToggleEnable(void) {
 }
 
 String Wlan_GetIpAddress(void) {
+    if (accessPointStarted) {
+        return WiFi.softAPIP().toString();
+    }
     return WiFi.localIP().toString();
 }
 
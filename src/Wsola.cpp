@@ -0,0 +1,139 @@
+#include <math.h>
+#include <string.h>
+#include "Wsola.h"
+
+#define WSOLA_SKIP_SHIFT                16u     // Fraction of skipped input-frames is accumulated as Q16
+
+static void Wsola_ProcessSequence(wsolaState *_state);
+static void Wsola_Finish(wsolaState *_state);
+static uint16_t Wsola_Seek(wsolaState *_state);
+static void Wsola_Crossfade(wsolaState *_state, const uint16_t _offset);
+static void Wsola_StoreOverlap(wsolaState *_state, const uint32_t _start);
+static inline int16_t Wsola_Mono(const uint32_t _frame);
+
+// Buffers of _state have to be set up already (refer wsolaState)
+void Wsola_Start(wsolaState *_state, const uint16_t _sequenceFrames, const uint16_t _seekFrames, const uint16_t _overlapFrames) {
+    _state->sequenceFrames = _sequenceFrames;
+    _state->seekFrames = _seekFrames;
+    _state->overlapFrames = _overlapFrames;
+    _state->inputFrames = 0;
+    _state->skipFraction = 0;
+    _state->speed = WSOLA_SPEED_NORMAL;
+    _state->firstSequence = true;
+    _state->active = true;
+}
+
+// Input is collected until it covers the search-window and the frames to be skipped
+void Wsola_Push(wsolaState *_state, const uint32_t _frame, const uint8_t _speed) {
+    _state->input[_state->inputFrames++] = _frame;
+    if (_state->firstSequence) {
+        _state->speed = _speed;
+    }
+
+    const uint32_t skip = (((uint32_t) _state->speed << WSOLA_SKIP_SHIFT) / 100u) * (_state->sequenceFrames - _state->overlapFrames) + _state->skipFraction;
+    const uint32_t skipFrames = skip >> WSOLA_SKIP_SHIFT;
+    const uint32_t seekEnd = _state->sequenceFrames + _state->seekFrames;
+    if (_state->inputFrames < (seekEnd > skipFrames ? seekEnd : skipFrames + 1u)) {
+        return;
+    }
+
+    if (!_state->firstSequence && _speed == WSOLA_SPEED_NORMAL) {
+        Wsola_Finish(_state);
+        return;
+    }
+    Wsola_ProcessSequence(_state);
+
+    _state->skipFraction = skip & ((1u << WSOLA_SKIP_SHIFT) - 1);
+    _state->inputFrames -= skipFrames;
+    memmove(_state->input, _state->input + skipFrames, _state->inputFrames * sizeof(uint32_t));
+    _state->speed = _speed;     // Skip of the next sequence
+}
+
+// Outputs (sequence - overlap) frames: crossfade at the best-fitting position followed by the middle of the sequence
+void Wsola_ProcessSequence(wsolaState *_state) {
+    uint16_t offset = 0;
+    if (_state->firstSequence) {
+        for (uint16_t i = 0; i < _state->overlapFrames; i++) {
+            _state->output(_state->input[i]);
+        }
+        _state->firstSequence = false;
+    } else {
+        offset = Wsola_Seek(_state);
+        Wsola_Crossfade(_state, offset);
+    }
+
+    const uint32_t end = offset + _state->sequenceFrames - _state->overlapFrames;
+    for (uint32_t i = offset + _state->overlapFrames; i < end; i++) {
+        _state->output(_state->input[i]);
+    }
+    Wsola_StoreOverlap(_state, end);
+}
+
+// Back to normal speed: last splice is placed as usual, afterwards the remaining input continues without any gap
+void Wsola_Finish(wsolaState *_state) {
+    const uint16_t offset = Wsola_Seek(_state);
+    Wsola_Crossfade(_state, offset);
+    for (uint32_t i = offset + _state->overlapFrames; i < _state->inputFrames; i++) {
+        _state->output(_state->input[i]);
+    }
+    _state->inputFrames = 0;
+    _state->active = false;
+}
+
+// Returns offset (0..seekFrames) whose waveform correlates best with the stored overlap.
+// Coarse search (every 2nd offset, every 4th frame) is refined around the best candidate.
+uint16_t Wsola_Seek(wsolaState *_state) {
+    const uint16_t overlapFrames = _state->overlapFrames;
+    for (uint32_t i = 0; i < (uint32_t) _state->seekFrames + overlapFrames; i++) {
+        _state->seekMono[i] = Wsola_Mono(_state->input[i]);
+    }
+
+    uint16_t bestOffset = 0;
+    for (uint8_t pass = 0; pass < 2; pass++) {
+        float bestScore = -1e30f;
+        const uint16_t first = (pass && bestOffset) ? bestOffset - 1 : 0;
+        const uint16_t last = pass ? (bestOffset < _state->seekFrames ? bestOffset + 1 : _state->seekFrames) : _state->seekFrames;
+        const uint8_t offsetStep = pass ? 1 : 2;
+        const uint8_t frameStep = pass ? 2 : 4;
+
+        for (uint16_t offset = first; offset <= last; offset += offsetStep) {
+            const int16_t *candidate = &_state->seekMono[offset];
+            int32_t cross = 0;
+            int32_t norm = 0;
+            for (uint16_t i = 0; i < overlapFrames; i += frameStep) {
+                cross += _state->overlapMono[i] * candidate[i];
+                norm += candidate[i] * candidate[i];
+            }
+            const float score = cross / sqrtf(norm + 1.0f);
+            if (score > bestScore) {
+                bestScore = score;
+                bestOffset = offset;
+            }
+        }
+    }
+    return bestOffset;
+}
+
+// Fades out tail of the previous sequence while fading in the input at offset
+void Wsola_Crossfade(wsolaState *_state, const uint16_t _offset) {
+    const int32_t overlapFrames = _state->overlapFrames;
+    for (int32_t i = 0; i < overlapFrames; i++) {
+        const uint32_t a = _state->overlap[i];
+        const uint32_t b = _state->input[_offset + i];
+        const int32_t left = ((int16_t) (a & 0xFFFF) * (overlapFrames - i) + (int16_t) (b & 0xFFFF) * i) / overlapFrames;
+        const int32_t right = ((int16_t) (a >> 16) * (overlapFrames - i) + (int16_t) (b >> 16) * i) / overlapFrames;
+        _state->output(((uint32_t) (uint16_t) right << 16) | (uint16_t) left);
+    }
+}
+
+void Wsola_StoreOverlap(wsolaState *_state, const uint32_t _start) {
+    memcpy(_state->overlap, &_state->input[_start], _state->overlapFrames * sizeof(uint32_t));
+    for (uint16_t i = 0; i < _state->overlapFrames; i++) {
+        _state->overlapMono[i] = Wsola_Mono(_state->overlap[i]);
+    }
+}
+
+// Downmix with 12 bit; so sums over the overlap can't overflow int32
+inline int16_t Wsola_Mono(const uint32_t _frame) {
+    return ((int16_t) (_frame & 0xFFFF) + (int16_t) (_frame >> 16)) >> 5;
+}
@@ -0,0 +1,33 @@
+#pragma once
+#include <stdint.h>
+
+/* Time-stretching (WSOLA): input is cut into sequences that overlap by overlapFrames.
+   Per sequence (speed/100) * (sequence - overlap) input-frames are consumed but (sequence - overlap) frames are output; so speed
+   changes but pitch doesn't. Every splice is shifted by up to seekFrames to the position where the waveform fits best
+   to the end of the previous sequence (normalized cross-correlation of a mono-downmix); so there's neither a click nor a phasing.
+   All processing is integer except one sqrtf() per candidate. Doesn't depend on Arduino; so it's covered by the native unit-tests. */
+
+#define WSOLA_SPEED_NORMAL              100u                                        // Speed in percent
+#define WSOLA_INPUT_FRAMES(_sequenceFrames, _seekFrames)    (2u * (_sequenceFrames) + (_seekFrames) + 1u)   // Max. skip (200 %) is less than 2 sequences
+
+typedef void (*wsolaOutput)(const uint32_t _frame);
+
+// Buffers are provided by the caller: input (WSOLA_INPUT_FRAMES), overlap + overlapMono (overlapFrames), seekMono (seekFrames + overlapFrames)
+typedef struct {
+    uint32_t *input;                    // Stereo-frames (right << 16 | left) that weren't processed yet
+    uint32_t inputFrames;
+    uint32_t *overlap;                  // Tail of the previous sequence; faded out with the next one
+    int16_t *overlapMono;
+    int16_t *seekMono;                  // Mono-downmix of input used for seeking
+    uint16_t sequenceFrames;
+    uint16_t seekFrames;
+    uint16_t overlapFrames;
+    uint32_t skipFraction;              // Accumulated fraction of input-frames to be skipped (Q16)
+    uint8_t speed;                      // Speed of the current sequence; changes are applied at sequence-boundary
+    bool active;                        // false => back at normal speed; remaining input was output
+    bool firstSequence;                 // First sequence after activation is output without crossfade (continues pass-through)
+    wsolaOutput output;
+} wsolaState;
+
+void Wsola_Start(wsolaState *_state, const uint16_t _sequenceFrames, const uint16_t _seekFrames, const uint16_t _overlapFrames);
+void Wsola_Push(wsolaState *_state, const uint32_t _frame, const uint8_t _speed);
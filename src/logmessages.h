@@ -55,6 +55,7 @@ extern const char rfidTagReceived[];
 extern const char rfidTagUnknownInNvs[];
 extern const char goToSleepDueToIdle[];
 extern const char goToSleepDueToTimer[];
+extern const char sleepTimerFadeOut[];
 extern const char goToSleepNow[];
 extern const char maxLoudnessReached[];
 extern const char minLoudnessReached[];
@@ -162,6 +163,23 @@ extern const char failedOpenFileForWrite[];
 extern const char fileWritten[];
 extern const char writeFailed[];
 extern const char writingFile[];
+extern const char uploadStalled[];
+extern const char uploadFinished[];
+extern const char uploadInitFailed[];
+extern const char uploadAborted[];
+extern const char uploadWriterBusy[];
+extern const char archiveInitFailed[];
+extern const char archiveExtracting[];
+extern const char archiveExtracted[];
+extern const char archiveInvalid[];
+extern const char archiveEntrySkipped[];
+extern const char settingsInvalid[];
+extern const char settingsWriteError[];
+extern const char settingsSaved[];
+extern const char backupImportInvalid[];
+extern const char backupImportNoSpace[];
+extern const char backupImportFailed[];
+extern const char backupImportFinished[];
 extern const char failedToOpenFileForAppending[];
 extern const char listingDirectory[];
 extern const char failedToOpenDirectory[];
@@ -206,4 +224,40 @@ extern const char otaNotSupportedWebsite[];
 extern const char noPlaylist[];
 extern const char rfidTagRemoved[];
 extern const char rfidTagReapplied[];
+extern const char unableToCreateSeekTableQ[];
+extern const char seekTableCreated[];
+extern const char seekTableCreationFailed[];
+extern const char seekTableCreationQueued[];
+extern const char seekTableLoaded[];
+extern const char seekTableUsingToc[];
+extern const char audioUnderrunDetected[];
+extern const char audioInputBufferEnlarged[];
+extern const char audioLoadReductionActive[];
+extern const char audioLoadReductionInactive[];
+extern const char eqFiltersActivated[];
+extern const char eqFilterInvalid[];
+extern const char replayGainFromTag[];
+extern const char replayGainFromMeasurement[];
+extern const char replayGainMeasuring[];
+extern const char replayGainWebstream[];
+extern const char loudnessMeasured[];
+extern const char resamplerActive[];
+extern const char webStreamInitFailed[];
+extern const char webStreamBuffering[];
+extern const char webStreamConnectFailed[];
+extern const char webStreamReconnecting[];
+extern const char webStreamReconnected[];
+extern const char webStreamRebuffering[];
+extern const char webStreamStackFree[];
+extern const char coverImageCached[];
+extern const char coverImageCacheFailed[];
+extern const char unableToCreateAnnounceQ[];
+extern const char announceClipMissing[];
+extern const char announceClipInvalid[];
+extern const char uiSoundsLoaded[];
+extern const char playbackSpeedChanged[];
+extern const char pcmFastPathActive[];
+extern const char pcmFastPathFinished[];
+extern const char ledSpectrumOn[];
+extern const char ledSpectrumOff[];
 extern const char unableToTellIpAddress[];
\ No newline at end of file
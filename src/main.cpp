@@ -4,6 +4,7 @@
 #include "settings.h" // Contains all user-relevant settings (general)
 
 #include "AudioPlayer.h"
+#include "AudioStats.h"
 #include "Battery.h"
 #include "Bluetooth.h"
 #include "Button.h"
@@ -20,6 +21,7 @@
 #include "Rfid.h"
 #include "RotaryEncoder.h"
 #include "SdCard.h"
+#include "Spectrum.h"
 #include "System.h"
 #include "Web.h"
 #include "Wlan.h"
@@ -261,9 +263,11 @@ void loop() {
         Ftp_Cyclic();
         RotaryEncoder_Cyclic();
         Mqtt_Cyclic();
+        AudioStats_Cyclic();
     }
 
     AudioPlayer_Cyclic();
+    Spectrum_Cyclic();
     Battery_Cyclic();
     //Port_Cyclic(); // called by button (controlled via hw-timer)
     Button_Cyclic();
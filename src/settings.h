@@ -48,6 +48,17 @@
     //#define PAUSE_WHEN_RFID_REMOVED       // Playback starts when card is applied and pauses automatically, when card is removed (https://forum.espuino.de/t/neues-feature-pausieren-wenn-rfid-karte-entfernt-wurde/541)
     //#define SAVE_PLAYPOS_BEFORE_SHUTDOWN  // When playback is active and mode audiobook was selected, last play-position is saved automatically when shutdown is initiated
     //#define SAVE_PLAYPOS_WHEN_RFID_CHANGE // When playback is active and mode audiobook was selected, last play-position is saved automatically for old playlist when new RFID-tag is applied
+    //#define SEEKTABLE_ENABLE              // Creates a frame-index (sidecar-file) for mp3-files in order to seek/resume frame-accurate and fast in long audiobooks
+    //#define REPLAYGAIN_ENABLE             // Normalizes loudness of tracks (via ReplayGain-tag or loudness measured at first playback) and limits webstreams
+    //#define EQUALIZER_ENABLE              // Applies a cascade of biquad-filters (separately configurable for speaker and headphone) to audio-output. Replaces bass-boost for mono-speaker.
+    //#define RESAMPLER_ENABLE              // Resamples all tracks/streams to resamplerOutputRate; so I2S/DAC always run with the same clock (avoids glitches of some DACs when sample rate changes)
+    #define WEBSTREAM_BUFFER_ENABLE         // Buffers webstreams in PSRAM and reconnects automatically if connection is lost (only used if PSRAM is available)
+    #define ANNOUNCE_ENABLE                 // Announces IP-address, battery-level and sleep-timer offline via pre-recorded clips from SD (only used if PSRAM is available)
+    #define UISOUND_ENABLE                  // Mixes short feedback-sounds (clicks/chimes from SD) into playback for button-presses, RFID-cards etc.
+    #define PCM_FASTPATH_ENABLE             // Plays WAV-files (16 bit PCM) without audio-lib: blocks are read from SD and written to I2S directly (saves CPU-time and power)
+    #define TIMESTRETCH_ENABLE              // Playback-speed (0.5x..2.0x) without changing pitch (e.g. for audiobooks); speed is stored per RFID-tag with the last play-position
+    #define SPECTRUM_ENABLE                 // Octave-band levels of playback for Neopixel (toggled via CMD_TOGGLE_LED_SPECTRUM) and webgui
+    //#define WEBSOCKET_BINARY_ENABLE       // Sends spectrum to webgui as binary websocket-frame (9 instead of ~50 bytes); external clients need to handle binary frames
 
 
     //################## select SD card mode #############################
@@ -170,8 +181,11 @@
     constexpr const char nameBluetoothDevice[] PROGMEM = "ESPuino";        // Name of your ESPuino as Bluetooth-device
 
     // Where to store the backup-file for NVS-records
-    constexpr const char backupFile[] PROGMEM = "/backup.txt"; // File is written every time a (new) RFID-assignment via GUI is done
+    constexpr const char backupFile[] PROGMEM = "/backup.txt"; // Every (new) RFID-assignment via GUI is appended; compacted from time to time
     constexpr const char playlistCacheFile[] PROGMEM = "playlistcache.csv"; // Filename that is used for caching playlists
+    constexpr const char coverCacheDirectory[] PROGMEM = "/.coverCache"; // Cover-images (extracted from ID3-tags) are cached here for the webgui
+    constexpr uint16_t coverCacheMaxFiles = 100;                    // If cache holds this number of images, it's cleared
+    constexpr uint16_t coverCacheCopyBufferSize = 4096;             // Size of the buffer used to extract cover-images (in bytes)
 
     //#################### Settings for optional Modules##############################
     // (optinal) Neopixel
@@ -195,6 +209,142 @@
     // Seekmode-configuration
     constexpr uint8_t jumpOffset = 30;                            // Offset in seconds to jump for commands CMD_SEEK_FORWARDS / CMD_SEEK_BACKWARDS
 
+    // (optional) Seek-table for mp3-files (leave unchanged if in doubts...)
+    #ifdef SEEKTABLE_ENABLE
+        constexpr const char seekTableFileSuffix[] PROGMEM = ".idx"; // Suffix of the sidecar-file that is stored next to the mp3-file
+        constexpr uint8_t seekTableFramesPerEntry = 32;          // Every n-th frame-offset is stored (32 frames are ~0.8s @44.1 kHz)
+        constexpr uint16_t seekTableReadBufferSize = 4096;        // Size of the buffer used to scan mp3-files (in bytes)
+        constexpr uint32_t seekTableMaxResyncLength = 65536;      // Max. number of bytes that are searched for the next valid frame-header
+    #endif
+
+    // (optional) Equalizer: up to 6 filters per output. Each filter: {type, frequency (Hz), Q, gain (dB; only for peak/shelf)}
+    // Types: EQ_FILTER_NONE, EQ_FILTER_HIGHPASS, EQ_FILTER_LOWPASS, EQ_FILTER_PEAK, EQ_FILTER_LOWSHELF, EQ_FILTER_HIGHSHELF
+    #ifdef EQUALIZER_ENABLE
+        constexpr float eqSpeakerFilters[][4] = {
+            {EQ_FILTER_HIGHPASS, 120.0, 0.707, 0.0},    // Small speakers can't reproduce deep bass; removing it avoids distortion at high volume
+            {EQ_FILTER_PEAK, 250.0, 1.0, 3.0},          // Some warmth instead
+            {EQ_FILTER_PEAK, 3500.0, 1.5, -2.0}         // Tames harshness of cheap speakers
+        };
+        constexpr float eqHeadphoneFilters[][4] = {
+            {EQ_FILTER_NONE, 0.0, 0.0, 0.0}             // Headphones: no filtering
+        };
+    #endif
+
+    // (optional) Loudness-normalization
+    #ifdef REPLAYGAIN_ENABLE
+        constexpr const char replayGainFileSuffix[] PROGMEM = ".lud";  // Suffix of the sidecar-file that stores measured loudness of a track (if there's no ReplayGain-tag)
+        constexpr bool replayGainUseAlbumGain = false;            // Use album-gain instead of track-gain (keeps level-differences between tracks of an album)
+        constexpr float replayGainPreamp = 0.0;                   // Is added to every gain (in dB)
+        constexpr float replayGainTargetLoudness = -18.0;         // Tracks without tag are normalized to this loudness (in LUFS; corresponds to ReplayGain's reference)
+        constexpr float replayGainMaxGain = 12.0;                 // Max. amplification/attenuation (in dB)
+        constexpr float replayGainWebstreamGain = -6.0;           // Webstreams can't be analyzed and are usually mastered loud; fixed gain (in dB) + limiter
+        constexpr uint16_t replayGainMinMeasureTime = 30;         // Measured loudness is only stored if a track was played at least this period (in seconds)
+    #endif
+
+    // Volume-ramps (avoid clicks when volume is changed or playback is paused/stopped/skipped)
+    constexpr uint16_t volumeRampTime = 50;                       // Duration of a volume-change (in ms)
+    constexpr uint16_t fadeTimePause = 300;                       // Fade-out before pause/stop and fade-in after resume (in ms)
+    constexpr uint16_t fadeTimeTrackChange = 150;                 // Fade-out before and fade-in after manual track-change (in ms)
+    constexpr uint8_t sleepTimerFadeTime = 3;                     // Playback is faded out slowly during the last minutes of sleep-timer (in minutes)
+
+    // Channel-routing: mono-downmix (PLAY_MONO_SPEAKER), swap, balance and trim; changes are crossfaded
+    constexpr bool channelSwapSpeaker = false;                    // Swaps left and right channel
+    constexpr bool channelSwapHeadphone = false;
+    constexpr int8_t channelBalanceSpeaker = 0;                   // -100 (left only)..0 (centered)..100 (right only)
+    constexpr int8_t channelBalanceHeadphone = 0;
+    constexpr float channelTrimLeft = 0.0;                        // Gain of left channel (in dB, max. 0); e.g. to compensate speakers of different efficiency
+    constexpr float channelTrimRight = 0.0;                       // Gain of right channel (in dB, max. 0)
+    constexpr uint8_t channelRoutingRampTime = 20;                // Crossfade if routing changes, e.g. while plugging headphones (in ms)
+
+    // (optional) Resampler
+    #ifdef RESAMPLER_ENABLE
+        constexpr uint32_t resamplerOutputRate = 44100;           // Fixed rate of I2S (in Hz)
+        constexpr uint8_t resamplerTaps = 16;                     // Length of the polyphase-filter (even, 4..32); CPU-load and quality increase with length
+        constexpr float resamplerCutoff = 0.9;                    // Cutoff of the anti-aliasing filter relative to the lower Nyquist-frequency of in- and output
+    #endif
+
+    #ifdef WEBSTREAM_BUFFER_ENABLE
+        constexpr uint32_t webStreamBufferSize = 512u * 1024u;    // Size of the buffer in PSRAM (in bytes); 512 KB are ~30s @128 kbit/s
+        constexpr uint32_t webStreamPrebufferSize = 64u * 1024u;  // Playback starts (again) once buffer is filled up to this level (in bytes)
+        constexpr uint32_t webStreamConnectTimeout = 3000;        // Timeout for connect + response-header (in ms)
+        constexpr uint32_t webStreamDataTimeout = 5000;           // Connection is considered as lost if no data was received for this time (in ms)
+        constexpr uint32_t webStreamReconnectDelayMin = 500;      // Delay before first reconnect; doubled after each failed attempt (in ms)
+        constexpr uint32_t webStreamReconnectDelayMax = 30000;    // Max. delay between two reconnects (in ms)
+        constexpr uint16_t webStreamProxyPort = 8089;             // Local port the audio-lib fetches the buffered stream from
+    #endif
+
+    // Upload via web-explorer: network => ringbuffer => writer-task => SD
+    constexpr uint32_t uploadBufferSize = 256u * 1024u;           // Size of the ringbuffer in PSRAM (in bytes; power of two)
+    constexpr uint32_t uploadBufferSizeNoPsram = 16u * 1024u;     // Size of the ringbuffer if there's no PSRAM (in bytes; power of two)
+    constexpr uint32_t uploadWriteBatch = 32u * 1024u;            // SD is written in blocks of this size (in bytes; power of two). Multiple of cluster-size => writes are aligned
+    constexpr uint32_t uploadStallTimeout = 3000;                 // Max. time (in ms) one callback of async_tcp waits for SD in total; upload of a file is aborted if it runs out. Must be below task-watchdog of async_tcp (5 s)
+
+    // Websocket-push: changes of state (track, volume, statistics, ...) are collected and sent combined
+    constexpr uint8_t webPushMaxRate = 10;                        // Max. frames per second
+
+    // Download via web-explorer
+    constexpr uint16_t downloadChunkSize = 4096;                  // Max. bytes read from SD at once
+    constexpr uint16_t downloadRateWhilePlaying = 200;            // Max. rate while audio is played from SD (in kB/s)
+    constexpr uint8_t downloadMinDmaFill = 50;                    // While playing from SD, download pauses if I2S-DMA-buffer is filled less (in %)
+
+    #ifdef ANNOUNCE_ENABLE
+        // Clips (16 bit PCM WAV, all with the same sample rate): 0..9, point, ipaddress, battery, percent, sleeptimer, minutes, off
+        // Numbers can also be provided as a whole (e.g. 15.wav); otherwise they're spoken digit by digit. If folder doesn't exist, IP is told by online-TTS.
+        constexpr const char announceDirectory[] PROGMEM = "/announce";
+        constexpr uint8_t announceCrossfadeTime = 15;             // Consecutive clips are crossfaded (in ms)
+        constexpr int16_t announceSilenceThreshold = 100;         // Leading/trailing samples below this level are removed from clips (~ -50 dBFS)
+    #endif
+
+    #ifdef UISOUND_ENABLE
+        // Sounds (16 bit PCM WAV): click, ok, error, cardok, cardunknown, volumelimit. Missing files are ignored.
+        // Sounds are kept in RAM (heap if there's no PSRAM); so keep them short and use a low sample rate (e.g. 16 kHz).
+        constexpr const char uiSoundDirectory[] PROGMEM = "/uisounds";
+        constexpr float uiSoundLevel = -6.0;                      // Level of sounds relative to playback (in dB, max. 0); both follow the volume
+        constexpr uint16_t uiSoundMaxClipFrames = 8192;           // Longer sounds are truncated (in frames)
+        constexpr uint32_t uiSoundIdleSampleRate = 44100;         // I2S-rate used for sounds if nothing was played since boot
+        // Sounds are mixed into playback before the I2S-DMA-queue; so latency is its length (audio-lib: 8 x 1024 frames, ~186 ms @44.1 kHz).
+        // uiSoundLowLatency shortens it to 6 x 128 frames (~17 ms) for every I2S-driver (incl. bluetooth); that leaves less
+        // headroom against underruns (refer audio-stats). Raise the buffers if underruns occur.
+        constexpr bool uiSoundLowLatency = false;                 // Shortens I2S-DMA-queue if sounds are available
+        constexpr uint8_t uiSoundDmaBufferCount = 6;              // Number of DMA-buffers
+        constexpr uint16_t uiSoundDmaBufferLength = 128;          // Length of one DMA-buffer (in frames)
+    #endif
+
+    #ifdef PCM_FASTPATH_ENABLE
+        constexpr uint32_t pcmFastPathBlockSize = 4096;           // Bytes per SD-read/I2S-write (multiple of 512); larger => less overhead, but longer blocking
+    #endif
+
+    #ifdef TIMESTRETCH_ENABLE
+        // WSOLA: audio is cut into overlapping sequences that are repeated/skipped; every splice is placed where the waveforms match best
+        constexpr uint8_t timeStretchSequenceTime = 40;           // Length of a sequence (in ms); longer => less "stuttering", but more echo on speech
+        constexpr uint8_t timeStretchSeekTime = 15;               // Window for searching the best splice-position (in ms); CPU-load scales with it
+        constexpr uint8_t timeStretchOverlapTime = 8;             // Crossfade between two sequences (in ms)
+        constexpr uint8_t timeStretchSpeedStep = 10;              // Step of CMD_PLAYBACK_SPEED_UP/DOWN (in percent)
+    #endif
+
+    #ifdef SPECTRUM_ENABLE
+        constexpr uint8_t spectrumUpdateRate = 50;                // Analysis-windows per second
+        constexpr uint8_t spectrumDynamicRange = 48;              // Levels below -48 dBFS are shown as off (in dB)
+        constexpr uint8_t spectrumReleaseRate = 40;               // Falling speed of levels (in dB/s); rising is immediate
+        constexpr uint8_t spectrumCpuBudget = 3;                  // Max. CPU-load of analysis (in % of one core); if exceeded, input is decimated and upper bands may be dropped
+        constexpr uint8_t spectrumLedFrameRate = 30;              // Frames per second of LED-animation
+        constexpr uint16_t spectrumWebInterval = 100;             // Levels are sent to webgui in this interval if a client is connected (in ms)
+    #endif
+
+    // Volume-curve: volume is handled in fine steps (0..255); the well-known scale (0..21) is still used for MQTT, webgui and max/init-volume
+    constexpr float volumeCurveRange = 48.0;                      // Attenuation of the lowest volume-step (in dB); raise it if lowest volume is still too loud
+    constexpr uint8_t rotaryEncoderVolumeStep = 4;                // Fine steps per detent of rotary-encoder (255/21 ≈ 12 corresponds to the former behaviour)
+
+    // Audio-statistics: underrun-detection (leave unchanged if in doubts...)
+    constexpr uint16_t audioStatsDmaBufferFrames = 8192;          // Size of audio-lib's I2S-DMA-buffer in frames (8 buffers x 1024 frames); updated when I2S-driver is installed
+    constexpr uint8_t audioStatsUnderrunThreshold = 3;            // If a track reaches this number of underruns, input-buffer is enlarged (PSRAM) or LED/web-load is reduced
+    constexpr uint32_t audioStatsInputBufferDefault = 300000;     // Default-size of audio-lib's input-buffer in PSRAM (in bytes)
+    constexpr uint32_t audioStatsInputBufferMax = 1200000;        // Input-buffer is doubled up to this size (in bytes)
+    constexpr uint8_t audioStatsLoadReductionDuration = 10;       // Load-reduction ends after this period without underruns (in minutes)
+    constexpr uint8_t audioStatsPublishInterval = 10;             // Interval statistics are sent via websocket/MQTT while playing (in seconds)
+    constexpr uint8_t audioStatsLedReducedDelay = 20;             // Delay of LED-animation-loop while load-reduction is active (in ms)
+    constexpr uint16_t audioStatsWebReducedInterval = 1000;       // Min. interval of websocket-pushes (state) while load-reduction is active (in ms)
+
     // (optional) Topics for MQTT
     #ifdef MQTT_ENABLE
         constexpr uint16_t mqttRetryInterval = 60;                // Try to reconnect to MQTT-server every (n) seconds if connection is broken
@@ -208,6 +358,8 @@
         constexpr const char topicTrackControlCmnd[] PROGMEM = "Cmnd/ESPuino/TrackControl";
         constexpr const char topicLoudnessCmnd[] PROGMEM = "Cmnd/ESPuino/Loudness";
         constexpr const char topicLoudnessState[] PROGMEM = "State/ESPuino/Loudness";
+        constexpr const char topicLoudnessFineCmnd[] PROGMEM = "Cmnd/ESPuino/LoudnessFine";
+        constexpr const char topicLoudnessFineState[] PROGMEM = "State/ESPuino/LoudnessFine";
         constexpr const char topicSleepTimerCmnd[] PROGMEM = "Cmnd/ESPuino/SleepTimer";
         constexpr const char topicSleepTimerState[] PROGMEM = "State/ESPuino/SleepTimer";
         constexpr const char topicState[] PROGMEM = "State/ESPuino/State";
@@ -220,6 +372,10 @@
         constexpr const char topicLedBrightnessCmnd[] PROGMEM = "Cmnd/ESPuino/LedBrightness";
         constexpr const char topicLedBrightnessState[] PROGMEM = "State/ESPuino/LedBrightness";
         constexpr const char topicWiFiRssiState[] PROGMEM = "State/ESPuino/WifiRssi";
+        constexpr const char topicAudioStatsState[] PROGMEM = "State/ESPuino/AudioStats";
+        constexpr const char topicWebStreamStatsState[] PROGMEM = "State/ESPuino/WebStreamStats";
+        constexpr const char topicPlaybackSpeedCmnd[] PROGMEM = "Cmnd/ESPuino/PlaybackSpeed";
+        constexpr const char topicPlaybackSpeedState[] PROGMEM = "State/ESPuino/PlaybackSpeed";
         #ifdef MEASURE_BATTERY_VOLTAGE
             constexpr const char topicBatteryVoltage[] PROGMEM = "State/ESPuino/Voltage";
         #endif
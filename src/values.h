@@ -42,6 +42,7 @@
     #define CMD_REPEAT_PLAYLIST             110         // Changes active playmode to endless-loop (for a playlist)
     #define CMD_REPEAT_TRACK                111         // Changes active playmode to endless-loop (for a single track)
     #define CMD_DIMM_LEDS_NIGHTMODE         120         // Changes LED-brightness
+    #define CMD_TOGGLE_LED_SPECTRUM         121         // Toggles LED-animation while playing between progress and spectrum
     #define CMD_TOGGLE_WIFI_STATUS          130         // Toggles WiFi-status
     #define CMD_TOGGLE_BLUETOOTH_MODE       140         // Toggles Normal/Bluetooth Mode
     #define CMD_ENABLE_FTP_SERVER           150         // Enables FTP-server
@@ -59,6 +60,9 @@
     #define CMD_SLEEPMODE                   179         // Command: Go to deepsleep
     #define CMD_SEEK_FORWARDS               180         // Command: jump forwards (time period to jump (in seconds) is configured via settings.h: jumpOffset)
     #define CMD_SEEK_BACKWARDS              181         // Command: jump backwards (time period to jump (in seconds) is configured via settings.h: jumpOffset)
+    #define CMD_PLAYBACK_SPEED_DOWN         182         // Command: lower playback-speed (step is configured via settings.h: timeStretchSpeedStep)
+    #define CMD_PLAYBACK_SPEED_UP           183         // Command: raise playback-speed (step is configured via settings.h: timeStretchSpeedStep)
+    #define CMD_PLAYBACK_SPEED_NORMAL       184         // Command: reset playback-speed to 100 %
 
     // Repeat-Modes
     #define NO_REPEAT                       0           // No repeat
@@ -75,6 +79,17 @@
     #define DE                              1
     #define EN                              2
 
+    // Equalizer filter-types (refer eqSpeakerFilters / eqHeadphoneFilters in settings.h)
+    #define EQ_FILTER_NONE                  0           // Unused filter
+    #define EQ_FILTER_HIGHPASS              1           // Highpass (2nd order)
+    #define EQ_FILTER_LOWPASS               2           // Lowpass (2nd order)
+    #define EQ_FILTER_PEAK                  3           // Peaking EQ
+    #define EQ_FILTER_LOWSHELF              4           // Low shelf
+    #define EQ_FILTER_HIGHSHELF             5           // High shelf
+
     // Debug
     #define PRINT_TASK_STATS                900         // Prints task stats (only debugging; needs modification of platformio.ini (https://forum.espuino.de/t/rfid-mit-oder-ohne-task/353/21))
+    #define PRINT_SPECTRUM_STATS            905         // Prints spectrum's CPU-load and levels (only debugging)
+    #define PRINT_WEBSOCKET_STATS           907         // Prints websocket-events, -frames and -bytes per second (only debugging)
+    #define PRINT_NVS_EXPORT_STATS          908         // Benchmarks export of RFID-assignments: NVS-iterator vs. reading all pages of partition (only debugging)
 #endif
\ No newline at end of file
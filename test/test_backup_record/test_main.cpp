@@ -0,0 +1,92 @@
+#include <unity.h>
+#include <string.h>
+#include "BackupRecord.h"
+
+void setUp(void) {}
+void tearDown(void) {}
+
+static bool parse(const char *_record, char **_key, char **_value) {
+    static char line[400];
+    strncpy(line, _record, sizeof(line) - 1);
+    line[sizeof(line) - 1] = '\0';
+    return BackupRecord_Parse(line, _key, _value);
+}
+
+void test_assignment_is_split_into_key_and_value(void) {
+    char *key, *value;
+    TEST_ASSERT_TRUE(parse("^123456789012^#/mp3/Hörspiel#0#3#0#100", &key, &value));
+    TEST_ASSERT_EQUAL_STRING("123456789012", key);
+    TEST_ASSERT_EQUAL_STRING("#/mp3/Hörspiel#0#3#0#100", value);
+}
+
+void test_removal_has_no_value(void) {
+    char *key, *value;
+    TEST_ASSERT_TRUE(parse("^123456789012", &key, &value));
+    TEST_ASSERT_EQUAL_STRING("123456789012", key);
+    TEST_ASSERT_NULL(value);
+}
+
+void test_invalid_records_are_rejected(void) {
+    char *key, *value;
+    TEST_ASSERT_FALSE(parse("", &key, &value));
+    TEST_ASSERT_FALSE(parse("123^#/mp3", &key, &value));               // Leading delimiter is missing
+    TEST_ASSERT_FALSE(parse("^", &key, &value));                       // Empty key
+    TEST_ASSERT_FALSE(parse("^^#/mp3", &key, &value));
+    TEST_ASSERT_FALSE(parse("^12a4^#/mp3", &key, &value));             // Key isn't an RFID-id
+    TEST_ASSERT_FALSE(parse("^1234567890123456^#/mp3", &key, &value)); // Key is longer than NVS allows
+    TEST_ASSERT_FALSE(parse("^123^/mp3", &key, &value));               // Value doesn't start with stringDelimiter
+    TEST_ASSERT_FALSE(parse("^123^#/mp3^#/other", &key, &value));      // Delimiter within value
+    TEST_ASSERT_FALSE(parse("^123^", &key, &value));                   // Empty value
+}
+
+void test_limits_of_key_and_value(void) {
+    char record[BACKUPRECORD_VALUE_MAX + 32];
+    char *key, *value;
+    memset(record, 0, sizeof(record));
+    strcpy(record, "^123456789012345^#");
+    memset(record + strlen(record), 'x', BACKUPRECORD_VALUE_MAX - 1);
+    TEST_ASSERT_TRUE(parse(record, &key, &value));
+    TEST_ASSERT_EQUAL_UINT32(BACKUPRECORD_KEY_MAX, strlen(key));
+    TEST_ASSERT_EQUAL_UINT32(BACKUPRECORD_VALUE_MAX, strlen(value));
+
+    strcat(record, "x");
+    TEST_ASSERT_FALSE(parse(record, &key, &value));
+}
+
+void test_format_and_parse_round_trip(void) {
+    const char *keys[] = {"1", "987654321", "123456789012345"};
+    const char *values[] = {"#/mp3/Track 1.mp3#0#1#0#100", "#http://radio.example/stream#0#8#0#100", NULL};
+    for (unsigned int i = 0; i < sizeof(keys) / sizeof(keys[0]); i++) {
+        char line[400];
+        const size_t length = BackupRecord_Format(line, sizeof(line), keys[i], values[i]);
+        TEST_ASSERT_EQUAL_UINT32(strlen(line), length);
+        TEST_ASSERT_EQUAL_INT('\n', line[length - 1]);
+
+        line[length - 1] = '\0';
+        char *key, *value;
+        TEST_ASSERT_TRUE(BackupRecord_Parse(line, &key, &value));
+        TEST_ASSERT_EQUAL_STRING(keys[i], key);
+        if (values[i]) {
+            TEST_ASSERT_EQUAL_STRING(values[i], value);
+        } else {
+            TEST_ASSERT_NULL(value);
+        }
+    }
+}
+
+void test_format_reports_truncation(void) {
+    char line[8];
+    TEST_ASSERT_TRUE(BackupRecord_Format(line, sizeof(line), "123456", "#/mp3") >= sizeof(line));
+    TEST_ASSERT_EQUAL_STRING("^123456", line);
+}
+
+int main(void) {
+    UNITY_BEGIN();
+    RUN_TEST(test_assignment_is_split_into_key_and_value);
+    RUN_TEST(test_removal_has_no_value);
+    RUN_TEST(test_invalid_records_are_rejected);
+    RUN_TEST(test_limits_of_key_and_value);
+    RUN_TEST(test_format_and_parse_round_trip);
+    RUN_TEST(test_format_reports_truncation);
+    return UNITY_END();
+}
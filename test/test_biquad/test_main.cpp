@@ -0,0 +1,153 @@
+#include <unity.h>
+#include <math.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include "values.h"
+#include "Biquad.h"
+
+#define SAMPLE_RATE                     44100u
+
+static volatile int32_t benchmarkSink;          // Keeps the compiler from dropping benchmarked work
+
+void setUp(void) {}
+void tearDown(void) {}
+
+// Magnitude (in dB) of the quantized filter-cascade at _frequency
+static double magnitudeDb(const biquadCoefficients *_coefficients, const uint8_t _count, const double _frequency) {
+    const double scale = 1.0 / (1 << BIQUAD_COEF_SHIFT);
+    const double w = 2.0 * M_PI * _frequency / SAMPLE_RATE;
+    double magnitude = 1.0;
+    for (uint8_t i = 0; i < _count; i++) {
+        const biquadCoefficients *c = &_coefficients[i];
+        const double numRe = c->b0 * scale + c->b1 * scale * cos(w) + c->b2 * scale * cos(2 * w);
+        const double numIm = -(c->b1 * scale * sin(w) + c->b2 * scale * sin(2 * w));
+        const double denRe = 1.0 + c->a1 * scale * cos(w) + c->a2 * scale * cos(2 * w);
+        const double denIm = -(c->a1 * scale * sin(w) + c->a2 * scale * sin(2 * w));
+        magnitude *= sqrt((numRe * numRe + numIm * numIm) / (denRe * denRe + denIm * denIm));
+    }
+    return 20.0 * log10(magnitude);
+}
+
+// Runs a sine (24 bit) through the cascade and returns the gain (in dB) after settling
+static double measureGainDb(const biquadCoefficients *_coefficients, const uint8_t _count, const double _frequency) {
+    biquadState state[4];
+    memset(state, 0, sizeof(state));
+    const double amplitude = 1 << 20;
+    double peak = 0.0;
+    for (uint32_t n = 0; n < SAMPLE_RATE; n++) {
+        const int32_t x = (int32_t) lround(amplitude * sin(2.0 * M_PI * _frequency * n / SAMPLE_RATE));
+        const int32_t y = Biquad_Run(x, _coefficients, state, _count);
+        if (n >= SAMPLE_RATE / 2) {
+            peak = fmax(peak, fabs((double) y));
+        }
+    }
+    return 20.0 * log10(peak / amplitude);
+}
+
+void test_peak_has_its_gain_at_center_frequency(void) {
+    biquadCoefficients c;
+    TEST_ASSERT_TRUE(Biquad_Design(EQ_FILTER_PEAK, 1000.0f, 1.0f, 6.0f, SAMPLE_RATE, &c));
+    TEST_ASSERT_DOUBLE_WITHIN(0.01, 6.0, magnitudeDb(&c, 1, 1000.0));
+    TEST_ASSERT_DOUBLE_WITHIN(0.1, 0.0, magnitudeDb(&c, 1, 20.0));
+    TEST_ASSERT_DOUBLE_WITHIN(0.1, 0.0, magnitudeDb(&c, 1, 20000.0));
+}
+
+void test_highpass_and_lowpass_are_3db_down_at_cutoff(void) {
+    biquadCoefficients c;
+    TEST_ASSERT_TRUE(Biquad_Design(EQ_FILTER_HIGHPASS, 120.0f, 0.7071f, 0.0f, SAMPLE_RATE, &c));
+    TEST_ASSERT_DOUBLE_WITHIN(0.05, -3.01, magnitudeDb(&c, 1, 120.0));
+    TEST_ASSERT_LESS_THAN(-30.0, magnitudeDb(&c, 1, 20.0));
+    TEST_ASSERT_DOUBLE_WITHIN(0.01, 0.0, magnitudeDb(&c, 1, 10000.0));
+
+    TEST_ASSERT_TRUE(Biquad_Design(EQ_FILTER_LOWPASS, 5000.0f, 0.7071f, 0.0f, SAMPLE_RATE, &c));
+    TEST_ASSERT_DOUBLE_WITHIN(0.05, -3.01, magnitudeDb(&c, 1, 5000.0));
+    TEST_ASSERT_DOUBLE_WITHIN(0.01, 0.0, magnitudeDb(&c, 1, 50.0));
+}
+
+void test_shelves_reach_their_gain(void) {
+    biquadCoefficients c;
+    TEST_ASSERT_TRUE(Biquad_Design(EQ_FILTER_LOWSHELF, 200.0f, 0.7071f, -6.0f, SAMPLE_RATE, &c));
+    TEST_ASSERT_DOUBLE_WITHIN(0.05, -6.0, magnitudeDb(&c, 1, 10.0));
+    TEST_ASSERT_DOUBLE_WITHIN(0.05, 0.0, magnitudeDb(&c, 1, 15000.0));
+
+    TEST_ASSERT_TRUE(Biquad_Design(EQ_FILTER_HIGHSHELF, 4000.0f, 0.7071f, 4.0f, SAMPLE_RATE, &c));
+    TEST_ASSERT_DOUBLE_WITHIN(0.1, 4.0, magnitudeDb(&c, 1, 20000.0));
+    TEST_ASSERT_DOUBLE_WITHIN(0.05, 0.0, magnitudeDb(&c, 1, 50.0));
+}
+
+void test_invalid_filters_are_rejected(void) {
+    biquadCoefficients c;
+    TEST_ASSERT_FALSE(Biquad_Design(EQ_FILTER_PEAK, 0.0f, 1.0f, 3.0f, SAMPLE_RATE, &c));
+    TEST_ASSERT_FALSE(Biquad_Design(EQ_FILTER_PEAK, SAMPLE_RATE / 2.0f, 1.0f, 3.0f, SAMPLE_RATE, &c));
+    TEST_ASSERT_FALSE(Biquad_Design(EQ_FILTER_PEAK, 1000.0f, 0.0f, 3.0f, SAMPLE_RATE, &c));
+    TEST_ASSERT_FALSE(Biquad_Design(EQ_FILTER_NONE, 1000.0f, 1.0f, 3.0f, SAMPLE_RATE, &c));
+    TEST_ASSERT_FALSE(Biquad_Design(EQ_FILTER_HIGHSHELF, 1000.0f, 1.0f, 30.0f, SAMPLE_RATE, &c));    // Coefficients exceed Q4.28
+}
+
+// Fixed-point processing matches the designed response (default speaker-curve of settings.h)
+void test_cascade_in_fixed_point_matches_response(void) {
+    biquadCoefficients c[3];
+    TEST_ASSERT_TRUE(Biquad_Design(EQ_FILTER_HIGHPASS, 120.0f, 0.707f, 0.0f, SAMPLE_RATE, &c[0]));
+    TEST_ASSERT_TRUE(Biquad_Design(EQ_FILTER_PEAK, 250.0f, 1.0f, 3.0f, SAMPLE_RATE, &c[1]));
+    TEST_ASSERT_TRUE(Biquad_Design(EQ_FILTER_PEAK, 3500.0f, 1.5f, -2.0f, SAMPLE_RATE, &c[2]));
+
+    const double frequencies[] = {60.0, 250.0, 1000.0, 3500.0, 10000.0};
+    for (uint8_t i = 0; i < sizeof(frequencies) / sizeof(frequencies[0]); i++) {
+        TEST_ASSERT_DOUBLE_WITHIN(0.05, magnitudeDb(c, 3, frequencies[i]), measureGainDb(c, 3, frequencies[i]));
+    }
+}
+
+// Silence stays silent (no limit-cycles) and DC is removed by a highpass
+void test_highpass_removes_dc(void) {
+    biquadCoefficients c;
+    biquadState state;
+    memset(&state, 0, sizeof(state));
+    TEST_ASSERT_TRUE(Biquad_Design(EQ_FILTER_HIGHPASS, 38.14f, 0.5003f, 0.0f, SAMPLE_RATE, &c));
+    int32_t y = 0;
+    for (uint32_t n = 0; n < SAMPLE_RATE; n++) {
+        y = Biquad_Run(1 << 22, &c, &state, 1);
+    }
+    TEST_ASSERT_INT_WITHIN(1, 0, y);
+    for (uint32_t n = 0; n < SAMPLE_RATE; n++) {
+        y = Biquad_Run(0, &c, &state, 1);
+    }
+    TEST_ASSERT_INT_WITHIN(1, 0, y);
+}
+
+// Host benchmark: CPU-time per second of stereo-audio for cascades of 1..6 biquads (max. of AudioDsp). Absolute numbers depend
+// on the host; they're meant for comparing variants. Only asserts that processing is faster than real-time.
+void test_benchmark(void) {
+    biquadCoefficients c[6];
+    for (uint8_t i = 0; i < 6; i++) {
+        TEST_ASSERT_TRUE(Biquad_Design(EQ_FILTER_PEAK, 100.0f * (i + 1), 1.0f, 3.0f, SAMPLE_RATE, &c[i]));
+    }
+    const uint32_t seconds = 10;
+    for (uint8_t count = 1; count <= 6; count++) {
+        biquadState state[2][6];
+        memset(state, 0, sizeof(state));
+        int32_t sink = 0;
+        const clock_t start = clock();
+        for (uint32_t n = 0; n < seconds * SAMPLE_RATE; n++) {
+            const int32_t x = (int32_t) ((n * 2654435761u) >> 8) - (1 << 23);     // 24 bit noise
+            sink ^= Biquad_Run(x, c, state[0], count);
+            sink ^= Biquad_Run(-x, c, state[1], count);
+        }
+        const double cpuSeconds = (double) (clock() - start) / CLOCKS_PER_SEC;
+        benchmarkSink = sink;
+        printf("Biquad: %u filter(s), %.3f ms CPU per s of stereo-audio @ %u Hz\n", count, cpuSeconds * 1000.0 / seconds, SAMPLE_RATE);
+        TEST_ASSERT_LESS_THAN((double) seconds, cpuSeconds);
+    }
+}
+
+int main(void) {
+    UNITY_BEGIN();
+    RUN_TEST(test_peak_has_its_gain_at_center_frequency);
+    RUN_TEST(test_highpass_and_lowpass_are_3db_down_at_cutoff);
+    RUN_TEST(test_shelves_reach_their_gain);
+    RUN_TEST(test_invalid_filters_are_rejected);
+    RUN_TEST(test_cascade_in_fixed_point_matches_response);
+    RUN_TEST(test_highpass_removes_dc);
+    RUN_TEST(test_benchmark);
+    return UNITY_END();
+}
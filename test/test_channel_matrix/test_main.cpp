@@ -0,0 +1,189 @@
+#include <unity.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include "ChannelMatrix.h"
+
+#define SAMPLE_RATE                     44100u
+#define BLOCK_FRAMES                    512u    // Frames per block (e.g. PcmPlayer)
+
+static channelMatrixState state;
+static volatile uint32_t benchmarkSink;         // Keeps the compiler from dropping benchmarked work
+
+void setUp(void) {
+    memset(&state, 0, sizeof(state));
+}
+
+void tearDown(void) {}
+
+static uint32_t frame(const int16_t _left, const int16_t _right) {
+    return ((uint32_t) (uint16_t) _right << 16) | (uint16_t) _left;
+}
+
+static int16_t left(const uint32_t _frame) {
+    return (int16_t) (_frame & 0xFFFF);
+}
+
+static int16_t right(const uint32_t _frame) {
+    return (int16_t) (_frame >> 16);
+}
+
+void test_default_is_identity(void) {
+    ChannelMatrix_SetTarget(&state, false, false, 0, 0.0f, 0.0f, 0);
+    TEST_ASSERT_TRUE(state.identity);
+    TEST_ASSERT_TRUE(ChannelMatrix_IsIdentity(state.weight));
+
+    uint32_t frames[] = {frame(1234, -4321), frame(32767, -32768), frame(-1, 1)};
+    const uint32_t reference[] = {frame(1234, -4321), frame(32767, -32768), frame(-1, 1)};
+    ChannelMatrix_Run(&state, frames, 3);
+    TEST_ASSERT_EQUAL_MEMORY(reference, frames, sizeof(frames));
+}
+
+// Same result as audio-lib's forceMono() ((left + right) / 2) except for rounding
+void test_mono_is_mean_of_both_channels(void) {
+    ChannelMatrix_SetTarget(&state, true, false, 0, 0.0f, 0.0f, 0);
+    TEST_ASSERT_FALSE(state.identity);
+
+    uint32_t frames[] = {frame(1000, 3000), frame(32767, 32767), frame(-32768, -32768), frame(32767, -32768)};
+    ChannelMatrix_Run(&state, frames, 4);
+    TEST_ASSERT_EQUAL_INT16(2000, left(frames[0]));
+    TEST_ASSERT_EQUAL_INT16(2000, right(frames[0]));
+    TEST_ASSERT_EQUAL_INT16(32767, left(frames[1]));      // Weights of a row sum up to 1 => no clipping
+    TEST_ASSERT_EQUAL_INT16(-32768, right(frames[2]));
+    TEST_ASSERT_INT_WITHIN(1, 0, left(frames[3]));
+}
+
+void test_swap_exchanges_channels(void) {
+    ChannelMatrix_SetTarget(&state, false, true, 0, 0.0f, 0.0f, 0);
+    uint32_t frames[] = {frame(100, -200)};
+    ChannelMatrix_Run(&state, frames, 1);
+    TEST_ASSERT_EQUAL_INT16(-200, left(frames[0]));
+    TEST_ASSERT_EQUAL_INT16(100, right(frames[0]));
+}
+
+void test_balance_attenuates_opposite_channel(void) {
+    ChannelMatrix_SetTarget(&state, false, false, 50, 0.0f, 0.0f, 0);
+    TEST_ASSERT_EQUAL_INT16(CHANNELMATRIX_UNITY / 2, state.weight[CHANNELMATRIX_LL]);
+    TEST_ASSERT_EQUAL_INT16(CHANNELMATRIX_UNITY, state.weight[CHANNELMATRIX_RR]);
+
+    ChannelMatrix_SetTarget(&state, false, false, -100, 0.0f, 0.0f, 0);
+    TEST_ASSERT_EQUAL_INT16(CHANNELMATRIX_UNITY, state.weight[CHANNELMATRIX_LL]);
+    TEST_ASSERT_EQUAL_INT16(0, state.weight[CHANNELMATRIX_RR]);
+
+    ChannelMatrix_SetTarget(&state, false, false, 127, 0.0f, 0.0f, 0);     // Limited to 100
+    TEST_ASSERT_EQUAL_INT16(0, state.weight[CHANNELMATRIX_LL]);
+}
+
+void test_trim_is_limited_to_0db(void) {
+    ChannelMatrix_SetTarget(&state, false, false, 0, -6.0206f, 6.0f, 0);
+    TEST_ASSERT_INT_WITHIN(1, CHANNELMATRIX_UNITY / 2, state.weight[CHANNELMATRIX_LL]);
+    TEST_ASSERT_EQUAL_INT16(CHANNELMATRIX_UNITY, state.weight[CHANNELMATRIX_RR]);
+}
+
+// Crossfade starts at the current matrix, moves monotonically and ends exactly at the target
+void test_ramp_reaches_target(void) {
+    const uint32_t rampFrames = 882;    // 20 ms @ 44.1 kHz
+    ChannelMatrix_SetTarget(&state, false, false, 0, 0.0f, 0.0f, 0);
+    ChannelMatrix_SetTarget(&state, true, false, 0, 0.0f, 0.0f, rampFrames);
+    TEST_ASSERT_FALSE(state.identity);
+
+    uint32_t frames[1000];
+    for (uint32_t i = 0; i < 1000; i++) {
+        frames[i] = frame(10000, 0);
+    }
+    ChannelMatrix_Run(&state, frames, 1000);
+
+    TEST_ASSERT_INT_WITHIN(20, 10000, left(frames[0]));
+    TEST_ASSERT_INT_WITHIN(20, 0, right(frames[0]));
+    for (uint32_t i = 1; i < 1000; i++) {
+        TEST_ASSERT_TRUE(left(frames[i]) <= left(frames[i - 1]));
+        TEST_ASSERT_TRUE(right(frames[i]) >= right(frames[i - 1]));
+    }
+    TEST_ASSERT_EQUAL_INT16(5000, left(frames[rampFrames - 1]));
+    TEST_ASSERT_EQUAL_INT16(5000, right(frames[999]));
+    TEST_ASSERT_EQUAL_MEMORY(state.target, state.weight, sizeof(state.weight));
+    TEST_ASSERT_EQUAL_UINT32(0, state.rampFrames);
+}
+
+// Ramp back to identity ends in pass-through
+void test_ramp_to_identity_ends_in_bypass(void) {
+    ChannelMatrix_SetTarget(&state, true, false, 0, 0.0f, 0.0f, 0);
+    ChannelMatrix_SetTarget(&state, false, false, 0, 0.0f, 0.0f, 100);
+    TEST_ASSERT_FALSE(state.identity);
+
+    uint32_t frames[64];
+    memset(frames, 0, sizeof(frames));
+    ChannelMatrix_Run(&state, frames, 64);
+    TEST_ASSERT_FALSE(state.identity);
+    ChannelMatrix_Run(&state, frames, 64);
+    TEST_ASSERT_TRUE(state.identity);
+}
+
+// Mono-path of audio-lib (forceMono() in Audio::playSample()) that is replaced by the matrix: integer-mean, truncated
+static void libForceMono(int16_t *_sample) {
+    const int32_t xy = (_sample[1] + _sample[0]) / 2;
+    _sample[1] = (int16_t) xy;
+    _sample[0] = (int16_t) xy;
+}
+
+// Host benchmark: CPU-time per second of stereo-audio for mono-downmix by audio-lib vs. the matrix per frame (as called by
+// audio-lib's callback) and per block. Absolute numbers depend on the host; they're meant for comparing variants.
+// Result differs from audio-lib's only by rounding (max. 1 LSB).
+void test_benchmark(void) {
+    static uint32_t signal[SAMPLE_RATE];
+    for (uint32_t n = 0; n < SAMPLE_RATE; n++) {
+        signal[n] = n * 2654435761u;                // Noise in both channels
+    }
+    static uint32_t frames[SAMPLE_RATE];
+    ChannelMatrix_SetTarget(&state, true, false, 0, 0.0f, 0.0f, 0);
+
+    const uint32_t seconds = 10;
+    const char *names[] = {"audio-lib forceMono()", "matrix per frame", "matrix per block"};
+    for (uint8_t variant = 0; variant < 3; variant++) {
+        double cpuSeconds = 0.0;
+        uint32_t sink = 0;
+        for (uint32_t s = 0; s < seconds; s++) {
+            memcpy(frames, signal, sizeof(frames));
+            const clock_t start = clock();
+            if (variant == 0) {
+                for (uint32_t n = 0; n < SAMPLE_RATE; n++) {
+                    libForceMono((int16_t *) &frames[n]);
+                }
+            } else if (variant == 1) {
+                for (uint32_t n = 0; n < SAMPLE_RATE; n++) {
+                    ChannelMatrix_Run(&state, &frames[n], 1);
+                }
+            } else {
+                for (uint32_t n = 0; n < SAMPLE_RATE; n += BLOCK_FRAMES) {
+                    ChannelMatrix_Run(&state, &frames[n], (SAMPLE_RATE - n < BLOCK_FRAMES) ? SAMPLE_RATE - n : BLOCK_FRAMES);
+                }
+            }
+            cpuSeconds += (double) (clock() - start) / CLOCKS_PER_SEC;
+            sink ^= frames[s];
+        }
+        benchmarkSink = sink;
+        printf("ChannelMatrix: %s, %.3f ms CPU per s of stereo-audio @ %u Hz\n", names[variant], cpuSeconds * 1000.0 / seconds, SAMPLE_RATE);
+        TEST_ASSERT_LESS_THAN((double) seconds, cpuSeconds);
+
+        for (uint32_t n = 0; n < SAMPLE_RATE; n++) {
+            int16_t reference[2];
+            memcpy(reference, &signal[n], sizeof(reference));
+            libForceMono(reference);
+            TEST_ASSERT_INT_WITHIN(1, reference[0], left(frames[n]));
+            TEST_ASSERT_INT_WITHIN(1, reference[1], right(frames[n]));
+        }
+    }
+}
+
+int main(void) {
+    UNITY_BEGIN();
+    RUN_TEST(test_default_is_identity);
+    RUN_TEST(test_mono_is_mean_of_both_channels);
+    RUN_TEST(test_swap_exchanges_channels);
+    RUN_TEST(test_balance_attenuates_opposite_channel);
+    RUN_TEST(test_trim_is_limited_to_0db);
+    RUN_TEST(test_ramp_reaches_target);
+    RUN_TEST(test_ramp_to_identity_ends_in_bypass);
+    RUN_TEST(test_benchmark);
+    return UNITY_END();
+}
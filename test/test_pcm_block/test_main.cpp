@@ -0,0 +1,99 @@
+#include <unity.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include "ChannelMatrix.h"
+#include "PcmBlock.h"
+
+#define SAMPLE_RATE                     44100u
+#define BLOCK_FRAMES                    1024u   // Default of pcmFastPathBlockSize (4096 bytes)
+
+static uint32_t buffer[BLOCK_FRAMES];
+static channelMatrixState state;
+static volatile uint32_t benchmarkSink;         // Keeps the compiler from dropping benchmarked work
+
+void setUp(void) {
+    memset(&state, 0, sizeof(state));
+}
+
+void tearDown(void) {}
+
+static int16_t left(const uint32_t _frame) {
+    return (int16_t) (_frame & 0xFFFF);
+}
+
+static int16_t right(const uint32_t _frame) {
+    return (int16_t) (_frame >> 16);
+}
+
+void test_mono_is_expanded_in_place(void) {
+    int16_t *samples = (int16_t *) buffer;
+    for (uint32_t i = 0; i < BLOCK_FRAMES; i++) {
+        samples[i] = (int16_t) (i * 64 - 32768);
+    }
+    PcmBlock_ExpandMono(buffer, BLOCK_FRAMES);
+    for (uint32_t i = 0; i < BLOCK_FRAMES; i++) {
+        TEST_ASSERT_EQUAL_INT16((int16_t) (i * 64 - 32768), left(buffer[i]));
+        TEST_ASSERT_EQUAL_INT16((int16_t) (i * 64 - 32768), right(buffer[i]));
+    }
+}
+
+// Per-sample chain like audio-lib's: every frame is built from the decoded samples and passed through a callback
+// (audio_process_i2s()) to the processing-stages one by one
+typedef void (*frameCallback)(uint32_t *_frame);
+
+static void processFrame(uint32_t *_frame) {
+    ChannelMatrix_Run(&state, _frame, 1);
+}
+
+static frameCallback volatile callback = processFrame;
+
+// Host benchmark: CPU-time per second of a mono WAV-file (routed to stereo with mono-downmix enabled) for the fast path
+// (in-place expansion and routing per block) vs. the per-sample chain. Power can't be measured on the host; CPU-time
+// is its proxy (refer audio-stats on the device). Absolute numbers depend on the host; they're meant for comparing variants.
+void test_benchmark(void) {
+    static int16_t source[SAMPLE_RATE];
+    for (uint32_t n = 0; n < SAMPLE_RATE; n++) {
+        source[n] = (int16_t) ((n * 2654435761u) >> 16);
+    }
+    ChannelMatrix_SetTarget(&state, true, false, 0, 0.0f, 0.0f, 0);
+
+    const uint32_t seconds = 10;
+    const char *names[] = {"per-sample chain", "block path"};
+    uint32_t checksum[2] = {0, 0};
+    for (uint8_t variant = 0; variant < 2; variant++) {
+        uint32_t sink = 0;
+        const clock_t start = clock();
+        for (uint32_t s = 0; s < seconds; s++) {
+            for (uint32_t n = 0; n < SAMPLE_RATE; n += BLOCK_FRAMES) {
+                const uint32_t numberOfFrames = (SAMPLE_RATE - n < BLOCK_FRAMES) ? SAMPLE_RATE - n : BLOCK_FRAMES;
+                if (variant == 0) {
+                    for (uint32_t i = 0; i < numberOfFrames; i++) {
+                        const uint16_t sample = source[n + i];
+                        uint32_t frame = ((uint32_t) sample << 16) | sample;
+                        callback(&frame);
+                        buffer[i] = frame;
+                    }
+                } else {
+                    memcpy(buffer, &source[n], numberOfFrames * sizeof(int16_t));      // Like reading the file into the buffer
+                    PcmBlock_ExpandMono(buffer, numberOfFrames);
+                    ChannelMatrix_Run(&state, buffer, numberOfFrames);
+                }
+                sink += buffer[numberOfFrames - 1];
+            }
+        }
+        const double cpuSeconds = (double) (clock() - start) / CLOCKS_PER_SEC;
+        benchmarkSink = sink;
+        checksum[variant] = sink;
+        printf("PCM: %s, %.3f ms CPU per s of mono-audio @ %u Hz\n", names[variant], cpuSeconds * 1000.0 / seconds, SAMPLE_RATE);
+        TEST_ASSERT_LESS_THAN((double) seconds, cpuSeconds);
+    }
+    TEST_ASSERT_EQUAL_UINT32(checksum[0], checksum[1]);     // Both paths output the same frames
+}
+
+int main(void) {
+    UNITY_BEGIN();
+    RUN_TEST(test_mono_is_expanded_in_place);
+    RUN_TEST(test_benchmark);
+    return UNITY_END();
+}
@@ -0,0 +1,170 @@
+#include <unity.h>
+#include <math.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include "ResamplerFilter.h"
+
+#define TAPS                            16u     // Default of settings.h
+#define CUTOFF                          0.9f
+
+static int16_t coefficients[(RESAMPLER_PHASES + 1) * TAPS];
+static volatile uint32_t benchmarkSink;         // Keeps the compiler from dropping benchmarked work
+
+void setUp(void) {}
+void tearDown(void) {}
+
+// Feeds mono-input (as stereo-frames) through the filter and collects the left channel of the output
+static uint32_t resample(const int16_t *_input, const uint32_t _numberOfInputFrames, const uint32_t _inputRate, const uint32_t _outputRate, int16_t *_output, const uint32_t _maxOutputFrames) {
+    static resamplerFilterState state;
+    ResamplerFilter_Start(&state, coefficients, TAPS, _inputRate, _outputRate);
+    uint32_t numberOfOutputFrames = 0;
+
+    for (uint32_t n = 0; n < _numberOfInputFrames; n++) {
+        uint32_t output[8];
+        const uint8_t numberOfFrames = ResamplerFilter_Push(&state, ((uint32_t) (uint16_t) _input[n] << 16) | (uint16_t) _input[n], output, 8);
+        for (uint8_t i = 0; i < numberOfFrames && numberOfOutputFrames < _maxOutputFrames; i++) {
+            TEST_ASSERT_EQUAL_UINT32(output[i] >> 16, output[i] & 0xFFFF);     // Both channels are filtered alike
+            _output[numberOfOutputFrames++] = (int16_t) (output[i] & 0xFFFF);
+        }
+    }
+    return numberOfOutputFrames;
+}
+
+// Fundamental is fitted by least squares (a * sin + b * cos); everything else is THD+N (in dB)
+static double thdN(const int16_t *_output, const uint32_t _first, const uint32_t _last, const double _frequency, const uint32_t _rate) {
+    double ys = 0.0, yc = 0.0, yy = 0.0, ss = 0.0, cc = 0.0, sc = 0.0;
+    for (uint32_t n = _first; n < _last; n++) {
+        const double s = sin(2.0 * M_PI * _frequency * n / _rate);
+        const double c = cos(2.0 * M_PI * _frequency * n / _rate);
+        ys += _output[n] * s;
+        yc += _output[n] * c;
+        yy += (double) _output[n] * _output[n];
+        ss += s * s;
+        cc += c * c;
+        sc += s * c;
+    }
+    const double det = ss * cc - sc * sc;
+    const double a = (ys * cc - yc * sc) / det;
+    const double b = (yc * ss - ys * sc) / det;
+    const double fundamentalEnergy = a * ys + b * yc;
+    return 10.0 * log10(fmax(yy - fundamentalEnergy, 1e-9) / fundamentalEnergy);
+}
+
+static double resampleSine(const uint32_t _inputRate, const uint32_t _outputRate, const double _frequency, double *_amplitude) {
+    static int16_t input[9600];
+    static int16_t output[9600 * 2];
+    const uint32_t numberOfInputFrames = _inputRate / 10;
+    for (uint32_t n = 0; n < numberOfInputFrames; n++) {
+        input[n] = (int16_t) lround(16000.0 * sin(2.0 * M_PI * _frequency * n / _inputRate));
+    }
+    const uint32_t numberOfOutputFrames = resample(input, numberOfInputFrames, _inputRate, _outputRate, output, sizeof(output) / sizeof(output[0]));
+    TEST_ASSERT_UINT32_WITHIN(1, (uint64_t) numberOfInputFrames * _outputRate / _inputRate, numberOfOutputFrames);
+
+    uint32_t skip = TAPS * _outputRate / _inputRate + 1;    // Settling of the filter
+    int16_t peak = 0;
+    for (uint32_t n = skip; n < numberOfOutputFrames; n++) {
+        peak = output[n] > peak ? output[n] : peak;
+    }
+    *_amplitude = peak;
+    return thdN(output, skip, numberOfOutputFrames, _frequency, _outputRate);
+}
+
+// Every phase has unity-gain at DC (no modulation of constant signals)
+void test_dc_passes_every_phase_unchanged(void) {
+    ResamplerFilter_Design(coefficients, TAPS, CUTOFF * 44100.0f / 48000.0f);
+    for (uint32_t p = 0; p <= RESAMPLER_PHASES; p++) {
+        int32_t sum = 0;
+        for (uint8_t i = 0; i < TAPS; i++) {
+            sum += coefficients[p * TAPS + i];
+        }
+        TEST_ASSERT_INT_WITHIN(TAPS / 2, 1 << RESAMPLER_COEF_SHIFT, sum);
+    }
+
+    int16_t history[TAPS];
+    for (uint8_t i = 0; i < TAPS; i++) {
+        history[i] = 20000;
+    }
+    for (uint32_t fraction = 0; fraction < (1u << RESAMPLER_POSITION_SHIFT); fraction += 97) {
+        TEST_ASSERT_INT_WITHIN(20000 * (TAPS / 2) / (1 << RESAMPLER_COEF_SHIFT) + 2, 20000, ResamplerFilter_Run(history, coefficients, TAPS, fraction));   // Rounding of coefficients
+    }
+}
+
+// Phase 0 is a (windowed) sinc sampled at integers => it passes input-frames nearly unchanged
+void test_phase_zero_is_nearly_a_delay(void) {
+    ResamplerFilter_Design(coefficients, TAPS, 1.0f);
+    TEST_ASSERT_INT_WITHIN(1, 1 << RESAMPLER_COEF_SHIFT, coefficients[TAPS / 2]);
+    for (uint8_t i = 0; i < TAPS; i++) {
+        if (i != TAPS / 2) {
+            TEST_ASSERT_INT_WITHIN(1, 0, coefficients[i]);
+        }
+    }
+}
+
+void test_upsampling_44k1_to_48k_is_clean(void) {
+    ResamplerFilter_Design(coefficients, TAPS, CUTOFF);
+    double amplitude;
+    TEST_ASSERT_LESS_THAN(-60.0, resampleSine(44100, 48000, 1000.0, &amplitude));
+    TEST_ASSERT_DOUBLE_WITHIN(16000 * 0.01, 16000.0, amplitude);
+}
+
+void test_downsampling_48k_to_44k1_is_clean(void) {
+    ResamplerFilter_Design(coefficients, TAPS, CUTOFF * 44100.0f / 48000.0f);
+    double amplitude;
+    TEST_ASSERT_LESS_THAN(-60.0, resampleSine(48000, 44100, 1000.0, &amplitude));
+    TEST_ASSERT_DOUBLE_WITHIN(16000 * 0.01, 16000.0, amplitude);
+}
+
+// Tone above the output's Nyquist-frequency must not alias into the passband
+void test_downsampling_suppresses_aliasing(void) {
+    ResamplerFilter_Design(coefficients, TAPS, CUTOFF * 22050.0f / 48000.0f);
+    double amplitude;
+    resampleSine(48000, 22050, 15000.0, &amplitude);
+    TEST_ASSERT_LESS_THAN(16000 / 10, amplitude);     // At least -20 dB
+}
+
+void test_full_scale_is_clipped_instead_of_wrapped(void) {
+    ResamplerFilter_Design(coefficients, TAPS, CUTOFF);
+    int16_t history[TAPS];
+    for (uint8_t i = 0; i < TAPS; i++) {
+        history[i] = 32767;
+    }
+    for (uint32_t fraction = 0; fraction < (1u << RESAMPLER_POSITION_SHIFT); fraction += 97) {
+        TEST_ASSERT_GREATER_THAN(32700, ResamplerFilter_Run(history, coefficients, TAPS, fraction));     // Gain of some phases is slightly above 1
+    }
+}
+
+// Host benchmark: CPU-time per second of stereo-audio for common conversions. Absolute numbers depend on the host;
+// they're meant for comparing variants (e.g. number of taps). Only asserts that processing is faster than real-time.
+void test_benchmark(void) {
+    const uint32_t rates[][2] = {{44100, 48000}, {48000, 44100}, {22050, 44100}, {32000, 48000}};
+    const uint32_t seconds = 10;
+    for (uint8_t r = 0; r < sizeof(rates) / sizeof(rates[0]); r++) {
+        static resamplerFilterState state;
+        ResamplerFilter_Design(coefficients, TAPS, CUTOFF * (rates[r][0] > rates[r][1] ? (float) rates[r][1] / rates[r][0] : 1.0f));
+        ResamplerFilter_Start(&state, coefficients, TAPS, rates[r][0], rates[r][1]);
+        uint32_t sink = 0;
+        const clock_t start = clock();
+        for (uint32_t n = 0; n < seconds * rates[r][0]; n++) {
+            uint32_t output[8];
+            const uint8_t numberOfFrames = ResamplerFilter_Push(&state, n * 2654435761u, output, 8);
+            sink ^= numberOfFrames ? output[0] : 0;
+        }
+        const double cpuSeconds = (double) (clock() - start) / CLOCKS_PER_SEC;
+        benchmarkSink = sink;
+        printf("Resampler: %u taps, %u Hz => %u Hz, %.3f ms CPU per s of stereo-audio\n", TAPS, rates[r][0], rates[r][1], cpuSeconds * 1000.0 / seconds);
+        TEST_ASSERT_LESS_THAN((double) seconds, cpuSeconds);
+    }
+}
+
+int main(void) {
+    UNITY_BEGIN();
+    RUN_TEST(test_dc_passes_every_phase_unchanged);
+    RUN_TEST(test_phase_zero_is_nearly_a_delay);
+    RUN_TEST(test_upsampling_44k1_to_48k_is_clean);
+    RUN_TEST(test_downsampling_48k_to_44k1_is_clean);
+    RUN_TEST(test_downsampling_suppresses_aliasing);
+    RUN_TEST(test_full_scale_is_clipped_instead_of_wrapped);
+    RUN_TEST(test_benchmark);
+    return UNITY_END();
+}
@@ -0,0 +1,180 @@
+#include <unity.h>
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include "Wsola.h"
+
+#define SAMPLE_RATE                     44100u
+#define SEQUENCE_FRAMES                 (SAMPLE_RATE * 40u / 1000u)     // Defaults of settings.h
+#define SEEK_FRAMES                     (SAMPLE_RATE * 15u / 1000u)
+#define OVERLAP_FRAMES                  (SAMPLE_RATE * 8u / 1000u)
+#define MAX_OUTPUT_FRAMES               (4u * SAMPLE_RATE)
+
+static uint32_t input[WSOLA_INPUT_FRAMES(SEQUENCE_FRAMES, SEEK_FRAMES)];
+static uint32_t overlap[OVERLAP_FRAMES];
+static int16_t overlapMono[OVERLAP_FRAMES];
+static int16_t seekMono[SEEK_FRAMES + OVERLAP_FRAMES];
+static int16_t *output;
+static uint32_t outputFrames;
+static wsolaState state;
+static volatile uint32_t benchmarkSink;         // Keeps the compiler from dropping benchmarked work
+
+static void collect(const uint32_t _frame) {
+    if (outputFrames < MAX_OUTPUT_FRAMES) {
+        output[outputFrames] = (int16_t) (_frame & 0xFFFF);
+    }
+    outputFrames++;
+}
+
+static uint32_t frame(const int16_t _left, const int16_t _right) {
+    return ((uint32_t) (uint16_t) _right << 16) | (uint16_t) _left;
+}
+
+void setUp(void) {
+    state.input = input;
+    state.overlap = overlap;
+    state.overlapMono = overlapMono;
+    state.seekMono = seekMono;
+    state.output = collect;
+    outputFrames = 0;
+    Wsola_Start(&state, SEQUENCE_FRAMES, SEEK_FRAMES, OVERLAP_FRAMES);
+}
+
+void tearDown(void) {}
+
+static int16_t sine(const uint32_t _n, const double _frequency) {
+    return (int16_t) lround(12000.0 * sin(2.0 * M_PI * _frequency * _n / SAMPLE_RATE));
+}
+
+static void stretchSine(const uint8_t _speed, const uint32_t _numberOfInputFrames, const double _frequency) {
+    for (uint32_t n = 0; n < _numberOfInputFrames; n++) {
+        const int16_t y = sine(n, _frequency);
+        Wsola_Push(&state, frame(y, y), _speed);
+    }
+}
+
+void test_output_length_follows_speed(void) {
+    const uint8_t speeds[] = {50, 75, 125, 150, 200};
+    const uint32_t numberOfInputFrames = 2u * SAMPLE_RATE;
+    for (uint8_t s = 0; s < sizeof(speeds); s++) {
+        setUp();
+        stretchSine(speeds[s], numberOfInputFrames, 220.0);
+        TEST_ASSERT_TRUE(state.active);
+        const double expected = 100.0 / speeds[s];
+        TEST_ASSERT_DOUBLE_WITHIN(0.02 * expected, expected, (double) (outputFrames + state.inputFrames * 100u / speeds[s]) / numberOfInputFrames);
+    }
+}
+
+// Splices are placed where the waveform continues; so a pure tone stays a pure tone (no clicks)
+void test_splices_keep_waveform_continuous(void) {
+    const double frequency = 220.0;
+    stretchSine(150, 2u * SAMPLE_RATE, frequency);
+    TEST_ASSERT_GREATER_THAN(SAMPLE_RATE, outputFrames);
+
+    // Max. step between two frames of a sine is 2 * pi * f / fs * amplitude
+    const double maxStep = 2.0 * M_PI * frequency / SAMPLE_RATE * 12000.0;
+    for (uint32_t n = 1; n < outputFrames; n++) {
+        TEST_ASSERT_LESS_THAN(maxStep * 1.5 + 2.0, fabs((double) output[n] - output[n - 1]));
+    }
+
+    // Crossfading waveforms out of phase would cancel them; so amplitude of every period is checked as well
+    const uint32_t period = (uint32_t) (SAMPLE_RATE / frequency) + 1u;
+    for (uint32_t start = 0; start + period <= outputFrames; start += period / 2) {
+        int16_t peak = 0;
+        for (uint32_t n = start; n < start + period; n++) {
+            peak = output[n] > peak ? output[n] : peak;
+        }
+        TEST_ASSERT_GREATER_THAN(11500, peak);
+    }
+}
+
+// Pitch doesn't change: zero-crossings per second of output are the same as the input's
+void test_pitch_is_preserved(void) {
+    const double frequency = 440.0;
+    stretchSine(70, SAMPLE_RATE, frequency);
+    uint32_t crossings = 0;
+    for (uint32_t n = 1; n < outputFrames; n++) {
+        crossings += (output[n - 1] < 0 && output[n] >= 0);
+    }
+    TEST_ASSERT_DOUBLE_WITHIN(frequency * 0.02, frequency, (double) crossings * SAMPLE_RATE / outputFrames);
+}
+
+// First sequence continues pass-through without any gap
+void test_first_sequence_is_passed_unchanged(void) {
+    stretchSine(200, 2u * (SEQUENCE_FRAMES - OVERLAP_FRAMES) + 1u, 300.0);     // Skip of 200 % exceeds the search-window
+    TEST_ASSERT_EQUAL_UINT32(SEQUENCE_FRAMES - OVERLAP_FRAMES, outputFrames);
+    for (uint32_t n = 0; n < outputFrames; n++) {
+        TEST_ASSERT_EQUAL_INT16(sine(n, 300.0), output[n]);
+    }
+}
+
+// Back to normal speed: remaining input is output and processing stops at the next sequence-boundary
+void test_normal_speed_finishes(void) {
+    stretchSine(150, SAMPLE_RATE / 2, 220.0);
+    const uint32_t numberOfOutputFrames = outputFrames;
+    for (uint32_t n = 0; n < 2 * SEQUENCE_FRAMES + SEEK_FRAMES && state.active; n++) {
+        Wsola_Push(&state, frame(0, 0), WSOLA_SPEED_NORMAL);
+    }
+    TEST_ASSERT_FALSE(state.active);
+    TEST_ASSERT_EQUAL_UINT32(0, state.inputFrames);
+    TEST_ASSERT_GREATER_THAN(numberOfOutputFrames, outputFrames);
+}
+
+void test_channels_are_kept_apart(void) {
+    for (uint32_t n = 0; n < SAMPLE_RATE; n++) {
+        Wsola_Push(&state, frame(8000, -8000), 130);
+    }
+    // Crossfade of two constant frames is constant; so left stays 8000 (right isn't mixed into it)
+    for (uint32_t n = 0; n < outputFrames; n++) {
+        TEST_ASSERT_INT_WITHIN(1, 8000, output[n]);
+    }
+}
+
+static void discard(const uint32_t _frame) {
+    benchmarkSink = _frame;
+}
+
+// Host benchmark: CPU-time per second of stereo-audio (input) over the speed-range. Signal is speech-like (harmonics of a
+// gliding fundamental plus noise) so that seeking has to search. Absolute numbers depend on the host; they're meant for
+// comparing variants. Only asserts that processing is faster than real-time.
+void test_benchmark(void) {
+    static uint32_t signal[SAMPLE_RATE];
+    double phase = 0.0;
+    for (uint32_t n = 0; n < SAMPLE_RATE; n++) {
+        const double fundamental = 120.0 + 60.0 * sin(2.0 * M_PI * 2.0 * n / SAMPLE_RATE);
+        phase += 2.0 * M_PI * fundamental / SAMPLE_RATE;
+        const int16_t noise = (int16_t) ((n * 2654435761u) >> 22) - 512;
+        const int16_t y = (int16_t) (6000.0 * sin(phase) + 3000.0 * sin(2.0 * phase) + 1500.0 * sin(3.0 * phase)) + noise;
+        signal[n] = frame(y, y);
+    }
+
+    const uint8_t speeds[] = {50, 75, 100, 125, 150, 200};
+    const uint32_t seconds = 10;
+    for (uint8_t s = 0; s < sizeof(speeds); s++) {
+        setUp();
+        state.output = discard;
+        const clock_t start = clock();
+        for (uint32_t n = 0; n < seconds * SAMPLE_RATE; n++) {
+            Wsola_Push(&state, signal[n % SAMPLE_RATE], speeds[s]);
+        }
+        const double cpuSeconds = (double) (clock() - start) / CLOCKS_PER_SEC;
+        printf("WSOLA: %u %%, %.3f ms CPU per s of stereo-audio @ %u Hz\n", speeds[s], cpuSeconds * 1000.0 / seconds, SAMPLE_RATE);
+        TEST_ASSERT_LESS_THAN((double) seconds, cpuSeconds);
+    }
+}
+
+int main(void) {
+    output = (int16_t *) malloc(MAX_OUTPUT_FRAMES * sizeof(int16_t));
+    UNITY_BEGIN();
+    RUN_TEST(test_output_length_follows_speed);
+    RUN_TEST(test_splices_keep_waveform_continuous);
+    RUN_TEST(test_pitch_is_preserved);
+    RUN_TEST(test_first_sequence_is_passed_unchanged);
+    RUN_TEST(test_normal_speed_finishes);
+    RUN_TEST(test_channels_are_kept_apart);
+    RUN_TEST(test_benchmark);
+    const int result = UNITY_END();
+    free(output);
+    return result;
+}